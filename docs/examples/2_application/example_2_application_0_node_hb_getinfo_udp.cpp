@@ -185,8 +185,10 @@ TEST_F(Example_2_Application_0_NodeHeartbeatGetInfo_Udp, main)
         },
         {true});  // persist
     //
-    storage::KeyValue platform_storage("/tmp/org.opencyphal.ex_2_app_0");
-    load(platform_storage, rgy);
+    // Registers are persisted via write-behind storage, so that file I/O doesn't stall the executor thread.
+    storage::KeyValue            platform_storage("/tmp/org.opencyphal.ex_2_app_0");
+    storage::WriteBehindKeyValue write_behind_storage{platform_storage};
+    load(write_behind_storage, rgy);
 
     // 5. Main loop.
     //
@@ -207,7 +209,8 @@ TEST_F(Example_2_Application_0_NodeHeartbeatGetInfo_Udp, main)
         EXPECT_THAT(executor_.pollAwaitableResourcesFor(opt_timeout), testing::Eq(cetl::nullopt));
     }
 
-    save(platform_storage, rgy);
+    save(write_behind_storage, rgy);
+    EXPECT_THAT(write_behind_storage.flush(), Eq(cetl::nullopt));
 
     std::cout << "Done.\n-----------\nStats:\n";
     std::cout << "worst_callback_lateness  = " << worst_lateness.count() << " us\n";
@@ -23,8 +23,10 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <iterator>
 #include <string>
 #include <unistd.h>
@@ -138,6 +140,7 @@ public:
         , socket_can_tx_fd_{std::exchange(other.socket_can_tx_fd_, -1)}
         , iface_address_{other.iface_address_}
         , tx_mr_{other.tx_mr_}
+        , tx_frame_footprint_{other.tx_frame_footprint_}
     {
     }
     CanMedia* operator=(CanMedia&&) noexcept = delete;
@@ -216,10 +219,16 @@ private:
             return CanardFilter{filter.id, filter.mask};
         });
 
-        const std::int16_t result = ::socketcanFilter(socket_can_rx_fd_, can_filters.size(), can_filters.data());
-        if (result < 0)
+        // TX socket also receives frames (at least its own ones as TX confirmations - see `popTxLoopback`),
+        // so we apply the same filters to it as well - to avoid draining of unrelated bus traffic.
+        //
+        for (const SocketCANFD socket_can_fd : {socket_can_rx_fd_, socket_can_tx_fd_})
         {
-            return libcyphal::transport::PlatformError{posix::PosixPlatformError{-result}};
+            const std::int16_t result = ::socketcanFilter(socket_can_fd, can_filters.size(), can_filters.data());
+            if (result < 0)
+            {
+                return libcyphal::transport::PlatformError{posix::PosixPlatformError{-result}};
+            }
         }
         return cetl::nullopt;
     }
@@ -228,6 +237,9 @@ private:
                           const libcyphal::transport::can::CanId can_id,
                           libcyphal::transport::MediaPayload&    payload) noexcept override
     {
+        // Until we know how much kernel memory a single frame takes, try to learn it from a push to empty TX queue.
+        const bool is_learning = (tx_frame_footprint_ == 0) && (::socketcanGetTxQueueBytes(socket_can_tx_fd_) == 0);
+
         const CanardFrame  canard_frame{can_id, {payload.getSpan().size(), payload.getSpan().data()}};
         const std::int16_t result = ::socketcanPush(socket_can_tx_fd_, &canard_frame, 0);
         if (result < 0)
@@ -238,6 +250,12 @@ private:
         const bool is_accepted = result > 0;
         if (is_accepted)
         {
+            if (is_learning)
+            {
+                const std::int32_t queued_bytes = ::socketcanGetTxQueueBytes(socket_can_tx_fd_);
+                tx_frame_footprint_             = static_cast<std::size_t>(std::max<std::int32_t>(queued_bytes, 0));
+            }
+
             // Payload is not needed anymore, so return memory asap.
             payload.reset();
         }
@@ -245,14 +263,38 @@ private:
         return PushResult::Success{is_accepted};
     }
 
+    cetl::optional<std::size_t> getTxInFlightCount() const noexcept override
+    {
+        // The frame might have been already transmitted by the time we tried to learn its footprint -
+        // then we just can't tell, and so no limiting will be applied.
+        if (tx_frame_footprint_ == 0)
+        {
+            return cetl::nullopt;
+        }
+
+        const std::int32_t queued_bytes = ::socketcanGetTxQueueBytes(socket_can_tx_fd_);
+        if (queued_bytes < 0)
+        {
+            return cetl::nullopt;
+        }
+        return (static_cast<std::size_t>(queued_bytes) + tx_frame_footprint_ - 1U) / tx_frame_footprint_;
+    }
+
     CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
     {
-        CanardFrame canard_frame{};
-        bool        is_loopback{false};
+        // TX confirmations go first - the sooner they are popped, the sooner time sync (if any) could use them.
+        if (auto tx_loopback = popTxLoopback(payload_buffer))
+        {
+            return *tx_loopback;
+        }
+
+        CanardFrame       canard_frame{};
+        CanardMicrosecond timestamp_us{0};
+        bool              is_loopback{false};
 
         const std::int16_t result = ::socketcanPop(socket_can_rx_fd_,
                                                    &canard_frame,
-                                                   nullptr,
+                                                   &timestamp_us,
                                                    payload_buffer.size(),
                                                    payload_buffer.data(),
                                                    0,
@@ -266,7 +308,58 @@ private:
             return cetl::nullopt;
         }
 
-        return PopResult::Metadata{executor_.now(), canard_frame.extended_can_id, canard_frame.payload.size};
+        return PopResult::Metadata{toExecutorTime(timestamp_us),
+                                   canard_frame.extended_can_id,
+                                   canard_frame.payload.size};
+    }
+
+    /// Pops the next TX confirmation (aka loopback frame) of our own TX socket.
+    ///
+    /// The TX socket has `CAN_RAW_RECV_OWN_MSGS` enabled, so the kernel loops back each transmitted frame
+    /// (marked with `MSG_CONFIRM`) when it has actually left the interface. There is no separate executor
+    /// callback for the TX socket readability - our own frames are also received by the RX socket at the same time,
+    /// so the pop callback is triggered anyway. Other frames of the TX socket are skipped -
+    /// they are received (and handled) via the RX socket.
+    ///
+    CETL_NODISCARD cetl::optional<PopResult::Metadata> popTxLoopback(
+        const cetl::span<cetl::byte> payload_buffer) const noexcept
+    {
+        CanardFrame       canard_frame{};
+        CanardMicrosecond timestamp_us{0};
+        bool              is_loopback{false};
+
+        while (::socketcanPop(socket_can_tx_fd_,
+                              &canard_frame,
+                              &timestamp_us,
+                              payload_buffer.size(),
+                              payload_buffer.data(),
+                              0,
+                              &is_loopback) > 0)
+        {
+            if (is_loopback)
+            {
+                return PopResult::Metadata{toExecutorTime(timestamp_us),
+                                           canard_frame.extended_can_id,
+                                           canard_frame.payload.size,
+                                           true /* is_tx_loopback */};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    /// Converts a kernel timestamp (`SO_TIMESTAMP`, which is of the real-time clock) to the executor's clock.
+    ///
+    /// The conversion goes via age of the timestamp, so it's not affected by the executor latency -
+    /// only by the (sub-microsecond) distance between reading of the two clocks.
+    ///
+    libcyphal::TimePoint toExecutorTime(const CanardMicrosecond realtime_us) const
+    {
+        const auto realtime_now = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        const auto age =
+            realtime_now - std::chrono::microseconds{static_cast<std::chrono::microseconds::rep>(realtime_us)};
+
+        return executor_.now() - std::max(age, std::chrono::microseconds::zero());
     }
 
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerPushCallback(
@@ -296,6 +389,7 @@ private:
     SocketCANFD                 socket_can_tx_fd_;
     const std::string           iface_address_;
     cetl::pmr::memory_resource& tx_mr_;
+    std::size_t                 tx_frame_footprint_{0};
 
 };  // CanMedia
 
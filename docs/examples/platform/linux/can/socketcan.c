@@ -13,6 +13,7 @@
 #ifdef __linux__
 #    include <linux/can.h>
 #    include <linux/can/raw.h>
+#    include <linux/sockios.h>
 #    include <net/if.h>
 #    include <sys/ioctl.h>
 #    include <sys/socket.h>
@@ -165,6 +166,16 @@ int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const fram
     return poll_result;
 }
 
+int32_t socketcanGetTxQueueBytes(const SocketCANFD fd)
+{
+    int queued_bytes = 0;
+    if (ioctl(fd, SIOCOUTQ, &queued_bytes) < 0)
+    {
+        return getNegatedErrno();
+    }
+    return (int32_t) queued_bytes;
+}
+
 int16_t socketcanPop(const SocketCANFD        fd,
                      struct CanardFrame* const       out_frame,
                      CanardMicrosecond* const out_timestamp_usec,
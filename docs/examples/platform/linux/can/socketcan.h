@@ -55,6 +55,12 @@ SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd);
 /// Returns 1 on success, 0 on timeout, negated errno on error.
 int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const frame, const CanardMicrosecond timeout_usec);
 
+/// Get amount of memory held by not yet transmitted frames of the socket (aka `SIOCOUTQ`).
+/// It includes frames in the queuing discipline and in the driver FIFO, and it's accounted in the kernel memory units,
+/// i.e. includes per frame overhead. The frames are released once the driver reports completion of transmission.
+/// Returns the number of bytes (non-negative), or negated errno on error.
+int32_t socketcanGetTxQueueBytes(const SocketCANFD fd);
+
 /// Fetch a new extended CAN data frame from the RX queue.
 /// If the received frame is not an extended-ID data frame, it will be dropped and the function will return early.
 /// The payload pointer of the returned frame will point to the payload_buffer. It can be a stack-allocated array.
@@ -128,6 +128,11 @@ protected:
                 [&new_cb_node](const Trigger::Writable& writable) {
                     //
                     new_cb_node.setup(writable.fd, EPOLLOUT);
+                },
+                [&new_cb_node](const Trigger::Erroneous& erroneous) {
+                    //
+                    // `EPOLLERR` is always reported, so it's here just b/c the node needs some events.
+                    new_cb_node.setup(erroneous.fd, EPOLLERR);
                 }),
             trigger);
 
@@ -0,0 +1,388 @@
+/// This software is distributed under the terms of the MIT License.
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+// This is needed to enable the necessary declarations in sys/ (like `MAP_POPULATE`) and net/ (like `struct ifreq`).
+#ifndef _GNU_SOURCE
+#    define _GNU_SOURCE  // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+
+#include "xdp.h"
+
+#ifdef __linux__
+#    include <linux/if_xdp.h>
+#    include <arpa/inet.h>
+#    include <ifaddrs.h>
+#    include <net/if.h>
+#    include <net/if_arp.h>
+#    include <sys/ioctl.h>
+#    include <sys/mman.h>
+#    include <sys/socket.h>
+#else
+#    error "AF_XDP sockets are Linux specific."
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifndef AF_XDP
+#    define AF_XDP 44
+#endif
+#ifndef SOL_XDP
+#    define SOL_XDP 283
+#endif
+
+/// This is the value recommended by the Cyphal/UDP specification.
+#define OVERRIDE_TTL 16
+
+/// RFC 2474.
+#define DSCP_MAX 63
+
+#define ETH_HEADER_SIZE 14U
+#define IP_HEADER_SIZE 20U
+#define UDP_HEADER_SIZE 8U
+#define HEADERS_SIZE (ETH_HEADER_SIZE + IP_HEADER_SIZE + UDP_HEADER_SIZE)
+
+/// Shorter frames are padded up to the min Ethernet frame size (excluding FCS).
+#define ETH_MIN_FRAME_SIZE 60U
+
+static bool isMulticast(const uint32_t address)
+{
+    return (address & 0xF0000000UL) == 0xE0000000UL;  // NOLINT(*-magic-numbers)
+}
+
+static void storeU16(uint8_t* const out, const uint16_t value)
+{
+    out[0] = (uint8_t) (value >> 8U);    // NOLINT(*-magic-numbers)
+    out[1] = (uint8_t) (value & 0xFFU);  // NOLINT(*-magic-numbers)
+}
+
+static void storeU32(uint8_t* const out, const uint32_t value)
+{
+    storeU16(&out[0], (uint16_t) (value >> 16U));      // NOLINT(*-magic-numbers)
+    storeU16(&out[2], (uint16_t) (value & 0xFFFFUL));  // NOLINT(*-magic-numbers)
+}
+
+/// RFC 791 header checksum - one's complement of the one's complement sum of all 16-bit words.
+static uint16_t ipHeaderChecksum(const uint8_t* const header)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < IP_HEADER_SIZE; i += 2U)
+    {
+        sum += ((uint32_t) header[i] << 8U) | header[i + 1U];  // NOLINT(*-magic-numbers)
+    }
+    while ((sum >> 16U) != 0)  // NOLINT(*-magic-numbers)
+    {
+        sum = (sum & 0xFFFFUL) + (sum >> 16U);  // NOLINT(*-magic-numbers)
+    }
+    return (uint16_t) ~sum;
+}
+
+/// Finds the interface which has the specified address, and fetches its index and Ethernet MAC address.
+static int16_t findIface(const uint32_t local_iface_address, unsigned int* const out_index, uint8_t* const out_mac)
+{
+    struct ifaddrs* ifaddr_list = NULL;
+    if (getifaddrs(&ifaddr_list) != 0)
+    {
+        return (int16_t) -errno;
+    }
+
+    int16_t res = -ENODEV;
+    for (const struct ifaddrs* ifa = ifaddr_list; ifa != NULL; ifa = ifa->ifa_next)
+    {
+        if ((ifa->ifa_addr == NULL) || (ifa->ifa_addr->sa_family != AF_INET) ||
+            (ntohl(((const struct sockaddr_in*) ifa->ifa_addr)->sin_addr.s_addr) != local_iface_address))
+        {
+            continue;
+        }
+
+        const int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (fd < 0)
+        {
+            res = (int16_t) -errno;
+            break;
+        }
+        struct ifreq ifr;
+        (void) memset(&ifr, 0, sizeof(ifr));
+        (void) strncpy(ifr.ifr_name, ifa->ifa_name, IFNAMSIZ - 1);
+        if (ioctl(fd, SIOCGIFHWADDR, &ifr) != 0)
+        {
+            res = (int16_t) -errno;
+        }
+        else if (ifr.ifr_hwaddr.sa_family != ARPHRD_ETHER)
+        {
+            res = -EPFNOSUPPORT;
+        }
+        else
+        {
+            *out_index = if_nametoindex(ifa->ifa_name);
+            (void) memcpy(out_mac, ifr.ifr_hwaddr.sa_data, 6U);  // NOLINT(*-magic-numbers)
+            res = (*out_index > 0) ? 0 : (int16_t) -errno;
+        }
+        (void) close(fd);
+        break;
+    }
+    freeifaddrs(ifaddr_list);
+    return res;
+}
+
+static bool mapRing(const int                         fd,
+                    const struct xdp_ring_offset* const offsets,
+                    const size_t                      entry_size,
+                    const off_t                       page_offset,
+                    XDPRing* const                    out_ring)
+{
+    const int protection = PROT_READ | PROT_WRITE;
+    out_ring->map_size   = offsets->desc + (XDP_TX_RING_SIZE * entry_size);
+    out_ring->map        = mmap(NULL, out_ring->map_size, protection, MAP_SHARED | MAP_POPULATE, fd, page_offset);
+    if (out_ring->map == MAP_FAILED)
+    {
+        out_ring->map = NULL;
+        return false;
+    }
+
+    uint8_t* const base = (uint8_t*) out_ring->map;
+    out_ring->producer  = (uint32_t*) (void*) (base + offsets->producer);
+    out_ring->consumer  = (uint32_t*) (void*) (base + offsets->consumer);
+    out_ring->flags     = (uint32_t*) (void*) (base + offsets->flags);
+    out_ring->entries   = base + offsets->desc;
+    return true;
+}
+
+static void unmapRing(XDPRing* const ring)
+{
+    if (ring->map != NULL)
+    {
+        (void) munmap(ring->map, ring->map_size);
+        ring->map = NULL;
+    }
+}
+
+/// Moves UMEM frames of already transmitted datagrams from the completion ring back to the free frames.
+static void reclaimCompletedFrames(XDPTxHandle* const self)
+{
+    const uint32_t  produced  = __atomic_load_n(self->completion.producer, __ATOMIC_ACQUIRE);
+    uint32_t        consumed  = *self->completion.consumer;
+    const uint64_t* addresses = (const uint64_t*) self->completion.entries;
+    while ((consumed != produced) && (self->free_frames_count < XDP_TX_FRAMES_COUNT))
+    {
+        self->free_frames[self->free_frames_count++] = addresses[consumed & (XDP_TX_RING_SIZE - 1U)];
+        ++consumed;
+    }
+    __atomic_store_n(self->completion.consumer, consumed, __ATOMIC_RELEASE);
+}
+
+/// In the copy mode, the kernel transmits queued frames only when it's kicked (by `sendto` or by `poll`).
+static int16_t kickTx(XDPTxHandle* const self)
+{
+    if ((__atomic_load_n(self->tx.flags, __ATOMIC_ACQUIRE) & XDP_RING_NEED_WAKEUP) == 0)
+    {
+        return 0;
+    }
+    if (sendto(self->fd, NULL, 0, MSG_DONTWAIT, NULL, 0) >= 0)
+    {
+        return 0;
+    }
+    // The queued frames will be transmitted on the next kick then.
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EBUSY) || (errno == ENOBUFS))
+    {
+        return 0;
+    }
+    return (int16_t) -errno;
+}
+
+/// Builds Ethernet, IPv4 and UDP headers of a datagram in front of its payload.
+static void buildHeaders(XDPTxHandle* const self,
+                         uint8_t* const     frame,
+                         const uint32_t     remote_address,
+                         const uint16_t     remote_port,
+                         const uint8_t      dscp,
+                         const size_t       payload_size)
+{
+    // RFC 1112: the low 23 bits of the multicast group are placed into the 01:00:5E:00:00:00 MAC address.
+    uint8_t* const eth = frame;
+    eth[0]             = 0x01U;                                        // NOLINT(*-magic-numbers)
+    eth[1]             = 0x00U;                                        // NOLINT(*-magic-numbers)
+    eth[2]             = 0x5EU;                                        // NOLINT(*-magic-numbers)
+    eth[3]             = (uint8_t) ((remote_address >> 16U) & 0x7FU);  // NOLINT(*-magic-numbers)
+    eth[4]             = (uint8_t) ((remote_address >> 8U) & 0xFFU);   // NOLINT(*-magic-numbers)
+    eth[5]             = (uint8_t) (remote_address & 0xFFU);           // NOLINT(*-magic-numbers)
+    (void) memcpy(&eth[6], self->local_mac, 6U);                       // NOLINT(*-magic-numbers)
+    storeU16(&eth[12], 0x0800U);                                       // NOLINT(*-magic-numbers) IPv4
+
+    uint8_t* const ip = &frame[ETH_HEADER_SIZE];
+    ip[0]             = 0x45U;                   // NOLINT(*-magic-numbers) Version 4, and no options.
+    ip[1]             = (uint8_t) (dscp << 2U);  // The 2 least significant bits are used for the ECN field.
+    storeU16(&ip[2], (uint16_t) (IP_HEADER_SIZE + UDP_HEADER_SIZE + payload_size));
+    storeU16(&ip[4], self->ip_id++);
+    storeU16(&ip[6], 0x4000U);  // NOLINT(*-magic-numbers) Don't fragment.
+    ip[8] = OVERRIDE_TTL;
+    ip[9] = IPPROTO_UDP;
+    storeU16(&ip[10], 0);  // NOLINT(*-magic-numbers) Zeroed for the checksum calculation.
+    storeU32(&ip[12], self->local_iface_address);
+    storeU32(&ip[16], remote_address);
+    storeU16(&ip[10], ipHeaderChecksum(ip));  // NOLINT(*-magic-numbers)
+
+    // RFC 768: zero checksum means that it's not computed, which is allowed over IPv4.
+    // Cyphal/UDP has its own transfer CRC anyway.
+    uint8_t* const udp = &frame[ETH_HEADER_SIZE + IP_HEADER_SIZE];
+    storeU16(&udp[0], self->local_port);
+    storeU16(&udp[2], remote_port);
+    storeU16(&udp[4], (uint16_t) (UDP_HEADER_SIZE + payload_size));
+    storeU16(&udp[6], 0);  // NOLINT(*-magic-numbers)
+}
+
+int16_t xdpTxInit(XDPTxHandle* const self, const uint32_t local_iface_address, const uint16_t local_port)
+{
+    if ((self == NULL) || (local_iface_address == 0) || (local_port == 0))
+    {
+        return -EINVAL;
+    }
+    (void) memset(self, 0, sizeof(*self));
+    self->fd                  = -1;
+    self->local_iface_address = local_iface_address;
+    self->local_port          = local_port;
+
+    unsigned int if_index = 0;
+    int16_t      res      = findIface(local_iface_address, &if_index, self->local_mac);
+    if (res < 0)
+    {
+        return res;
+    }
+
+    const size_t umem_size = (size_t) XDP_TX_FRAMES_COUNT * XDP_TX_FRAME_SIZE;
+    self->umem             = mmap(NULL, umem_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (self->umem == MAP_FAILED)
+    {
+        self->umem = NULL;
+        return (int16_t) -errno;
+    }
+    for (uint32_t i = 0; i < XDP_TX_FRAMES_COUNT; ++i)
+    {
+        self->free_frames[i] = (uint64_t) i * XDP_TX_FRAME_SIZE;
+    }
+    self->free_frames_count = XDP_TX_FRAMES_COUNT;
+
+    const struct xdp_umem_reg umem_reg = {
+        .addr       = (uint64_t) (uintptr_t) self->umem,
+        .len        = umem_size,
+        .chunk_size = XDP_TX_FRAME_SIZE,
+        .headroom   = 0,
+    };
+    // The kernel insists on the fill ring even for TX only sockets, but it's never used (so not even mapped).
+    const int ring_size = XDP_TX_RING_SIZE;
+
+    struct xdp_mmap_offsets offsets;
+    socklen_t               offsets_size = sizeof(offsets);
+
+    self->fd = socket(AF_XDP, SOCK_RAW, 0);
+    bool ok  = self->fd >= 0;
+    //
+    ok = ok && setsockopt(self->fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) == 0;
+    ok = ok && setsockopt(self->fd, SOL_XDP, XDP_UMEM_FILL_RING, &ring_size, sizeof(ring_size)) == 0;
+    ok = ok && setsockopt(self->fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring_size, sizeof(ring_size)) == 0;
+    ok = ok && setsockopt(self->fd, SOL_XDP, XDP_TX_RING, &ring_size, sizeof(ring_size)) == 0;
+    ok = ok && getsockopt(self->fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_size) == 0;
+    ok = ok && mapRing(self->fd, &offsets.tx, sizeof(struct xdp_desc), (off_t) XDP_PGOFF_TX_RING, &self->tx);
+    ok = ok && mapRing(self->fd,  //
+                       &offsets.cr,
+                       sizeof(uint64_t),
+                       (off_t) XDP_UMEM_PGOFF_COMPLETION_RING,
+                       &self->completion);
+    ok = ok && bind(self->fd,
+                    (struct sockaddr*) &(struct sockaddr_xdp){
+                        .sxdp_family   = AF_XDP,
+                        .sxdp_flags    = XDP_COPY | XDP_USE_NEED_WAKEUP,
+                        .sxdp_ifindex  = if_index,
+                        .sxdp_queue_id = 0,
+                    },
+                    sizeof(struct sockaddr_xdp)) == 0;
+    if (ok)
+    {
+        res = 0;
+    }
+    else
+    {
+        res = (int16_t) -errno;
+        xdpTxClose(self);
+    }
+    return res;
+}
+
+int16_t xdpTxSend(XDPTxHandle* const self,
+                  const uint32_t     remote_address,
+                  const uint16_t     remote_port,
+                  const uint8_t      dscp,
+                  const size_t       payload_size,
+                  const void* const  payload)
+{
+    if ((self == NULL) || (self->fd < 0) || !isMulticast(remote_address) || (remote_port == 0) ||
+        ((payload == NULL) && (payload_size > 0)) || (dscp > DSCP_MAX))
+    {
+        return -EINVAL;
+    }
+    if (payload_size > XDP_TX_MAX_PAYLOAD_SIZE)
+    {
+        return -EMSGSIZE;
+    }
+
+    reclaimCompletedFrames(self);
+
+    const uint32_t produced = *self->tx.producer;
+    const uint32_t consumed = __atomic_load_n(self->tx.consumer, __ATOMIC_ACQUIRE);
+    if (((produced - consumed) >= XDP_TX_RING_SIZE) || (self->free_frames_count == 0))
+    {
+        // Let the kernel drain the ring - the socket becomes writable again after that.
+        const int16_t kick_res = kickTx(self);
+        return (kick_res < 0) ? kick_res : 0;
+    }
+
+    const uint64_t frame_address = self->free_frames[--self->free_frames_count];
+    uint8_t* const frame         = (uint8_t*) self->umem + frame_address;
+
+    buildHeaders(self, frame, remote_address, remote_port, dscp, payload_size);
+    if (payload_size > 0)
+    {
+        (void) memcpy(&frame[HEADERS_SIZE], payload, payload_size);
+    }
+    size_t frame_size = HEADERS_SIZE + payload_size;
+    if (frame_size < ETH_MIN_FRAME_SIZE)
+    {
+        (void) memset(&frame[frame_size], 0, ETH_MIN_FRAME_SIZE - frame_size);
+        frame_size = ETH_MIN_FRAME_SIZE;
+    }
+
+    struct xdp_desc* const descriptors = (struct xdp_desc*) self->tx.entries;
+    struct xdp_desc* const descriptor  = &descriptors[produced & (XDP_TX_RING_SIZE - 1U)];
+    descriptor->addr                   = frame_address;
+    descriptor->len                    = (uint32_t) frame_size;
+    descriptor->options                = 0;
+    __atomic_store_n(self->tx.producer, produced + 1U, __ATOMIC_RELEASE);
+
+    // The frame is queued already, so a kick failure (if persistent) is reported by the next sends instead.
+    (void) kickTx(self);
+    return 1;
+}
+
+void xdpTxClose(XDPTxHandle* const self)
+{
+    if (self != NULL)
+    {
+        if (self->fd >= 0)
+        {
+            (void) close(self->fd);
+        }
+        unmapRing(&self->tx);
+        unmapRing(&self->completion);
+        if (self->umem != NULL)
+        {
+            (void) munmap(self->umem, (size_t) XDP_TX_FRAMES_COUNT * XDP_TX_FRAME_SIZE);
+        }
+        self->fd                = -1;
+        self->umem              = NULL;
+        self->free_frames_count = 0;
+    }
+}
@@ -0,0 +1,97 @@
+/// This module implements Cyphal/UDP transmission via Linux AF_XDP sockets, bypassing the kernel networking stack.
+///
+/// Datagrams are framed by the module itself (Ethernet, IPv4 and UDP headers) directly in a packet buffer shared
+/// with the kernel (UMEM), and then the kernel just hands the frames over to the network interface.
+/// So, there is neither socket layer, nor routing, nor per datagram system call (one `sendto` kicks out a batch).
+/// The socket is bound in the copy mode, so it works with any network interface driver (including `veth`),
+/// and it doesn't need any XDP program to be attached - such program is needed only for reception,
+/// so reception is left to the regular sockets (see `udp.h`).
+///
+/// Multicast only: destination MAC address is derived from the destination multicast group (RFC 1112),
+/// hence no ARP is involved. IGMP is not involved either b/c it's needed only for reception.
+/// Note that the frames are not looped back to the local host (unlike `IP_MULTICAST_LOOP` of regular sockets).
+///
+/// Creating an AF_XDP socket needs the `CAP_NET_RAW` capability.
+///
+/// All addresses and values used in this API are in the host-native byte order (see `udp.h`).
+///
+/// This software is distributed under the terms of the MIT License.
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Size of a single UMEM frame - the whole Ethernet frame of a datagram has to fit into it.
+#define XDP_TX_FRAME_SIZE 4096U
+
+/// Number of descriptors in the TX ring, and in the completion ring as well.
+#define XDP_TX_RING_SIZE 64U
+
+/// There are enough UMEM frames to fill both rings, so whenever the TX ring has room (the socket is writable),
+/// there is a free frame as well (once completions are reclaimed).
+#define XDP_TX_FRAMES_COUNT (XDP_TX_RING_SIZE * 2U)
+
+/// Max UDP payload size which fits into a UMEM frame (besides Ethernet, IPv4 and UDP headers).
+#define XDP_TX_MAX_PAYLOAD_SIZE (XDP_TX_FRAME_SIZE - 42U)
+
+/// Memory mapped ring shared with the kernel.
+typedef struct
+{
+    uint32_t* producer;
+    uint32_t* consumer;
+    uint32_t* flags;
+    void*     entries;  ///< `struct xdp_desc` array of the TX ring, or `uint64_t` UMEM addresses of the completion one.
+    void*     map;
+    size_t    map_size;
+} XDPRing;
+
+typedef struct
+{
+    int      fd;
+    void*    umem;  ///< `XDP_TX_FRAMES_COUNT` frames of `XDP_TX_FRAME_SIZE` bytes each.
+    XDPRing  tx;
+    XDPRing  completion;
+    uint64_t free_frames[XDP_TX_FRAMES_COUNT];  ///< Stack of UMEM addresses of frames which are not in use.
+    uint32_t free_frames_count;
+    uint32_t local_iface_address;
+    uint8_t  local_mac[6];
+    uint16_t local_port;
+    uint16_t ip_id;
+} XDPTxHandle;
+
+/// Initialize an AF_XDP TX socket bound to the first queue of the network interface which has the specified address.
+/// The interface has to be an Ethernet one (so f.e. the loopback interface is rejected with -EPFNOSUPPORT).
+/// Datagrams are sent from the specified local UDP port (the Cyphal/UDP Specification doesn't restrict it),
+/// and the kernel doesn't reserve the port for the socket.
+/// Only one AF_XDP socket could be bound to the same interface queue, so the handle is supposed to be shared by
+/// all TX sockets of the interface (-EBUSY is returned otherwise).
+/// On error returns a negative error code.
+int16_t xdpTxInit(XDPTxHandle* const self, const uint32_t local_iface_address, const uint16_t local_port);
+
+/// Send a datagram to the specified multicast endpoint without blocking using the specified IP DSCP field value.
+/// The datagram is queued to the TX ring, and the kernel is kicked to transmit the queued frames (if it needs so).
+/// Returns -EMSGSIZE if the payload is bigger than `XDP_TX_MAX_PAYLOAD_SIZE`,
+/// and -EINVAL if the remote address is not a multicast one.
+/// Returns 1 on success, 0 if the socket is not ready for sending, or a negative error code.
+int16_t xdpTxSend(XDPTxHandle* const self,
+                  const uint32_t     remote_address,
+                  const uint16_t     remote_port,
+                  const uint8_t      dscp,
+                  const size_t       payload_size,
+                  const void* const  payload);
+
+/// No effect if the argument is invalid.
+/// This function is guaranteed to invalidate the handle.
+void xdpTxClose(XDPTxHandle* const self);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,346 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_LINUX_XDP_MEDIA_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_LINUX_XDP_MEDIA_HPP_INCLUDED
+
+#include "../../posix/posix_executor_extension.hpp"
+#include "../../posix/posix_platform_error.hpp"
+#include "../../posix/udp/udp.h"
+#include "../../posix/udp/udp_media.hpp"
+#include "xdp.h"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/frame_monitor_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace example
+{
+namespace platform
+{
+// Can't use lowercased `linux` - gnuc++ defines it as macro.
+namespace Linux
+{
+
+/// @brief Implements TX socket which sends datagrams via AF_XDP socket of the media (see `xdp.h`).
+///
+/// There could be only one AF_XDP socket per interface queue, so all TX sockets of the media share it.
+/// Still, each TX socket has its own duplicate of the AF_XDP socket descriptor - b/c a descriptor could be
+/// awaited by the executor only once, whereas the transport awaits writability of each its TX socket.
+///
+class XdpTxSocket final : public libcyphal::transport::udp::ITxSocket
+{
+public:
+    CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeTxSocketResult::Type make(
+        cetl::pmr::memory_resource& memory,
+        libcyphal::IExecutor&       executor,
+        XDPTxHandle&                xdp_handle,
+        const std::size_t           mtu)
+    {
+        const int awaitable_fd = ::dup(xdp_handle.fd);
+        if (awaitable_fd < 0)
+        {
+            return libcyphal::transport::PlatformError{posix::PosixPlatformError{errno}};
+        }
+
+        auto tx_socket =
+            libcyphal::makeUniquePtr<ITxSocket, XdpTxSocket>(memory, executor, xdp_handle, awaitable_fd, mtu);
+        if (tx_socket == nullptr)
+        {
+            (void) ::close(awaitable_fd);
+            return libcyphal::MemoryError{};
+        }
+
+        return tx_socket;
+    }
+
+    XdpTxSocket(libcyphal::IExecutor& executor, XDPTxHandle& xdp_handle, const int awaitable_fd, const std::size_t mtu)
+        : executor_{executor}
+        , xdp_handle_{xdp_handle}
+        , awaitable_fd_{awaitable_fd}
+        , mtu_{mtu}
+    {
+        CETL_DEBUG_ASSERT(awaitable_fd_ >= 0, "");
+    }
+
+    ~XdpTxSocket()
+    {
+        (void) ::close(awaitable_fd_);
+    }
+
+    XdpTxSocket(const XdpTxSocket&)                = delete;
+    XdpTxSocket(XdpTxSocket&&) noexcept            = delete;
+    XdpTxSocket& operator=(const XdpTxSocket&)     = delete;
+    XdpTxSocket& operator=(XdpTxSocket&&) noexcept = delete;
+
+private:
+    // MARK: ITxSocket
+
+    CETL_NODISCARD std::size_t getMtu() const noexcept override
+    {
+        return mtu_;
+    }
+
+    SendResult::Type send(const libcyphal::TimePoint,
+                          const libcyphal::transport::udp::IpEndpoint  multicast_endpoint,
+                          const std::uint8_t                           dscp,
+                          const libcyphal::transport::PayloadFragments payload_fragments) override
+    {
+        CETL_DEBUG_ASSERT(payload_fragments.size() == 1, "");
+
+        const auto         payload = payload_fragments[0];
+        const std::int16_t result  = ::xdpTxSend(&xdp_handle_,
+                                                multicast_endpoint.ip_address,
+                                                multicast_endpoint.udp_port,
+                                                dscp,
+                                                payload.size(),
+                                                payload.data());
+        if (result < 0)
+        {
+            return libcyphal::transport::PlatformError{posix::PosixPlatformError{-result}};
+        }
+
+        return SendResult::Success{result == 1};
+    }
+
+    CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerCallback(
+        libcyphal::IExecutor::Callback::Function&& function) override
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<posix::IPosixExecutorExtension*>(&executor_);
+        if (nullptr == posix_executor_ext)
+        {
+            return {};
+        }
+
+        // In the copy mode, polling of the AF_XDP socket also kicks the kernel to transmit queued frames,
+        // and then the socket becomes writable as soon as there is room in its TX ring.
+        return posix_executor_ext->registerAwaitableCallback(std::move(function),
+                                                             posix::IPosixExecutorExtension::Trigger::Writable{
+                                                                 awaitable_fd_});
+    }
+
+    // MARK: Data members:
+
+    libcyphal::IExecutor& executor_;
+    XDPTxHandle&          xdp_handle_;
+    const int             awaitable_fd_;
+    const std::size_t     mtu_;
+
+};  // XdpTxSocket
+
+// MARK: -
+
+/// @brief Implements UDP media which transmits via AF_XDP socket (bypassing the kernel networking stack).
+///
+/// Reception is done by the regular POSIX sockets (see `posix::UdpMedia`) - receiving via AF_XDP needs
+/// an XDP program which steers Cyphal datagrams of the interface to the socket.
+/// Multicast datagrams sent via AF_XDP are not looped back to the local host, so local nodes don't hear each other
+/// over the media (unlike over `posix::UdpMedia`).
+///
+class XdpUdpMedia final : public libcyphal::transport::udp::IMedia
+{
+public:
+    struct Collection
+    {
+        Collection() = default;
+
+        bool make(cetl::pmr::memory_resource& memory,
+                  libcyphal::IExecutor&       executor,
+                  std::vector<std::string>&   iface_addresses,
+                  const std::size_t           mtu = DefaultMtu)
+        {
+            reset();
+
+            for (const auto& iface_address : iface_addresses)
+            {
+                auto maybe_media = XdpUdpMedia::make(memory, executor, iface_address, mtu);
+                if (auto* const error = cetl::get_if<libcyphal::transport::PlatformError>(&maybe_media))
+                {
+                    std::cerr << "Failed to create AF_XDP media '" << iface_address << "', errno=" << (*error)->code()
+                              << ".\n";
+                    return false;
+                }
+                media_vector_.emplace_back(cetl::get<XdpUdpMedia>(std::move(maybe_media)));
+            }
+
+            for (auto& media : media_vector_)
+            {
+                media_ifaces_.push_back(&media);
+            }
+
+            return true;
+        }
+
+        cetl::span<IMedia*> span()
+        {
+            return {media_ifaces_.data(), media_ifaces_.size()};
+        }
+
+        void reset()
+        {
+            media_vector_.clear();
+            media_ifaces_.clear();
+        }
+
+    private:
+        std::vector<XdpUdpMedia> media_vector_;
+        std::vector<IMedia*>     media_ifaces_;
+
+    };  // Collection
+
+    /// Default MTU of the media - fits into standard (1500 bytes) Ethernet frames.
+    static constexpr std::size_t DefaultMtu = libcyphal::transport::udp::ITxSocket::DefaultMtu;
+
+    /// Per Cyphal/UDP Specification, this is the UDP port of all transfers. The Specification doesn't restrict
+    /// the source port, so datagrams are sent from the same port as well (see `xdpTxInit`).
+    static constexpr std::uint16_t UdpPort = 9382U;
+
+    /// @brief Makes a new media, and binds its AF_XDP socket to the interface which has the given address.
+    ///
+    /// @param mtu Max payload size (excluding Cyphal header) of TX datagrams. It's limited by the size of UMEM frames
+    ///            (see `XDP_TX_MAX_PAYLOAD_SIZE`) and by the interface MTU.
+    ///
+    CETL_NODISCARD static cetl::variant<XdpUdpMedia, libcyphal::transport::PlatformError> make(
+        cetl::pmr::memory_resource& memory,
+        libcyphal::IExecutor&       executor,
+        const std::string&          iface_address,
+        const std::size_t           mtu = DefaultMtu)
+    {
+        // The handle is shared by TX sockets of the media, so it must stay in place while the media is moved.
+        auto xdp_handle = std::make_unique<XDPTxHandle>();
+        xdp_handle->fd  = -1;
+
+        const std::uint32_t iface_ip_address = ::udpParseIfaceAddress(iface_address.c_str());
+        const std::int16_t  result           = ::xdpTxInit(xdp_handle.get(), iface_ip_address, UdpPort);
+        if (result < 0)
+        {
+            return libcyphal::transport::PlatformError{posix::PosixPlatformError{-result}};
+        }
+
+        return XdpUdpMedia{memory, executor, iface_address, std::move(xdp_handle), mtu};
+    }
+
+    ~XdpUdpMedia()
+    {
+        if (xdp_handle_ != nullptr)
+        {
+            ::xdpTxClose(xdp_handle_.get());
+        }
+    }
+
+    XdpUdpMedia(const XdpUdpMedia&)                = delete;
+    XdpUdpMedia& operator=(const XdpUdpMedia&)     = delete;
+    XdpUdpMedia* operator=(XdpUdpMedia&&) noexcept = delete;
+
+    XdpUdpMedia(XdpUdpMedia&& other) noexcept
+        : memory_{other.memory_}
+        , executor_{other.executor_}
+        , iface_address_{other.iface_address_}
+        , xdp_handle_{std::move(other.xdp_handle_)}
+        , mtu_{other.mtu_}
+        , rx_media_{std::move(other.rx_media_)}
+    {
+    }
+
+private:
+    XdpUdpMedia(cetl::pmr::memory_resource&  memory,
+                libcyphal::IExecutor&        executor,
+                const std::string&           iface_address,
+                std::unique_ptr<XDPTxHandle> xdp_handle,
+                const std::size_t            mtu)
+        : memory_{memory}
+        , executor_{executor}
+        , iface_address_{iface_address}
+        , xdp_handle_{std::move(xdp_handle)}
+        , mtu_{mtu}
+        , rx_media_{memory, executor, iface_address, false /* is_zero_copy */, mtu}
+    {
+    }
+
+    // MARK: - IMedia
+
+    MakeTxSocketResult::Type makeTxSocket() override
+    {
+        return XdpTxSocket::make(memory_, executor_, *xdp_handle_, getTxMtu());
+    }
+
+    /// All bands share the only AF_XDP socket of the interface, so there is no per band socket priority.
+    /// Still, the transport keeps transfers of the more important bands ahead (in its per band TX queues),
+    /// and each datagram carries its DSCP value.
+    ///
+    MakeTxSocketResult::Type makeBandTxSocket(const TxBandParams&) override
+    {
+        return makeTxSocket();
+    }
+
+    MakeRxSocketResult::Type makeRxSocket(const libcyphal::transport::udp::IpEndpoint& multicast_endpoint) override
+    {
+        return static_cast<IMedia&>(rx_media_).makeRxSocket(multicast_endpoint);
+    }
+
+    MakeRxSocketResult::Type makeFrameMonitorRxSocket(const libcyphal::transport::FrameMonitorRxParams& params) override
+    {
+        return static_cast<IMedia&>(rx_media_).makeFrameMonitorRxSocket(params);
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        // Payloads are copied into UMEM frames anyway.
+        return memory_;
+    }
+
+    std::size_t getTxMtu() const
+    {
+        // Min IPv4 header (20 bytes) and UDP header (8 bytes) - datagrams are sent w/o IP options.
+        constexpr std::size_t IpUdpHeadersSize = 28;
+        constexpr std::size_t CyphalHeaderSize = 24;
+
+        std::size_t mtu = std::min<std::size_t>(mtu_, XDP_TX_MAX_PAYLOAD_SIZE - CyphalHeaderSize);
+
+        // There is no IP fragmentation here, so datagrams have to fit into the interface MTU.
+        const std::int32_t iface_mtu = ::udpGetIfaceMtu(::udpParseIfaceAddress(iface_address_.c_str()));
+        if (iface_mtu > static_cast<std::int32_t>(IpUdpHeadersSize + CyphalHeaderSize))
+        {
+            mtu = std::min(mtu, static_cast<std::size_t>(iface_mtu) - IpUdpHeadersSize - CyphalHeaderSize);
+        }
+        return mtu;
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&  memory_;
+    libcyphal::IExecutor&        executor_;
+    std::string                  iface_address_;
+    std::unique_ptr<XDPTxHandle> xdp_handle_;
+    std::size_t                  mtu_;
+    posix::UdpMedia              rx_media_;
+
+};  // XdpUdpMedia
+
+}  // namespace Linux
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_LINUX_XDP_MEDIA_HPP_INCLUDED
@@ -41,8 +41,14 @@ public:
         {
             int fd;
         };
+        /// Awaits an error condition of the descriptor (`POLLERR`), f.e. pending messages in a socket error queue.
+        /// Note that the condition is reported to `Readable` and `Writable` awaiters of the same descriptor as well.
+        struct Erroneous
+        {
+            int fd;
+        };
 
-        using Variant = cetl::variant<Readable, Writable>;
+        using Variant = cetl::variant<Readable, Writable, Erroneous>;
     };
 
     CETL_NODISCARD virtual libcyphal::IExecutor::Callback::Any registerAwaitableCallback(
@@ -46,7 +46,8 @@ public:
         : awaitable_nodes_{&awaitable_nodes_, &awaitable_nodes_}
         , total_awaitables_{0}
         , poll_fds_{&memory_resource}
-        , callback_interfaces_{&memory_resource}
+        , awaitable_interfaces_{&memory_resource}
+        , is_poll_set_stale_{false}
     {
     }
     ~PollSingleThreadedExecutor() override = default;
@@ -75,22 +76,14 @@ public:
             return cetl::nullopt;
         }
 
-        // (Re-)populate the poll file descriptors and the callback IDs into variable size arrays.
-        // Note, their `clear` doesn't deallocate the memory,
-        // so we can reuse them, and grow on demand (but never shrink).
+        // Normally the poll set is maintained incrementally (as awaitables come and go),
+        // so it has to be rebuilt only if some previous incremental update has failed to allocate memory.
         //
-        poll_fds_.clear();
-        callback_interfaces_.clear();
-        for (auto* node = awaitable_nodes_.next_node; node != &awaitable_nodes_; node = node->next_node)
-        {
-            auto& awaitable_node = static_cast<AwaitableNode&>(*node);
-            callback_interfaces_.push_back(&awaitable_node);
-            poll_fds_.push_back({awaitable_node.fd(), static_cast<std::int16_t>(awaitable_node.events()), 0});
-        }
-        if ((total_awaitables_ != poll_fds_.size()) || (total_awaitables_ != callback_interfaces_.size()))
+        if (is_poll_set_stale_ && (!rebuildPollSet()))
         {
             return libcyphal::MemoryError{};
         }
+        CETL_DEBUG_ASSERT(total_awaitables_ == poll_fds_.size(), "");
 
         // Make sure that timeout is within the range of `::poll()`'s `int` timeout parameter.
         // Any possible negative timeout will be treated as zero (return immediately from the `::poll`).
@@ -128,9 +121,9 @@ public:
 
                 if (0 != (static_cast<PollEvents>(poll_fd.revents) & static_cast<PollEvents>(poll_fd.events)))
                 {
-                    if (auto* const cb_interface = callback_interfaces_[index])
+                    if (auto* const awaitable_node = awaitable_interfaces_[index])
                     {
-                        cb_interface->schedule(Callback::Schedule::Once{now_time});
+                        awaitable_node->schedule(Callback::Schedule::Once{now_time});
                     }
                 }
             }
@@ -149,8 +142,15 @@ public:
         poll_fds_.clear();
         poll_fds_.shrink_to_fit();
 
-        callback_interfaces_.clear();
-        callback_interfaces_.shrink_to_fit();
+        awaitable_interfaces_.clear();
+        awaitable_interfaces_.shrink_to_fit();
+
+        // The set will be rebuilt on the next poll (if there are still awaitables).
+        for (auto* node = awaitable_nodes_.next_node; node != &awaitable_nodes_; node = node->next_node)
+        {
+            static_cast<AwaitableNode&>(*node).poll_index_ = NoPollIndex;
+        }
+        is_poll_set_stale_ = (total_awaitables_ > 0);
     }
 
 protected:
@@ -170,6 +170,12 @@ protected:
                 [&new_cb_node](const Trigger::Writable& writable) {
                     //
                     new_cb_node.setup(writable.fd, POLLOUT);
+                },
+                [&new_cb_node](const Trigger::Erroneous& erroneous) {
+                    //
+                    // `poll` ignores `POLLERR` in the requested events (it's always reported), but having it
+                    // there makes the node to match its reported events (see `pollAwaitableResourcesFor`).
+                    new_cb_node.setup(erroneous.fd, POLLERR);
                 }),
             trigger);
 
@@ -201,6 +207,9 @@ private:
     using Base       = SingleThreadedExecutor;
     using Self       = PollSingleThreadedExecutor;
 
+    /// Index of an awaitable node which is not (yet) in the poll set.
+    static constexpr std::size_t NoPollIndex = std::numeric_limits<std::size_t>::max();
+
     struct DoubleLinkedNode
     {
         DoubleLinkedNode* prev_node;
@@ -215,6 +224,7 @@ private:
             , DoubleLinkedNode{&origin_node, origin_node.next_node}
             , fd_{-1}
             , events_{0}
+            , poll_index_{NoPollIndex}
         {
             origin_node.next_node->prev_node = this;
             origin_node.next_node            = this;
@@ -225,6 +235,7 @@ private:
             if (fd_ >= 0)
             {
                 getExecutor().total_awaitables_--;
+                getExecutor().removeFromPollSet(*this);
             }
 
             if ((nullptr != prev_node) && (nullptr != next_node))
@@ -239,9 +250,14 @@ private:
             , DoubleLinkedNode{std::exchange(other.prev_node, nullptr), std::exchange(other.next_node, nullptr)}
             , fd_{std::exchange(other.fd_, -1)}
             , events_{std::exchange(other.events_, 0)}
+            , poll_index_{other.poll_index_}
         {
             prev_node->next_node = this;
             next_node->prev_node = this;
+
+            other.poll_index_ = NoPollIndex;
+
+            getExecutor().relocateInPollSet(*this);
         }
 
         AwaitableNode(const AwaitableNode&)                      = delete;
@@ -263,13 +279,19 @@ private:
             CETL_DEBUG_ASSERT(fd >= 0, "");
             CETL_DEBUG_ASSERT(events != 0, "");
 
+            if (fd_ < 0)
+            {
+                getExecutor().total_awaitables_++;
+            }
             fd_     = fd;
             events_ = events;
 
-            getExecutor().total_awaitables_++;
+            getExecutor().updatePollSet(*this);
         }
 
     private:
+        friend class PollSingleThreadedExecutor;
+
         Self& getExecutor() noexcept
         {
             return static_cast<Self&>(executor());
@@ -277,21 +299,109 @@ private:
 
         // MARK: Data members:
 
-        int        fd_;
-        PollEvents events_;
+        int         fd_;
+        PollEvents  events_;
+        std::size_t poll_index_;
 
     };  // AwaitableNode
 
+    /// Adds the awaitable node to the poll set, or updates its entry there (if it's already in the set).
+    ///
+    void updatePollSet(AwaitableNode& node)
+    {
+        const pollfd poll_fd{node.fd(), static_cast<std::int16_t>(node.events()), 0};
+        if (node.poll_index_ != NoPollIndex)
+        {
+            poll_fds_[node.poll_index_] = poll_fd;
+            return;
+        }
+        if (is_poll_set_stale_)
+        {
+            return;
+        }
+
+        // Note, arrays grow on demand (but never shrink), so normally there is no allocation here.
+        //
+        const std::size_t index = poll_fds_.size();
+        poll_fds_.push_back(poll_fd);
+        awaitable_interfaces_.push_back(&node);
+        if ((poll_fds_.size() != (index + 1)) || (awaitable_interfaces_.size() != (index + 1)))
+        {
+            is_poll_set_stale_ = true;
+            return;
+        }
+        node.poll_index_ = index;
+    }
+
+    /// Removes the awaitable node from the poll set - its place is taken by the last entry of the set.
+    ///
+    void removeFromPollSet(AwaitableNode& node)
+    {
+        const std::size_t index = node.poll_index_;
+        node.poll_index_        = NoPollIndex;
+        if (is_poll_set_stale_ || (index == NoPollIndex))
+        {
+            return;
+        }
+
+        const std::size_t last_index = poll_fds_.size() - 1;
+        if (index != last_index)
+        {
+            poll_fds_[index]                          = poll_fds_[last_index];
+            awaitable_interfaces_[index]              = awaitable_interfaces_[last_index];
+            awaitable_interfaces_[index]->poll_index_ = index;
+        }
+        poll_fds_.pop_back();
+        awaitable_interfaces_.pop_back();
+    }
+
+    /// Updates the poll set entry of the awaitable node after the node has been moved to a new address.
+    ///
+    void relocateInPollSet(AwaitableNode& node) noexcept
+    {
+        if ((!is_poll_set_stale_) && (node.poll_index_ != NoPollIndex))
+        {
+            awaitable_interfaces_[node.poll_index_] = &node;
+        }
+    }
+
+    /// Rebuilds the whole poll set from scratch (by walking all awaitable nodes).
+    ///
+    /// @return `true` if the set is consistent again; `false` if there is not enough memory.
+    ///
+    bool rebuildPollSet()
+    {
+        // Note, `clear` doesn't deallocate the memory, so we can reuse it.
+        //
+        poll_fds_.clear();
+        awaitable_interfaces_.clear();
+        for (auto* node = awaitable_nodes_.next_node; node != &awaitable_nodes_; node = node->next_node)
+        {
+            auto& awaitable_node       = static_cast<AwaitableNode&>(*node);
+            awaitable_node.poll_index_ = NoPollIndex;
+            if (awaitable_node.fd() >= 0)
+            {
+                awaitable_node.poll_index_ = poll_fds_.size();
+                awaitable_interfaces_.push_back(&awaitable_node);
+                poll_fds_.push_back({awaitable_node.fd(), static_cast<std::int16_t>(awaitable_node.events()), 0});
+            }
+        }
+        is_poll_set_stale_ =
+            (total_awaitables_ != poll_fds_.size()) || (total_awaitables_ != awaitable_interfaces_.size());
+        return !is_poll_set_stale_;
+    }
+
     // MARK: - Data members:
 
     using PollFds = cetl::VariableLengthArray<pollfd, cetl::pmr::polymorphic_allocator<pollfd>>;
-    using CallbackInterfaces =
-        cetl::VariableLengthArray<Callback::Interface*, cetl::pmr::polymorphic_allocator<Callback::Interface*>>;
-
-    DoubleLinkedNode   awaitable_nodes_;
-    std::size_t        total_awaitables_;
-    PollFds            poll_fds_;
-    CallbackInterfaces callback_interfaces_;
+    using AwaitableInterfaces =
+        cetl::VariableLengthArray<AwaitableNode*, cetl::pmr::polymorphic_allocator<AwaitableNode*>>;
+
+    DoubleLinkedNode    awaitable_nodes_;
+    std::size_t         total_awaitables_;
+    PollFds             poll_fds_;
+    AwaitableInterfaces awaitable_interfaces_;
+    bool                is_poll_set_stale_;
 
 };  // PollSingleThreadedExecutor
 
@@ -13,12 +13,21 @@
 
 #include <fcntl.h>
 #include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#include <string.h>
 #include <poll.h>
 #include <errno.h>
 #include <limits.h>
 
+#if defined(__linux__)
+#    include <linux/errqueue.h>
+#    include <linux/net_tstamp.h>
+#endif
+
 /// This is the value recommended by the Cyphal/UDP specification.
 #define OVERRIDE_TTL 16
 
@@ -36,6 +45,8 @@ int16_t udpTxInit(UDPTxHandle* const self, const uint32_t local_iface_address)
     if ((self != NULL) && (local_iface_address > 0))
     {
         self->fd                 = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        self->tos                = -1;
+        self->priority           = -1;
         uint32_t  local_iface_be = htonl(local_iface_address);
         const int ttl            = OVERRIDE_TTL;
         bool      ok             = self->fd >= 0;
@@ -65,24 +76,61 @@ int16_t udpTxInit(UDPTxHandle* const self, const uint32_t local_iface_address)
     return res;
 }
 
-int16_t udpTxSend(UDPTxHandle* const self,
-                  const uint32_t     remote_address,
-                  const uint16_t     remote_port,
-                  const uint8_t      dscp,
-                  const size_t       payload_size,
-                  const void* const  payload)
+int16_t udpTxSetPriority(UDPTxHandle* const self, const int socket_priority, const size_t send_buffer_size)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (send_buffer_size <= INT_MAX))
+    {
+        bool ok = true;
+#ifdef SO_PRIORITY
+        ok = ok && setsockopt(self->fd, SOL_SOCKET, SO_PRIORITY, &socket_priority, sizeof(socket_priority)) == 0;
+        self->priority = ok ? socket_priority : -1;
+#else
+        (void) socket_priority;
+#endif
+        if (send_buffer_size > 0)
+        {
+            const int sndbuf = (int) send_buffer_size;
+            ok               = ok && setsockopt(self->fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf)) == 0;
+        }
+        res = ok ? 0 : (int16_t) -errno;
+    }
+    return res;
+}
+
+static int16_t txSend(UDPTxHandle* const self,
+                      const uint32_t     remote_address,
+                      const uint16_t     remote_port,
+                      const uint8_t      dscp,
+                      const size_t       payload_size,
+                      const void* const  payload,
+                      const int          flags)
 {
     int16_t res = -EINVAL;
     if ((self != NULL) && (self->fd >= 0) && (remote_address > 0) && (remote_port > 0) && (payload != NULL) &&
         (dscp <= DSCP_MAX))
     {
-        const int dscp_int = dscp << 2U;  // The 2 least significant bits are used for the ECN field.
-        (void) setsockopt(self->fd, IPPROTO_IP, IP_TOS, &dscp_int, sizeof(dscp_int));  // Best effort.
+        const int tos = dscp << 2U;  // The 2 least significant bits are used for the ECN field.
+        if (tos != self->tos)
+        {
+            // Best effort.
+            self->tos = (setsockopt(self->fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos)) == 0) ? tos : -1;
+#ifdef SO_PRIORITY
+            // The order matters: Linux overwrites the socket priority with one derived from the TOS
+            // (see `rt_tos2priority`) on every `IP_TOS` change, so the configured priority (if any)
+            // has to be re-applied AFTER it - otherwise it would be silently lost on the very first send.
+            // Both are applied only on TOS change, which is rare for a socket of a single priority band.
+            if (self->priority >= 0)
+            {
+                (void) setsockopt(self->fd, SOL_SOCKET, SO_PRIORITY, &self->priority, sizeof(self->priority));
+            }
+#endif
+        }
         const ssize_t send_result =
             sendto(self->fd,
                    payload,
                    payload_size,
-                   MSG_DONTWAIT,
+                   MSG_DONTWAIT | flags,
                    (struct sockaddr*) &(struct sockaddr_in){.sin_family = AF_INET,
                                                             .sin_addr   = {.s_addr = htonl(remote_address)},
                                                             .sin_port   = htons(remote_port)},
@@ -103,6 +151,168 @@ int16_t udpTxSend(UDPTxHandle* const self,
     return res;
 }
 
+int16_t udpTxSend(UDPTxHandle* const self,
+                  const uint32_t     remote_address,
+                  const uint16_t     remote_port,
+                  const uint8_t      dscp,
+                  const size_t       payload_size,
+                  const void* const  payload)
+{
+    return txSend(self, remote_address, remote_port, dscp, payload_size, payload, 0);
+}
+
+int16_t udpTxEnableZeroCopy(UDPTxHandle* const self)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0))
+    {
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+        const int one = 1;
+        res           = (setsockopt(self->fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0) ? 0 : (int16_t) -errno;
+#else
+        res = -ENOPROTOOPT;
+#endif
+    }
+    return res;
+}
+
+int16_t udpTxSendZeroCopy(UDPTxHandle* const self,
+                          const uint32_t     remote_address,
+                          const uint16_t     remote_port,
+                          const uint8_t      dscp,
+                          const size_t       payload_size,
+                          const void* const  payload)
+{
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    return txSend(self, remote_address, remote_port, dscp, payload_size, payload, MSG_ZEROCOPY);
+#else
+    (void) self;
+    (void) remote_address;
+    (void) remote_port;
+    (void) dscp;
+    (void) payload_size;
+    (void) payload;
+    return -ENOPROTOOPT;
+#endif
+}
+
+int16_t udpTxReadZeroCopyCompletion(UDPTxHandle* const self, uint32_t* const out_first_id, uint32_t* const out_last_id)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (out_first_id != NULL) && (out_last_id != NULL))
+    {
+#if defined(SO_EE_ORIGIN_ZEROCOPY)
+        res = 0;
+        for (;;)
+        {
+            char          control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in))];
+            struct msghdr msg         = {0};
+            msg.msg_control           = control;
+            msg.msg_controllen        = sizeof(control);
+            const ssize_t recv_result = recvmsg(self->fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+            if (recv_result < 0)
+            {
+                res = ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ? 0 : (int16_t) -errno;
+                break;
+            }
+            for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != NULL; cm = CMSG_NXTHDR(&msg, cm))
+            {
+                const struct sock_extended_err* const err = (const struct sock_extended_err*) CMSG_DATA(cm);
+                if ((cm->cmsg_level == IPPROTO_IP) && (cm->cmsg_type == IP_RECVERR) && (err->ee_errno == 0) &&
+                    (err->ee_origin == SO_EE_ORIGIN_ZEROCOPY))
+                {
+                    *out_first_id = err->ee_info;
+                    *out_last_id  = err->ee_data;
+                    res           = 1;
+                }
+            }
+            if (res != 0)
+            {
+                break;
+            }
+        }
+#else
+        res = 0;  // There are no zero-copy sends on this platform, hence no completions.
+#endif
+    }
+    return res;
+}
+
+int16_t udpTxEnableTimestamping(UDPTxHandle* const self)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0))
+    {
+#if defined(SO_TIMESTAMPING) && defined(SOF_TIMESTAMPING_OPT_TSONLY)
+        const int flags = SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |  //
+                          SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+        res = (setsockopt(self->fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0) ? 0 : (int16_t) -errno;
+#else
+        res = -ENOPROTOOPT;
+#endif
+    }
+    return res;
+}
+
+int16_t udpTxReadTimestamp(UDPTxHandle* const self, uint32_t* const out_id, uint64_t* const out_timestamp_usec)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (out_id != NULL) && (out_timestamp_usec != NULL))
+    {
+#if defined(SO_TIMESTAMPING) && defined(SO_EE_ORIGIN_TIMESTAMPING)
+        res = 0;
+        for (;;)
+        {
+            char control[CMSG_SPACE(sizeof(struct scm_timestamping)) +
+                         CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in))];
+            struct msghdr msg         = {0};
+            msg.msg_control           = control;
+            msg.msg_controllen        = sizeof(control);
+            const ssize_t recv_result = recvmsg(self->fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+            if (recv_result < 0)
+            {
+                res = ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ? 0 : (int16_t) -errno;
+                break;
+            }
+            // The timestamp and its ID come in separate control messages of the same notification.
+            bool     has_timestamp = false;
+            bool     has_id        = false;
+            uint64_t timestamp_us  = 0;
+            uint32_t id            = 0;
+            for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != NULL; cm = CMSG_NXTHDR(&msg, cm))
+            {
+                if ((cm->cmsg_level == SOL_SOCKET) && (cm->cmsg_type == SCM_TIMESTAMPING))
+                {
+                    struct scm_timestamping tss;
+                    (void) memcpy(&tss, CMSG_DATA(cm), sizeof(tss));  // Copy to avoid alignment problems
+                    // The software timestamp is the first one (the rest are legacy and hardware ones).
+                    timestamp_us  = ((uint64_t) tss.ts[0].tv_sec * 1000000ULL) +  // NOLINT(*-magic-numbers)
+                                   ((uint64_t) tss.ts[0].tv_nsec / 1000ULL);      // NOLINT(*-magic-numbers)
+                    has_timestamp = true;
+                }
+                const struct sock_extended_err* const err = (const struct sock_extended_err*) CMSG_DATA(cm);
+                if ((cm->cmsg_level == IPPROTO_IP) && (cm->cmsg_type == IP_RECVERR) && (err->ee_errno == ENOMSG) &&
+                    (err->ee_origin == SO_EE_ORIGIN_TIMESTAMPING))
+                {
+                    id     = err->ee_data;
+                    has_id = true;
+                }
+            }
+            if (has_timestamp && has_id)
+            {
+                *out_id             = id;
+                *out_timestamp_usec = timestamp_us;
+                res                 = 1;
+                break;
+            }
+        }
+#else
+        res = 0;  // There are no transmission timestamps on this platform.
+#endif
+    }
+    return res;
+}
+
 void udpTxClose(UDPTxHandle* const self)
 {
     if ((self != NULL) && (self->fd >= 0))
@@ -112,6 +322,55 @@ void udpTxClose(UDPTxHandle* const self)
     }
 }
 
+/// Opens a non-blocking RX socket, which shares the given port with other applications, and binds it.
+static bool rxOpen(UDPRxHandle* const self, const uint32_t bind_address, const uint16_t remote_port)
+{
+    const int reuse = 1;
+    self->fd        = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    bool ok         = self->fd >= 0;
+    // Set non-blocking mode.
+    ok = ok && (fcntl(self->fd, F_SETFL, O_NONBLOCK) == 0);
+    // Allow other applications to use the same Cyphal port as well. This must be done before binding.
+    // Failure to do so will make it impossible to run more than one Cyphal/UDP node on the same host.
+    ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) == 0);
+#ifdef SO_REUSEPORT  // Linux
+    ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) == 0);
+#endif
+    const struct sockaddr_in bind_addr = {
+        .sin_family = AF_INET,
+        .sin_addr   = {.s_addr = htonl(bind_address)},
+        .sin_port   = htons(remote_port),
+    };
+    ok = ok && (bind(self->fd, (struct sockaddr*) &bind_addr, sizeof(bind_addr)) == 0);
+    return ok;
+}
+
+/// Joins the RX socket to the multicast group on the given local interface.
+static bool rxJoin(UDPRxHandle* const self, const uint32_t local_iface_address, const uint32_t multicast_group)
+{
+    // INADDR_ANY in IP_ADD_MEMBERSHIP doesn't actually mean "any", it means "choose one automatically";
+    // see https://tldp.org/HOWTO/Multicast-HOWTO-6.html. This is why we have to specify the interface explicitly.
+    // This is needed to inform the networking stack of which local interface to use for IGMP membership reports.
+    const struct in_addr tuple[2] = {{.s_addr = htonl(multicast_group)}, {.s_addr = htonl(local_iface_address)}};
+    return setsockopt(self->fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &tuple[0], sizeof(tuple)) == 0;
+}
+
+/// Converts the result of RX socket initialization to the error code; the socket is closed on failure.
+static int16_t rxInitResult(UDPRxHandle* const self, const bool ok)
+{
+    int16_t res = 0;
+    if (!ok)
+    {
+        res = (int16_t) -errno;
+        if (self->fd >= 0)
+        {
+            (void) close(self->fd);
+        }
+        self->fd = -1;
+    }
+    return res;
+}
+
 int16_t udpRxInit(UDPRxHandle* const self,
                   const uint32_t     local_iface_address,
                   const uint32_t     multicast_group,
@@ -120,45 +379,44 @@ int16_t udpRxInit(UDPRxHandle* const self,
     int16_t res = -EINVAL;
     if ((self != NULL) && (local_iface_address > 0) && isMulticast(multicast_group) && (remote_port > 0))
     {
-        const int reuse = 1;
-        self->fd        = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-        bool ok         = self->fd >= 0;
-        // Set non-blocking mode.
-        ok = ok && (fcntl(self->fd, F_SETFL, O_NONBLOCK) == 0);
-        // Allow other applications to use the same Cyphal port as well. This must be done before binding.
-        // Failure to do so will make it impossible to run more than one Cyphal/UDP node on the same host.
-        ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) == 0);
-#ifdef SO_REUSEPORT  // Linux
-        ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) == 0);
-#endif
         // Binding to the multicast group address is necessary on GNU/Linux: https://habr.com/ru/post/141021/
         // Binding to a multicast address is not allowed on Windows, and it is not necessary there;
         // instead, one should bind to INADDR_ANY with the specific port.
-        const struct sockaddr_in bind_addr = {
-            .sin_family = AF_INET,
 #ifdef _WIN32
-            .sin_addr = {.s_addr = INADDR_ANY},
+        const uint32_t bind_address = INADDR_ANY;
 #else
-            .sin_addr = {.s_addr = htonl(multicast_group)},
+        const uint32_t bind_address = multicast_group;
 #endif
-            .sin_port = htons(remote_port),
-        };
-        ok = ok && (bind(self->fd, (struct sockaddr*) &bind_addr, sizeof(bind_addr)) == 0);
-        // INADDR_ANY in IP_ADD_MEMBERSHIP doesn't actually mean "any", it means "choose one automatically";
-        // see https://tldp.org/HOWTO/Multicast-HOWTO-6.html. This is why we have to specify the interface explicitly.
-        // This is needed to inform the networking stack of which local interface to use for IGMP membership reports.
-        const struct in_addr tuple[2] = {{.s_addr = htonl(multicast_group)}, {.s_addr = htonl(local_iface_address)}};
-        ok = ok && (setsockopt(self->fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &tuple[0], sizeof(tuple)) == 0);
-        if (ok)
-        {
-            res = 0;
-        }
-        else
+        bool ok = rxOpen(self, bind_address, remote_port);
+        ok      = ok && rxJoin(self, local_iface_address, multicast_group);
+        res     = rxInitResult(self, ok);
+    }
+    return res;
+}
+
+int16_t udpRxInitRange(UDPRxHandle* const self,
+                       const uint32_t     local_iface_address,
+                       const uint32_t     first_multicast_group,
+                       const uint32_t     last_multicast_group,
+                       const uint16_t     remote_port)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (local_iface_address > 0) && isMulticast(first_multicast_group) &&
+        isMulticast(last_multicast_group) && (first_multicast_group <= last_multicast_group) && (remote_port > 0))
+    {
+        // The socket can't be bound to a single group address (like in `udpRxInit`), so it's bound to any address.
+        // Note that on GNU/Linux such socket also receives datagrams of groups joined by other sockets of the host
+        // (see `IP_MULTICAST_ALL`), and unicast datagrams to the port - it's up to the user to filter them out.
+        bool ok = rxOpen(self, INADDR_ANY, remote_port);
+        for (uint32_t group = first_multicast_group; ok && (group <= last_multicast_group); group++)
         {
-            res = (int16_t) -errno;
-            (void) close(self->fd);
-            self->fd = -1;
+            ok = rxJoin(self, local_iface_address, group);
+            if (group == UINT32_MAX)
+            {
+                break;
+            }
         }
+        res = rxInitResult(self, ok);
     }
     return res;
 }
@@ -168,8 +426,18 @@ int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size,
     int16_t res = -EINVAL;
     if ((self != NULL) && (self->fd >= 0) && (inout_payload_size != NULL) && (out_payload != NULL))
     {
-        const ssize_t recv_result = recv(self->fd, out_payload, *inout_payload_size, MSG_DONTWAIT);
-        if (recv_result >= 0)
+#if defined(__linux__)
+        // With `MSG_TRUNC` Linux returns the real size of the datagram even if it doesn't fit into the buffer.
+        const int flags = MSG_DONTWAIT | MSG_TRUNC;
+#else
+        const int flags = MSG_DONTWAIT;
+#endif
+        const ssize_t recv_result = recv(self->fd, out_payload, *inout_payload_size, flags);
+        if ((recv_result >= 0) && ((size_t) recv_result > *inout_payload_size))
+        {
+            res = -EMSGSIZE;  // The datagram has been truncated (and so dropped) - the buffer is too small.
+        }
+        else if (recv_result >= 0)
         {
             *inout_payload_size = (size_t) recv_result;
             res                 = 1;
@@ -249,6 +517,44 @@ int16_t udpWait(const uint64_t        timeout_usec,
     return res;
 }
 
+int32_t udpGetIfaceMtu(const uint32_t local_iface_address)
+{
+    int32_t res = -EINVAL;
+    if (local_iface_address > 0)
+    {
+        struct ifaddrs* ifaddr_list = NULL;
+        if (getifaddrs(&ifaddr_list) != 0)
+        {
+            return (int32_t) -errno;
+        }
+
+        res = -ENODEV;
+        for (const struct ifaddrs* ifa = ifaddr_list; ifa != NULL; ifa = ifa->ifa_next)
+        {
+            if ((ifa->ifa_addr == NULL) || (ifa->ifa_addr->sa_family != AF_INET) ||
+                (ntohl(((const struct sockaddr_in*) ifa->ifa_addr)->sin_addr.s_addr) != local_iface_address))
+            {
+                continue;
+            }
+
+            const int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (fd < 0)
+            {
+                res = (int32_t) -errno;
+                break;
+            }
+            struct ifreq ifr;
+            (void) memset(&ifr, 0, sizeof(ifr));
+            (void) strncpy(ifr.ifr_name, ifa->ifa_name, IFNAMSIZ - 1);
+            res = (ioctl(fd, SIOCGIFMTU, &ifr) == 0) ? (int32_t) ifr.ifr_mtu : (int32_t) -errno;
+            (void) close(fd);
+            break;
+        }
+        freeifaddrs(ifaddr_list);
+    }
+    return res;
+}
+
 uint32_t udpParseIfaceAddress(const char* const address)
 {
     uint32_t out = 0;
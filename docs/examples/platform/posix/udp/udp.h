@@ -36,6 +36,8 @@ extern "C" {
 typedef struct
 {
     int fd;
+    int tos;       ///< The IP TOS value currently applied to the socket; negative if unknown.
+    int priority;  ///< The socket priority configured by `udpTxSetPriority`; negative if not configured.
 } UDPTxHandle;
 typedef struct
 {
@@ -49,6 +51,16 @@ typedef struct
 /// On error returns a negative error code.
 int16_t udpTxInit(UDPTxHandle* const self, const uint32_t local_iface_address);
 
+/// Configure OS level TX priority of the socket, and limit its send buffer size.
+/// The socket priority (Linux `SO_PRIORITY`, 0..6 w/o `CAP_NET_ADMIN`) selects the queuing discipline band,
+/// so that datagrams of a higher priority socket are not stuck behind datagrams of a lower priority one.
+/// Zero send buffer size leaves the OS default intact; otherwise, the socket stops accepting datagrams
+/// (see `udpTxSend` returning 0) while the buffer is full.
+/// The socket priority is ignored on platforms which don't support it.
+/// Linux resets the socket priority whenever `IP_TOS` is changed, so `udpTxSend` re-applies it after each change.
+/// On error returns a negative error code.
+int16_t udpTxSetPriority(UDPTxHandle* const self, const int socket_priority, const size_t send_buffer_size);
+
 /// Send a datagram to the specified endpoint without blocking using the specified IP DSCP field value.
 /// A real-time embedded system should normally accept a transmission deadline here for the networking stack.
 /// Returns 1 on success, 0 if the socket is not ready for sending, or a negative error code.
@@ -59,6 +71,45 @@ int16_t udpTxSend(UDPTxHandle* const self,
                   const size_t       payload_size,
                   const void* const  payload);
 
+/// Enable zero-copy transmission (Linux `SO_ZEROCOPY`) on the socket, so that `udpTxSendZeroCopy` could be used.
+/// Returns -ENOPROTOOPT on platforms which don't support it; the socket is still usable for `udpTxSend` then.
+/// On error returns a negative error code.
+int16_t udpTxEnableZeroCopy(UDPTxHandle* const self);
+
+/// Same as `udpTxSend`, but the kernel transmits directly from the payload memory (Linux `MSG_ZEROCOPY`).
+/// The payload memory must stay intact until the kernel reports completion of this send
+/// (see `udpTxReadZeroCopyCompletion`). Each successful send is given the next 32-bit notification ID,
+/// starting from zero for a new socket. Returns -ENOBUFS if the kernel can't pin more user memory
+/// at the moment - the regular `udpTxSend` could be used as a fallback then.
+/// Returns -ENOPROTOOPT on platforms which don't support zero-copy transmission.
+/// Returns 1 on success, 0 if the socket is not ready for sending, or a negative error code.
+int16_t udpTxSendZeroCopy(UDPTxHandle* const self,
+                          const uint32_t     remote_address,
+                          const uint16_t     remote_port,
+                          const uint8_t      dscp,
+                          const size_t       payload_size,
+                          const void* const  payload);
+
+/// Read the next zero-copy completion notification from the socket error queue without blocking.
+/// A notification covers the inclusive range of notification IDs of completed `udpTxSendZeroCopy` calls.
+/// Other (not zero-copy related) messages of the error queue are skipped.
+/// Returns 1 if a notification has been read, 0 if there is none, or a negative error code.
+int16_t udpTxReadZeroCopyCompletion(UDPTxHandle* const self, uint32_t* const out_first_id, uint32_t* const out_last_id);
+
+/// Enable software transmission timestamps (Linux `SO_TIMESTAMPING`) on the socket,
+/// so that `udpTxReadTimestamp` could be used. Each send is given the next 32-bit timestamp ID,
+/// starting from zero since this call. Not to be combined with zero-copy transmission on the same socket -
+/// both report via the socket error queue, and each reader skips notifications of the other.
+/// Returns -ENOPROTOOPT on platforms which don't support it; the socket is still usable for `udpTxSend` then.
+/// On error returns a negative error code.
+int16_t udpTxEnableTimestamping(UDPTxHandle* const self);
+
+/// Read the next transmission timestamp notification from the socket error queue without blocking.
+/// The timestamp is in microseconds of the system real-time clock (`CLOCK_REALTIME`).
+/// Other (not timestamp related) messages of the error queue are skipped.
+/// Returns 1 if a notification has been read, 0 if there is none, or a negative error code.
+int16_t udpTxReadTimestamp(UDPTxHandle* const self, uint32_t* const out_id, uint64_t* const out_timestamp_usec);
+
 /// No effect if the argument is invalid.
 /// This function is guaranteed to invalidate the handle.
 void udpTxClose(UDPTxHandle* const self);
@@ -73,9 +124,23 @@ int16_t udpRxInit(UDPRxHandle* const self,
                   const uint32_t     multicast_group,
                   const uint16_t     remote_port);
 
+/// Initialize an RX socket which receives datagrams of many multicast groups at once, f.e. for a network monitor.
+/// The socket will be bound to the specified port (of any local address), and joined to all multicast groups
+/// in the [first_multicast_group, last_multicast_group] range, so it might receive other datagrams
+/// to the same port as well (see `udpRxInit` for details of binding and joining).
+/// Note that the number of group memberships per socket is limited by the OS (f.e. by `igmp_max_memberships`
+/// sysctl on GNU/Linux, which is only 20 by default), so a wide range fails to be joined with -ENOBUFS.
+/// On error returns a negative error code.
+int16_t udpRxInitRange(UDPRxHandle* const self,
+                       const uint32_t     local_iface_address,
+                       const uint32_t     first_multicast_group,
+                       const uint32_t     last_multicast_group,
+                       const uint16_t     remote_port);
+
 /// Read one datagram from the socket without blocking.
 /// The size of the destination buffer is specified in inout_payload_size; it is updated to the actual size of the
-/// received datagram upon return.
+/// received datagram upon return. A datagram which doesn't fit into the buffer is dropped, and -EMSGSIZE is returned
+/// (detected on platforms which report real size of truncated datagrams, f.e. Linux).
 /// Returns 1 on success, 0 if the socket is not ready for reading, or a negative error code.
 int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size, void* const out_payload);
 
@@ -109,6 +174,12 @@ int16_t udpWait(const uint64_t        timeout_usec,
                 const size_t          rx_count,
                 UDPRxAwaitable* const rx);
 
+/// Query the MTU of the local network interface which has the specified address; e.g., 9000 for jumbo frames.
+/// Note that the MTU limits the whole IP packet, so the max UDP payload (w/o IP fragmentation) is smaller
+/// by the IP and UDP headers. Returns -ENODEV if there is no interface with such address.
+/// On error returns a negative error code.
+int32_t udpGetIfaceMtu(const uint32_t local_iface_address);
+
 /// Convert an interface address from string to binary representation; e.g., "127.0.0.1" --> 0x7F000001.
 /// Returns zero if the address is not recognized.
 uint32_t udpParseIfaceAddress(const char* const address);
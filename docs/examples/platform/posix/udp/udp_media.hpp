@@ -7,13 +7,20 @@
 #ifndef EXAMPLE_PLATFORM_POSIX_UPD_MEDIA_HPP_INCLUDED
 #define EXAMPLE_PLATFORM_POSIX_UPD_MEDIA_HPP_INCLUDED
 
+#include "udp.h"
 #include "udp_sockets.hpp"
+#include "zero_copy_tx_memory.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
 #include <libcyphal/executor.hpp>
+#include <libcyphal/transport/frame_monitor_sessions.hpp>
 #include <libcyphal/transport/udp/media.hpp>
 #include <libcyphal/transport/udp/tx_rx_sockets.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -34,13 +41,16 @@ public:
 
         void make(cetl::pmr::memory_resource& memory,
                   libcyphal::IExecutor&       executor,
-                  std::vector<std::string>&   iface_addresses)
+                  std::vector<std::string>&   iface_addresses,
+                  const bool                  is_zero_copy       = false,
+                  const std::size_t           mtu                = DefaultMtu,
+                  const bool                  is_tx_timestamping = false)
         {
             reset();
 
             for (const auto& iface_address : iface_addresses)
             {
-                media_vector_.emplace_back(memory, executor, iface_address);
+                media_vector_.emplace_back(memory, executor, iface_address, is_zero_copy, mtu, is_tx_timestamping);
             }
             for (auto& media : media_vector_)
             {
@@ -64,10 +74,34 @@ public:
         std::vector<IMedia*>  media_ifaces_;
     };
 
-    UdpMedia(cetl::pmr::memory_resource& memory, libcyphal::IExecutor& executor, std::string iface_address)
+    /// Default MTU of the media - fits into standard (1500 bytes) Ethernet frames.
+    static constexpr std::size_t DefaultMtu = libcyphal::transport::udp::ITxSocket::DefaultMtu;
+
+    /// Special MTU value which makes the media to derive its MTU from the MTU of the network interface,
+    /// f.e. 8908 bytes for 9000 bytes jumbo frames. Falls back to `DefaultMtu` if the interface MTU is unknown.
+    static constexpr std::size_t IfaceMtu = 0;
+
+    /// @param is_zero_copy If `true`, large TX datagrams are sent with zero-copy (where the platform supports it).
+    ///                     Their payloads are allocated from the media own TX memory (see `ZeroCopyTxMemory`).
+    /// @param mtu Max payload size (excluding Cyphal header) of TX datagrams, or `IfaceMtu`.
+    ///            RX buffers are sized to accept the biggest datagram the interface could deliver
+    ///            (but not less than needed for the given MTU), so peers with bigger MTU are still heard.
+    /// @param is_tx_timestamping If `true`, TX sockets report kernel timestamps of sent datagrams (where supported,
+    ///                           and only without zero-copy) - f.e. for the time synchronization master.
+    ///
+    UdpMedia(cetl::pmr::memory_resource& memory,
+             libcyphal::IExecutor&       executor,
+             std::string                 iface_address,
+             const bool                  is_zero_copy       = false,
+             const std::size_t           mtu                = DefaultMtu,
+             const bool                  is_tx_timestamping = false)
         : memory_{memory}
         , executor_{executor}
         , iface_address_{std::move(iface_address)}
+        , is_zero_copy_{is_zero_copy}
+        , mtu_{mtu}
+        , is_tx_timestamping_{is_tx_timestamping}
+        , zero_copy_tx_memory_{memory}
     {
     }
     ~UdpMedia() = default;
@@ -80,6 +114,10 @@ public:
         : memory_{other.memory_}
         , executor_{other.executor_}
         , iface_address_{other.iface_address_}
+        , is_zero_copy_{other.is_zero_copy_}
+        , mtu_{other.mtu_}
+        , is_tx_timestamping_{other.is_tx_timestamping_}
+        , zero_copy_tx_memory_{other.memory_}
     {
     }
 
@@ -88,24 +126,117 @@ private:
 
     MakeTxSocketResult::Type makeTxSocket() override
     {
-        return UdpTxSocket::make(memory_, executor_, iface_address_);
+        return UdpTxSocket::make(memory_,
+                                 executor_,
+                                 iface_address_,
+                                 getTxMtu(),
+                                 getZeroCopyTxMemory(),
+                                 is_tx_timestamping_);
+    }
+
+    MakeTxSocketResult::Type makeBandTxSocket(const TxBandParams& params) override
+    {
+        return UdpTxSocket::make(memory_,
+                                 executor_,
+                                 iface_address_,
+                                 params,
+                                 getTxMtu(),
+                                 getZeroCopyTxMemory(),
+                                 is_tx_timestamping_);
     }
 
     MakeRxSocketResult::Type makeRxSocket(const libcyphal::transport::udp::IpEndpoint& multicast_endpoint) override
     {
-        return UdpRxSocket::make(memory_, executor_, iface_address_, multicast_endpoint);
+        return UdpRxSocket::make(memory_, executor_, iface_address_, multicast_endpoint, getRxBufferSize());
+    }
+
+    /// Joins multicast groups of all subjects of the range by a single socket (see `UdpRxSocket::makeRange`),
+    /// so the range is limited by the OS limit of group memberships per socket (see `udpRxInitRange`).
+    /// Service transfers are not supported b/c each node has its own group of service transfers (`239.1.x.x`),
+    /// and there are too many of them to be joined.
+    ///
+    MakeRxSocketResult::Type makeFrameMonitorRxSocket(const libcyphal::transport::FrameMonitorRxParams& params) override
+    {
+        // Per Cyphal/UDP Specification, messages are sent to the `239.0.x.x` multicast group of the subject.
+        constexpr std::uint32_t SubjectMulticastPrefix = 0xEF000000UL;
+        constexpr std::uint16_t UdpPort                = 9382U;
+
+        if (params.with_services)
+        {
+            return libcyphal::ArgumentError{};
+        }
+        return UdpRxSocket::makeRange(memory_,
+                                      executor_,
+                                      iface_address_,
+                                      SubjectMulticastPrefix | static_cast<std::uint32_t>(params.subject_id_first),
+                                      SubjectMulticastPrefix | static_cast<std::uint32_t>(params.subject_id_last),
+                                      UdpPort,
+                                      getRxBufferSize());
     }
 
     cetl::pmr::memory_resource& getTxMemoryResource() override
     {
+        if (is_zero_copy_)
+        {
+            return zero_copy_tx_memory_;
+        }
         return memory_;
     }
 
+    ZeroCopyTxMemory* getZeroCopyTxMemory() noexcept
+    {
+        return is_zero_copy_ ? &zero_copy_tx_memory_ : nullptr;
+    }
+
+    /// The interface MTU is queried on each socket creation (rather than once), so that the media
+    /// picks up changes of the interface configuration when the transport recreates its sockets.
+    ///
+    std::size_t getTxMtu() const
+    {
+        // Max IPv4 header (60 bytes), UDP header (8 bytes) and Cyphal header (24 bytes).
+        constexpr std::size_t TxHeadersSize = 92;
+
+        if (mtu_ != IfaceMtu)
+        {
+            return mtu_;
+        }
+        const auto iface_mtu = queryIfaceMtu();
+        return (iface_mtu > TxHeadersSize) ? (iface_mtu - TxHeadersSize) : DefaultMtu;
+    }
+
+    std::size_t getRxBufferSize() const
+    {
+        constexpr std::size_t IpUdpHeadersSize = 28;  // Min IPv4 header (20 bytes) and UDP header (8 bytes).
+        constexpr std::size_t CyphalHeaderSize = 24;
+
+        std::size_t buffer_size = UdpRxSocket::DefaultBufferSize;
+        buffer_size             = std::max(buffer_size, getTxMtu() + CyphalHeaderSize);
+
+        const auto iface_mtu = queryIfaceMtu();
+        if (iface_mtu > IpUdpHeadersSize)
+        {
+            buffer_size = std::max(buffer_size, iface_mtu - IpUdpHeadersSize);
+        }
+        return buffer_size;
+    }
+
+    /// @return MTU of the network interface, or zero if it's unknown.
+    ///
+    std::size_t queryIfaceMtu() const
+    {
+        const std::int32_t result = ::udpGetIfaceMtu(::udpParseIfaceAddress(iface_address_.c_str()));
+        return (result > 0) ? static_cast<std::size_t>(result) : 0;
+    }
+
     // MARK: Data members:
 
     cetl::pmr::memory_resource& memory_;
     libcyphal::IExecutor&       executor_;
     std::string                 iface_address_;
+    bool                        is_zero_copy_;
+    std::size_t                 mtu_;
+    bool                        is_tx_timestamping_;
+    ZeroCopyTxMemory            zero_copy_tx_memory_;
 
 };  // UdpMedia
 
@@ -10,6 +10,7 @@
 #include "../posix_executor_extension.hpp"
 #include "../posix_platform_error.hpp"
 #include "udp.h"
+#include "zero_copy_tx_memory.hpp"
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
@@ -22,12 +23,17 @@
 #include <libcyphal/transport/udp/tx_rx_sockets.hpp>
 #include <libcyphal/types.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cerrno>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <unistd.h>
 #include <utility>
+#include <vector>
 
 namespace example
 {
@@ -39,38 +45,95 @@ namespace posix
 class UdpTxSocket final : public libcyphal::transport::udp::ITxSocket
 {
 public:
+    /// @brief Makes a new TX socket.
+    ///
+    /// @param mtu Max payload size (excluding Cyphal header) of datagrams which the transport will send via
+    ///            the socket. Bigger than default values are useful with jumbo frames (see `udpGetIfaceMtu`).
+    /// @param zero_copy_memory Optional TX memory resource of the media. If provided (and supported by the platform),
+    ///                         large datagrams allocated from it are sent with zero-copy (see `ZeroCopyTxMemory`).
+    /// @param is_tx_timestamping If `true` (and supported by the platform), sent datagrams are timestamped
+    ///                           by the kernel (see `udpTxEnableTimestamping`). Ignored when zero-copy is in use.
+    ///
     CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeTxSocketResult::Type make(
         cetl::pmr::memory_resource& memory,
         libcyphal::IExecutor&       executor,
-        const std::string&          iface_address)
+        const std::string&          iface_address,
+        const std::size_t           mtu                = DefaultMtu,
+        ZeroCopyTxMemory* const     zero_copy_memory   = nullptr,
+        const bool                  is_tx_timestamping = false)
     {
-        UDPTxHandle handle{-1};
+        UDPTxHandle handle{-1, -1, -1};
         const auto  result = ::udpTxInit(&handle, ::udpParseIfaceAddress(iface_address.c_str()));
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
         }
 
-        auto tx_socket = libcyphal::makeUniquePtr<ITxSocket, UdpTxSocket>(memory, executor, handle);
-        if (tx_socket == nullptr)
+        return make(memory, executor, handle, mtu, zero_copy_memory, is_tx_timestamping);
+    }
+
+    CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeTxSocketResult::Type make(
+        cetl::pmr::memory_resource&                            memory,
+        libcyphal::IExecutor&                                  executor,
+        const std::string&                                     iface_address,
+        const libcyphal::transport::udp::IMedia::TxBandParams& band_params,
+        const std::size_t                                      mtu                = DefaultMtu,
+        ZeroCopyTxMemory* const                                zero_copy_memory   = nullptr,
+        const bool                                             is_tx_timestamping = false)
+    {
+        UDPTxHandle handle{-1, -1, -1};
+        auto        result = ::udpTxInit(&handle, ::udpParseIfaceAddress(iface_address.c_str()));
+        if (result < 0)
+        {
+            return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
+        }
+
+        result = ::udpTxSetPriority(&handle, getSocketPriority(band_params), getSendBufferSize(band_params, mtu));
+        if (result < 0)
         {
             ::udpTxClose(&handle);
-            return libcyphal::MemoryError{};
+            return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
         }
 
-        return tx_socket;
+        return make(memory, executor, handle, mtu, zero_copy_memory, is_tx_timestamping);
     }
 
-    UdpTxSocket(libcyphal::IExecutor& executor, UDPTxHandle udp_handle)
+    UdpTxSocket(libcyphal::IExecutor&   executor,
+                UDPTxHandle             udp_handle,
+                const std::size_t       mtu                = DefaultMtu,
+                ZeroCopyTxMemory* const zero_copy_memory   = nullptr,
+                const bool              is_tx_timestamping = false)
         : udp_handle_{udp_handle}
         , executor_{executor}
+        , mtu_{mtu}
+        , zero_copy_memory_{zero_copy_memory}
+        , is_tx_timestamping_{is_tx_timestamping}
     {
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+
+        if (zero_copy_memory_ != nullptr)
+        {
+            setupZeroCopyReaping();
+        }
     }
 
     ~UdpTxSocket()
     {
+        zero_copy_reaping_callback_.reset();
+        if (error_queue_fd_ >= 0)
+        {
+            ::close(error_queue_fd_);
+        }
         ::udpTxClose(&udp_handle_);
+
+        // Completions of still in-flight zero-copy sends will never be read now, so let their payloads go.
+        for (const auto* const payload : zero_copy_in_flight_)
+        {
+            if (payload != nullptr)
+            {
+                zero_copy_memory_->unpin(payload);
+            }
+        }
     }
 
     UdpTxSocket(const UdpTxSocket&)                = delete;
@@ -79,8 +142,75 @@ public:
     UdpTxSocket& operator=(UdpTxSocket&&) noexcept = delete;
 
 private:
+    CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeTxSocketResult::Type make(
+        cetl::pmr::memory_resource& memory,
+        libcyphal::IExecutor&       executor,
+        UDPTxHandle&                handle,
+        const std::size_t           mtu,
+        ZeroCopyTxMemory*           zero_copy_memory,
+        bool                        is_tx_timestamping)
+    {
+        // Zero-copy is an optimization, so just fall back to the regular sending if the platform doesn't support it.
+        if ((zero_copy_memory != nullptr) && (::udpTxEnableZeroCopy(&handle) < 0))
+        {
+            zero_copy_memory = nullptr;
+        }
+
+        // Timestamps are best-effort as well, and they share the socket error queue with zero-copy completions.
+        is_tx_timestamping =
+            is_tx_timestamping && (zero_copy_memory == nullptr) && (::udpTxEnableTimestamping(&handle) >= 0);
+
+        auto tx_socket = libcyphal::makeUniquePtr<ITxSocket, UdpTxSocket>(memory,
+                                                                          executor,
+                                                                          handle,
+                                                                          mtu,
+                                                                          zero_copy_memory,
+                                                                          is_tx_timestamping);
+        if (tx_socket == nullptr)
+        {
+            ::udpTxClose(&handle);
+            return libcyphal::MemoryError{};
+        }
+
+        return tx_socket;
+    }
+
+    /// Maps band priorities to Linux socket priority (which in turn selects `pfifo_fast`/`prio` qdisc band):
+    /// 6 - interactive, 0 - best effort, and 2 - bulk.
+    ///
+    CETL_NODISCARD static int getSocketPriority(const libcyphal::transport::udp::IMedia::TxBandParams& band_params)
+    {
+        using libcyphal::transport::Priority;
+
+        if (band_params.highest_priority <= Priority::Immediate)
+        {
+            return 6;  // NOLINT(*-magic-numbers)
+        }
+        if (band_params.highest_priority <= Priority::Nominal)
+        {
+            return 0;
+        }
+        return 2;
+    }
+
+    /// Approximates send buffer size which can hold the given number of max size datagrams.
+    /// Note that Linux doubles requested `SO_SNDBUF` value to account its own bookkeeping overhead.
+    ///
+    CETL_NODISCARD static std::size_t getSendBufferSize(
+        const libcyphal::transport::udp::IMedia::TxBandParams& band_params,
+        const std::size_t                                      mtu)
+    {
+        constexpr std::size_t DatagramOverhead = 256;  // IP/UDP headers and OS per packet accounting.
+        return band_params.max_pending_datagrams * (mtu + DatagramOverhead) / 2U;
+    }
+
     // MARK: ITxSocket
 
+    CETL_NODISCARD std::size_t getMtu() const noexcept override
+    {
+        return mtu_;
+    }
+
     SendResult::Type send(const libcyphal::TimePoint,
                           const libcyphal::transport::udp::IpEndpoint  multicast_endpoint,
                           const std::uint8_t                           dscp,
@@ -89,16 +219,26 @@ private:
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
         CETL_DEBUG_ASSERT(payload_fragments.size() == 1, "");
 
-        const std::int16_t result = ::udpTxSend(&udp_handle_,
-                                                multicast_endpoint.ip_address,
-                                                multicast_endpoint.udp_port,
-                                                dscp,
-                                                payload_fragments[0].size(),
-                                                payload_fragments[0].data());
+        const auto payload = payload_fragments[0];
+
+        std::int16_t result = 0;
+        if (!trySendZeroCopy(multicast_endpoint, dscp, payload, result))
+        {
+            result = ::udpTxSend(&udp_handle_,
+                                 multicast_endpoint.ip_address,
+                                 multicast_endpoint.udp_port,
+                                 dscp,
+                                 payload.size(),
+                                 payload.data());
+        }
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
         }
+        if ((result == 1) && is_tx_timestamping_)
+        {
+            return SendResult::Success{true, readTxTimestampOf(next_timestamp_id_++)};
+        }
 
         return SendResult::Success{result == 1};
     }
@@ -118,10 +258,152 @@ private:
                                                                  udp_handle_.fd});
     }
 
+    /// Tries to send the payload with zero-copy (if it's enabled and applicable to the payload).
+    ///
+    /// @return `true` if the send has been attempted (see `out_result`); `false` if the payload
+    ///         should be sent in the regular (copying) way.
+    ///
+    bool trySendZeroCopy(const libcyphal::transport::udp::IpEndpoint multicast_endpoint,
+                         const std::uint8_t                          dscp,
+                         const cetl::span<const cetl::byte>          payload,
+                         std::int16_t&                               out_result)
+    {
+        if ((zero_copy_memory_ == nullptr) || (getZeroCopyInFlightCount() >= MaxZeroCopyInFlight) ||
+            !zero_copy_memory_->tryPin(payload.data(), payload.size()))
+        {
+            return false;
+        }
+
+        out_result = ::udpTxSendZeroCopy(&udp_handle_,
+                                         multicast_endpoint.ip_address,
+                                         multicast_endpoint.udp_port,
+                                         dscp,
+                                         payload.size(),
+                                         payload.data());
+        if (out_result == 1)
+        {
+            // The kernel gives consecutive notification IDs to successful zero-copy sends.
+            zero_copy_in_flight_[next_zero_copy_id_ % MaxZeroCopyInFlight] = payload.data();
+            ++next_zero_copy_id_;
+            return true;
+        }
+
+        zero_copy_memory_->unpin(payload.data());
+
+        // The kernel can't pin more user pages at the moment, so fall back to copying.
+        return out_result != -ENOBUFS;
+    }
+
+    std::uint32_t getZeroCopyInFlightCount() const noexcept
+    {
+        return next_zero_copy_id_ - oldest_zero_copy_id_;
+    }
+
+    /// Makes the executor to reap zero-copy completions as soon as they appear in the socket error queue.
+    ///
+    /// The socket descriptor is already awaited for writability by the transport (and a descriptor could be
+    /// awaited only once), so a duplicate of the descriptor is awaited instead - both share the error queue.
+    /// Zero-copy is disabled if completions can't be awaited, so that payloads don't stay pinned forever.
+    ///
+    void setupZeroCopyReaping()
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor_);
+        error_queue_fd_                = ::dup(udp_handle_.fd);
+        if ((posix_executor_ext != nullptr) && (error_queue_fd_ >= 0))
+        {
+            zero_copy_reaping_callback_ = posix_executor_ext->registerAwaitableCallback(  //
+                [this](const auto&) {
+                    //
+                    reapZeroCopyCompletions();
+                },
+                IPosixExecutorExtension::Trigger::Erroneous{error_queue_fd_});
+        }
+        if (!zero_copy_reaping_callback_)
+        {
+            zero_copy_memory_ = nullptr;
+        }
+    }
+
+    /// Reads all available zero-copy completions, and unpins payloads of the completed sends.
+    ///
+    /// The error queue is drained completely (even if there are no sends in flight) b/c its readiness
+    /// is level-triggered - otherwise the executor would keep calling the reaping back.
+    ///
+    void reapZeroCopyCompletions()
+    {
+        std::uint32_t first_id = 0;
+        std::uint32_t last_id  = 0;
+        while (::udpTxReadZeroCopyCompletion(&udp_handle_, &first_id, &last_id) > 0)
+        {
+            // The range is inclusive, and may wrap around 32-bit IDs.
+            const std::uint32_t in_flight_count = getZeroCopyInFlightCount();
+            for (std::uint32_t offset = 0; offset < in_flight_count; ++offset)
+            {
+                const std::uint32_t id = oldest_zero_copy_id_ + offset;
+                if (static_cast<std::uint32_t>(id - first_id) <= static_cast<std::uint32_t>(last_id - first_id))
+                {
+                    const cetl::byte*& payload = zero_copy_in_flight_[id % MaxZeroCopyInFlight];
+                    if (payload != nullptr)
+                    {
+                        zero_copy_memory_->unpin(payload);
+                        payload = nullptr;
+                    }
+                }
+            }
+            // Completions usually come in order, but the oldest send could still be in flight.
+            while ((oldest_zero_copy_id_ != next_zero_copy_id_) &&
+                   (zero_copy_in_flight_[oldest_zero_copy_id_ % MaxZeroCopyInFlight] == nullptr))
+            {
+                ++oldest_zero_copy_id_;
+            }
+        }
+    }
+
+    /// Reads all available TX timestamps, and returns the one of the given send (if it's already available).
+    ///
+    /// The kernel usually timestamps a datagram before `sendmsg` returns (when the datagram is handed to the driver),
+    /// but it might be delayed by queueing (f.e. by a qdisc) - then the timestamp is just skipped on the next read.
+    /// The timestamp is converted from the real-time clock of the kernel to the executor's monotonic clock.
+    ///
+    cetl::optional<libcyphal::TimePoint> readTxTimestampOf(const std::uint32_t send_id)
+    {
+        cetl::optional<libcyphal::TimePoint> tx_timestamp;
+
+        std::uint32_t id           = 0;
+        std::uint64_t timestamp_us = 0;
+        while (::udpTxReadTimestamp(&udp_handle_, &id, &timestamp_us) > 0)
+        {
+            if (id == send_id)
+            {
+                const auto realtime_now = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::system_clock::now().time_since_epoch());
+                const auto age =
+                    realtime_now - std::chrono::microseconds{static_cast<std::chrono::microseconds::rep>(timestamp_us)};
+
+                tx_timestamp = executor_.now() - std::max(age, std::chrono::microseconds::zero());
+            }
+        }
+        return tx_timestamp;
+    }
+
+    /// Payloads of zero-copy sends in flight are indexed by their notification IDs (modulo this capacity).
+    /// There can't be more of them than pinnable blocks anyway.
+    static constexpr std::uint32_t MaxZeroCopyInFlight = ZeroCopyTxMemory::BlocksCount;
+    static_assert((MaxZeroCopyInFlight & (MaxZeroCopyInFlight - 1U)) == 0, "Must divide 2^32 (ID wrap around).");
+
     // MARK: Data members:
 
-    UDPTxHandle           udp_handle_;
-    libcyphal::IExecutor& executor_;
+    UDPTxHandle                                        udp_handle_;
+    libcyphal::IExecutor&                              executor_;
+    const std::size_t                                  mtu_;
+    ZeroCopyTxMemory*                                  zero_copy_memory_;
+    std::uint32_t                                      oldest_zero_copy_id_{0};
+    std::uint32_t                                      next_zero_copy_id_{0};
+    std::array<const cetl::byte*, MaxZeroCopyInFlight> zero_copy_in_flight_{};
+    int                                                error_queue_fd_{-1};
+    const bool                                         is_tx_timestamping_;
+    std::uint32_t                                      next_timestamp_id_{0};
+    libcyphal::IExecutor::Callback::Any                zero_copy_reaping_callback_;
 
 };  // UdpTxSocket
 
@@ -130,34 +412,57 @@ private:
 class UdpRxSocket final : public libcyphal::transport::udp::IRxSocket
 {
 public:
+    /// Default size of the receive buffer - enough for datagrams of standard (1500 bytes) Ethernet frames.
+    static constexpr std::size_t DefaultBufferSize = 2000;
+
+    /// @brief Makes a new RX socket.
+    ///
+    /// @param buffer_size Size of the receive buffer, which limits size of acceptable datagrams (including
+    ///                    Cyphal header). Datagrams which don't fit into the buffer are dropped.
+    ///
     CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeRxSocketResult::Type make(
         cetl::pmr::memory_resource&                  memory,
         libcyphal::IExecutor&                        executor,
         const std::string&                           address,
-        const libcyphal::transport::udp::IpEndpoint& endpoint)
+        const libcyphal::transport::udp::IpEndpoint& endpoint,
+        const std::size_t                            buffer_size = DefaultBufferSize)
     {
         UDPRxHandle handle{-1};
         const auto  result =
             ::udpRxInit(&handle, ::udpParseIfaceAddress(address.c_str()), endpoint.ip_address, endpoint.udp_port);
-        if (result < 0)
-        {
-            return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
-        }
-
-        auto rx_socket = libcyphal::makeUniquePtr<IRxSocket, UdpRxSocket>(memory, executor, handle, memory);
-        if (rx_socket == nullptr)
-        {
-            ::udpRxClose(&handle);
-            return libcyphal::MemoryError{};
-        }
+        return makeFrom(memory, executor, handle, result, buffer_size);
+    }
 
-        return rx_socket;
+    /// @brief Makes a new RX socket which receives datagrams of a range of multicast groups at once.
+    ///
+    /// The socket is joined to all groups in the `[first_ip_address, last_ip_address]` range (see `udpRxInitRange`).
+    ///
+    CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeRxSocketResult::Type makeRange(
+        cetl::pmr::memory_resource& memory,
+        libcyphal::IExecutor&       executor,
+        const std::string&          address,
+        const std::uint32_t         first_ip_address,
+        const std::uint32_t         last_ip_address,
+        const std::uint16_t         udp_port,
+        const std::size_t           buffer_size = DefaultBufferSize)
+    {
+        UDPRxHandle handle{-1};
+        const auto  result = ::udpRxInitRange(&handle,
+                                              ::udpParseIfaceAddress(address.c_str()),
+                                              first_ip_address,
+                                              last_ip_address,
+                                              udp_port);
+        return makeFrom(memory, executor, handle, result, buffer_size);
     }
 
-    UdpRxSocket(libcyphal::IExecutor& executor, UDPRxHandle udp_handle, cetl::pmr::memory_resource& memory)
+    UdpRxSocket(libcyphal::IExecutor&       executor,
+                UDPRxHandle                 udp_handle,
+                cetl::pmr::memory_resource& memory,
+                const std::size_t           buffer_size = DefaultBufferSize)
         : udp_handle_{udp_handle}
         , executor_{executor}
         , memory_{memory}
+        , buffer_(buffer_size)
     {
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
     }
@@ -173,7 +478,28 @@ public:
     UdpRxSocket& operator=(UdpRxSocket&&) noexcept = delete;
 
 private:
-    static constexpr std::size_t BufferSize = 2000;
+    CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeRxSocketResult::Type makeFrom(
+        cetl::pmr::memory_resource& memory,
+        libcyphal::IExecutor&       executor,
+        UDPRxHandle                 handle,
+        const std::int16_t          init_result,
+        const std::size_t           buffer_size)
+    {
+        if (init_result < 0)
+        {
+            return libcyphal::transport::PlatformError{PosixPlatformError{-init_result}};
+        }
+
+        auto rx_socket =
+            libcyphal::makeUniquePtr<IRxSocket, UdpRxSocket>(memory, executor, handle, memory, buffer_size);
+        if (rx_socket == nullptr)
+        {
+            ::udpRxClose(&handle);
+            return libcyphal::MemoryError{};
+        }
+
+        return rx_socket;
+    }
 
     // MARK: IRxSocket
 
@@ -182,12 +508,12 @@ private:
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
 
         // Current Udpard api limitation is not allowing to pass bigger buffer than actual data size is.
-        // Hence, we need temp buffer on stack, and then memory copying.
+        // Hence, we need temp buffer, and then memory copying. The buffer is allocated once (per socket)
+        // b/c it could be too big for the stack - f.e. with jumbo frames.
         // TODO: Eliminate tmp buffer and memmove when https://github.com/OpenCyphal/libudpard/issues/58 is resolved.
         //
-        std::array<cetl::byte, BufferSize> buffer{};
-        std::size_t                        inout_size = buffer.size();
-        const std::int16_t                 result     = ::udpRxReceive(&udp_handle_, &inout_size, buffer.data());
+        std::size_t        inout_size = buffer_.size();
+        const std::int16_t result     = ::udpRxReceive(&udp_handle_, &inout_size, buffer_.data());
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
@@ -202,7 +528,7 @@ private:
         {
             return libcyphal::MemoryError{};
         }
-        (void) std::memmove(allocated_buffer, buffer.data(), inout_size);
+        (void) std::memmove(allocated_buffer, buffer_.data(), inout_size);
 
         return ReceiveResult::Metadata{executor_.now(),
                                        {static_cast<cetl::byte*>(allocated_buffer),
@@ -229,6 +555,7 @@ private:
     UDPRxHandle                 udp_handle_;
     libcyphal::IExecutor&       executor_;
     cetl::pmr::memory_resource& memory_;
+    std::vector<cetl::byte>     buffer_;
 
 };  // UdpRxSocket
 
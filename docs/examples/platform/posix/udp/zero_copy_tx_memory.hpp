@@ -0,0 +1,209 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_POSIX_UDP_ZERO_COPY_TX_MEMORY_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_POSIX_UDP_ZERO_COPY_TX_MEMORY_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace example
+{
+namespace platform
+{
+namespace posix
+{
+
+/// @brief Defines TX payload memory resource which keeps datagram payloads alive while the kernel references them.
+///
+/// With `MSG_ZEROCOPY` the kernel transmits directly from the user memory, so a payload block must not be
+/// deallocated (and then reused) until the kernel reports completion of the send via the socket error queue.
+/// The transport deallocates a TX datagram payload as soon as a socket has accepted it, so this resource
+/// defers actual deallocation of "pinned" blocks until the socket unpins them (on the completion notification).
+///
+/// Large payloads are served from a pool of fixed-size blocks, which is allocated from the upstream memory
+/// once (on the first large payload), so that neither allocation nor pinning of a block allocates or searches.
+/// Blocks which were not allocated from the pool (f.e. reused buffers of TX streams, or payloads when the pool
+/// is exhausted) can't be pinned, so sockets send such payloads in the regular (copying) way. The same is for
+/// small payloads - page pinning and completion handling cost more than copying of a few kilobytes.
+///
+class ZeroCopyTxMemory final : public cetl::pmr::memory_resource
+{
+public:
+    /// Zero-copy pays off only for large (f.e. jumbo) datagrams.
+    static constexpr std::size_t DefaultMinPayloadSize = 8192;
+
+    /// Size of a pool block - enough for a datagram of 9000 bytes jumbo frames.
+    static constexpr std::size_t BlockSize = 9216;
+
+    /// Number of pool blocks, and so the max number of zero-copy sends in flight.
+    static constexpr std::size_t BlocksCount = 64;
+
+    explicit ZeroCopyTxMemory(cetl::pmr::memory_resource& upstream,
+                              const std::size_t           min_payload_size = DefaultMinPayloadSize)
+        : upstream_{upstream}
+        , min_payload_size_{min_payload_size}
+    {
+    }
+
+    ~ZeroCopyTxMemory() override
+    {
+        // Normally only released (but still pinned) blocks could be left in the pool - if sockets were closed
+        // before their completions were read. The kernel doesn't reference them anymore at this point.
+        if (pool_ != nullptr)
+        {
+            upstream_.deallocate(pool_, PoolSize, PoolAlignment);
+        }
+    }
+
+    ZeroCopyTxMemory(const ZeroCopyTxMemory&)                = delete;
+    ZeroCopyTxMemory(ZeroCopyTxMemory&&) noexcept            = delete;
+    ZeroCopyTxMemory& operator=(const ZeroCopyTxMemory&)     = delete;
+    ZeroCopyTxMemory& operator=(ZeroCopyTxMemory&&) noexcept = delete;
+
+    /// @brief Pins the given payload block, so that its deallocation is deferred until `unpin`.
+    ///
+    /// @return `true` if the block belongs to the pool, and it's large enough to be sent with zero-copy
+    ///         (and so has been pinned); otherwise `false`.
+    ///
+    bool tryPin(const void* const data, const std::size_t size) noexcept
+    {
+        Block* const block = findBlock(data);
+        if ((block == nullptr) || (size < min_payload_size_))
+        {
+            return false;
+        }
+        ++block->pins;
+        return true;
+    }
+
+    /// @brief Unpins the given payload block, and returns it to the pool if it's already released by its owner.
+    ///
+    void unpin(const void* const data) noexcept
+    {
+        Block* const block = findBlock(data);
+        if (block == nullptr)
+        {
+            return;
+        }
+
+        CETL_DEBUG_ASSERT(block->pins > 0, "");
+        --block->pins;
+        if ((block->pins == 0) && block->is_released)
+        {
+            releaseBlock(*block);
+        }
+    }
+
+private:
+    static constexpr std::size_t PoolSize      = BlockSize * BlocksCount;
+    static constexpr std::size_t PoolAlignment = alignof(std::max_align_t);
+    static constexpr std::size_t NoBlock       = BlocksCount;
+
+    struct Block
+    {
+        std::size_t pins;
+        bool        is_released;
+        std::size_t next_free;
+    };
+
+    /// Allocates the pool (if not yet), and links all its blocks into the free list.
+    ///
+    bool ensurePool()
+    {
+        if ((pool_ == nullptr) && !is_pool_failed_)
+        {
+            pool_           = static_cast<cetl::byte*>(upstream_.allocate(PoolSize, PoolAlignment));
+            is_pool_failed_ = (pool_ == nullptr);
+            for (std::size_t index = 0; index < BlocksCount; ++index)
+            {
+                blocks_[index] = Block{0, false, index + 1U};
+            }
+            free_head_ = 0;
+        }
+        return pool_ != nullptr;
+    }
+
+    /// @return The block of the pool which starts at the given address, or `nullptr` if there is no such.
+    ///
+    Block* findBlock(const void* const data) noexcept
+    {
+        // No Sonar `cpp:S3630` b/c it's the only way to check that a pointer belongs to the pool.
+        const auto address = reinterpret_cast<std::uintptr_t>(data);   // NOLINT NOSONAR cpp:S3630
+        const auto begin   = reinterpret_cast<std::uintptr_t>(pool_);  // NOLINT NOSONAR cpp:S3630
+        if ((pool_ == nullptr) || (address < begin) || ((address - begin) >= PoolSize) ||
+            (((address - begin) % BlockSize) != 0))
+        {
+            return nullptr;
+        }
+        return &blocks_[(address - begin) / BlockSize];
+    }
+
+    void releaseBlock(Block& block) noexcept
+    {
+        block.is_released = false;
+        block.next_free   = free_head_;
+        free_head_        = static_cast<std::size_t>(&block - blocks_.data());
+    }
+
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(std::size_t size_bytes, std::size_t alignment) override
+    {
+        if ((size_bytes >= min_payload_size_) && (size_bytes <= BlockSize) && (alignment <= PoolAlignment) &&
+            ensurePool() && (free_head_ != NoBlock))
+        {
+            const std::size_t index = free_head_;
+            free_head_              = blocks_[index].next_free;
+            blocks_[index]          = Block{0, false, NoBlock};
+            return pool_ + (index * BlockSize);  // NOLINT(*-pointer-arithmetic)
+        }
+        return upstream_.allocate(size_bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t size_bytes, std::size_t alignment) override
+    {
+        Block* const block = findBlock(ptr);
+        if (block == nullptr)
+        {
+            upstream_.deallocate(ptr, size_bytes, alignment);
+            return;
+        }
+
+        if (block->pins > 0)
+        {
+            // The kernel may still read the block - postpone its return to the pool until the last `unpin`.
+            block->is_released = true;
+            return;
+        }
+        releaseBlock(*block);
+    }
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&    upstream_;
+    const std::size_t              min_payload_size_;
+    cetl::byte*                    pool_{nullptr};
+    bool                           is_pool_failed_{false};
+    std::size_t                    free_head_{NoBlock};
+    std::array<Block, BlocksCount> blocks_{};
+
+};  // ZeroCopyTxMemory
+
+}  // namespace posix
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_POSIX_UDP_ZERO_COPY_TX_MEMORY_HPP_INCLUDED
@@ -11,14 +11,22 @@
 #include <libcyphal/platform/storage.hpp>
 #include <libcyphal/types.hpp>
 
+#include <algorithm>
 #include <cerrno>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <stdio.h>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace example
 {
@@ -116,6 +124,212 @@ private:
 
 };  // KeyValue
 
+/// Decorates another (blocking) key-value storage with write-behind caching.
+///
+/// - Reads are served from an in-memory cache (populated by previous writes, or by complete reads of the underlying
+///   storage - a read which has filled the whole `data` buffer might be truncated, so it isn't cached).
+/// - Writes (`put` and `drop`) only update the cache, and are queued to a background worker thread,
+///   which writes them to the underlying storage. Repeated writes of the same key are coalesced -
+///   only the latest value is written (once), if the key is still waiting in the queue.
+/// - `flush` is a barrier - it blocks until all queued writes have been completed (f.e. at shutdown,
+///   or before a node restart), and reports the first error (if any) of the background writes since previous flush.
+///
+/// As a result, storage latency doesn't leak into the executor thread (f.e. on `uavcan.register.Access` bursts).
+/// Note that `drop` of a non-existing key is not reported as an error (b/c it's not known synchronously).
+///
+class WriteBehindKeyValue final : public libcyphal::platform::storage::IKeyValue
+{
+public:
+    using Error = libcyphal::platform::storage::Error;
+
+    explicit WriteBehindKeyValue(libcyphal::platform::storage::IKeyValue& storage)
+        : storage_{storage}
+        , worker_{[this] { runWorker(); }}
+    {
+    }
+
+    WriteBehindKeyValue(const WriteBehindKeyValue&)                = delete;
+    WriteBehindKeyValue(WriteBehindKeyValue&&) noexcept            = delete;
+    WriteBehindKeyValue& operator=(const WriteBehindKeyValue&)     = delete;
+    WriteBehindKeyValue& operator=(WriteBehindKeyValue&&) noexcept = delete;
+
+    ~WriteBehindKeyValue()
+    {
+        (void) flush();
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            is_stopping_ = true;
+        }
+        queue_cv_.notify_all();
+        worker_.join();
+    }
+
+    /// Blocks until all queued writes have been written to the underlying storage.
+    ///
+    /// @return The first error of the background writes since the previous flush (if any).
+    ///
+    cetl::optional<Error> flush()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        idle_cv_.wait(lock, [this] { return queue_.empty() && (!is_writing_); });
+        return std::exchange(first_error_, cetl::nullopt);
+    }
+
+private:
+    struct Entry
+    {
+        /// The latest value of the key; `nullopt` if the key is dropped.
+        cetl::optional<std::vector<std::uint8_t>> value;
+
+        /// Whether the key is waiting in the queue to be written.
+        bool is_queued;
+    };
+
+    static std::string makeKey(const cetl::string_view key)
+    {
+        return std::string{key.cbegin(), key.cend()};
+    }
+
+    void enqueue(std::string&& key, cetl::optional<std::vector<std::uint8_t>>&& value)
+    {
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+
+            auto& entry = cache_[key];
+            entry.value = std::move(value);
+            if (!entry.is_queued)
+            {
+                entry.is_queued = true;
+                queue_.push_back(std::move(key));
+            }
+        }
+        queue_cv_.notify_one();
+    }
+
+    void runWorker()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        while (true)
+        {
+            queue_cv_.wait(lock, [this] { return is_stopping_ || (!queue_.empty()); });
+            if (queue_.empty())
+            {
+                break;  // Stopping, and nothing left to write.
+            }
+
+            // Take a snapshot of the latest value, so that the key could be updated (and queued again)
+            // while we are writing it to the storage.
+            //
+            const std::string key = std::move(queue_.front());
+            queue_.pop_front();
+            auto& entry      = cache_[key];
+            entry.is_queued  = false;
+            const auto value = entry.value;
+            is_writing_      = true;
+
+            lock.unlock();
+            const auto failure = writeToStorage(key, value);
+            lock.lock();
+
+            is_writing_ = false;
+            if (failure.has_value() && (!first_error_.has_value()))
+            {
+                first_error_ = failure;
+            }
+            if (queue_.empty())
+            {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+
+    cetl::optional<Error> writeToStorage(const std::string&                               key,
+                                         const cetl::optional<std::vector<std::uint8_t>>& value)
+    {
+        const std::lock_guard<std::mutex> lock{storage_mutex_};
+
+        const cetl::string_view key_view{key.data(), key.size()};
+        if (value.has_value())
+        {
+            return storage_.put(key_view, {value->data(), value->size()});
+        }
+        const auto failure = storage_.drop(key_view);
+        return (failure == Error::Existence) ? cetl::nullopt : failure;
+    }
+
+    // MARK: - libcyphal::platform::storage::IKeyValue
+
+    auto get(const cetl::string_view        key,
+             const cetl::span<std::uint8_t> data) const -> libcyphal::Expected<std::size_t, Error> override
+    {
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+
+            const auto it = cache_.find(makeKey(key));
+            if (it != cache_.end())
+            {
+                const auto& value = it->second.value;
+                if (!value.has_value())
+                {
+                    return Error::Existence;
+                }
+                const auto size = std::min(value->size(), data.size());
+                (void) std::copy_n(value->cbegin(), size, data.begin());
+                return size;
+            }
+        }
+
+        // Not cached yet - read from the underlying storage (the worker might be using it concurrently).
+        //
+        std::unique_lock<std::mutex> storage_lock{storage_mutex_};
+        auto                         result = storage_.get(key, data);
+        storage_lock.unlock();
+
+        // Cache the value only if it's known to be complete (or known to be missing).
+        //
+        const auto* const size = cetl::get_if<std::size_t>(&result);
+        if ((size != nullptr) && (*size < data.size()))
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            (void) cache_.emplace(makeKey(key), Entry{std::vector<std::uint8_t>{data.begin(), data.begin() + *size}});
+        }
+        else if ((cetl::get_if<Error>(&result) != nullptr) && (cetl::get<Error>(result) == Error::Existence))
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            (void) cache_.emplace(makeKey(key), Entry{});
+        }
+        return result;
+    }
+
+    auto put(const cetl::string_view key, const cetl::span<const std::uint8_t> data)  //
+        -> cetl::optional<Error> override
+    {
+        enqueue(makeKey(key), std::vector<std::uint8_t>{data.begin(), data.end()});
+        return cetl::nullopt;
+    }
+
+    auto drop(const cetl::string_view key) -> cetl::optional<Error> override
+    {
+        enqueue(makeKey(key), cetl::nullopt);
+        return cetl::nullopt;
+    }
+
+    // MARK: Data members:
+
+    libcyphal::platform::storage::IKeyValue&       storage_;
+    mutable std::mutex                             mutex_;
+    mutable std::mutex                             storage_mutex_;
+    std::condition_variable                        queue_cv_;
+    std::condition_variable                        idle_cv_;
+    mutable std::unordered_map<std::string, Entry> cache_;
+    std::deque<std::string>                        queue_;
+    bool                                           is_writing_{false};
+    bool                                           is_stopping_{false};
+    cetl::optional<Error>                          first_error_;
+    std::thread                                    worker_;
+
+};  // WriteBehindKeyValue
+
 }  // namespace storage
 }  // namespace platform
 }  // namespace example
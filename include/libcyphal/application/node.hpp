@@ -10,6 +10,7 @@
 #include "libcyphal/types.hpp"
 #include "node/get_info_provider.hpp"
 #include "node/heartbeat_producer.hpp"
+#include "node/port_list_producer.hpp"
 #include "node/registry_provider.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
@@ -115,6 +116,39 @@ public:
         return cetl::nullopt;
     }
 
+    /// @brief Gets reference to the optional 'PortListProducer' component.
+    ///
+    /// By default, node does not create the port list producer (`cetl::nullopt`).
+    /// Use `makePortListProducer` method to create the port list producer.
+    ///
+    cetl::optional<node::PortListProducer>& getPortListProducer() noexcept
+    {
+        return port_list_producer_;
+    }
+
+    /// @brief Makes a new 'PortListProducer' component.
+    ///
+    /// Replaces the existing one if it was already created.
+    /// Use `getPortListProducer` method to get a reference to the producer optional.
+    ///
+    /// @return Possible failure to make a new producer instance. `nullptr` on success.
+    ///
+    cetl::optional<MakeFailure> makePortListProducer()
+    {
+        // Reset the existing producer if any.
+        // Otherwise, the new producer will publish its list in parallel with the old one.
+        port_list_producer_.reset();
+
+        auto maybe_producer = node::PortListProducer::make(presentation_);
+        if (auto* const failure = cetl::get_if<MakeFailure>(&maybe_producer))
+        {
+            return std::move(*failure);
+        }
+
+        (void) port_list_producer_.emplace(cetl::get<node::PortListProducer>(std::move(maybe_producer)));
+        return cetl::nullopt;
+    }
+
 private:
     Node(presentation::Presentation& presentation,
          node::GetInfoProvider&&     get_info_provider,
@@ -131,6 +165,7 @@ private:
     node::GetInfoProvider                  get_info_provider_;
     node::HeartbeatProducer                heartbeat_producer_;
     cetl::optional<node::RegistryProvider> registry_provider_;
+    cetl::optional<node::PortListProducer> port_list_producer_;
 
 };  // Node
 
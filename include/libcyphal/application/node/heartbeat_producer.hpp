@@ -10,14 +10,19 @@
 #include "libcyphal/executor.hpp"
 #include "libcyphal/presentation/presentation.hpp"
 #include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/presentation/template_publisher.hpp"
+#include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/transport.hpp"
 #include "libcyphal/types.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pmr/function.hpp>
 
+#include <nunavut/support/serialization.hpp>
+
 #include <uavcan/node/Heartbeat_1_0.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -32,7 +37,9 @@ namespace node
 
 /// @brief Defines 'Heartbeat' producer component for the application node.
 ///
-/// Internally, it uses the 'Heartbeat' message publisher to periodically publish heartbeat messages.
+/// Internally, it uses the 'Heartbeat' message template publisher to periodically publish heartbeat messages.
+/// The message is serialized only once - all its fields have fixed layout, so on each publication
+/// they are just patched in-place within the pre-serialized payload template.
 ///
 /// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
 /// We need custom move constructor to reset up the publishing callback,
@@ -53,13 +60,25 @@ public:
     static auto make(presentation::Presentation& presentation)
         -> Expected<HeartbeatProducer, presentation::Presentation::MakeFailure>
     {
-        auto maybe_heartbeat_pub = presentation.makePublisher<Publisher::Message>();
+        auto maybe_heartbeat_pub = presentation.makePublisher<Message>();
         if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_heartbeat_pub))
         {
             return std::move(*failure);
         }
 
-        return HeartbeatProducer{presentation, cetl::get<Publisher>(std::move(maybe_heartbeat_pub))};
+        Message message{Message::allocator_type{&presentation.memory()}};
+        auto    maybe_template_pub =
+            Publisher::make(cetl::get<presentation::Publisher<Message>>(std::move(maybe_heartbeat_pub)), message);
+        if (cetl::get_if<nunavut::support::Error>(&maybe_template_pub) != nullptr)
+        {
+            // Serialization of the fixed-size heartbeat message is not supposed to fail.
+            CETL_DEBUG_ASSERT(false, "Unexpected heartbeat serialization failure.");
+            return presentation::Presentation::MakeFailure{transport::ArgumentError{}};
+        }
+
+        return HeartbeatProducer{presentation,
+                                 cetl::get<Publisher>(std::move(maybe_template_pub)),
+                                 std::move(message)};
     }
 
     HeartbeatProducer(HeartbeatProducer&& other) noexcept
@@ -133,13 +152,22 @@ public:
 
 private:
     using Callback  = IExecutor::Callback;
-    using Publisher = presentation::Publisher<Message>;
+    using Publisher = presentation::TemplatePublisher<Message>;
 
-    HeartbeatProducer(presentation::Presentation& presentation, Publisher&& publisher)
+    /// Byte offsets of the heartbeat fields within its serialized payload (see `uavcan.node.Heartbeat.1.0`).
+    struct Offsets
+    {
+        static constexpr std::size_t Uptime = 0U;
+        static constexpr std::size_t Health = 4U;
+        static constexpr std::size_t Mode   = 5U;
+        static constexpr std::size_t Vssc   = 6U;
+    };
+
+    HeartbeatProducer(presentation::Presentation& presentation, Publisher&& publisher, Message&& message)
         : presentation_{presentation}
         , startup_time_{presentation.executor().now()}
         , publisher_{std::move(publisher)}
-        , message_{Message::allocator_type{&presentation.memory()}}
+        , message_{std::move(message)}
         , next_exec_time_{startup_time_}
     {
         startPublishing();
@@ -184,11 +212,21 @@ private:
             update_callback_fn_(UpdateCallback::Arg{message_, approx_now});
         }
 
+        // Patch the pre-serialized template. Health and mode are saturated to their `uint2` and `uint3` ranges
+        // (the same way as DSDL serialization would do it).
+        //
+        constexpr std::uint8_t HealthMax = 3U;
+        constexpr std::uint8_t ModeMax   = 7U;
+        (void) publisher_.patch(Offsets::Uptime, message_.uptime);
+        (void) publisher_.patch(Offsets::Health, std::min(message_.health.value, HealthMax));
+        (void) publisher_.patch(Offsets::Mode, std::min(message_.mode.value, ModeMax));
+        (void) publisher_.patch(Offsets::Vssc, message_.vendor_specific_status_code);
+
         // Deadline for the next publication is the current time plus 1s publication period -
         // it has no sense to keep the message in the queue for longer than that.
         // There is nothing we can do about possible publishing failures - we just ignore them.
         // TODO: Introduce error handler at the node level.
-        (void) publisher_.publish(approx_now + getPeriod(), message_);
+        (void) publisher_.publish(approx_now + getPeriod());
     }
 
     void stopPublishing()
@@ -200,7 +238,7 @@ private:
 
     presentation::Presentation& presentation_;
     const TimePoint             startup_time_;
-    const Publisher             publisher_;
+    Publisher                   publisher_;
     Callback::Any               periodic_cb_;
     Message                     message_;
     UpdateCallback::Function    update_callback_fn_;
@@ -0,0 +1,239 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PRODUCER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PRODUCER_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/node/port/List_0_1.hpp>
+#include <uavcan/node/port/ServiceIDList_0_1.hpp>
+#include <uavcan/node/port/SubjectIDList_0_1.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'uavcan.node.port.List' producer component for the application node.
+///
+/// Publishes the list of ports (publishers, subscribers, clients and servers) made by the presentation layer,
+/// so that network monitoring tools could discover the node's port configuration without sniffing the traffic.
+///
+/// The presentation layer keeps its ports incrementally (see `Presentation::forEachPortId`), so the producer
+/// just checks the ports revision once per second, and builds & publishes a new message only if the port
+/// configuration has changed, or if the message hasn't been published for the max publication period (10s).
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the publishing callback,
+/// but at the destructor level, we don't need to do anything.
+///
+class PortListProducer final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the port list.
+    ///
+    using Message = uavcan::node::port::List_0_1;
+
+    /// @brief Factory method to create a port list producer instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'port.List' publisher,
+    ///                     as well as to introspect all other ports made by the presentation layer.
+    /// @return The port list producer instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<PortListProducer, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_port_list_pub = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_port_list_pub))
+        {
+            return std::move(*failure);
+        }
+
+        return PortListProducer{presentation, cetl::get<Publisher>(std::move(maybe_port_list_pub))};
+    }
+
+    PortListProducer(PortListProducer&& other) noexcept
+        : presentation_{other.presentation_}
+        , publisher_{other.publisher_}
+        , message_{std::move(other.message_)}
+        , published_revision_{other.published_revision_}
+        , last_publish_time_{other.last_publish_time_}
+        , next_exec_time_{other.next_exec_time_}
+    {
+        // We can't move `periodic_cb_` callback (b/c it captures its own `this` pointer),
+        // so we need to stop it in the moved-from object, and start in the new one.
+        other.stopPublishing();
+        startPublishing();
+    }
+
+    ~PortListProducer() = default;
+
+    PortListProducer(const PortListProducer&)                = delete;
+    PortListProducer& operator=(const PortListProducer&)     = delete;
+    PortListProducer& operator=(PortListProducer&&) noexcept = delete;
+
+private:
+    using Callback  = IExecutor::Callback;
+    using Publisher = presentation::Publisher<Message>;
+    using PortKind  = presentation::Presentation::PortKind;
+
+    /// Max number of subject IDs in the sparse list variant of `uavcan.node.port.SubjectIDList.0.1`.
+    /// Bigger sets of subjects are encoded as the mask (of all possible subject IDs) variant.
+    static constexpr std::size_t SparseListCapacity = 255U;
+
+    PortListProducer(presentation::Presentation& presentation, Publisher&& publisher)
+        : presentation_{presentation}
+        , publisher_{std::move(publisher)}
+        , message_{Message::allocator_type{&presentation.memory()}}
+        , last_publish_time_{presentation.executor().now()}
+        , next_exec_time_{last_publish_time_}
+    {
+        publisher_.setPriority(transport::Priority::Optional);
+        startPublishing();
+    }
+
+    /// Period of checking whether the port configuration has changed.
+    /// It also limits rate of publications caused by often changes.
+    ///
+    static constexpr Duration getCheckPeriod()
+    {
+        return std::chrono::seconds(1);
+    }
+
+    /// See `MAX_PUBLICATION_PERIOD` of the message.
+    ///
+    static constexpr Duration getMaxPublicationPeriod()
+    {
+        return std::chrono::seconds(10);
+    }
+
+    void startPublishing()
+    {
+        periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            // We keep track of the next execution time to allow
+            // smooth rescheduling to the new instance in the move constructor.
+            next_exec_time_ = arg.exec_time + getCheckPeriod();
+
+            publishMessageIfNeeded(arg.approx_now);
+        });
+
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, getCheckPeriod()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void stopPublishing()
+    {
+        periodic_cb_.reset();
+    }
+
+    void publishMessageIfNeeded(const TimePoint approx_now)
+    {
+        // Publishing of the port list makes sense only if the local node ID is known.
+        if (presentation_.transport().getLocalNodeId() == cetl::nullopt)
+        {
+            return;
+        }
+
+        const std::size_t revision   = presentation_.getPortsRevision();
+        const bool        is_changed = (!published_revision_) || (*published_revision_ != revision);
+        if ((!is_changed) && ((approx_now - last_publish_time_) < getMaxPublicationPeriod()))
+        {
+            return;
+        }
+
+        // The message is (re)built only here, so its cost is proportional to the number of ports,
+        // but it's paid only on port configuration changes (or once per the max publication period).
+        //
+        fillSubjectIds(PortKind::Publisher, message_.publishers);
+        fillSubjectIds(PortKind::Subscriber, message_.subscribers);
+        fillServiceIds(PortKind::Client, message_.clients);
+        fillServiceIds(PortKind::Server, message_.servers);
+
+        // Deadline for the publication is the current time plus the check period -
+        // it has no sense to keep the message in the queue for longer than that.
+        // In case of a publishing failure, the message will be published again on the next check.
+        if (!publisher_.publish(approx_now + getCheckPeriod(), message_))
+        {
+            published_revision_ = revision;
+            last_publish_time_  = approx_now;
+        }
+    }
+
+    void fillSubjectIds(const PortKind kind, uavcan::node::port::SubjectIDList_0_1& subject_ids) const
+    {
+        std::size_t count = 0;
+        presentation_.forEachPortId(kind, [&count](const transport::PortId) { ++count; });
+
+        if (count <= SparseListCapacity)
+        {
+            auto& sparse_list = subject_ids.set_sparse_list();
+            sparse_list.reserve(count);
+            presentation_.forEachPortId(kind, [&sparse_list](const transport::PortId subject_id) {
+                //
+                sparse_list.emplace_back();
+                sparse_list.back().value = subject_id;
+            });
+            return;
+        }
+
+        auto& mask = subject_ids.set_mask();
+        presentation_.forEachPortId(kind, [&mask](const transport::PortId subject_id) {
+            //
+            if (subject_id < mask.size())
+            {
+                mask[subject_id] = true;
+            }
+        });
+    }
+
+    void fillServiceIds(const PortKind kind, uavcan::node::port::ServiceIDList_0_1& service_ids) const
+    {
+        auto& mask = service_ids.mask;
+        for (std::size_t service_id = 0; service_id < mask.size(); ++service_id)
+        {
+            mask[service_id] = false;
+        }
+        presentation_.forEachPortId(kind, [&mask](const transport::PortId service_id) {
+            //
+            if (service_id < mask.size())
+            {
+                mask[service_id] = true;
+            }
+        });
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Publisher                   publisher_;
+    Callback::Any               periodic_cb_;
+    Message                     message_;
+    cetl::optional<std::size_t> published_revision_;
+    TimePoint                   last_publish_time_;
+    TimePoint                   next_exec_time_;
+
+};  // PortListProducer
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PRODUCER_HPP_INCLUDED
@@ -0,0 +1,183 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_TIME_TIME_SYNC_MASTER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_TIME_TIME_SYNC_MASTER_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/time/Synchronization_1_0.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace time
+{
+
+/// @brief Defines time synchronization master component for the application node.
+///
+/// Periodically publishes 'uavcan.time.Synchronization' messages, each of which carries the transmission timestamp
+/// of the previous message (see the DSDL definition for the algorithm). The master time is the executor's clock.
+///
+/// Transmission timestamps are reported by the transport media (see `IMessageTxSession::setOnTxTimestampCallback`).
+/// If the media can't report them, the master still publishes messages, but with zero (aka unknown) timestamps,
+/// so slaves won't be able to synchronize.
+///
+class TimeSyncMaster final
+{
+public:
+    /// @brief Defines the message type for the time synchronization.
+    ///
+    using Message = uavcan::time::Synchronization_1_0;
+
+    /// @brief Factory method to create a time synchronization master instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Synchronization' publisher.
+    /// @return The time synchronization master instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<TimeSyncMaster, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_sync_pub = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_sync_pub))
+        {
+            return std::move(*failure);
+        }
+
+        return TimeSyncMaster{presentation, cetl::get<Publisher>(std::move(maybe_sync_pub))};
+    }
+
+    TimeSyncMaster(TimeSyncMaster&& other) noexcept
+        : presentation_{other.presentation_}
+        , publisher_{other.publisher_}
+        , last_tx_timestamp_{other.last_tx_timestamp_}
+        , last_publish_time_{other.last_publish_time_}
+        , next_exec_time_{other.next_exec_time_}
+    {
+        // We can't move `periodic_cb_` callback (and the TX timestamp callback, b/c both capture `this` pointer),
+        // so we need to stop them in the moved-from object, and start in the new one.
+        other.stopPublishing();
+        startPublishing();
+    }
+
+    ~TimeSyncMaster()
+    {
+        stopPublishing();
+    }
+
+    TimeSyncMaster(const TimeSyncMaster&)                = delete;
+    TimeSyncMaster& operator=(const TimeSyncMaster&)     = delete;
+    TimeSyncMaster& operator=(TimeSyncMaster&&) noexcept = delete;
+
+private:
+    using Callback  = IExecutor::Callback;
+    using Publisher = presentation::Publisher<Message>;
+
+    TimeSyncMaster(presentation::Presentation& presentation, Publisher&& publisher)
+        : presentation_{presentation}
+        , publisher_{std::move(publisher)}
+        , last_publish_time_{presentation.executor().now()}
+        , next_exec_time_{last_publish_time_}
+    {
+        startPublishing();
+    }
+
+    /// Publication period of the master - see `MAX_PUBLICATION_PERIOD` of the message.
+    ///
+    static constexpr Duration getPeriod()
+    {
+        return std::chrono::seconds(1);
+    }
+
+    void startPublishing()
+    {
+        publisher_.setOnTxTimestampCallback([this](const auto& arg) {
+            //
+            last_tx_timestamp_ = arg.timestamp;
+        });
+
+        periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            // We keep track of the next execution time to allow
+            // smooth rescheduling to the new instance in the move constructor.
+            next_exec_time_ = arg.exec_time + getPeriod();
+
+            publishMessage(arg.approx_now);
+        });
+
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, getPeriod()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void stopPublishing()
+    {
+        // Only the active (not moved-from) master owns the TX timestamp callback of the shared publisher session.
+        if (periodic_cb_)
+        {
+            periodic_cb_.reset();
+            publisher_.setOnTxTimestampCallback({});
+        }
+    }
+
+    void publishMessage(const TimePoint approx_now)
+    {
+        // Anonymous nodes can't be masters - slaves need the master node ID.
+        if (presentation_.transport().getLocalNodeId() == cetl::nullopt)
+        {
+            last_tx_timestamp_.reset();
+            return;
+        }
+
+        // The reported timestamp belongs to the previous message only if the message has been transmitted
+        // after the previous publication (a late report of an even older message must not be used).
+        // Half of the period is used as a margin b/c of possible conversion jitter of the media timestamps.
+        //
+        std::uint64_t previous_tx_us = 0;
+        if (last_tx_timestamp_ && ((*last_tx_timestamp_ + (getPeriod() / 2)) > last_publish_time_))
+        {
+            const auto tx_us = std::chrono::duration_cast<std::chrono::microseconds>(  //
+                last_tx_timestamp_->time_since_epoch());
+            previous_tx_us = static_cast<std::uint64_t>(tx_us.count());
+        }
+        last_tx_timestamp_.reset();
+        last_publish_time_ = approx_now;
+
+        Message message{Message::allocator_type{&presentation_.memory()}};
+        message.previous_transmission_timestamp_microsecond = previous_tx_us;
+
+        // Deadline for the next publication is the current time plus the publication period -
+        // it has no sense to keep the message in the queue for longer than that.
+        // There is nothing we can do about possible publishing failures - we just ignore them.
+        (void) publisher_.publish(approx_now + getPeriod(), message);
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Publisher                   publisher_;
+    Callback::Any               periodic_cb_;
+    cetl::optional<TimePoint>   last_tx_timestamp_;
+    TimePoint                   last_publish_time_;
+    TimePoint                   next_exec_time_;
+
+};  // TimeSyncMaster
+
+}  // namespace time
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_TIME_TIME_SYNC_MASTER_HPP_INCLUDED
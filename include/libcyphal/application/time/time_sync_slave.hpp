@@ -0,0 +1,217 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_TIME_TIME_SYNC_SLAVE_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_TIME_TIME_SYNC_SLAVE_HPP_INCLUDED
+
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/time/Synchronization_1_0.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace time
+{
+
+/// @brief Defines time synchronization slave component for the application node.
+///
+/// Subscribes to 'uavcan.time.Synchronization' messages, and maintains offset of the master clock
+/// relative to the executor's clock (see the DSDL definition for the algorithm). So, the synchronized clock
+/// is available (via `now`) alongside the executor's monotonic `now()`.
+///
+/// If there are several masters, the one with the lowest node ID is preferred. A master is considered lost
+/// if it hasn't published anything during the timeout (3 seconds) - then another master could be picked up.
+///
+class TimeSyncSlave final
+{
+public:
+    /// @brief Defines the message type for the time synchronization.
+    ///
+    using Message = uavcan::time::Synchronization_1_0;
+
+    /// @brief Factory method to create a time synchronization slave instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Synchronization' subscriber.
+    /// @return The time synchronization slave instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<TimeSyncSlave, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_sync_sub = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_sync_sub))
+        {
+            return std::move(*failure);
+        }
+
+        return TimeSyncSlave{presentation, cetl::get<Subscriber>(std::move(maybe_sync_sub))};
+    }
+
+    TimeSyncSlave(TimeSyncSlave&& other) noexcept
+        : presentation_{other.presentation_}
+        , subscriber_{std::move(other.subscriber_)}
+        , master_{other.master_}
+        , offset_{other.offset_}
+    {
+        // We can't move the subscriber callback (b/c it captures `this` pointer), so we need to set it up again.
+        setupOnReceiveCallback();
+    }
+
+    ~TimeSyncSlave() = default;
+
+    TimeSyncSlave(const TimeSyncSlave&)                = delete;
+    TimeSyncSlave& operator=(const TimeSyncSlave&)     = delete;
+    TimeSyncSlave& operator=(TimeSyncSlave&&) noexcept = delete;
+
+    /// @brief Gets the current time of the master clock.
+    ///
+    /// @return The synchronized time, or `nullopt` if not synchronized (yet or anymore).
+    ///
+    cetl::optional<TimePoint> now() const
+    {
+        if (const auto offset = getOffset())
+        {
+            return presentation_.executor().now() + *offset;
+        }
+        return cetl::nullopt;
+    }
+
+    /// @brief Gets offset of the master clock relative to the executor's clock.
+    ///
+    /// @return The offset, or `nullopt` if not synchronized (yet or anymore).
+    ///
+    cetl::optional<Duration> getOffset() const
+    {
+        if (!isMasterAlive(presentation_.executor().now()))
+        {
+            return cetl::nullopt;
+        }
+        return offset_;
+    }
+
+    /// @brief Gets node ID of the current master.
+    ///
+    /// @return The master node ID, or `nullopt` if there is no alive master.
+    ///
+    cetl::optional<transport::NodeId> getMasterNodeId() const
+    {
+        if (!isMasterAlive(presentation_.executor().now()))
+        {
+            return cetl::nullopt;
+        }
+        return master_->node_id;
+    }
+
+private:
+    using Subscriber = presentation::Subscriber<Message>;
+
+    /// Holds what is known about the previous message of the current master.
+    struct MasterState
+    {
+        transport::NodeId     node_id;
+        transport::TransferId transfer_id;
+        TimePoint             rx_timestamp;
+    };
+
+    TimeSyncSlave(presentation::Presentation& presentation, Subscriber&& subscriber)
+        : presentation_{presentation}
+        , subscriber_{std::move(subscriber)}
+    {
+        setupOnReceiveCallback();
+    }
+
+    /// Timeout of a master - see `MAX_PUBLICATION_PERIOD` and `PUBLISHER_TIMEOUT_PERIOD_MULTIPLIER` of the message.
+    ///
+    static constexpr Duration getMasterTimeout()
+    {
+        return std::chrono::seconds(3);
+    }
+
+    CETL_NODISCARD bool isMasterAlive(const TimePoint now) const
+    {
+        return master_ && ((now - master_->rx_timestamp) < getMasterTimeout());
+    }
+
+    /// Transfer IDs of Cyphal/CAN are just 5-bit (so wrap around after 31),
+    /// whereas Cyphal/UDP ones are 64-bit (and so practically never wrap).
+    ///
+    CETL_NODISCARD static bool isNextTransferId(const transport::TransferId prev, const transport::TransferId next)
+    {
+        constexpr transport::TransferId CanTransferIdMax = 31U;
+        return (next == (prev + 1U)) || ((prev == CanTransferIdMax) && (next == 0U));
+    }
+
+    void setupOnReceiveCallback()
+    {
+        subscriber_.setOnReceiveCallback([this](const auto& arg) {
+            //
+            onReceiveMessage(arg.message, arg.metadata);
+        });
+    }
+
+    void onReceiveMessage(const Message& message, const transport::MessageRxMetadata& metadata)
+    {
+        // Anonymous masters are not allowed - we need to tell apart different masters.
+        if (!metadata.publisher_node_id)
+        {
+            return;
+        }
+        const transport::NodeId master_node_id = *metadata.publisher_node_id;
+        const TimePoint         rx_timestamp   = metadata.rx_meta.timestamp;
+        const auto              transfer_id    = metadata.rx_meta.base.transfer_id;
+
+        if (isMasterAlive(rx_timestamp) && (master_->node_id != master_node_id))
+        {
+            // Ignore a master with higher node ID while the current one is alive; otherwise switch to the new one
+            // (and start over b/c time bases of different masters are not related).
+            if (master_node_id > master_->node_id)
+            {
+                return;
+            }
+            master_.reset();
+        }
+
+        // The message carries TX timestamp of the previous one (in the master clock), so together
+        // with RX timestamp of the previous message (in our clock) we have the clock offset.
+        // Zero timestamp means that the master doesn't know it.
+        //
+        const std::uint64_t previous_tx_us = message.previous_transmission_timestamp_microsecond;
+        if ((previous_tx_us != 0) && isMasterAlive(rx_timestamp) && isNextTransferId(master_->transfer_id, transfer_id))
+        {
+            const std::chrono::microseconds master_tx{static_cast<std::chrono::microseconds::rep>(previous_tx_us)};
+            offset_ = master_tx - master_->rx_timestamp.time_since_epoch();
+        }
+        else if (!isMasterAlive(rx_timestamp))
+        {
+            offset_.reset();
+        }
+
+        master_ = MasterState{master_node_id, transfer_id, rx_timestamp};
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Subscriber                  subscriber_;
+    cetl::optional<MasterState> master_;
+    cetl::optional<Duration>    offset_;
+
+};  // TimeSyncSlave
+
+}  // namespace time
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_TIME_TIME_SYNC_SLAVE_HPP_INCLUDED
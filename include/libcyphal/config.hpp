@@ -105,6 +105,36 @@ struct Config
             /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
             return sizeof(void*) * 4;
         }
+
+        /// Defines max number of remote publishers which reception metrics are tracked individually
+        /// per subscription (when the metrics are enabled). The least recently heard publisher is evicted
+        /// when a new one appears, so the capacity should cover the expected number of publishers of a subject.
+        ///
+        static constexpr std::size_t RxMetrics_SourcesCapacity()
+        {
+            /// Capacity is chosen arbitrary - as compromise between memory footprint and typical network size.
+            return 8;
+        }
+
+        /// Defines max size of a raw message payload which could be restored by a decompressing raw subscriber.
+        /// Compressed frames which claim bigger original size are not decompressed (but passed as is) -
+        /// this protects the subscriber's memory from malformed or malicious frames.
+        ///
+        static constexpr std::size_t RawCompression_MaxPayloadSize()
+        {
+            /// Size is chosen arbitrary - it should cover the biggest expected raw message.
+            return 65536;
+        }
+
+        /// Defines max number of client nodes which request rates are tracked individually per server
+        /// (when its admission control is enabled). The least recently heard client is evicted
+        /// when a new one appears, so the capacity should cover the expected number of clients of a service.
+        ///
+        static constexpr std::size_t ServerAdmission_ClientsCapacity()
+        {
+            /// Capacity is chosen arbitrary - as compromise between memory footprint and typical network size.
+            return 8;
+        }
     };
 
     /// Defines various configuration parameters for the transport layer.
@@ -120,6 +150,22 @@ struct Config
             return sizeof(void*) * 4;
         }
 
+        /// Defines max footprint of a callback function in use by the message TX session timestamp notification.
+        ///
+        static constexpr std::size_t IMessageTxSession_OnTxTimestampCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+            return sizeof(void*) * 4;
+        }
+
+        /// Defines max footprint of a callback function in use by the message TX session capacity notification.
+        ///
+        static constexpr std::size_t IMessageTxSession_OnTxCapacityCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+            return sizeof(void*) * 4;
+        }
+
         /// Defines max footprint of a callback function in use by the service RX session notification.
         /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
         ///
@@ -129,6 +175,31 @@ struct Config
             return sizeof(void*) * 4;
         }
 
+        /// Defines max footprint of a callback function in use by the frame monitor RX session notification.
+        ///
+        static constexpr std::size_t IFrameMonitorRxSession_OnFrameCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+            return sizeof(void*) * 4;
+        }
+
+        /// Defines max number of concurrent multi-frame transfers reassembled by a frame monitor RX session.
+        /// The least recently started reassembly is replaced by a new one when all of them are busy.
+        ///
+        static constexpr std::size_t FrameMonitorRxSession_ReassemblySlotsCapacity()  // NOSONAR cpp:S799
+        {
+            /// Capacity is chosen arbitrary - as compromise between memory footprint and bus load.
+            return 8;
+        }
+
+        /// Defines max footprint of a per port fault rates function in use by the fault injecting media decorators.
+        ///
+        static constexpr std::size_t FaultInjection_PortRatesFunctionMaxSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+            return sizeof(void*) * 4;
+        }
+
         /// Defines max footprint of a platform-specific error implementation.
         ///
         static constexpr std::size_t PlatformErrorMaxSize()
@@ -145,6 +216,16 @@ struct Config
             return sizeof(void*) * 8;
         }
 
+        /// Defines max number of remote sources per message RX session, which latest delivered transfer IDs
+        /// are remembered while the RX reassembly budget is enabled. After an eviction of the session, duplicates
+        /// of such transfers are still rejected (within the transfer-ID timeout).
+        ///
+        static constexpr std::size_t RxReassemblyBudget_DeliveredSourcesCapacity()  // NOSONAR cpp:S799
+        {
+            /// Capacity is chosen arbitrary - as compromise between memory footprint and typical network size.
+            return 8;
+        }
+
         /// Defines various configuration parameters for the CAN transport sublayer.
         ///
         struct Can
@@ -157,6 +238,15 @@ struct Config
                 return sizeof(void*) * 3;
             }
 
+            /// Defines period (in microseconds) of re-checking number of TX frames in flight of a media,
+            /// when the transport has stopped pushing frames to the media b/c of the in-flight limit.
+            ///
+            static constexpr std::size_t TxInFlightRecheckPeriodUs()
+            {
+                /// Roughly a transmission time of a classic CAN frame at 1 Mbit/s.
+                return 100;
+            }
+
         };  // Can
 
         /// Defines various configuration parameters for the UDO transport sublayer.
@@ -171,6 +261,14 @@ struct Config
                 return sizeof(void*) * 3;
             }
 
+            /// Defines max footprint of a callback function in use by the message stream RX session notification.
+            ///
+            static constexpr std::size_t IMessageStreamRxSession_OnChunkCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
         };  // Udp
 
     };  // Transport
@@ -55,13 +55,39 @@ public:
             /// @brief Defines schedule which will execute callback function at the specified execution time, and
             /// then repeatedly at `exec_time + (N * period)` with strict period advancement, no phase error growth.
             ///
+            /// When an execution is late by one or more whole periods (f.e. after a long callback, or when the
+            /// thread has been descheduled), the overrun policy defines what happens with the missed periods.
+            /// Any policy keeps the phase - execution times are always `exec_time + (N * period)`.
+            ///
             struct Repeat
             {
+                /// @brief Defines policies of handling missed periods.
+                ///
+                enum class Overrun : std::uint8_t
+                {
+                    /// All missed periods are executed back-to-back (until the callback catches up).
+                    /// Nothing is lost, but there is a burst of executions after a stall.
+                    CatchUp,
+
+                    /// Missed periods are skipped - the next execution is at the nearest future period.
+                    Skip,
+
+                    /// Up to `max_burst` missed periods are executed back-to-back, and the rest are skipped.
+                    LimitBurst,
+                };
+
                 /// Absolute time point when it's desired to execute it first time.
                 TimePoint exec_time;
 
                 /// Positive (non-zero) period between each callback execution.
                 Duration period;
+
+                /// Policy of handling missed periods.
+                Overrun overrun{Overrun::CatchUp};
+
+                /// Max number of missed periods executed back-to-back (in addition to the late execution itself).
+                /// In use only by the `Overrun::LimitBurst` policy; zero is equivalent to `Overrun::Skip`.
+                std::uint32_t max_burst{1};
             };
 
             using Variant = cetl::variant<Once, Repeat>;
@@ -100,6 +126,23 @@ public:
         ///
         using Function = cetl::pmr::function<void(const Arg& arg), FunctionMaxSize>;
 
+        /// @brief Defines overrun accounting of a callback.
+        ///
+        /// Counters are accumulated since the callback registration (rescheduling doesn't reset them).
+        ///
+        struct OverrunStats
+        {
+            /// Number of executions which were late by one or more whole periods (of `Schedule::Repeat`).
+            std::size_t overruns{0};
+
+            /// Number of periods which were skipped (not executed at all) according to the overrun policy.
+            std::size_t missed_periods{0};
+
+            /// Max observed lateness of an execution (aka `approx_now - exec_time`).
+            Duration max_lateness{};
+
+        };  // OverrunStats
+
         /// @brief Defines maximum size of callback implementation.
         ///
         /// Size is chosen arbitrary, but it should be enough to store any callback implementation.
@@ -132,6 +175,15 @@ public:
             ///
             virtual void schedule(const Schedule::Variant& schedule) = 0;
 
+            /// @brief Gets overrun accounting of the callback.
+            ///
+            /// @return `nullopt` if the executor doesn't track overruns (default).
+            ///
+            virtual cetl::optional<OverrunStats> getOverrunStats() const
+            {
+                return cetl::nullopt;
+            }
+
             // MARK: RTTI
 
             static constexpr cetl::type_id _get_type_id_() noexcept
@@ -213,6 +265,19 @@ public:
                 return false;
             }
 
+            /// @brief Gets overrun accounting of the callback.
+            ///
+            /// @return `nullopt` if the callback had been reset, or if its executor doesn't track overruns.
+            ///
+            cetl::optional<OverrunStats> getOverrunStats()
+            {
+                if (const auto* const interface = getInterface())
+                {
+                    return interface->getOverrunStats();
+                }
+                return cetl::nullopt;
+            }
+
         };  // Any
 
     };  // Callback
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 #include <utility>
@@ -136,6 +137,8 @@ protected:
             , function_{std::move(other.function_)}
             , next_exec_time_{other.next_exec_time_}
             , schedule_{other.schedule_}
+            , overrun_stats_{other.overrun_stats_}
+            , burst_count_{other.burst_count_}
         {
         }
 
@@ -147,10 +150,12 @@ protected:
         {
             CETL_DEBUG_ASSERT(schedule_, "");
 
+            overrun_stats_.max_lateness = std::max(overrun_stats_.max_lateness, arg.approx_now - arg.exec_time);
+
             next_exec_time_ = cetl::visit(  //
                 cetl::make_overloaded(      //
                     [](const Callback::Schedule::Once&) { return TimePointNever(); },
-                    [&arg](const Callback::Schedule::Repeat& repeat) { return arg.exec_time + repeat.period; }),
+                    [this, &arg](const Callback::Schedule::Repeat& repeat) { return nextRepeatTime(repeat, arg); }),
                 *schedule_);  // NOLINT(bugprone-unchecked-optional-access)
         }
 
@@ -178,7 +183,8 @@ protected:
         {
             CETL_DEBUG_ASSERT(isLinked(), "");
 
-            schedule_ = schedule;
+            schedule_    = schedule;
+            burst_count_ = 0;
             executor_.adjustNextExecTimeOf(*this, [this, &schedule](auto&) {
                 //
                 next_exec_time_ = cetl::visit(  //
@@ -189,6 +195,11 @@ protected:
             });
         }
 
+        CETL_NODISCARD cetl::optional<Callback::OverrunStats> getOverrunStats() const override
+        {
+            return overrun_stats_;
+        }
+
     protected:
         SingleThreadedExecutor& executor() noexcept
         {
@@ -196,12 +207,60 @@ protected:
         }
 
     private:
+        using Overrun = Callback::Schedule::Repeat::Overrun;
+
+        /// Calculates the next execution time of a repeating callback according to its overrun policy.
+        ///
+        /// The current execution is late by `missed` whole periods if `approx_now` is already
+        /// at or beyond `exec_time + (missed * period)`.
+        ///
+        TimePoint nextRepeatTime(const Callback::Schedule::Repeat& repeat, const Callback::Arg& arg)
+        {
+            const TimePoint next_exec_time = arg.exec_time + repeat.period;
+            if ((repeat.period <= Duration::zero()) || (arg.approx_now < next_exec_time))
+            {
+                burst_count_ = 0;
+                return next_exec_time;
+            }
+
+            ++overrun_stats_.overruns;
+
+            const auto missed = static_cast<std::size_t>((arg.approx_now - arg.exec_time) / repeat.period);
+            switch (repeat.overrun)
+            {
+            case Overrun::LimitBurst:
+            {
+                if (burst_count_ < repeat.max_burst)
+                {
+                    ++burst_count_;
+                    return next_exec_time;
+                }
+                break;
+            }
+            case Overrun::Skip:
+            {
+                break;
+            }
+            case Overrun::CatchUp:
+            {
+                return next_exec_time;
+            }
+            }
+
+            // Skip all missed periods, so that the next execution is at the nearest future period (keeping phase).
+            burst_count_ = 0;
+            overrun_stats_.missed_periods += missed;
+            return arg.exec_time + (repeat.period * static_cast<Duration::rep>(missed + 1U));
+        }
+
         // MARK: Data members:
 
         SingleThreadedExecutor&                     executor_;
         Callback::Function                          function_;
         TimePoint                                   next_exec_time_;
         cetl::optional<Callback::Schedule::Variant> schedule_;
+        Callback::OverrunStats                      overrun_stats_;
+        std::uint32_t                               burst_count_{0};
 
     };  // CallbackNode
 
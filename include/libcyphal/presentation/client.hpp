@@ -11,6 +11,7 @@
 #include "presentation_delegate.hpp"
 #include "response_promise.hpp"
 
+#include "libcyphal/errors.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
@@ -20,6 +21,7 @@
 
 #include <nunavut/support/serialization.hpp>
 
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -55,9 +57,29 @@ public:
     ///
     using Failure = libcyphal::detail::AppendType<transport::AnyFailure, TooManyPendingRequestsError>::Result;
 
+    /// @brief Defines policy of issuing requests of this client.
+    ///
+    /// By default, a request is sent once, so a single lost frame (f.e. on a lossy CAN bus) costs the whole
+    /// response timeout. With retransmissions, while the response is still pending, the same request (with
+    /// the same transfer ID) is sent again - evenly spread over the response timeout. F.e. with 2 retransmissions
+    /// and 300ms response timeout, the request is sent at 0ms, 100ms and 200ms. The first response resolves
+    /// the promise, and stops further retransmissions.
+    ///
+    /// Because of the same transfer ID, a server processes (and responds to) only the first received copy of
+    /// the request - duplicates are dropped by its transport. So retransmissions recover lost requests,
+    /// but not lost responses. Any late duplicate response is dropped by the client (as not matching any
+    /// pending request), without reaching the user.
+    ///
+    struct RequestPolicy
+    {
+        /// Max number of retransmissions of a request while its response is pending. Zero disables them.
+        std::uint8_t retransmissions{0};
+    };
+
     ClientBase(const ClientBase& other)
         : shared_client_{other.shared_client_}
         , priority_{other.priority_}
+        , request_policy_{other.request_policy_}
     {
         CETL_DEBUG_ASSERT(other.shared_client_ != nullptr,
                           "Not supposed to copy construct from already moved `other`.");
@@ -68,6 +90,7 @@ public:
     ClientBase(ClientBase&& other) noexcept
         : shared_client_{std::exchange(other.shared_client_, nullptr)}
         , priority_{other.priority_}
+        , request_policy_{other.request_policy_}
     {
         CETL_DEBUG_ASSERT(shared_client_ != nullptr, "Not supposed to move construct from already moved `other`.");
         // No need to retain the moved object, as it is already retained.
@@ -82,8 +105,9 @@ public:
         {
             (void) shared_client_->release();
 
-            shared_client_ = other.shared_client_;
-            priority_      = other.priority_;
+            shared_client_  = other.shared_client_;
+            priority_       = other.priority_;
+            request_policy_ = other.request_policy_;
 
             shared_client_->retain();
         }
@@ -98,8 +122,9 @@ public:
 
         (void) shared_client_->release();
 
-        shared_client_ = std::exchange(other.shared_client_, nullptr);
-        priority_      = other.priority_;
+        shared_client_  = std::exchange(other.shared_client_, nullptr);
+        priority_       = other.priority_;
+        request_policy_ = other.request_policy_;
 
         // No need to retain the moved object, as it is already retained.
         return *this;
@@ -127,6 +152,22 @@ public:
         priority_ = priority;
     }
 
+    /// @brief Gets current request policy of this client.
+    ///
+    RequestPolicy getRequestPolicy() const noexcept
+    {
+        return request_policy_;
+    }
+
+    /// @brief Sets request policy of this client. See `RequestPolicy` for details.
+    ///
+    /// The new policy will be used for the next request. Prior requests will not be affected by this change.
+    ///
+    void setRequestPolicy(const RequestPolicy& request_policy) noexcept
+    {
+        request_policy_ = request_policy;
+    }
+
 protected:
     ~ClientBase()
     {
@@ -139,6 +180,7 @@ protected:
     explicit ClientBase(SharedClient* const shared_client)
         : shared_client_{shared_client}
         , priority_{transport::Priority::Nominal}
+        , request_policy_{}
     {
         CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
         shared_client_->retain();
@@ -155,11 +197,44 @@ protected:
         return *shared_client_;
     }
 
+    /// @brief Sends the request, and (if enabled by the policy) starts its retransmissions.
+    ///
+    /// @return `nullopt` if the request has been sent; otherwise the failure (and the promise is to be dropped).
+    ///
+    template <typename Promise>
+    cetl::optional<Failure> sendRequest(Promise&                             response_promise,
+                                        const transport::TransferTxMetadata& tx_metadata,
+                                        const transport::PayloadFragments    payload) const
+    {
+        auto& shared_client = getSharedClient();
+
+        // Payload copy (for retransmissions) is made before sending, so that we won't fail after the sending.
+        const bool is_retransmitted = request_policy_.retransmissions > 0;
+        auto       retransmitter    = is_retransmitted ? RequestRetransmitter::make(shared_client, tx_metadata, payload)
+                                                       : cetl::optional<RequestRetransmitter>{};
+        if (is_retransmitted && (!retransmitter))
+        {
+            return Failure{MemoryError{}};
+        }
+
+        if (auto failure = shared_client.sendRequestPayload(tx_metadata, payload))
+        {
+            return libcyphal::detail::upcastVariant<Failure>(std::move(*failure));
+        }
+
+        if (retransmitter)
+        {
+            response_promise.acceptRetransmitter(std::move(*retransmitter), request_policy_.retransmissions);
+        }
+        return cetl::nullopt;
+    }
+
 private:
     // MARK: Data members:
 
     SharedClient*       shared_client_;
     transport::Priority priority_;
+    RequestPolicy       request_policy_;
 
 };  // ClientBase
 
@@ -254,7 +329,7 @@ public:
                                                            response_deadline.value_or(request_deadline)};
                 //
                 const transport::TransferTxMetadata tx_metadata{{transfer_id, getPriority()}, request_deadline};
-                if (auto failure = shared_client.sendRequestPayload(tx_metadata, serialized_fragments))
+                if (auto failure = sendRequest(response_promise, tx_metadata, serialized_fragments))
                 {
                     return libcyphal::detail::upcastVariant<Failure>(std::move(*failure));
                 }
@@ -342,9 +417,9 @@ public:
                                                response_deadline.value_or(request_deadline)};
         //
         const transport::TransferTxMetadata tx_metadata{{transfer_id, getPriority()}, request_deadline};
-        if (auto failure = shared_client.sendRequestPayload(tx_metadata, request_payload))
+        if (auto failure = sendRequest(response_promise, tx_metadata, request_payload))
         {
-            return libcyphal::detail::upcastVariant<Failure>(std::move(*failure));
+            return std::move(*failure);
         }
 
         return response_promise;
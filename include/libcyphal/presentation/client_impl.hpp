@@ -6,6 +6,7 @@
 #ifndef LIBCYPHAL_PRESENTATION_CLIENT_IMPL_HPP_INCLUDED
 #define LIBCYPHAL_PRESENTATION_CLIENT_IMPL_HPP_INCLUDED
 
+#include "deadline_manager.hpp"
 #include "presentation_delegate.hpp"
 #include "shared_object.hpp"
 
@@ -20,7 +21,11 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include <utility>
 
 namespace libcyphal
@@ -40,46 +45,7 @@ public:
     using Node::remove;
     using Node::isLinked;
 
-    class TimeoutNode : public Node<TimeoutNode>
-    {
-    public:
-        bool isTimeoutLinked() const noexcept
-        {
-            return isLinked();
-        }
-
-        TimePoint getTimeoutDeadline() const noexcept
-        {
-            return deadline_;
-        }
-
-        void setTimeoutDeadline(const TimePoint timeout_deadline) noexcept
-        {
-            deadline_ = timeout_deadline;
-        }
-
-        CETL_NODISCARD std::int8_t compareByTimeoutDeadline(const TimePoint timeout_deadline) const noexcept
-        {
-            // No two deadline times compare equal, which allows us to have multiple nodes
-            // with the same deadline time in the tree. With two nodes sharing the same deadline time,
-            // the one added later is considered to be later.
-            return (timeout_deadline >= deadline_) ? +1 : -1;
-        }
-
-    protected:
-        explicit TimeoutNode(const TimePoint timeout_deadline)
-            : deadline_{timeout_deadline}
-        {
-        }
-
-    private:
-        // MARK: Data members:
-
-        TimePoint deadline_;
-
-    };  // TimeoutNode
-
-    class CallbackNode : public Node<CallbackNode>, public TimeoutNode
+    class CallbackNode : public Node<CallbackNode>, public DeadlineNode
     {
     public:
         CallbackNode(const CallbackNode&)                = delete;
@@ -110,7 +76,7 @@ public:
 
     protected:
         CallbackNode(const transport::TransferId transfer_id, const TimePoint response_deadline)
-            : TimeoutNode{response_deadline}
+            : DeadlineNode{response_deadline}
             , transfer_id_{transfer_id}
         {
         }
@@ -134,7 +100,6 @@ public:
         , svc_request_tx_session_{std::move(svc_request_tx_session)}
         , svc_response_rx_session_{std::move(svc_response_rx_session)}
         , response_rx_params_{svc_response_rx_session_->getParams()}
-        , nearest_deadline_{DistantFuture()}
     {
         CETL_DEBUG_ASSERT(svc_request_tx_session_ != nullptr, "");
         CETL_DEBUG_ASSERT(svc_response_rx_session_ != nullptr, "");
@@ -151,12 +116,6 @@ public:
             //
             onResponseRxTransfer(arg.transfer);
         });
-
-        nearest_deadline_callback_ = executor_.registerCallback([this](const auto& arg) {
-            //
-            onNearestDeadline(arg.approx_now);
-        });
-        CETL_DEBUG_ASSERT(nearest_deadline_callback_, "Should not fail b/c we pass proper lambda.");
     }
 
     CETL_NODISCARD TimePoint now() const noexcept
@@ -169,6 +128,11 @@ public:
         return delegate_.memory();
     }
 
+    CETL_NODISCARD transport::PortId getServiceId() const noexcept
+    {
+        return response_rx_params_.service_id;
+    }
+
     CETL_NODISCARD std::int32_t compareByNodeAndServiceIds(const transport::ResponseRxParams& rx_params) const
     {
         if (response_rx_params_.server_node_id != rx_params.server_node_id)
@@ -195,17 +159,27 @@ public:
         return svc_request_tx_session_->send(tx_metadata, payload);
     }
 
-    void updateDeadlineOfTimeoutNode(TimeoutNode& timeout_node, const TimePoint new_deadline)
+    CETL_NODISCARD DeadlineManager& getDeadlineManager() const noexcept
     {
-        if (timeout_node.isTimeoutLinked())
-        {
-            // Remove previous timeout node (if any),
-            // and then reinsert the node with updated/given new deadline time.
-            //
-            timeout_nodes_by_deadline_.remove(&timeout_node);
-            timeout_node.setTimeoutDeadline(new_deadline);
-            insertTimeoutNodeAndReschedule(timeout_node);
-        }
+        return delegate_.getDeadlineManager();
+    }
+
+    void updateDeadlineOfCallbackNode(CallbackNode& callback_node, const TimePoint new_deadline)
+    {
+        delegate_.getDeadlineManager().updateNodeDeadline(callback_node, new_deadline);
+    }
+
+    /// @brief Handles response timeout of the callback node.
+    ///
+    /// Called (indirectly, via the callback node) by the presentation-wide deadline manager,
+    /// which has already unlinked the node from its deadlines tree.
+    ///
+    void onCallbackNodeDeadline(CallbackNode& callback_node, const TimePoint approx_now)
+    {
+        CETL_DEBUG_ASSERT(!callback_node.isDeadlineLinked(), "");
+
+        removeCallbackNode(callback_node);
+        callback_node.onResponseTimeout(callback_node.getDeadline(), approx_now);
     }
 
     void releaseCallbackNode(CallbackNode& callback_node) noexcept
@@ -227,7 +201,6 @@ public:
         if (SharedObject::release())
         {
             CETL_DEBUG_ASSERT(cb_nodes_by_transfer_id_.empty(), "");
-            CETL_DEBUG_ASSERT(timeout_nodes_by_deadline_.empty(), "");
 
             delegate_.markSharedObjAsUnreferenced(*this);
             return true;
@@ -260,26 +233,19 @@ protected:
         CETL_DEBUG_ASSERT(!std::get<1>(cb_node_existing), "Unexpected existing callback node.");
         CETL_DEBUG_ASSERT(&callback_node == std::get<0>(cb_node_existing), "Unexpected callback node.");
 
-        insertTimeoutNodeAndReschedule(callback_node);
+        delegate_.getDeadlineManager().insertNode(callback_node);
     }
 
     virtual void removeCallbackNode(CallbackNode& callback_node)
     {
         cb_nodes_by_transfer_id_.remove(&callback_node);
-        if (callback_node.isTimeoutLinked())
+        if (callback_node.isDeadlineLinked())
         {
-            removeTimeoutNodeAndReschedule(callback_node);
+            delegate_.getDeadlineManager().removeNode(callback_node);
         }
     }
 
 private:
-    using Schedule = IExecutor::Callback::Schedule;
-
-    static constexpr TimePoint DistantFuture()
-    {
-        return TimePoint::max();
-    }
-
     void onResponseRxTransfer(transport::ServiceRxTransfer& transfer)
     {
         const auto transfer_id = transfer.metadata.rx_meta.base.transfer_id;
@@ -294,106 +260,168 @@ private:
         }
     }
 
-    void onNearestDeadline(const TimePoint approx_now)
+    // MARK: Data members:
+
+    IPresentationDelegate&                         delegate_;
+    IExecutor&                                     executor_;
+    const UniquePtr<transport::IRequestTxSession>  svc_request_tx_session_;
+    const UniquePtr<transport::IResponseRxSession> svc_response_rx_session_;
+    const transport::ResponseRxParams              response_rx_params_;
+    common::cavl::Tree<CallbackNode>               cb_nodes_by_transfer_id_;
+
+};  // SharedClient
+
+// MARK: -
+
+/// @brief Retransmits a pending request (with the same transfer ID) until its response is received.
+///
+/// Holds its own copy of the request payload, so it's independent of the original (possibly stack) buffer.
+/// Retransmissions are driven by the presentation-wide deadline manager, and are evenly spread over the response
+/// timeout. Because the request transfer ID stays the same, a server accepts (and responds to) only one of
+/// the copies, and any late duplicate response is dropped by the client as not matching any pending request.
+///
+class RequestRetransmitter final : public DeadlineNode
+{
+public:
+    /// @brief Makes a new retransmitter (not yet started) of the given request.
+    ///
+    /// @return `nullopt` if there is not enough memory for the payload copy.
+    ///
+    CETL_NODISCARD static cetl::optional<RequestRetransmitter> make(SharedClient&                        shared_client,
+                                                                    const transport::TransferTxMetadata& tx_metadata,
+                                                                    const transport::PayloadFragments    payload)
     {
-        while (auto* const nearest_deadline_node = timeout_nodes_by_deadline_.min())
+        std::size_t payload_size = 0;
+        for (const auto& fragment : payload)
         {
-            if (approx_now < nearest_deadline_node->getTimeoutDeadline())
+            payload_size += fragment.size();
+        }
+
+        auto& memory = shared_client.memory();
+        // No Sonar `cpp:S5356` and `cpp:S5357` b/c we allocate raw bytes buffer.
+        Buffer buffer{static_cast<cetl::byte*>(memory.allocate(payload_size)),  // NOSONAR cpp:S5356 cpp:S5357
+                      {payload_size, &memory}};
+        if ((!buffer) && (payload_size > 0))
+        {
+            return cetl::nullopt;
+        }
+
+        std::size_t offset = 0;
+        for (const auto& fragment : payload)
+        {
+            if (!fragment.empty())
             {
-                break;
+                (void) std::memcpy(buffer.get() + offset, fragment.data(), fragment.size());  // NOLINT
+                offset += fragment.size();
             }
+        }
 
-            // Downcast is safe here b/c every timeout node is always a callback node.
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-            auto& callback_node = static_cast<CallbackNode&>(*nearest_deadline_node);
+        return RequestRetransmitter{shared_client, tx_metadata, std::move(buffer)};
+    }
 
-            removeCallbackNode(callback_node);
-            callback_node.onResponseTimeout(callback_node.getTimeoutDeadline(), approx_now);
-        }
+    RequestRetransmitter(RequestRetransmitter&& other) noexcept
+        : DeadlineNode{std::move(static_cast<DeadlineNode&&>(other))}
+        , shared_client_{std::exchange(other.shared_client_, nullptr)}
+        , base_metadata_{other.base_metadata_}
+        , tx_timeout_{other.tx_timeout_}
+        , interval_{other.interval_}
+        , remaining_{std::exchange(other.remaining_, 0)}
+        , buffer_{std::move(other.buffer_)}
+    {
     }
 
-    void insertTimeoutNodeAndReschedule(TimeoutNode& timeout_node)
+    ~RequestRetransmitter()
     {
-        CETL_DEBUG_ASSERT(!timeout_node.isTimeoutLinked(), "");
+        stop();
+    }
 
-        const auto new_node_deadline = timeout_node.getTimeoutDeadline();
+    RequestRetransmitter(const RequestRetransmitter&)                = delete;
+    RequestRetransmitter& operator=(const RequestRetransmitter&)     = delete;
+    RequestRetransmitter& operator=(RequestRetransmitter&&) noexcept = delete;
 
-        // 1. Insert the new timeout node.
-        //
-        const auto timeout_node_existing = timeout_nodes_by_deadline_.search(  //
-            [new_node_deadline](const TimeoutNode& other_node) {               // predicate
-                //
-                return other_node.compareByTimeoutDeadline(new_node_deadline);
-            },
-            [&timeout_node]() { return &timeout_node; });  // "factory"
+    /// @brief Schedules the given number of retransmissions, evenly spread up to the response deadline.
+    ///
+    void start(const std::uint8_t count, const TimePoint response_deadline)
+    {
+        CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
 
-        (void) timeout_node_existing;
-        CETL_DEBUG_ASSERT(timeout_node.isTimeoutLinked(), "");
-        CETL_DEBUG_ASSERT(!std::get<1>(timeout_node_existing), "Unexpected existing timeout node.");
-        CETL_DEBUG_ASSERT(&timeout_node == std::get<0>(timeout_node_existing), "Unexpected timeout node.");
+        const auto now = shared_client_->now();
+        if ((count == 0) || (response_deadline <= now))
+        {
+            return;
+        }
 
-        // 2. Reschedule the nearest deadline callback if it's gonna happen earlier than it was before.
-        //
-        if (nearest_deadline_ > new_node_deadline)
+        interval_  = (response_deadline - now) / (count + 1);
+        remaining_ = count;
+        if (interval_ > Duration::zero())
         {
-            nearest_deadline_ = new_node_deadline;
-            const auto result = nearest_deadline_callback_.schedule(Schedule::Once{new_node_deadline});
-            CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `nearest_deadline_callback_`.");
-            (void) result;
+            setDeadline(now + interval_);
+            shared_client_->getDeadlineManager().insertNode(*this);
         }
     }
 
-    void removeTimeoutNodeAndReschedule(TimeoutNode& timeout_node)
+    /// @brief Cancels all pending retransmissions (if any).
+    ///
+    /// Safe to call from within the request sending (f.e. on a response received in context of the sending).
+    ///
+    void stop() noexcept
     {
-        CETL_DEBUG_ASSERT(timeout_node.isTimeoutLinked(), "");
-
-        timeout_nodes_by_deadline_.remove(&timeout_node);
-        const auto old_cb_node_deadline = timeout_node.getTimeoutDeadline();
-
-        // No need to reschedule the nearest deadline callback if deadline of the removed node was not the nearest.
-        //
-        CETL_DEBUG_ASSERT(old_cb_node_deadline >= nearest_deadline_, "");
-        if (nearest_deadline_ < old_cb_node_deadline)
+        remaining_ = 0;
+        if ((shared_client_ != nullptr) && isDeadlineLinked())
         {
-            return;
+            shared_client_->getDeadlineManager().removeNode(*this);
         }
+    }
 
-        if (const auto* const nearest_deadline_node = timeout_nodes_by_deadline_.min())
-        {
-            // Already existing schedule will work fine if the nearest deadline is not changed.
-            //
-            if (nearest_deadline_ < nearest_deadline_node->getTimeoutDeadline())
-            {
-                nearest_deadline_ = nearest_deadline_node->getTimeoutDeadline();
-                const auto result = nearest_deadline_callback_.schedule(Schedule::Once{nearest_deadline_});
-                CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `nearest_deadline_callback_`.");
-                (void) result;
-            }
-        }
-        else
+private:
+    using Buffer = std::unique_ptr<cetl::byte, PmrRawBytesDeleter>;
+
+    RequestRetransmitter(SharedClient& shared_client, const transport::TransferTxMetadata& tx_metadata, Buffer buffer)
+        : DeadlineNode{TimePoint::max()}
+        , shared_client_{&shared_client}
+        , base_metadata_{tx_metadata.base}
+        , tx_timeout_{tx_metadata.deadline - shared_client.now()}
+        , interval_{}
+        , remaining_{0}
+        , buffer_{std::move(buffer)}
+    {
+    }
+
+    // MARK: DeadlineNode
+
+    void onDeadline(const TimePoint approx_now) override
+    {
+        CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
+        CETL_DEBUG_ASSERT(remaining_ > 0, "");
+
+        // Schedule the next retransmission before sending the current one - a response might be received
+        // in context of the sending call, which would `stop` this retransmitter.
+        --remaining_;
+        if (remaining_ > 0)
         {
-            // No more timeout nodes left, so cancel the schedule (by moving it to the distant future).
-            //
-            nearest_deadline_ = DistantFuture();
-            const auto result = nearest_deadline_callback_.schedule(Schedule::Once{nearest_deadline_});
-            CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `nearest_deadline_callback_`.");
-            (void) result;
+            setDeadline(approx_now + interval_);
+            shared_client_->getDeadlineManager().insertNode(*this);
         }
+
+        // Retransmission is the best effort - a failure to send is not fatal b/c
+        // either the next retransmission or the response timeout will follow anyway.
+        //
+        const cetl::span<const cetl::byte>                      data_span{buffer_.get(), buffer_.get_deleter().size()};
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{data_span};
+        const transport::TransferTxMetadata                     tx_metadata{base_metadata_, approx_now + tx_timeout_};
+        (void) shared_client_->sendRequestPayload(tx_metadata, fragments);
     }
 
     // MARK: Data members:
 
-    IPresentationDelegate&                         delegate_;
-    IExecutor&                                     executor_;
-    const UniquePtr<transport::IRequestTxSession>  svc_request_tx_session_;
-    const UniquePtr<transport::IResponseRxSession> svc_response_rx_session_;
-    const transport::ResponseRxParams              response_rx_params_;
-    common::cavl::Tree<CallbackNode>               cb_nodes_by_transfer_id_;
-    TimePoint                                      nearest_deadline_;
-    common::cavl::Tree<TimeoutNode>                timeout_nodes_by_deadline_;
-    IExecutor::Callback::Any                       nearest_deadline_callback_;
+    SharedClient*               shared_client_;
+    transport::TransferMetadata base_metadata_;
+    Duration                    tx_timeout_;
+    Duration                    interval_;
+    std::uint8_t                remaining_;
+    Buffer                      buffer_;
 
-};  // SharedClient
+};  // RequestRetransmitter
 
 // MARK: -
 
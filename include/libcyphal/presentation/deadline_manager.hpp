@@ -0,0 +1,233 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_DEADLINE_MANAGER_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_DEADLINE_MANAGER_HPP_INCLUDED
+
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+
+#include <cstdint>
+#include <tuple>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// Internal implementation details of the Presentation layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines a node which could be registered at the deadline manager.
+///
+class DeadlineNode : public common::cavl::Node<DeadlineNode>
+{
+public:
+    DeadlineNode(const DeadlineNode&)                = delete;
+    DeadlineNode& operator=(const DeadlineNode&)     = delete;
+    DeadlineNode& operator=(DeadlineNode&&) noexcept = delete;
+
+    bool isDeadlineLinked() const noexcept
+    {
+        return isLinked();
+    }
+
+    TimePoint getDeadline() const noexcept
+    {
+        return deadline_;
+    }
+
+    CETL_NODISCARD std::int8_t compareByDeadline(const TimePoint deadline) const noexcept
+    {
+        // No two deadline times compare equal, which allows us to have multiple nodes
+        // with the same deadline time in the tree. With two nodes sharing the same deadline time,
+        // the one added later is considered to be later.
+        return (deadline >= deadline_) ? +1 : -1;
+    }
+
+    /// @brief Called by the deadline manager when the deadline of this node has been reached.
+    ///
+    /// The node is already unlinked from the manager at this point, so it's safe to destroy it inside the call.
+    ///
+    virtual void onDeadline(const TimePoint approx_now) = 0;
+
+protected:
+    explicit DeadlineNode(const TimePoint deadline)
+        : deadline_{deadline}
+    {
+    }
+
+    ~DeadlineNode()                       = default;
+    DeadlineNode(DeadlineNode&&) noexcept = default;
+
+    /// @brief Sets new deadline of the node, which is not linked to the manager (f.e. before its re-insertion).
+    ///
+    void setDeadline(const TimePoint deadline) noexcept
+    {
+        CETL_DEBUG_ASSERT(!isDeadlineLinked(), "Use `DeadlineManager::updateNodeDeadline` for linked nodes.");
+        deadline_ = deadline;
+    }
+
+private:
+    friend class DeadlineManager;
+
+    // MARK: Data members:
+
+    TimePoint deadline_;
+
+};  // DeadlineNode
+
+/// @brief Defines a presentation-wide manager of deadlines.
+///
+/// Holds pending deadlines of all its users (f.e. response timeouts of all RPC clients) in a single tree,
+/// and drives them with a single executor callback, which is rescheduled only when the nearest deadline changes.
+/// So, the executor load depends on the number of pending deadlines rather than on the number of their owners.
+///
+class DeadlineManager final
+{
+public:
+    explicit DeadlineManager(IExecutor& executor)
+        : nearest_deadline_{DistantFuture()}
+    {
+        nearest_deadline_callback_ = executor.registerCallback([this](const auto& arg) {
+            //
+            onNearestDeadline(arg.approx_now);
+        });
+        CETL_DEBUG_ASSERT(nearest_deadline_callback_, "Should not fail b/c we pass proper lambda.");
+    }
+
+    DeadlineManager(const DeadlineManager&)                = delete;
+    DeadlineManager(DeadlineManager&&) noexcept            = delete;
+    DeadlineManager& operator=(const DeadlineManager&)     = delete;
+    DeadlineManager& operator=(DeadlineManager&&) noexcept = delete;
+
+    ~DeadlineManager()
+    {
+        CETL_DEBUG_ASSERT(deadline_nodes_.empty(), "All deadline nodes must be removed before the manager.");
+    }
+
+    void insertNode(DeadlineNode& deadline_node)
+    {
+        CETL_DEBUG_ASSERT(!deadline_node.isDeadlineLinked(), "");
+
+        const auto new_node_deadline = deadline_node.getDeadline();
+
+        // 1. Insert the new deadline node.
+        //
+        const auto deadline_node_existing = deadline_nodes_.search(  //
+            [new_node_deadline](const DeadlineNode& other_node) {    // predicate
+                //
+                return other_node.compareByDeadline(new_node_deadline);
+            },
+            [&deadline_node]() { return &deadline_node; });  // "factory"
+
+        (void) deadline_node_existing;
+        CETL_DEBUG_ASSERT(deadline_node.isDeadlineLinked(), "");
+        CETL_DEBUG_ASSERT(!std::get<1>(deadline_node_existing), "Unexpected existing deadline node.");
+        CETL_DEBUG_ASSERT(&deadline_node == std::get<0>(deadline_node_existing), "Unexpected deadline node.");
+
+        // 2. Reschedule the nearest deadline callback if it's gonna happen earlier than it was before.
+        //
+        if (nearest_deadline_ > new_node_deadline)
+        {
+            scheduleNearestDeadline(new_node_deadline);
+        }
+    }
+
+    void removeNode(DeadlineNode& deadline_node)
+    {
+        CETL_DEBUG_ASSERT(deadline_node.isDeadlineLinked(), "");
+
+        deadline_nodes_.remove(&deadline_node);
+        const auto old_node_deadline = deadline_node.getDeadline();
+
+        // No need to reschedule the nearest deadline callback if deadline of the removed node was not the nearest.
+        //
+        CETL_DEBUG_ASSERT(old_node_deadline >= nearest_deadline_, "");
+        if (nearest_deadline_ < old_node_deadline)
+        {
+            return;
+        }
+
+        if (const auto* const nearest_deadline_node = deadline_nodes_.min())
+        {
+            // Already existing schedule will work fine if the nearest deadline is not changed.
+            //
+            if (nearest_deadline_ < nearest_deadline_node->getDeadline())
+            {
+                scheduleNearestDeadline(nearest_deadline_node->getDeadline());
+            }
+        }
+        else
+        {
+            // No more deadline nodes left, so cancel the schedule (by moving it to the distant future).
+            //
+            scheduleNearestDeadline(DistantFuture());
+        }
+    }
+
+    /// @brief Updates deadline of the node, but only if the node is currently linked to the manager.
+    ///
+    void updateNodeDeadline(DeadlineNode& deadline_node, const TimePoint new_deadline)
+    {
+        if (deadline_node.isDeadlineLinked())
+        {
+            // Remove previous deadline node, and then reinsert the node with updated/given new deadline time.
+            //
+            removeNode(deadline_node);
+            deadline_node.deadline_ = new_deadline;
+            insertNode(deadline_node);
+        }
+    }
+
+private:
+    using Schedule = IExecutor::Callback::Schedule;
+
+    static constexpr TimePoint DistantFuture()
+    {
+        return TimePoint::max();
+    }
+
+    void scheduleNearestDeadline(const TimePoint deadline)
+    {
+        nearest_deadline_ = deadline;
+        const auto result = nearest_deadline_callback_.schedule(Schedule::Once{nearest_deadline_});
+        CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `nearest_deadline_callback_`.");
+        (void) result;
+    }
+
+    void onNearestDeadline(const TimePoint approx_now)
+    {
+        while (auto* const nearest_deadline_node = deadline_nodes_.min())
+        {
+            if (approx_now < nearest_deadline_node->getDeadline())
+            {
+                break;
+            }
+
+            removeNode(*nearest_deadline_node);
+            nearest_deadline_node->onDeadline(approx_now);
+        }
+    }
+
+    // MARK: Data members:
+
+    TimePoint                        nearest_deadline_;
+    common::cavl::Tree<DeadlineNode> deadline_nodes_;
+    IExecutor::Callback::Any         nearest_deadline_callback_;
+
+};  // DeadlineManager
+
+}  // namespace detail
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_DEADLINE_MANAGER_HPP_INCLUDED
@@ -8,6 +8,7 @@
 
 #include "client.hpp"
 #include "client_impl.hpp"
+#include "deadline_manager.hpp"
 #include "presentation_delegate.hpp"
 #include "publisher.hpp"
 #include "publisher_impl.hpp"
@@ -32,6 +33,7 @@
 #include <cetl/pf17/cetlpf.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -106,12 +108,23 @@ public:
     ///
     using MakeFailure = transport::AnyFailure;
 
+    /// @brief Defines kinds of ports made by the presentation layer (see `forEachPortId`).
+    ///
+    enum class PortKind : std::uint8_t
+    {
+        Publisher,
+        Subscriber,
+        Client,
+        Server,
+    };
+
     /// @brief Constructs the presentation layer object.
     ///
     Presentation(cetl::pmr::memory_resource& memory, IExecutor& executor, transport::ITransport& transport) noexcept
         : memory_{memory}
         , executor_{executor}
         , transport_{transport}
+        , deadline_manager_{executor}
         , unreferenced_nodes_{&unreferenced_nodes_, &unreferenced_nodes_}
     {
         unref_nodes_deleter_callback_ = executor_.registerCallback([this](const auto&) {
@@ -136,6 +149,8 @@ public:
                           "Message publishers must be destroyed before presentation.");
         CETL_DEBUG_ASSERT(subscriber_impl_nodes_.empty(),  //
                           "Message subscribers must be destroyed before presentation.");
+        CETL_DEBUG_ASSERT(server_impl_nodes_.empty(),  //
+                          "RPC servers must be destroyed before presentation.");
     }
 
     /// @brief Gets reference to the executor instance of this presentation object.
@@ -152,6 +167,60 @@ public:
         return transport_;
     }
 
+    /// @brief Gets revision of the set of ports made by this presentation object.
+    ///
+    /// The revision is incremented whenever a publisher, subscriber, client or server is made or released,
+    /// so it is a cheap way to detect changes of the port configuration (see `forEachPortId`).
+    /// Note that the revision might be incremented even if the resulting set of port IDs stays the same.
+    ///
+    std::size_t getPortsRevision() const noexcept
+    {
+        return ports_revision_;
+    }
+
+    /// @brief Visits IDs of all ports of the given kind which are currently in use.
+    ///
+    /// Ports are kept in AVL trees (one per kind), which are updated incrementally whenever a port is made
+    /// or destroyed, so no extra bookkeeping is needed. Complexity is linear to the number of ports of the kind.
+    /// Subject and server service IDs are visited in ascending order. Clients are bound to server nodes,
+    /// so the same client service ID is visited once per server node (and not necessarily in order).
+    ///
+    /// @param kind The kind of ports to visit.
+    /// @param visitor The function to be called with `transport::PortId` of each port.
+    ///                It must not make or destroy any port of the presentation object.
+    ///
+    template <typename Visitor>
+    void forEachPortId(const PortKind kind, const Visitor& visitor) const
+    {
+        switch (kind)
+        {
+        case PortKind::Publisher:
+            forEachReferencedNode(publisher_impl_nodes_, [&visitor](const detail::PublisherImpl& publisher_impl) {
+                //
+                visitor(publisher_impl.getSubjectId());
+            });
+            break;
+        case PortKind::Subscriber:
+            forEachReferencedNode(subscriber_impl_nodes_, [&visitor](const detail::SubscriberImpl& subscriber_impl) {
+                //
+                visitor(subscriber_impl.getSubjectId());
+            });
+            break;
+        case PortKind::Client:
+            forEachReferencedNode(shared_client_nodes_, [&visitor](const detail::SharedClient& shared_client) {
+                //
+                visitor(shared_client.getServiceId());
+            });
+            break;
+        case PortKind::Server:
+            server_impl_nodes_.traverseInOrder([&visitor](const detail::ServerImpl& server_impl) {
+                //
+                visitor(server_impl.getServiceId());
+            });
+            break;
+        }
+    }
+
     /// @brief Makes a message publisher.
     ///
     /// The publisher must never outlive this presentation object.
@@ -188,6 +257,7 @@ public:
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
         // If it's the case, we need to remove it from the list b/c it's going to be referenced.
         publisher_impl->unlinkIfReferenced();
+        ++ports_revision_;
 
         return Publisher<Message>{publisher_impl};
     }
@@ -552,6 +622,7 @@ private:
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
         // If it's the case, we need to remove it from the list b/c it's going to be referenced.
         subscriber_impl->unlinkIfReferenced();
+        ++ports_revision_;
 
         return subscriber_impl;
     }
@@ -579,7 +650,29 @@ private:
             const transport::ResponseTxParams tx_params{params.service_id};
             if (auto tx_session = getIfSession(transport_.makeResponseTxSession(tx_params), out_failure))
             {
-                return detail::ServerImpl{memory_, executor_, std::move(rx_session), std::move(tx_session)};
+                Expected<detail::ServerImpl, MakeFailure> server_impl{detail::ServerImpl{asDelegate(),
+                                                                                         executor_,
+                                                                                         params.service_id,
+                                                                                         std::move(rx_session),
+                                                                                         std::move(tx_session)}};
+
+                // Transport doesn't allow multiple request sessions for the same service ID,
+                // so there is no way to find here an existing server node - it's always a new one.
+                // The node will stay linked (even after moving) until its destruction (see `forgetServerImpl`).
+                //
+                auto&      new_server_impl = cetl::get<detail::ServerImpl>(server_impl);
+                const auto service_id      = params.service_id;
+                const auto server_existing = server_impl_nodes_.search(
+                    [service_id](const detail::ServerImpl& other_server) {  // predicate
+                        //
+                        return other_server.compareByServiceId(service_id);
+                    },
+                    [&new_server_impl]() { return &new_server_impl; });  // "factory"
+                CETL_DEBUG_ASSERT(std::get<0>(server_existing) == &new_server_impl, "");
+                (void) server_existing;
+
+                ++ports_revision_;
+                return server_impl;
             }
         }
         CETL_DEBUG_ASSERT(out_failure, "");
@@ -612,6 +705,7 @@ private:
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
         // If it's the case, we need to remove it from the list b/c it's going to be referenced.
         shared_client->unlinkIfReferenced();
+        ++ports_revision_;
 
         return shared_client;
     }
@@ -669,6 +763,20 @@ private:
         return nullptr;
     }
 
+    /// Visits only referenced nodes - unreferenced ones are about to be destroyed (see `destroyUnreferencedNodes`).
+    ///
+    template <typename SharedNode, typename Visitor>
+    static void forEachReferencedNode(const common::cavl::Tree<SharedNode>& tree, const Visitor& visitor)
+    {
+        tree.traverseInOrder([&visitor](const SharedNode& shared_node) {
+            //
+            if (shared_node.isReferenced())
+            {
+                visitor(shared_node);
+            }
+        });
+    }
+
     template <typename SharedNode>
     static void forgetSharedNode(SharedNode& shared_node) noexcept
     {
@@ -704,6 +812,7 @@ private:
         //
         CETL_DEBUG_ASSERT(!shared_obj.isReferenced(), "");
         shared_obj.linkAsUnreferenced(unreferenced_nodes_);
+        ++ports_revision_;
         //
         const auto result = unref_nodes_deleter_callback_.schedule(Schedule::Once{executor_.now()});
         CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `unref_nodes_deleter_callback_`.");
@@ -720,21 +829,42 @@ private:
         forgetSharedNode(publisher_impl);
     }
 
+    transport::TransferId getTransferIdModulo() const noexcept override
+    {
+        return transport_.getProtocolParams().transfer_id_modulo;
+    }
+
+    detail::DeadlineManager& getDeadlineManager() noexcept override
+    {
+        return deadline_manager_;
+    }
+
     void forgetSubscriberImpl(detail::SubscriberImpl& subscriber_impl) noexcept override
     {
         forgetSharedNode(subscriber_impl);
     }
 
+    void forgetServerImpl(detail::ServerImpl& server_impl) noexcept override
+    {
+        CETL_DEBUG_ASSERT(server_impl.isLinked(), "");
+
+        server_impl.remove();
+        ++ports_revision_;
+    }
+
     // MARK: Data members:
 
     cetl::pmr::memory_resource&                memory_;
     IExecutor&                                 executor_;
     transport::ITransport&                     transport_;
+    detail::DeadlineManager                    deadline_manager_;
     common::cavl::Tree<detail::SharedClient>   shared_client_nodes_;
     common::cavl::Tree<detail::PublisherImpl>  publisher_impl_nodes_;
     common::cavl::Tree<detail::SubscriberImpl> subscriber_impl_nodes_;
+    common::cavl::Tree<detail::ServerImpl>     server_impl_nodes_;
     detail::UnRefNode                          unreferenced_nodes_;
     IExecutor::Callback::Any                   unref_nodes_deleter_callback_;
+    std::size_t                                ports_revision_{0};
 
 };  // Presentation
 
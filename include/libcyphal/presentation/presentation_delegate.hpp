@@ -8,6 +8,8 @@
 
 #include "shared_object.hpp"
 
+#include "libcyphal/transport/types.hpp"
+
 #include <cetl/pf17/cetlpf.hpp>
 
 #include <type_traits>
@@ -70,9 +72,11 @@ struct IsServiceTrait<T, true>
 };
 
 // Forward declaration.
+class DeadlineManager;
 class SharedClient;
 class PublisherImpl;
 class SubscriberImpl;
+class ServerImpl;
 
 /// @brief Defines internal interface for the Presentation layer delegate.
 ///
@@ -86,10 +90,14 @@ public:
 
     virtual cetl::pmr::memory_resource& memory() const noexcept = 0;
 
+    virtual transport::TransferId getTransferIdModulo() const noexcept = 0;
+    virtual DeadlineManager&      getDeadlineManager() noexcept        = 0;
+
     virtual void markSharedObjAsUnreferenced(SharedObject& shared_obj) noexcept = 0;
     virtual void forgetSharedClient(SharedClient& shared_client) noexcept       = 0;
     virtual void forgetPublisherImpl(PublisherImpl& publisher_impl) noexcept    = 0;
     virtual void forgetSubscriberImpl(SubscriberImpl& subscriber_impl) noexcept = 0;
+    virtual void forgetServerImpl(ServerImpl& server_impl) noexcept             = 0;
 
 protected:
     IPresentationDelegate()  = default;
@@ -8,16 +8,22 @@
 
 #include "common_helpers.hpp"
 #include "publisher_impl.hpp"
+#include "raw_compression.hpp"
 
+#include "libcyphal/errors.hpp"
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 
 #include <nunavut/support/serialization.hpp>
 
+#include <array>
+#include <cstddef>
 #include <utility>
 
 namespace libcyphal
@@ -100,6 +106,52 @@ public:
         priority_ = priority;
     }
 
+    /// @brief Umbrella type for transmission timestamp callback entities.
+    ///
+    /// @see transport::IMessageTxSession::OnTxTimestampCallback
+    ///
+    using OnTxTimestampCallback = transport::IMessageTxSession::OnTxTimestampCallback;
+
+    /// @brief Sets function which will be called when a published message has been actually transmitted.
+    ///
+    /// Note that all publishers of the same subject share the same transport session,
+    /// so the latest set callback wins (and it reports timestamps of messages from all such publishers).
+    /// The callback is called only if the transport media support TX timestamps.
+    ///
+    /// @param on_tx_timestamp_cb_fn The function which will be called back.
+    ///                              Use `nullptr` (or `{}`) to disable the callback.
+    ///
+    void setOnTxTimestampCallback(OnTxTimestampCallback::Function&& on_tx_timestamp_cb_fn)
+    {
+        CETL_DEBUG_ASSERT(impl_ != nullptr, "");
+
+        impl_->setOnTxTimestampCallback(std::move(on_tx_timestamp_cb_fn));
+    }
+
+    /// @brief Umbrella type for TX capacity (aka flow control) callback entities.
+    ///
+    /// @see transport::IMessageTxSession::OnTxCapacityCallback
+    ///
+    using OnTxCapacityCallback = transport::IMessageTxSession::OnTxCapacityCallback;
+
+    /// @brief Sets function which will be called when TX queues have room again (after being filled up).
+    ///
+    /// Intended for producers which get `CapacityError` (or `MemoryError` for CAN) from `publish` - instead of
+    /// polling, they could retry publishing from (or after) the callback. The same as with timestamps,
+    /// all publishers of the same subject share the same transport session, so the latest set callback wins.
+    ///
+    /// @param on_tx_capacity_cb_fn The function which will be called back.
+    ///                             Use `nullptr` (or `{}`) to disable the callback.
+    /// @param watermark The low watermark (in frames) of TX queue occupancy,
+    ///                  see `transport::IMessageTxSession::setOnTxCapacityCallback` for details.
+    ///
+    void setOnTxCapacityCallback(OnTxCapacityCallback::Function&& on_tx_capacity_cb_fn, const std::size_t watermark)
+    {
+        CETL_DEBUG_ASSERT(impl_ != nullptr, "");
+
+        impl_->setOnTxCapacityCallback(std::move(on_tx_capacity_cb_fn), watermark);
+    }
+
 protected:
     ~PublisherBase()
     {
@@ -217,12 +269,46 @@ class Publisher<void> final : public detail::PublisherBase
 public:
     /// Publishes the raw message on libcyphal network.
     ///
+    /// If compression is enabled, the message data is first compressed into a PMR allocated frame
+    /// (see `detail::RawCompression`), and `MemoryError` is returned if the frame can't be allocated.
+    /// Data bigger than `config::Presentation::RawCompression_MaxPayloadSize` is always sent as is
+    /// (uncompressed and not framed) b/c subscribers wouldn't restore it.
+    ///
     /// @param deadline The latest time to send the message. Will be dropped if exceeded.
     /// @param payload_fragments The message data to publish.
     ///
     cetl::optional<Failure> publish(const TimePoint deadline, const transport::PayloadFragments payload_fragments) const
     {
-        return publishRawData(deadline, payload_fragments);
+        if (!is_compression_enabled_ || !detail::RawCompression::isWithinMaxPayloadSize(payload_fragments))
+        {
+            return publishRawData(deadline, payload_fragments);
+        }
+
+        auto frame = detail::RawCompression::compress(memory(), payload_fragments);
+        if (const auto* const memory_error = cetl::get_if<MemoryError>(&frame))
+        {
+            return *memory_error;
+        }
+        const std::array<const cetl::span<const cetl::byte>, 1> frame_fragments{
+            cetl::get<detail::RawPayloadBuffer>(frame).getSpan()};
+        return publishRawData(deadline, frame_fragments);
+    }
+
+    /// @brief Enables (or disables) transparent compression of published messages.
+    ///
+    /// Compression is opt-in per publisher - it makes sense only for big and compressible payloads
+    /// (f.e. text, maps, sparse arrays), and only if all subscribers of the subject enable decompression
+    /// (see `Subscriber<void>::setDecompression`). Incompressible payloads are sent w/o compression,
+    /// but still framed, so the per-message overhead is limited by the frame header.
+    ///
+    void setCompression(const bool is_enabled) noexcept
+    {
+        is_compression_enabled_ = is_enabled;
+    }
+
+    bool isCompressionEnabled() const noexcept
+    {
+        return is_compression_enabled_;
     }
 
 private:
@@ -233,6 +319,10 @@ private:
     {
     }
 
+    // MARK: Data members:
+
+    bool is_compression_enabled_{false};
+
 };  // Publisher<void>
 
 }  // namespace presentation
@@ -18,6 +18,7 @@
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pf20/cetlpf.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -52,6 +53,11 @@ public:
         return delegate_.memory();
     }
 
+    CETL_NODISCARD transport::PortId getSubjectId() const noexcept
+    {
+        return subject_id_;
+    }
+
     CETL_NODISCARD std::int32_t compareBySubjectId(const transport::PortId subject_id) const
     {
         return static_cast<std::int32_t>(subject_id_) - static_cast<std::int32_t>(subject_id);
@@ -67,6 +73,17 @@ public:
         return msg_tx_session_->send(metadata, payload_fragments);
     }
 
+    void setOnTxTimestampCallback(transport::IMessageTxSession::OnTxTimestampCallback::Function&& function)
+    {
+        msg_tx_session_->setOnTxTimestampCallback(std::move(function));
+    }
+
+    void setOnTxCapacityCallback(transport::IMessageTxSession::OnTxCapacityCallback::Function&& function,
+                                 const std::size_t                                            watermark)
+    {
+        msg_tx_session_->setOnTxCapacityCallback(std::move(function), watermark);
+    }
+
     // MARK: SharedObject
 
     /// @brief Decrements the reference count, and deletes this shared publisher if the count is zero.
@@ -0,0 +1,621 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_RAW_COMPRESSION_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_RAW_COMPRESSION_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/contiguous_payload.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// Internal implementation details of the Presentation layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines a PMR allocated contiguous byte buffer, which could also serve as a scattered buffer storage.
+///
+/// The buffer is movable but not copyable. Memory is deallocated when the buffer is destroyed.
+///
+class RawPayloadBuffer final : public transport::ScatteredBuffer::IStorage
+{
+public:
+    /// @brief Allocates a new buffer of the given capacity.
+    ///
+    /// @return The buffer (with zero size), or `nullopt` if memory could not be allocated.
+    ///
+    static cetl::optional<RawPayloadBuffer> make(cetl::pmr::memory_resource& memory, const std::size_t capacity)
+    {
+        // Even empty buffer gets an allocation, so that "no memory" is never confused with "empty".
+        auto* const data = static_cast<cetl::byte*>(memory.allocate(std::max<std::size_t>(capacity, 1)));
+        if (data == nullptr)
+        {
+            return cetl::nullopt;
+        }
+        return RawPayloadBuffer{memory, data, capacity};
+    }
+
+    RawPayloadBuffer(RawPayloadBuffer&& other) noexcept
+        : memory_{other.memory_}
+        , data_{std::exchange(other.data_, nullptr)}
+        , capacity_{std::exchange(other.capacity_, 0)}
+        , size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    ~RawPayloadBuffer()
+    {
+        if (data_ != nullptr)
+        {
+            memory_->deallocate(data_, std::max<std::size_t>(capacity_, 1));
+        }
+    }
+
+    RawPayloadBuffer(const RawPayloadBuffer&)                = delete;
+    RawPayloadBuffer& operator=(const RawPayloadBuffer&)     = delete;
+    RawPayloadBuffer& operator=(RawPayloadBuffer&&) noexcept = delete;
+
+    cetl::byte* data() noexcept
+    {
+        return data_;
+    }
+
+    const cetl::byte* data() const noexcept
+    {
+        return data_;
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    void resize(const std::size_t new_size) noexcept
+    {
+        CETL_DEBUG_ASSERT(new_size <= capacity_, "");
+        size_ = std::min(new_size, capacity_);
+    }
+
+    cetl::span<const cetl::byte> getSpan() const noexcept
+    {
+        return {data_, size_};
+    }
+
+    // MARK: ScatteredBuffer::IStorage
+
+    CETL_NODISCARD std::size_t size() const noexcept override
+    {
+        return size_;
+    }
+
+    CETL_NODISCARD std::size_t copy(const std::size_t offset_bytes,
+                                    cetl::byte* const destination,
+                                    const std::size_t length_bytes) const override
+    {
+        CETL_DEBUG_ASSERT((destination != nullptr) || (length_bytes == 0),
+                          "Destination could be null only with zero bytes ask.");
+
+        if ((destination == nullptr) || (size_ <= offset_bytes))
+        {
+            return 0;
+        }
+
+        const std::size_t bytes_to_copy = std::min(length_bytes, size_ - offset_bytes);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        (void) std::memmove(destination, data_ + offset_bytes, bytes_to_copy);
+        return bytes_to_copy;
+    }
+
+private:
+    RawPayloadBuffer(cetl::pmr::memory_resource& memory, cetl::byte* const data, const std::size_t capacity) noexcept
+        : memory_{&memory}
+        , data_{data}
+        , capacity_{capacity}
+        , size_{0}
+    {
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource* memory_;
+    cetl::byte*                 data_;
+    std::size_t                 capacity_;
+    std::size_t                 size_;
+
+};  // RawPayloadBuffer
+
+/// @brief Defines transparent compression of raw (aka untyped) message payloads.
+///
+/// A compressed payload is a frame of the following layout (all multibyte fields are little-endian):
+/// - 2 bytes of the frame marker (`0xCF 0x5A`);
+/// - 1 byte of the frame format version (currently `1`);
+/// - 1 byte of the compression method (see `Method`);
+/// - 4 bytes of the original (uncompressed) payload size;
+/// - the method specific body.
+///
+/// The marker allows a decompressing subscriber to tell frames from payloads of uncompressed (aka legacy) peers,
+/// which are passed as is. The `Lz` body is a sequence of LZ77 literal/match pairs encoded in LZ4 block style:
+/// a token byte (literals length in high nibble, match length minus 4 in low nibble, both extended with `255`-run
+/// bytes if equal to 15), literals, and 2 bytes of match offset. The last sequence has literals only.
+/// If a payload doesn't shrink, the compressor falls back to the `Stored` method (body is the payload as is),
+/// so the frame is never bigger than the payload plus the header.
+///
+class RawCompression final
+{
+public:
+    static constexpr std::size_t HeaderSize     = 8;
+    static constexpr std::size_t MaxPayloadSize = config::Presentation::RawCompression_MaxPayloadSize();
+
+    enum class Method : std::uint8_t
+    {
+        Stored = 0,
+        Lz     = 1,
+    };
+
+    /// @brief Defines any possible failure of decompression.
+    ///
+    /// `ArgumentError` means that the frame is malformed (or is not a frame at all, but legacy payload
+    /// which just happened to start with the marker).
+    ///
+    using DecompressFailure = cetl::variant<ArgumentError, MemoryError>;
+
+    /// @brief Compresses payload fragments into a new frame.
+    ///
+    /// The hash table of the compressor is PMR allocated for the duration of the call only.
+    /// If the payload is fragmented it's first gathered into a temporary contiguous PMR buffer.
+    ///
+    static Expected<RawPayloadBuffer, MemoryError> compress(cetl::pmr::memory_resource&       memory,
+                                                            const transport::PayloadFragments payload_fragments)
+    {
+        const transport::detail::ContiguousPayload payload{memory, payload_fragments};
+        if ((payload.data() == nullptr) && (payload.size() > 0))
+        {
+            return MemoryError{};
+        }
+        if (payload.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            // The frame header can't represent such a big payload (not expected in practice anyway).
+            return MemoryError{};
+        }
+
+        auto maybe_frame = RawPayloadBuffer::make(memory, HeaderSize + getLzBound(payload.size()));
+        if (!maybe_frame)
+        {
+            return MemoryError{};
+        }
+        RawPayloadBuffer& frame = *maybe_frame;
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        cetl::byte* const body      = frame.data() + HeaderSize;
+        std::size_t       body_size = 0;
+        if (payload.size() >= MinMatch)
+        {
+            auto maybe_hash_table = RawPayloadBuffer::make(memory, HashTableSize * sizeof(std::uint32_t));
+            if (!maybe_hash_table)
+            {
+                return MemoryError{};
+            }
+            body_size = compressLz(payload.data(),
+                                   payload.size(),
+                                   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                                   reinterpret_cast<std::uint32_t*>(maybe_hash_table->data()),  // NOSONAR cpp:S3630
+                                   body,
+                                   frame.capacity() - HeaderSize);
+        }
+
+        Method method = Method::Lz;
+        if ((body_size == 0) || (body_size >= payload.size()))
+        {
+            method    = Method::Stored;
+            body_size = payload.size();
+            if (body_size > 0)
+            {
+                (void) std::memmove(body, payload.data(), body_size);
+            }
+        }
+
+        writeHeader(frame.data(), method, payload.size());
+        frame.resize(HeaderSize + body_size);
+        return std::move(frame);
+    }
+
+    /// @brief Checks whether the payload is not too big to be restored by a decompressing subscriber.
+    ///
+    /// Subscribers don't restore frames which claim original size bigger than `MaxPayloadSize`
+    /// (such frames are dropped), so bigger payloads must be sent uncompressed.
+    ///
+    static bool isWithinMaxPayloadSize(const transport::PayloadFragments payload_fragments) noexcept
+    {
+        std::size_t payload_size = 0;
+        for (const auto fragment : payload_fragments)
+        {
+            payload_size += fragment.size();
+            if (payload_size > MaxPayloadSize)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Checks whether the given raw message starts with a frame header of the supported version.
+    ///
+    static bool hasFrameMarker(const transport::ScatteredBuffer& raw_message)
+    {
+        std::array<cetl::byte, HeaderSize> header{};
+        return readHeader(raw_message, header);
+    }
+
+    /// @brief Restores the original payload out of the given frame.
+    ///
+    /// The compressed frame is first gathered into a temporary contiguous PMR buffer
+    /// (b/c the scattered buffer could be accessed only by copying), and then decoded into a new buffer.
+    ///
+    static Expected<RawPayloadBuffer, DecompressFailure> decompress(cetl::pmr::memory_resource&       memory,
+                                                                    const transport::ScatteredBuffer& raw_message)
+    {
+        std::array<cetl::byte, HeaderSize> header{};
+        if (!readHeader(raw_message, header))
+        {
+            return ArgumentError{};
+        }
+        const auto        method        = static_cast<Method>(header[3]);
+        const std::size_t body_size     = raw_message.size() - HeaderSize;
+        const std::size_t original_size = readOriginalSize(header.data());
+        if (original_size > MaxPayloadSize)
+        {
+            return ArgumentError{};
+        }
+
+        auto maybe_payload = RawPayloadBuffer::make(memory, original_size);
+        if (!maybe_payload)
+        {
+            return MemoryError{};
+        }
+        RawPayloadBuffer& payload = *maybe_payload;
+
+        if (method == Method::Stored)
+        {
+            if (body_size != original_size)
+            {
+                return ArgumentError{};
+            }
+            (void) raw_message.copy(HeaderSize, payload.data(), original_size);
+        }
+        else if (method == Method::Lz)
+        {
+            auto maybe_body = RawPayloadBuffer::make(memory, body_size);
+            if (!maybe_body)
+            {
+                return MemoryError{};
+            }
+            (void) raw_message.copy(HeaderSize, maybe_body->data(), body_size);
+            if (!decompressLz(maybe_body->data(), body_size, payload.data(), original_size))
+            {
+                return ArgumentError{};
+            }
+        }
+        else
+        {
+            return ArgumentError{};
+        }
+
+        payload.resize(original_size);
+        return std::move(payload);
+    }
+
+private:
+    static constexpr cetl::byte    MarkerByte0   = static_cast<cetl::byte>(0xCF);
+    static constexpr cetl::byte    MarkerByte1   = static_cast<cetl::byte>(0x5A);
+    static constexpr cetl::byte    Version       = static_cast<cetl::byte>(1);
+    static constexpr std::size_t   MinMatch      = 4;
+    static constexpr std::size_t   MaxOffset     = 0xFFFF;
+    static constexpr std::size_t   NibbleMax     = 15;
+    static constexpr std::size_t   ExtensionMax  = 255;
+    static constexpr std::uint32_t HashBits      = 12;
+    static constexpr std::size_t   HashTableSize = 1U << HashBits;
+
+    /// @brief Gets the worst case size of LZ body (for incompressible data).
+    ///
+    static constexpr std::size_t getLzBound(const std::size_t size) noexcept
+    {
+        return size + (size / ExtensionMax) + 16;  // NOLINT(readability-magic-numbers)
+    }
+
+    static bool readHeader(const transport::ScatteredBuffer& raw_message, std::array<cetl::byte, HeaderSize>& header)
+    {
+        if (raw_message.copy(0, header.data(), header.size()) < header.size())
+        {
+            return false;
+        }
+        return (header[0] == MarkerByte0) && (header[1] == MarkerByte1) && (header[2] == Version);
+    }
+
+    static void writeHeader(cetl::byte* const header, const Method method, const std::size_t original_size)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic,readability-magic-numbers)
+        header[0] = MarkerByte0;
+        header[1] = MarkerByte1;
+        header[2] = Version;
+        header[3] = static_cast<cetl::byte>(method);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            header[4 + i] = static_cast<cetl::byte>((original_size >> (i * 8U)) & 0xFFU);
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic,readability-magic-numbers)
+    }
+
+    static std::size_t readOriginalSize(const cetl::byte* const header)
+    {
+        std::size_t original_size = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic,readability-magic-numbers)
+            original_size |= static_cast<std::size_t>(header[4 + i]) << (i * 8U);
+        }
+        return original_size;
+    }
+
+    static std::uint32_t read32(const cetl::byte* const src) noexcept
+    {
+        std::uint32_t value = 0;
+        (void) std::memcpy(&value, src, sizeof(value));
+        return value;
+    }
+
+    static std::uint32_t hash32(const std::uint32_t value) noexcept
+    {
+        // Knuth's multiplicative hashing.
+        return (value * 2654435761U) >> (32U - HashBits);  // NOLINT(readability-magic-numbers)
+    }
+
+    /// @brief Helper which writes encoded bytes into a fixed capacity output (and tracks its overflow).
+    ///
+    class Writer final
+    {
+    public:
+        Writer(cetl::byte* const dst, const std::size_t capacity) noexcept
+            : dst_{dst}
+            , capacity_{capacity}
+            , size_{0}
+            , is_overflow_{false}
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return is_overflow_ ? 0 : size_;
+        }
+
+        void put(const cetl::byte byte) noexcept
+        {
+            if (size_ >= capacity_)
+            {
+                is_overflow_ = true;
+                return;
+            }
+            dst_[size_++] = byte;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        void put(const cetl::byte* const src, const std::size_t length) noexcept
+        {
+            if (length > (capacity_ - size_))
+            {
+                is_overflow_ = true;
+                return;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            (void) std::memmove(dst_ + size_, src, length);
+            size_ += length;
+        }
+
+        void putLengthExtension(std::size_t length) noexcept
+        {
+            if (length < NibbleMax)
+            {
+                return;
+            }
+            length -= NibbleMax;
+            while (length >= ExtensionMax)
+            {
+                put(static_cast<cetl::byte>(ExtensionMax));
+                length -= ExtensionMax;
+            }
+            put(static_cast<cetl::byte>(length));
+        }
+
+    private:
+        cetl::byte* const dst_;
+        const std::size_t capacity_;
+        std::size_t       size_;
+        bool              is_overflow_;
+
+    };  // Writer
+
+    static void putSequence(Writer&                 writer,
+                            const cetl::byte* const literals,
+                            const std::size_t       literals_length,
+                            const std::size_t       match_offset,
+                            const std::size_t       match_length) noexcept
+    {
+        const std::size_t match_code = (match_length > 0) ? (match_length - MinMatch) : 0;
+
+        // Ternaries (instead of `std::min`) b/c `NibbleMax` must not be ODR-used.
+        const std::size_t token = (((literals_length < NibbleMax) ? literals_length : NibbleMax) << 4U) |
+                                  ((match_code < NibbleMax) ? match_code : NibbleMax);
+        writer.put(static_cast<cetl::byte>(token));
+        writer.putLengthExtension(literals_length);
+        writer.put(literals, literals_length);
+        if (match_length > 0)
+        {
+            writer.put(static_cast<cetl::byte>(match_offset & 0xFFU));         // NOLINT(readability-magic-numbers)
+            writer.put(static_cast<cetl::byte>((match_offset >> 8U) & 0xFFU));  // NOLINT(readability-magic-numbers)
+            writer.putLengthExtension(match_code);
+        }
+    }
+
+    /// @return Size of the encoded body, or zero if it doesn't fit into the destination.
+    ///
+    static std::size_t compressLz(const cetl::byte* const src,
+                                  const std::size_t       src_size,
+                                  std::uint32_t* const    hash_table,
+                                  cetl::byte* const       dst,
+                                  const std::size_t       dst_capacity) noexcept
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // Table entries keep "position + 1" of the latest occurrence of a hash, so zero means "no occurrence".
+        std::fill(hash_table, hash_table + HashTableSize, 0U);
+
+        Writer      writer{dst, dst_capacity};
+        std::size_t anchor = 0;
+        std::size_t pos    = 0;
+        while ((pos + MinMatch) <= src_size)
+        {
+            const std::uint32_t value     = read32(src + pos);
+            std::uint32_t&      entry     = hash_table[hash32(value)];
+            const std::size_t   candidate = entry;
+            entry                         = static_cast<std::uint32_t>(pos + 1);
+
+            if ((candidate == 0) || ((pos + 1 - candidate) > MaxOffset) || (read32(src + candidate - 1) != value))
+            {
+                ++pos;
+                continue;
+            }
+
+            const std::size_t match_pos    = candidate - 1;
+            std::size_t       match_length = MinMatch;
+            while (((pos + match_length) < src_size) && (src[match_pos + match_length] == src[pos + match_length]))
+            {
+                ++match_length;
+            }
+
+            putSequence(writer, src + anchor, pos - anchor, pos - match_pos, match_length);
+            pos += match_length;
+            anchor = pos;
+        }
+        putSequence(writer, src + anchor, src_size - anchor, 0, 0);
+
+        return writer.size();
+
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    static bool readLengthExtension(const cetl::byte* const src,
+                                    const std::size_t       src_size,
+                                    std::size_t&            src_pos,
+                                    std::size_t&            length,
+                                    const std::size_t       length_limit) noexcept
+    {
+        if (length < NibbleMax)
+        {
+            return true;
+        }
+        std::size_t extension = ExtensionMax;
+        while (extension == ExtensionMax)
+        {
+            if ((src_pos >= src_size) || (length > length_limit))
+            {
+                return false;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            extension = static_cast<std::size_t>(src[src_pos++]);
+            length += extension;
+        }
+        return true;
+    }
+
+    /// @return `true` if exactly `dst_size` bytes were decoded without any out-of-bounds access.
+    ///
+    static bool decompressLz(const cetl::byte* const src,
+                             const std::size_t       src_size,
+                             cetl::byte* const       dst,
+                             const std::size_t       dst_size) noexcept
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        std::size_t src_pos = 0;
+        std::size_t dst_pos = 0;
+        while (src_pos < src_size)
+        {
+            const auto token = static_cast<std::size_t>(src[src_pos++]);
+
+            std::size_t literals_length = token >> 4U;
+            if (!readLengthExtension(src, src_size, src_pos, literals_length, dst_size) ||
+                (literals_length > (src_size - src_pos)) || (literals_length > (dst_size - dst_pos)))
+            {
+                return false;
+            }
+            (void) std::memmove(dst + dst_pos, src + src_pos, literals_length);
+            src_pos += literals_length;
+            dst_pos += literals_length;
+
+            if (src_pos == src_size)
+            {
+                break;  // The last sequence has no match.
+            }
+
+            if ((src_size - src_pos) < 2)
+            {
+                return false;
+            }
+            const std::size_t match_offset = static_cast<std::size_t>(src[src_pos]) |
+                                             (static_cast<std::size_t>(src[src_pos + 1]) << 8U);
+            src_pos += 2;
+            if ((match_offset == 0) || (match_offset > dst_pos))
+            {
+                return false;
+            }
+
+            std::size_t match_length = token & NibbleMax;
+            if (!readLengthExtension(src, src_size, src_pos, match_length, dst_size))
+            {
+                return false;
+            }
+            match_length += MinMatch;
+            if (match_length > (dst_size - dst_pos))
+            {
+                return false;
+            }
+
+            // Byte by byte b/c the match may overlap with its own output (f.e. runs of the same byte).
+            for (std::size_t i = 0; i < match_length; ++i, ++dst_pos)
+            {
+                dst[dst_pos] = dst[dst_pos - match_offset];
+            }
+        }
+        return dst_pos == dst_size;
+
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+};  // RawCompression
+
+}  // namespace detail
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_RAW_COMPRESSION_HPP_INCLUDED
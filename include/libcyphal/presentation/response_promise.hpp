@@ -22,6 +22,7 @@
 #include <nunavut/support/serialization.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace libcyphal
@@ -29,6 +30,16 @@ namespace libcyphal
 namespace presentation
 {
 
+/// Internal implementation details of the Presentation layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+class ClientBase;
+
+}  // namespace detail
+
 /// @brief Defines terminal 'expired' error state of the response promise.
 ///
 /// See `response_deadline` parameter of the `Client::request` method,
@@ -112,6 +123,7 @@ public:
         , request_time_{other.request_time_}
         , callback_fn_{std::move(other.callback_fn_)}
         , opt_result_{std::move(other.opt_result_)}
+        , retransmitter_{std::move(other.retransmitter_)}
     {
         CETL_DEBUG_ASSERT(shared_client_ != nullptr, "Not supposed to move construct from already moved `other`.");
         // No need to retain the moved object, as it is supposed to be already retained.
@@ -182,6 +194,9 @@ protected:
 
     ~ResponsePromiseBase()
     {
+        // The retransmitter has to be gone before the shared client (which might be released below).
+        retransmitter_.reset();
+
         if (shared_client_ != nullptr)
         {
             shared_client_->releaseCallbackNode(*this);
@@ -198,6 +213,14 @@ protected:
     {
         CETL_DEBUG_ASSERT(!opt_result_, "Result already set.");
 
+        // The first result wins - no more retransmissions of the request.
+        // Note that we just stop (and not destroy) the retransmitter b/c the result might be accepted
+        // in context of its sending call.
+        if (retransmitter_)
+        {
+            retransmitter_->stop();
+        }
+
         if (callback_fn_)
         {
             // Release callback function after calling it.
@@ -229,10 +252,32 @@ protected:
         callback_fn_ = std::move(callback_fn);
     }
 
+    /// @brief Takes over retransmissions of the request, and starts them (if the response is still pending).
+    ///
+    void acceptRetransmitter(detail::RequestRetransmitter&& retransmitter, const std::uint8_t count)
+    {
+        if (!isCallbackLinked())
+        {
+            // Already got a result (f.e. the response has been received in context of the initial sending).
+            return;
+        }
+
+        (void) retransmitter_.emplace(std::move(retransmitter));
+        retransmitter_->start(count, getDeadline());
+    }
+
     void acceptNewDeadline(const TimePoint deadline)
     {
         CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
-        shared_client_->updateDeadlineOfTimeoutNode(*this, deadline);
+        shared_client_->updateDeadlineOfCallbackNode(*this, deadline);
+    }
+
+    // MARK: DeadlineNode
+
+    void onDeadline(const TimePoint approx_now) override
+    {
+        CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
+        shared_client_->onCallbackNodeDeadline(*this, approx_now);
     }
 
     // MARK: CallbackNode
@@ -245,10 +290,11 @@ protected:
 private:
     // MARK: Data members:
 
-    detail::SharedClient*       shared_client_;
-    const TimePoint             request_time_;
-    typename Callback::Function callback_fn_;
-    cetl::optional<Result>      opt_result_;
+    detail::SharedClient*                        shared_client_;
+    const TimePoint                              request_time_;
+    typename Callback::Function                  callback_fn_;
+    cetl::optional<Result>                       opt_result_;
+    cetl::optional<detail::RequestRetransmitter> retransmitter_;
 
 };  // ResponsePromiseBase
 
@@ -310,6 +356,7 @@ public:
 private:
     template <typename Request, typename Response_>
     friend class Client;
+    friend class detail::ClientBase;
     using Base::Base;
 
     // MARK: CallbackNode
@@ -385,6 +432,7 @@ public:
 
 private:
     friend class RawServiceClient;
+    friend class detail::ClientBase;
     using Base::Base;
 
     // MARK: CallbackNode
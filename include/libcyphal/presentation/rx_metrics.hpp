@@ -0,0 +1,245 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_RX_METRICS_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_RX_METRICS_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// @brief Defines reception quality metrics of a subscription (or of a single remote publisher of it).
+///
+/// Interval and jitter are smoothed with exponentially weighted moving averages, so they reflect
+/// the recent behavior of the traffic, and could be maintained in constant time and memory.
+///
+struct RxMetrics
+{
+    /// Total number of received messages.
+    std::uint64_t messages{0};
+
+    /// Number of lost messages, detected as gaps in transfer IDs of the same remote publisher.
+    std::uint64_t lost{0};
+
+    /// Number of duplicate messages, detected as repeated transfer ID of the same remote publisher.
+    std::uint64_t duplicates{0};
+
+    /// Reception timestamp of the latest message; `nullopt` if nothing has been received yet.
+    cetl::optional<TimePoint> last_timestamp;
+
+    /// Smoothed interval between consecutive messages. Zero until at least two messages are received.
+    Duration mean_interval{};
+
+    /// Smoothed inter-arrival jitter - mean absolute deviation of an interval from the `mean_interval`.
+    /// Note that it's not the RFC 3550 estimator, which measures deviation from the previous interval.
+    Duration jitter{};
+
+    /// @brief Gets smoothed message rate in Hz (aka 1 / `mean_interval`); zero if it's not known yet.
+    ///
+    float getRateHz() const noexcept
+    {
+        using Seconds = std::chrono::duration<float>;
+        return (mean_interval > Duration::zero()) ? (1.0F / std::chrono::duration_cast<Seconds>(mean_interval).count())
+                                                  : 0.0F;
+    }
+
+    /// @brief Gets time elapsed since the latest message; `nullopt` if nothing has been received yet.
+    ///
+    cetl::optional<Duration> getAge(const TimePoint now) const noexcept
+    {
+        if (!last_timestamp)
+        {
+            return cetl::nullopt;
+        }
+        return now - *last_timestamp;
+    }
+
+};  // RxMetrics
+
+/// Internal implementation details of the Presentation layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Maintains reception metrics of a subscription - aggregated and per remote publisher.
+///
+/// Per publisher metrics are kept in a fixed capacity table (see `RxMetrics_SourcesCapacity` config),
+/// so no memory is allocated on reception path. If the table is full, the least recently heard
+/// publisher is evicted to make room for a new one. Anonymous messages are counted only in the aggregate.
+///
+class RxMetricsTracker final
+{
+public:
+    explicit RxMetricsTracker(const transport::TransferId transfer_id_modulo) noexcept
+        : transfer_id_modulo_{transfer_id_modulo}
+    {
+    }
+
+    ~RxMetricsTracker() = default;
+
+    RxMetricsTracker(const RxMetricsTracker&)                = delete;
+    RxMetricsTracker(RxMetricsTracker&&) noexcept            = delete;
+    RxMetricsTracker& operator=(const RxMetricsTracker&)     = delete;
+    RxMetricsTracker& operator=(RxMetricsTracker&&) noexcept = delete;
+
+    const RxMetrics& getAggregate() const noexcept
+    {
+        return aggregate_;
+    }
+
+    const RxMetrics* findSource(const transport::NodeId node_id) const noexcept
+    {
+        for (std::size_t i = 0; i < sources_count_; ++i)
+        {
+            if (sources_[i].node_id == node_id)
+            {
+                return &sources_[i].metrics;
+            }
+        }
+        return nullptr;
+    }
+
+    void update(const transport::MessageRxMetadata& metadata) noexcept
+    {
+        const auto timestamp = metadata.rx_meta.timestamp;
+        updateTiming(aggregate_, timestamp);
+
+        if (!metadata.publisher_node_id)
+        {
+            return;
+        }
+
+        const auto transfer_id = metadata.rx_meta.base.transfer_id;
+        Source&    source      = ensureSource(*metadata.publisher_node_id);
+        if (source.metrics.last_timestamp)
+        {
+            const auto distance = getTransferIdDistance(source.last_transfer_id, transfer_id);
+            if (distance == 0)
+            {
+                source.metrics.duplicates++;
+                aggregate_.duplicates++;
+            }
+            else if (distance <= getTransferIdHalfRange())
+            {
+                source.metrics.lost += distance - 1;
+                aggregate_.lost += distance - 1;
+            }
+            else
+            {
+                // The transfer ID went backwards - most probably the remote publisher has restarted,
+                // or the message has been reordered. Either way, it's not a loss, so just resync.
+            }
+        }
+        source.last_transfer_id = transfer_id;
+        updateTiming(source.metrics, timestamp);
+    }
+
+private:
+    static constexpr std::size_t SourcesCapacity = config::Presentation::RxMetrics_SourcesCapacity();
+
+    struct Source
+    {
+        transport::NodeId     node_id{0};
+        transport::TransferId last_transfer_id{0};
+        RxMetrics             metrics;
+    };
+
+    static void updateTiming(RxMetrics& metrics, const TimePoint timestamp) noexcept
+    {
+        // Smoothing factors are borrowed from RFC 3550 (gain of its jitter) and RFC 6298 (gain of its mean RTT).
+        constexpr Duration::rep IntervalGain = 8;
+        constexpr Duration::rep JitterGain   = 16;
+
+        if (metrics.last_timestamp && (timestamp >= *metrics.last_timestamp))
+        {
+            const Duration interval = timestamp - *metrics.last_timestamp;
+            if (metrics.messages == 1)
+            {
+                metrics.mean_interval = interval;
+            }
+            else
+            {
+                const Duration deviation = (interval >= metrics.mean_interval) ? (interval - metrics.mean_interval)
+                                                                                : (metrics.mean_interval - interval);
+                metrics.jitter += (deviation - metrics.jitter) / JitterGain;
+                metrics.mean_interval += (interval - metrics.mean_interval) / IntervalGain;
+            }
+        }
+        metrics.last_timestamp = timestamp;
+        metrics.messages++;
+    }
+
+    transport::TransferId getTransferIdDistance(const transport::TransferId from,
+                                                const transport::TransferId to) const noexcept
+    {
+        // Transfer IDs of UDP transport practically never overflow (modulo is the max of 64-bit type).
+        if (to >= from)
+        {
+            return to - from;
+        }
+        return (transfer_id_modulo_ - from) + to;
+    }
+
+    transport::TransferId getTransferIdHalfRange() const noexcept
+    {
+        return transfer_id_modulo_ / 2U;
+    }
+
+    Source& ensureSource(const transport::NodeId node_id) noexcept
+    {
+        Source* least_recent = nullptr;
+        for (std::size_t i = 0; i < sources_count_; ++i)
+        {
+            Source& source = sources_[i];
+            if (source.node_id == node_id)
+            {
+                return source;
+            }
+            if ((least_recent == nullptr) || (source.metrics.last_timestamp.value_or(TimePoint::min()) <
+                                              least_recent->metrics.last_timestamp.value_or(TimePoint::min())))
+            {
+                least_recent = &source;
+            }
+        }
+
+        if (sources_count_ < sources_.size())
+        {
+            least_recent = &sources_[sources_count_++];
+        }
+        CETL_DEBUG_ASSERT(least_recent != nullptr, "Capacity of the sources table should be non-zero.");
+
+        *least_recent         = Source{};
+        least_recent->node_id = node_id;
+        return *least_recent;
+    }
+
+    // MARK: Data members:
+
+    const transport::TransferId         transfer_id_modulo_;
+    RxMetrics                           aggregate_;
+    std::array<Source, SourcesCapacity> sources_{};
+    std::size_t                         sources_count_{0};
+
+};  // RxMetricsTracker
+
+}  // namespace detail
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_RX_METRICS_HPP_INCLUDED
@@ -7,6 +7,7 @@
 #define LIBCYPHAL_PRESENTATION_SERVER_HPP_INCLUDED
 
 #include "presentation_delegate.hpp"
+#include "server_admission.hpp"
 #include "server_impl.hpp"
 
 #include "libcyphal/config.hpp"
@@ -53,6 +54,7 @@ public:
 
     ServerBase(ServerBase&& other) noexcept
         : impl_{std::move(other.impl_)}
+        , admission_{std::move(other.admission_)}
     {
         impl_.setOnReceiveCallback(*this);
     }
@@ -61,10 +63,33 @@ public:
     ServerBase& operator=(const ServerBase& other)     = delete;
     ServerBase& operator=(ServerBase&& other) noexcept = delete;
 
+    /// @brief Sets admission control of incoming requests. See `ServerAdmission::Params` for details.
+    ///
+    /// Admission control is disabled by default, so the request callback is called for every incoming request.
+    /// Setting new parameters resets per client rate limits, but not the statistics.
+    ///
+    /// @param params The new admission parameters. Use `nullopt` to disable the admission control.
+    ///
+    void setAdmissionControl(const cetl::optional<ServerAdmission::Params>& params) noexcept
+    {
+        admission_.setParams(params);
+    }
+
+    /// @brief Gets statistics of the admission control (accumulated since the server creation).
+    ///
+    ServerAdmission::Stats getAdmissionStats() const noexcept
+    {
+        return admission_.getStats();
+    }
+
 protected:
+    using AdmissionTicket = ServerAdmissionController::Ticket;
+
     /// @brief Defines response continuation functor.
     ///
     /// NB! The functor is supposed to be called only once.
+    /// While the functor is alive and not called yet, it holds an outstanding request slot of the server
+    /// (if the admission control limits number of outstanding requests).
     ///
     template <typename Response, typename SomeFailure>
     class ContinuationImpl final
@@ -77,8 +102,9 @@ protected:
 
         ContinuationImpl() noexcept = default;
 
-        explicit ContinuationImpl(Function&& fn) noexcept
+        explicit ContinuationImpl(Function&& fn, AdmissionTicket&& ticket = AdmissionTicket{}) noexcept
             : fn_{std::move(fn)}
+            , ticket_{std::move(ticket)}
         {
         }
 
@@ -104,12 +130,14 @@ protected:
             {
                 auto func = std::exchange(fn_, nullptr);
                 result    = func(deadline, response);
+                ticket_.reset();
             }
             return result;
         }
 
     private:
-        Function fn_{};
+        Function        fn_{};
+        AdmissionTicket ticket_{};
 
     };  // ContinuationImpl
 
@@ -132,14 +160,32 @@ protected:
         return impl_.tryDeserialize(buffer, request);
     }
 
+    /// @brief Decides (by the admission control) whether the request should be passed to the request callback.
+    ///
+    /// @return `nullopt` if the request should be dropped; otherwise the ticket for the response continuation.
+    ///
+    cetl::optional<AdmissionTicket> admitRequest(const TimePoint                     approx_now,
+                                                 const transport::ServiceRxMetadata& metadata) noexcept
+    {
+        return admission_.admit(approx_now, metadata);
+    }
+
     cetl::optional<Failure> respondWithPayload(const transport::ServiceTxMetadata& tx_metadata,
-                                               const transport::PayloadFragments   payload) const
+                                               const transport::PayloadFragments   payload)
     {
-        return impl_.respondWithPayload(tx_metadata, payload);
+        auto failure = impl_.respondWithPayload(tx_metadata, payload);
+        if (failure && cetl::holds_alternative<transport::CapacityError>(*failure))
+        {
+            admission_.onResponseCapacityError(impl_.now());
+        }
+        return failure;
     }
 
 private:
-    ServerImpl impl_;
+    // MARK: Data members:
+
+    ServerImpl                impl_;
+    ServerAdmissionController admission_;
 
 };  // ServerBase
 
@@ -219,6 +265,13 @@ private:
             return;
         }
 
+        // Admission is decided before deserialization, so that rejected requests are cheap.
+        auto ticket = admitRequest(approx_now, rx_transfer.metadata);
+        if (!ticket)
+        {
+            return;
+        }
+
         // Try to deserialize the strong-typed request from raw bytes.
         // We just drop it if deserialization fails.
         //
@@ -253,7 +306,8 @@ private:
                             }
                             return cetl::nullopt;
                         });
-                }});
+                },
+                std::move(*ticket)});
     }
 
     // MARK: Data members:
@@ -331,6 +385,12 @@ private:
             return;
         }
 
+        auto ticket = admitRequest(approx_now, rx_transfer.metadata);
+        if (!ticket)
+        {
+            return;
+        }
+
         const auto base_metadata  = rx_transfer.metadata.rx_meta.base;
         const auto client_node_id = rx_transfer.metadata.remote_node_id;
 
@@ -344,7 +404,8 @@ private:
                     // We pass response payload to transport layer as is (without serialization).
                     const transport::ServiceTxMetadata tx_metadata{{base_metadata, deadline}, client_node_id};
                     return respondWithPayload(tx_metadata, payload);
-                }});
+                },
+                std::move(*ticket)});
     }
 
     // MARK: Data members:
@@ -0,0 +1,392 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_SERVER_ADMISSION_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_SERVER_ADMISSION_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// @brief Defines admission control of incoming requests of an RPC server.
+///
+/// Protects the server node (its executor and response TX queue) from chatty or buggy clients.
+/// A request which is not admitted is silently dropped - the request callback is not called for it at all.
+///
+struct ServerAdmission
+{
+    struct Params
+    {
+        /// Max number of admitted requests which are not responded yet (f.e. deferred by the user).
+        /// A request is outstanding while its response continuation is alive and has not been called.
+        /// Zero disables the limit. Response continuations may outlive (or be kept while moving) their server -
+        /// slots of continuations which are still alive when the server is destroyed are just released.
+        std::size_t max_outstanding_requests{0};
+
+        /// Max number of requests which a single client node can make in a burst.
+        /// Zero disables per client rate limiting.
+        std::uint16_t client_burst{0};
+
+        /// Interval at which a client node earns one more request (up to the `client_burst`).
+        /// Zero disables per client rate limiting.
+        Duration client_interval{};
+
+        /// Requests of priority lower than this one are shed while the response TX queue is congested.
+        transport::Priority shedding_priority{transport::Priority::Nominal};
+
+        /// For how long the response TX queue is considered congested since it has refused a response
+        /// because of its capacity (see `transport::CapacityError`). Zero disables the shedding.
+        Duration congestion_hold{};
+    };
+
+    struct Stats
+    {
+        /// Number of admitted requests.
+        std::uint64_t admitted{0};
+
+        /// Number of requests rejected b/c of too many outstanding requests.
+        std::uint64_t rejected_outstanding{0};
+
+        /// Number of requests rejected b/c their client node has exceeded its rate limit.
+        std::uint64_t rejected_rate_limited{0};
+
+        /// Number of requests shed b/c of their low priority while the response TX queue is congested.
+        std::uint64_t rejected_shed{0};
+    };
+
+};  // ServerAdmission
+
+/// Internal implementation details of the Presentation layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Makes admission decisions on incoming requests of a server.
+///
+/// Per client token buckets are kept in a fixed capacity table (see `ServerAdmission_ClientsCapacity` config),
+/// so no memory is allocated on reception path. If the table is full, the least recently heard client is evicted
+/// to make room for a new one (and so the evicted client starts over with a full bucket when heard again).
+///
+class ServerAdmissionController final
+{
+public:
+    /// @brief Holds an outstanding request slot until the response is sent (or abandoned).
+    ///
+    /// Tickets are intrusively linked to their controller, so that the controller could follow its server
+    /// when the latter is moved, and could detach still alive tickets when the server is destroyed
+    /// (a detached ticket does nothing on reset).
+    ///
+    class Ticket final
+    {
+    public:
+        Ticket() noexcept = default;
+
+        Ticket(Ticket&& other) noexcept
+        {
+            takeLinkFrom(other);
+        }
+
+        Ticket& operator=(Ticket&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                takeLinkFrom(other);
+            }
+            return *this;
+        }
+
+        ~Ticket()
+        {
+            reset();
+        }
+
+        Ticket(const Ticket&)            = delete;
+        Ticket& operator=(const Ticket&) = delete;
+
+        void reset() noexcept
+        {
+            if (controller_ != nullptr)
+            {
+                controller_->detachTicket(*this);
+            }
+        }
+
+    private:
+        friend class ServerAdmissionController;
+
+        explicit Ticket(ServerAdmissionController& controller) noexcept
+        {
+            controller.attachTicket(*this);
+        }
+
+        /// Replaces the other ticket (if it's attached) with this one in the list of its controller.
+        ///
+        void takeLinkFrom(Ticket& other) noexcept
+        {
+            controller_ = std::exchange(other.controller_, nullptr);
+            prev_       = std::exchange(other.prev_, nullptr);
+            next_       = std::exchange(other.next_, nullptr);
+            if (controller_ != nullptr)
+            {
+                if (prev_ != nullptr)
+                {
+                    prev_->next_ = this;
+                }
+                else
+                {
+                    controller_->tickets_head_ = this;
+                }
+                if (next_ != nullptr)
+                {
+                    next_->prev_ = this;
+                }
+            }
+        }
+
+        // MARK: Data members:
+
+        ServerAdmissionController* controller_{nullptr};
+        Ticket*                    prev_{nullptr};
+        Ticket*                    next_{nullptr};
+
+    };  // Ticket
+
+    ServerAdmissionController() = default;
+
+    ServerAdmissionController(ServerAdmissionController&& other) noexcept
+        : params_{std::move(other.params_)}
+        , stats_{other.stats_}
+        , outstanding_{std::exchange(other.outstanding_, 0)}
+        , congested_until_{other.congested_until_}
+        , clients_{other.clients_}
+        , clients_count_{other.clients_count_}
+        , tickets_head_{std::exchange(other.tickets_head_, nullptr)}
+    {
+        for (Ticket* ticket = tickets_head_; ticket != nullptr; ticket = ticket->next_)
+        {
+            ticket->controller_ = this;
+        }
+    }
+
+    ~ServerAdmissionController()
+    {
+        // Still alive tickets (f.e. of not yet called response continuations) are just detached.
+        while (tickets_head_ != nullptr)
+        {
+            Ticket& ticket     = *tickets_head_;
+            tickets_head_      = std::exchange(ticket.next_, nullptr);
+            ticket.prev_       = nullptr;
+            ticket.controller_ = nullptr;
+        }
+    }
+
+    ServerAdmissionController(const ServerAdmissionController&)                = delete;
+    ServerAdmissionController& operator=(const ServerAdmissionController&)     = delete;
+    ServerAdmissionController& operator=(ServerAdmissionController&&) noexcept = delete;
+
+    void setParams(const cetl::optional<ServerAdmission::Params>& params) noexcept
+    {
+        params_          = params;
+        clients_count_   = 0;
+        congested_until_ = TimePoint::min();
+    }
+
+    const ServerAdmission::Stats& getStats() const noexcept
+    {
+        return stats_;
+    }
+
+    /// @brief Decides whether the request should be admitted.
+    ///
+    /// @return `nullopt` if the request is rejected; otherwise the ticket to be held until the response is sent.
+    ///         The ticket is empty (not counted) if the limit of outstanding requests is disabled.
+    ///
+    cetl::optional<Ticket> admit(const TimePoint approx_now, const transport::ServiceRxMetadata& metadata) noexcept
+    {
+        if (!params_)
+        {
+            return Ticket{};
+        }
+        const auto& params = *params_;
+
+        if ((approx_now < congested_until_) && (metadata.rx_meta.base.priority > params.shedding_priority))
+        {
+            stats_.rejected_shed++;
+            return cetl::nullopt;
+        }
+
+        const bool is_limited = params.max_outstanding_requests > 0;
+        if (is_limited && (outstanding_ >= params.max_outstanding_requests))
+        {
+            stats_.rejected_outstanding++;
+            return cetl::nullopt;
+        }
+
+        if ((params.client_burst > 0) && (params.client_interval > Duration::zero()) &&
+            (!tryTakeClientToken(approx_now, metadata.remote_node_id, params)))
+        {
+            stats_.rejected_rate_limited++;
+            return cetl::nullopt;
+        }
+
+        stats_.admitted++;
+        return is_limited ? Ticket{*this} : Ticket{};
+    }
+
+    /// @brief Notifies that the response TX queue has refused a response b/c of its capacity.
+    ///
+    void onResponseCapacityError(const TimePoint approx_now) noexcept
+    {
+        if (params_ && (params_->congestion_hold > Duration::zero()))
+        {
+            congested_until_ = approx_now + params_->congestion_hold;
+        }
+    }
+
+private:
+    static constexpr std::size_t ClientsCapacity = config::Presentation::ServerAdmission_ClientsCapacity();
+
+    struct Client
+    {
+        transport::NodeId node_id{0};
+        std::uint16_t     tokens{0};
+        TimePoint         refilled_at{};
+        TimePoint         last_seen{};
+    };
+
+    bool tryTakeClientToken(const TimePoint                approx_now,
+                            const transport::NodeId        node_id,
+                            const ServerAdmission::Params& params) noexcept
+    {
+        Client& client   = ensureClient(approx_now, node_id, params);
+        client.last_seen = approx_now;
+
+        // Refill the bucket with whole tokens earned since the previous refill.
+        // A full bucket earns nothing, so its refill time just follows the current time - otherwise an idle gap
+        // (while the bucket was full) would be credited as soon as the first token is taken.
+        if (client.tokens >= params.client_burst)
+        {
+            client.refilled_at = approx_now;
+        }
+        else if (approx_now > client.refilled_at)
+        {
+            const auto earned = (approx_now - client.refilled_at) / params.client_interval;
+            if (earned >= (params.client_burst - client.tokens))
+            {
+                client.tokens      = params.client_burst;
+                client.refilled_at = approx_now;
+            }
+            else if (earned > 0)
+            {
+                client.tokens = static_cast<std::uint16_t>(client.tokens + earned);
+                client.refilled_at += params.client_interval * earned;
+            }
+        }
+
+        if (client.tokens == 0)
+        {
+            return false;
+        }
+        --client.tokens;
+        return true;
+    }
+
+    void attachTicket(Ticket& ticket) noexcept
+    {
+        CETL_DEBUG_ASSERT(ticket.controller_ == nullptr, "");
+
+        ticket.controller_ = this;
+        ticket.prev_       = nullptr;
+        ticket.next_       = std::exchange(tickets_head_, &ticket);
+        if (ticket.next_ != nullptr)
+        {
+            ticket.next_->prev_ = &ticket;
+        }
+        ++outstanding_;
+    }
+
+    void detachTicket(Ticket& ticket) noexcept
+    {
+        CETL_DEBUG_ASSERT(ticket.controller_ == this, "");
+        CETL_DEBUG_ASSERT(outstanding_ > 0, "");
+
+        if (ticket.prev_ != nullptr)
+        {
+            ticket.prev_->next_ = ticket.next_;
+        }
+        else
+        {
+            tickets_head_ = ticket.next_;
+        }
+        if (ticket.next_ != nullptr)
+        {
+            ticket.next_->prev_ = ticket.prev_;
+        }
+        ticket.controller_ = nullptr;
+        ticket.prev_       = nullptr;
+        ticket.next_       = nullptr;
+        --outstanding_;
+    }
+
+    Client& ensureClient(const TimePoint                approx_now,
+                         const transport::NodeId        node_id,
+                         const ServerAdmission::Params& params) noexcept
+    {
+        Client* least_recent = nullptr;
+        for (std::size_t i = 0; i < clients_count_; ++i)
+        {
+            Client& client = clients_[i];
+            if (client.node_id == node_id)
+            {
+                return client;
+            }
+            if ((least_recent == nullptr) || (client.last_seen < least_recent->last_seen))
+            {
+                least_recent = &client;
+            }
+        }
+
+        if (clients_count_ < clients_.size())
+        {
+            least_recent = &clients_[clients_count_++];
+        }
+        CETL_DEBUG_ASSERT(least_recent != nullptr, "Capacity of the clients table should be non-zero.");
+
+        *least_recent = Client{node_id, params.client_burst, approx_now, approx_now};
+        return *least_recent;
+    }
+
+    // MARK: Data members:
+
+    cetl::optional<ServerAdmission::Params> params_;
+    ServerAdmission::Stats                  stats_;
+    std::size_t                             outstanding_{0};
+    TimePoint                               congested_until_{TimePoint::min()};
+    std::array<Client, ClientsCapacity>     clients_{};
+    std::size_t                             clients_count_{0};
+    Ticket*                                 tickets_head_{nullptr};
+
+};  // ServerAdmissionController
+
+}  // namespace detail
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_SERVER_ADMISSION_HPP_INCLUDED
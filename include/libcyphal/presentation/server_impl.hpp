@@ -7,7 +7,9 @@
 #define LIBCYPHAL_PRESENTATION_SERVER_IMPL_HPP_INCLUDED
 
 #include "common_helpers.hpp"
+#include "presentation_delegate.hpp"
 
+#include "libcyphal/common/cavl/cavl.hpp"
 #include "libcyphal/time_provider.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
@@ -18,6 +20,7 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <cstdint>
 #include <utility>
 
 namespace libcyphal
@@ -31,9 +34,19 @@ namespace presentation
 namespace detail
 {
 
-class ServerImpl final
+/// @brief Defines internal implementation of an RPC server.
+///
+/// Unlike other (shared) implementations, the server one is owned by its single `Server` instance.
+/// Still, it's linked into the presentation tree of servers (by service ID), so that the presentation layer
+/// is able to introspect all servers it has made (see `Presentation::forEachPortId`). The tree link is moved
+/// together with the implementation, and the server is forgotten by the presentation on its destruction.
+///
+class ServerImpl final : public common::cavl::Node<ServerImpl>
 {
 public:
+    using Node::remove;
+    using Node::isLinked;
+
     class Callback
     {
     public:
@@ -51,19 +64,46 @@ public:
 
     };  // Callback
 
-    ServerImpl(cetl::pmr::memory_resource&              memory,
+    ServerImpl(IPresentationDelegate&                   delegate,
                ITimeProvider&                           time_provider,
+               const transport::PortId                  service_id,
                UniquePtr<transport::IRequestRxSession>  svc_req_rx_session,
                UniquePtr<transport::IResponseTxSession> svc_res_tx_session)
-        : memory_{memory}
+        : delegate_{delegate}
         , time_provider_{time_provider}
         , svc_req_rx_session_{std::move(svc_req_rx_session)}
         , svc_res_tx_session_{std::move(svc_res_tx_session)}
+        , service_id_{service_id}
     {
         CETL_DEBUG_ASSERT(svc_req_rx_session_ != nullptr, "");
         CETL_DEBUG_ASSERT(svc_res_tx_session_ != nullptr, "");
     }
 
+    ServerImpl(ServerImpl&& other) noexcept = default;
+
+    ~ServerImpl()
+    {
+        // Moved-from instances are not linked anymore (see `cavl::Node` move constructor).
+        if (isLinked())
+        {
+            delegate_.forgetServerImpl(*this);
+        }
+    }
+
+    ServerImpl(const ServerImpl&)                = delete;
+    ServerImpl& operator=(const ServerImpl&)     = delete;
+    ServerImpl& operator=(ServerImpl&&) noexcept = delete;
+
+    CETL_NODISCARD transport::PortId getServiceId() const noexcept
+    {
+        return service_id_;
+    }
+
+    CETL_NODISCARD std::int32_t compareByServiceId(const transport::PortId service_id) const
+    {
+        return static_cast<std::int32_t>(service_id_) - static_cast<std::int32_t>(service_id);
+    }
+
     void setOnReceiveCallback(Callback& callback) const
     {
         CETL_DEBUG_ASSERT(svc_req_rx_session_ != nullptr, "");
@@ -84,21 +124,27 @@ public:
     template <typename Request>
     bool tryDeserialize(const transport::ScatteredBuffer& buffer, Request& request)
     {
-        return tryDeserializePayload(buffer, memory_, request) == cetl::nullopt;
+        return tryDeserializePayload(buffer, delegate_.memory(), request) == cetl::nullopt;
     }
 
     CETL_NODISCARD cetl::pmr::memory_resource& memory() const noexcept
     {
-        return memory_;
+        return delegate_.memory();
+    }
+
+    CETL_NODISCARD TimePoint now() const noexcept
+    {
+        return time_provider_.now();
     }
 
 private:
     // MARK: Data members:
 
-    cetl::pmr::memory_resource&              memory_;
+    IPresentationDelegate&                   delegate_;
     ITimeProvider&                           time_provider_;
     UniquePtr<transport::IRequestRxSession>  svc_req_rx_session_;
     UniquePtr<transport::IResponseTxSession> svc_res_tx_session_;
+    const transport::PortId                  service_id_;
 
 };  // ServerImpl
 
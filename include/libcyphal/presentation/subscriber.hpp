@@ -6,9 +6,12 @@
 #ifndef LIBCYPHAL_PRESENTATION_SUBSCRIBER_HPP_INCLUDED
 #define LIBCYPHAL_PRESENTATION_SUBSCRIBER_HPP_INCLUDED
 
+#include "raw_compression.hpp"
+#include "rx_metrics.hpp"
 #include "subscriber_impl.hpp"
 
 #include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
 #include "libcyphal/transport/types.hpp"
@@ -67,7 +70,60 @@ public:
     SubscriberBase(const SubscriberBase& other)            = delete;
     SubscriberBase& operator=(const SubscriberBase& other) = delete;
 
+    /// @brief Enables tracking of reception quality metrics of the subscription.
+    ///
+    /// Metrics are maintained per subject, so they are shared by all subscribers of the same subject,
+    /// and once enabled they stay enabled until the last subscriber of the subject is destroyed.
+    /// Tracking adds a constant (small) cost to each message reception, and never allocates memory on the way.
+    ///
+    /// @return `nullopt` on success; otherwise memory error (if the tracker can't be allocated).
+    ///
+    cetl::optional<MemoryError> enableRxMetrics()
+    {
+        CETL_DEBUG_ASSERT(impl_ != nullptr, "");
+        return impl_->enableRxMetrics();
+    }
+
+    /// @brief Gets aggregated reception metrics of the subscription (from all remote publishers).
+    ///
+    /// @return Snapshot of the metrics, or `nullopt` if the metrics are not enabled.
+    ///
+    cetl::optional<RxMetrics> getRxMetrics() const noexcept
+    {
+        CETL_DEBUG_ASSERT(impl_ != nullptr, "");
+        if (const auto* const rx_metrics = impl_->getRxMetrics())
+        {
+            return rx_metrics->getAggregate();
+        }
+        return cetl::nullopt;
+    }
+
+    /// @brief Gets reception metrics of messages from a particular remote publisher.
+    ///
+    /// @param publisher_node_id Node ID of the remote publisher.
+    /// @return Snapshot of the metrics, or `nullopt` if the metrics are not enabled, or the publisher
+    ///         is not (or no longer) tracked - see `config::Presentation::RxMetrics_SourcesCapacity`.
+    ///
+    cetl::optional<RxMetrics> getRxMetrics(const transport::NodeId publisher_node_id) const noexcept
+    {
+        CETL_DEBUG_ASSERT(impl_ != nullptr, "");
+        if (const auto* const rx_metrics = impl_->getRxMetrics())
+        {
+            if (const auto* const source_metrics = rx_metrics->findSource(publisher_node_id))
+            {
+                return *source_metrics;
+            }
+        }
+        return cetl::nullopt;
+    }
+
 protected:
+    cetl::pmr::memory_resource& memory() const noexcept
+    {
+        CETL_DEBUG_ASSERT(impl_ != nullptr, "");
+        return impl_->memory();
+    }
+
     ~SubscriberBase()
     {
         if (impl_ != nullptr)
@@ -205,6 +261,25 @@ public:
         on_receive_cb_fn_ = std::move(on_receive_cb_fn);
     }
 
+    /// @brief Enables (or disables) transparent decompression of received messages.
+    ///
+    /// Decompression is opt-in per subscriber (see also `Publisher<void>::setCompression`).
+    /// When enabled, compressed frames are restored into PMR allocated buffers before being passed
+    /// to the callback; messages w/o the frame marker (from uncompressed peers) are passed as is.
+    /// A frame with the marker is dropped if it is malformed or truncated (including one which claims
+    /// original size bigger than `config::Presentation::RawCompression_MaxPayloadSize`),
+    /// or if its restored payload can't be allocated.
+    ///
+    void setDecompression(const bool is_enabled) noexcept
+    {
+        is_decompression_enabled_ = is_enabled;
+    }
+
+    bool isDecompressionEnabled() const noexcept
+    {
+        return is_decompression_enabled_;
+    }
+
 private:
     friend class Presentation;  // NOLINT cppcoreguidelines-virtual-class-destructor
     friend class detail::SubscriberImpl;
@@ -219,15 +294,30 @@ private:
                            const transport::ScatteredBuffer&   raw_message,
                            const transport::MessageRxMetadata& metadata) const
     {
-        if (on_receive_cb_fn_)
+        if (!on_receive_cb_fn_)
         {
-            on_receive_cb_fn_({approx_now, raw_message, metadata});
+            return;
         }
+
+        if (is_decompression_enabled_ && detail::RawCompression::hasFrameMarker(raw_message))
+        {
+            auto payload = detail::RawCompression::decompress(memory(), raw_message);
+            if (auto* const payload_buffer = cetl::get_if<detail::RawPayloadBuffer>(&payload))
+            {
+                const transport::ScatteredBuffer message{std::move(*payload_buffer)};
+                on_receive_cb_fn_({approx_now, message, metadata});
+            }
+            // Otherwise, the frame is either malformed or can't be restored due to lack of memory - drop it.
+            return;
+        }
+
+        on_receive_cb_fn_({approx_now, raw_message, metadata});
     }
 
     // MARK: Data members:
 
     OnReceiveCallback::Function on_receive_cb_fn_;
+    bool                        is_decompression_enabled_{false};
 
 };  // Subscriber<void>
 
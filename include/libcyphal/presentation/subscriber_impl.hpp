@@ -7,10 +7,12 @@
 #define LIBCYPHAL_PRESENTATION_SUBSCRIBER_IMPL_HPP_INCLUDED
 
 #include "presentation_delegate.hpp"
+#include "rx_metrics.hpp"
 #include "shared_object.hpp"
 
 #include "libcyphal/common/cavl/cavl.hpp"
 #include "libcyphal/common/crc.hpp"
+#include "libcyphal/errors.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
 #include "libcyphal/transport/types.hpp"
@@ -199,6 +201,16 @@ public:
         return time_provider_.now();
     }
 
+    CETL_NODISCARD cetl::pmr::memory_resource& memory() const noexcept
+    {
+        return delegate_.memory();
+    }
+
+    CETL_NODISCARD transport::PortId getSubjectId() const noexcept
+    {
+        return subject_id_;
+    }
+
     CETL_NODISCARD std::int32_t compareBySubjectId(const transport::PortId subject_id) const
     {
         return static_cast<std::int32_t>(subject_id_) - static_cast<std::int32_t>(subject_id);
@@ -248,6 +260,29 @@ public:
         (void) release();
     }
 
+    /// @brief Enables tracking of reception metrics (if not yet).
+    ///
+    /// The tracker is allocated from the presentation layer PMR only once, on the very first call.
+    ///
+    cetl::optional<MemoryError> enableRxMetrics()
+    {
+        if (rx_metrics_ == nullptr)
+        {
+            rx_metrics_ = makeUniquePtr<RxMetricsTracker, RxMetricsTracker>(delegate_.memory(),
+                                                                            delegate_.getTransferIdModulo());
+            if (rx_metrics_ == nullptr)
+            {
+                return MemoryError{};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    const RxMetricsTracker* getRxMetrics() const noexcept
+    {
+        return rx_metrics_.get();
+    }
+
     // MARK: SharedObject
 
     /// @brief Decrements the reference count, and releases this shared subscriber if the count is zero.
@@ -272,6 +307,11 @@ private:
     {
         CETL_DEBUG_ASSERT(next_cb_node_ == nullptr, "");
 
+        if (rx_metrics_ != nullptr)
+        {
+            rx_metrics_->update(arg.transfer.metadata);
+        }
+
         if (callback_nodes_.empty())
         {
             return;
@@ -306,6 +346,7 @@ private:
     const transport::PortId                       subject_id_;
     common::cavl::Tree<CallbackNode>              callback_nodes_;
     CallbackNode*                                 next_cb_node_;
+    UniquePtr<RxMetricsTracker>                   rx_metrics_;
 
 };  // SubscriberImpl
 
@@ -0,0 +1,165 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_TEMPLATE_PUBLISHER_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_TEMPLATE_PUBLISHER_HPP_INCLUDED
+
+#include "publisher.hpp"
+
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// @brief Defines a strong-typed publisher of pre-serialized (aka template) messages.
+///
+/// Periodic status messages (like `uavcan.node.Heartbeat`) typically have fixed layout, and only a few of their
+/// fields change between publications. Instead of serializing the whole message on each publication (as the regular
+/// `Publisher<Message>` does), this publisher serializes the message once into its internal payload template,
+/// and then allows to patch in-place individual fields at their fixed byte offsets. Publication of the template
+/// passes the already serialized payload directly to the transport layer, so per-publish CPU cost is reduced
+/// to a few stores (plus transport framing).
+///
+/// Patching is valid only for fields which have fixed byte-aligned offset within the serialized payload,
+/// i.e. fields which are not preceded by any variable-length fields (arrays, unions etc).
+/// Use `setMessage` to re-serialize the whole template if the layout (f.e. length of an array) has changed.
+///
+/// @tparam Message_ The message type of the publisher. The same requirements as for `Publisher<Message>`.
+///
+template <typename Message_>
+class TemplatePublisher final : public detail::PublisherBase
+{
+public:
+    /// @brief Defines the message type of the publisher.
+    ///
+    using Message = Message_;
+
+    /// @brief Makes a template publisher out of the regular strong-typed one.
+    ///
+    /// @param publisher The regular publisher to take over. Its priority is preserved.
+    /// @param message The initial message to serialize into the template.
+    /// @return The template publisher if the initial message was serialized successfully.
+    ///
+    static auto make(Publisher<Message>&& publisher, const Message& message)
+        -> Expected<TemplatePublisher, nunavut::support::Error>
+    {
+        TemplatePublisher template_publisher{std::move(publisher)};
+        if (const auto failure = template_publisher.setMessage(message))
+        {
+            return *failure;
+        }
+        return template_publisher;
+    }
+
+    /// @brief Serializes the whole message into the template (replacing the previous one).
+    ///
+    /// On failure the previous template is preserved.
+    ///
+    cetl::optional<nunavut::support::Error> setMessage(const Message& message)
+    {
+        // Next nolint b/c we use a buffer to serialize the message, so no need to zero it (and performance better).
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+        std::array<cetl::byte, BufferSize> buffer;
+        // TODO: Eliminate `reinterpret_cast` when Nunavut supports `cetl::byte` at its `serialize`.
+        const auto result_size = serialize(message,
+                                           // Next nolint & NOSONAR are currently unavoidable.
+                                           // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                                           {reinterpret_cast<std::uint8_t*>(buffer.data()),  // NOSONAR cpp:S3630,
+                                            buffer.size()});
+        if (!result_size)
+        {
+            return result_size.error();
+        }
+
+        buffer_       = buffer;
+        payload_size_ = result_size.value();
+        return cetl::nullopt;
+    }
+
+    /// @brief Gets the current serialized payload of the template.
+    ///
+    cetl::span<const cetl::byte> getPayload() const noexcept
+    {
+        return {buffer_.data(), payload_size_};
+    }
+
+    /// @brief Patches in-place an unsigned integer field of the template.
+    ///
+    /// The value is stored in the little-endian byte order (as required by the DSDL serialization).
+    /// For fields with bit length less than the field type (f.e. `uint2`), the user is responsible
+    /// for passing a value within the field's range (the DSDL saturation is not applied).
+    ///
+    /// @tparam Field Unsigned integer type which size matches the field's serialized size.
+    /// @param offset_bytes Byte offset of the field within the serialized payload.
+    /// @param value The new value of the field.
+    /// @return `true` if the field was patched; `false` if it goes beyond the serialized payload.
+    ///
+    template <typename Field>
+    bool patch(const std::size_t offset_bytes, const Field value) noexcept
+    {
+        static_assert(std::is_unsigned<Field>::value && !std::is_same<Field, bool>::value,
+                      "Only unsigned integer fields are supported.");
+
+        if ((offset_bytes > payload_size_) || (sizeof(Field) > (payload_size_ - offset_bytes)))
+        {
+            return false;
+        }
+
+        auto bits = static_cast<std::uint64_t>(value);
+        for (std::size_t i = 0; i < sizeof(Field); ++i)
+        {
+            buffer_[offset_bytes + i] = static_cast<cetl::byte>(bits & 0xFFU);  // NOLINT
+            bits >>= 8U;                                                         // NOLINT
+        }
+        return true;
+    }
+
+    /// Publishes the current template on libcyphal network.
+    ///
+    /// The template is not modified by the publication, so it could be published again (f.e. after patching).
+    ///
+    /// @param deadline The latest time to send the message. Will be dropped if exceeded.
+    ///
+    cetl::optional<Failure> publish(const TimePoint deadline) const
+    {
+        const cetl::span<const cetl::byte>                      data_span{buffer_.data(), payload_size_};
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{data_span};
+
+        return publishRawData(deadline, fragments);
+    }
+
+private:
+    static constexpr std::size_t BufferSize = Message::_traits_::SerializationBufferSizeBytes;
+
+    explicit TemplatePublisher(Publisher<Message>&& publisher)
+        : PublisherBase{std::move(publisher)}
+    {
+    }
+
+    // MARK: Data members:
+
+    std::array<cetl::byte, BufferSize> buffer_{};
+    std::size_t                        payload_size_{0};
+
+};  // TemplatePublisher<Message>
+
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_TEMPLATE_PUBLISHER_HPP_INCLUDED
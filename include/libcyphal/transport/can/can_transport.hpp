@@ -10,6 +10,8 @@
 
 #include "libcyphal/config.hpp"
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/transport/rx_reassembly_budget.hpp"
 #include "libcyphal/transport/transport.hpp"
 
 #include <canard.h>
@@ -36,6 +38,7 @@ public:
     /// - Index of media interface related to this error.
     ///   This index is the same as the index of the (not `nullptr`!) media interface
     ///   pointer in the `media` span argument used at the `makeTransport()` factory method.
+    ///   A media added later (see `addMedia`) gets the lowest index which is not in use by other media.
     /// - A reference to the entity that has caused this error.
     ///
     struct TransientErrorReport
@@ -137,6 +140,81 @@ public:
     ///
     virtual void setTransientErrorHandler(TransientErrorHandler handler) = 0;
 
+    /// @brief Adds a new redundant media interface to the running transport.
+    ///
+    /// The transport brings up TX queue, RX callback and filters for the new media, so all existing sessions
+    /// start using it as well (with their next transfers) - there is no need to remake the transport or its sessions.
+    ///
+    /// @param media The media interface to add. Must outlive the transport (or be removed from it before).
+    /// @return `nullopt` on success. Otherwise:
+    ///         - `AlreadyExistsError` if the media has been already added;
+    ///         - `ArgumentError` if there is no room for the media (see `media` span at `makeTransport()`).
+    ///
+    virtual cetl::optional<AnyFailure> addMedia(IMedia& media) = 0;
+
+    /// @brief Removes a redundant media interface from the running transport.
+    ///
+    /// Frames still queued for the media are dropped, and the transport won't call the media anymore,
+    /// so it could be destroyed right after this call. Other media and all sessions continue to work as is.
+    /// Should not be called from within the transient error handler.
+    ///
+    /// @param media The media interface to remove.
+    /// @return `nullopt` on success. `ArgumentError` if the media is unknown, or if it's the last one
+    ///         (transport must have at least one media - the same as at `makeTransport()`).
+    ///
+    virtual cetl::optional<ArgumentError> removeMedia(IMedia& media) = 0;
+
+    /// @brief Umbrella type for RX reassembly memory budget entities.
+    ///
+    /// See `transport::RxReassemblyBudget` for details. For this transport, only the first frame of a multi-frame
+    /// transfer needs memory - libcanard allocates for it a payload buffer of the subscription extent size,
+    /// and keeps it until the transfer is reassembled. So, the extent is what is accounted per such transfer.
+    ///
+    using RxReassemblyBudget = transport::RxReassemblyBudget;
+
+    /// Sets (or removes) the RX reassembly memory budget.
+    ///
+    /// See \ref RxReassemblyBudget for more details. Disabled by default.
+    ///
+    /// @param params Limits of the budget. `nullopt` disables the budget (statistics are kept).
+    ///
+    virtual void setRxReassemblyBudget(const cetl::optional<RxReassemblyBudget::Params>& params) = 0;
+
+    /// Gets cumulative statistics of the RX reassembly memory budget enforcement.
+    ///
+    virtual RxReassemblyBudget::Stats getRxReassemblyStats() const noexcept = 0;
+
+    /// Makes a new frame monitor (aka promiscuous) RX session.
+    ///
+    /// Intended for bus loggers and analyzers - all received frames of the monitored ports are delivered
+    /// to the session, see `IFrameMonitorRxSession` for details. While the session exists, media are configured
+    /// with a single accept-all filter (instead of per port filters), so CPU load of the media might increase.
+    ///
+    /// @param params The frame monitor RX session parameters. Subject IDs should be in the [0, 8191] range.
+    /// @return A new session if successful; otherwise a failure (f.e. `AlreadyExistsError` if there is
+    ///         another frame monitor session already).
+    ///
+    virtual Expected<UniquePtr<IFrameMonitorRxSession>, AnyFailure> makeFrameMonitorRxSession(
+        const FrameMonitorRxParams& params) = 0;
+
+    /// Makes a new logical node which shares media of this transport.
+    ///
+    /// Intended for gateways and simulators which represent several Cyphal nodes in one process. The logical node
+    /// is a transport on its own (with its own local node ID and sessions), but it doesn't have its own media -
+    /// frames are received (and filtered) by this transport only once, service transfers are demultiplexed
+    /// by their destination node ID, and transfers of the node are sent (with the node ID as the source one)
+    /// via TX queues of this transport. Note that transfers sent by one node of the same transport
+    /// are not received by the other ones (b/c media don't receive their own frames).
+    ///
+    /// The logical node must be destroyed before this transport, and all its sessions - before the node.
+    ///
+    /// @param node_id Local node ID of the logical node. Can't be changed later (see `ITransport::setLocalNodeId`).
+    /// @return A new logical node if successful; otherwise a failure:
+    ///         - `ArgumentError` if the node ID is invalid;
+    ///         - `AlreadyExistsError` if the node ID is already in use by this transport or its other logical node.
+    ///
+    virtual Expected<UniquePtr<ITransport>, AnyFailure> makeLogicalNode(const NodeId node_id) = 0;
+
 protected:
     ICanTransport()  = default;
     ~ICanTransport() = default;
@@ -8,17 +8,26 @@
 
 #include "can_transport.hpp"
 #include "delegate.hpp"
+#include "frame_codec.hpp"
+#include "frame_monitor_rx_session.hpp"
+#include "logical_node.hpp"
 #include "media.hpp"
 #include "msg_rx_session.hpp"
 #include "msg_tx_session.hpp"
 #include "svc_rx_sessions.hpp"
 #include "svc_tx_sessions.hpp"
 
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/config.hpp"
 #include "libcyphal/executor.hpp"
 #include "libcyphal/transport/contiguous_payload.hpp"
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
 #include "libcyphal/transport/lizard_helpers.hpp"
+#include "libcyphal/transport/media_slots.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/msg_tx_capacity.hpp"
+#include "libcyphal/transport/msg_tx_timestamping.hpp"
 #include "libcyphal/transport/svc_sessions.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
@@ -33,6 +42,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <utility>
 
@@ -51,7 +61,7 @@ namespace detail
 
 /// @brief Represents final implementation class of the CAN transport.
 ///
-class TransportImpl final : private TransportDelegate, public ICanTransport
+class TransportImpl final : private TransportDelegate, private ILogicalNodeHostDelegate, public ICanTransport
 {
     /// @brief Defines private specification for making interface unique ptr.
     ///
@@ -89,6 +99,11 @@ class TransportImpl final : private TransportDelegate, public ICanTransport
             return canard_tx_queue_;
         }
 
+        const CanardTxQueue& canard_tx_queue() const
+        {
+            return canard_tx_queue_;
+        }
+
         IExecutor::Callback::Any& tx_callback()
         {
             return tx_callback_;
@@ -99,6 +114,11 @@ class TransportImpl final : private TransportDelegate, public ICanTransport
             return rx_callback_;
         }
 
+        IExecutor::Callback::Any& tx_recheck_callback()
+        {
+            return tx_recheck_callback_;
+        }
+
         void propagateMtuToTxQueue()
         {
             canard_tx_queue_.mtu_bytes = interface_.getMtu();
@@ -122,16 +142,110 @@ class TransportImpl final : private TransportDelegate, public ICanTransport
         CanardTxQueue            canard_tx_queue_;
         IExecutor::Callback::Any rx_callback_;
         IExecutor::Callback::Any tx_callback_;
+        IExecutor::Callback::Any tx_recheck_callback_;
 
     };  // Media
-    using MediaArray = libcyphal::detail::VarArray<Media>;
+    using MediaArray = transport::detail::MediaSlots<Media>;
+
+    /// @brief Defines private storage of a subject subscription which is shared by logical nodes.
+    ///
+    /// Frames of the subject are reassembled only once (by the host canard instance dedicated to logical nodes),
+    /// and then the complete transfer is fanned out to message RX sessions of all subscribed logical nodes
+    /// (see `fanOutLogicalNodesMsgRxTransfer`). Sessions keep their subscriptions in canard instances of their nodes,
+    /// but only as a registry of their extents, transfer-ID timeouts and session delegates - frames aren't fed there.
+    ///
+    class SharedMsgRxSubscription final : private IRxSessionDelegate,
+                                          public common::cavl::Node<SharedMsgRxSubscription>
+    {
+    public:
+        SharedMsgRxSubscription(TransportImpl& host, const PortId subject_id, const std::size_t extent)
+            : host_{host}
+            , subject_id_{subject_id}
+            , subscription_{}
+        {
+            subscribe(extent);
+        }
+
+        SharedMsgRxSubscription(const SharedMsgRxSubscription&)                = delete;
+        SharedMsgRxSubscription(SharedMsgRxSubscription&&) noexcept            = delete;
+        SharedMsgRxSubscription& operator=(const SharedMsgRxSubscription&)     = delete;
+        SharedMsgRxSubscription& operator=(SharedMsgRxSubscription&&) noexcept = delete;
+
+        ~SharedMsgRxSubscription()
+        {
+            unsubscribe();
+        }
+
+        CETL_NODISCARD std::int32_t compareBySubjectId(const PortId subject_id) const noexcept
+        {
+            return static_cast<std::int32_t>(subject_id) - static_cast<std::int32_t>(subject_id_);
+        }
+
+        /// Re-subscribes with the new extent (if it's changed), which drops transfers being reassembled.
+        ///
+        void setExtent(const std::size_t extent)
+        {
+            if (subscription_.extent != extent)
+            {
+                unsubscribe();
+                subscribe(extent);
+            }
+        }
+
+        void setTransferIdTimeout(const CanardMicrosecond transfer_id_timeout_usec) noexcept
+        {
+            subscription_.transfer_id_timeout_usec = transfer_id_timeout_usec;
+        }
+
+    private:
+        void subscribe(const std::size_t extent)
+        {
+            const std::int8_t result = ::canardRxSubscribe(&host_.logical_nodes_canard_instance_,
+                                                           CanardTransferKindMessage,
+                                                           subject_id_,
+                                                           extent,
+                                                           CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
+                                                           &subscription_);
+            (void) result;
+            CETL_DEBUG_ASSERT(result > 0, "New subscription supposed to be made.");
+
+            // No Sonar `cpp:S5356` b/c we integrate here with C libcanard API.
+            subscription_.user_reference = static_cast<IRxSessionDelegate*>(this);  // NOSONAR cpp:S5356
+        }
+
+        void unsubscribe()
+        {
+            const std::int8_t result = ::canardRxUnsubscribe(&host_.logical_nodes_canard_instance_,
+                                                             CanardTransferKindMessage,
+                                                             subject_id_);
+            (void) result;
+            CETL_DEBUG_ASSERT(result > 0, "Subscription supposed to be made at constructor.");
+        }
+
+        // MARK: IRxSessionDelegate
+
+        void acceptRxTransfer(const CanardRxTransfer& transfer) override
+        {
+            // Session callbacks might destroy this subscription (f.e. by resetting the last session of the subject),
+            // so the fan out is done by the host, and nothing is touched here afterward.
+            host_.fanOutLogicalNodesMsgRxTransfer(subject_id_, transfer);
+        }
+
+        // MARK: Data members:
+
+        TransportImpl&       host_;
+        const PortId         subject_id_;
+        CanardRxSubscription subscription_;
+
+    };  // SharedMsgRxSubscription
 
 public:
     CETL_NODISCARD static Expected<UniquePtr<ICanTransport>, FactoryFailure> make(  //
         cetl::pmr::memory_resource& memory,
         IExecutor&                  executor,
         const cetl::span<IMedia*>   media,
-        const std::size_t           tx_capacity)
+        const std::size_t           tx_capacity,
+        const std::size_t           tx_in_flight_limit)
     {
         // Verify input arguments:
         // - At least one media interface must be provided, but no more than the maximum allowed (255).
@@ -145,16 +259,25 @@ public:
             return ArgumentError{};
         }
 
+        // Extra `nullptr` entries of the span reserve slots for media which might be added later (see `addMedia`).
+        const std::size_t media_capacity =
+            std::min(media.size(), static_cast<std::size_t>(std::numeric_limits<std::uint8_t>::max()));
+
         // False positive of clang-tidy - we move `media_array` to the `transport` instance, so can't make it const.
         // NOLINTNEXTLINE(misc-const-correctness)
-        MediaArray media_array = makeMediaArray(memory, media_count, media, tx_capacity);
+        MediaArray media_array = makeMediaArray(memory, media_capacity, media, tx_capacity);
         if (media_array.size() != media_count)
         {
             return MemoryError{};
         }
 
-        auto transport =
-            libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, memory, executor, std::move(media_array));
+        auto transport = libcyphal::detail::makeUniquePtr<Spec>(memory,
+                                                                Spec{},
+                                                                memory,
+                                                                executor,
+                                                                std::move(media_array),
+                                                                tx_capacity,
+                                                                tx_in_flight_limit);
         if (transport == nullptr)
         {
             return MemoryError{};
@@ -163,12 +286,21 @@ public:
         return transport;
     }
 
-    TransportImpl(const Spec, cetl::pmr::memory_resource& memory, IExecutor& executor, MediaArray&& media_array)
+    TransportImpl(const Spec,
+                  cetl::pmr::memory_resource& memory,
+                  IExecutor&                  executor,
+                  MediaArray&&                media_array,
+                  const std::size_t           tx_capacity,
+                  const std::size_t           tx_in_flight_limit)
         : TransportDelegate{memory}
         , executor_{executor}
         , media_array_{std::move(media_array)}
+        , tx_capacity_{tx_capacity}
+        , tx_in_flight_limit_{tx_in_flight_limit}
         , total_msg_rx_ports_{0}
         , total_svc_rx_ports_{0}
+        , logical_nodes_canard_instance_{::canardInit(makeCanardMemoryResource())}
+        , shared_msg_rx_allocator_{&memory}
     {
         scheduleConfigOfFilters();
     }
@@ -181,6 +313,7 @@ public:
     ~TransportImpl()
     {
         configure_filters_callback_.reset();
+        tx_capacity_callback_.reset();
 
         for (Media& media : media_array_)
         {
@@ -191,6 +324,10 @@ public:
                           "Message sessions must be destroyed before transport.");
         CETL_DEBUG_ASSERT(total_svc_rx_ports_ == 0,  //
                           "Service sessions must be destroyed before transport.");
+        CETL_DEBUG_ASSERT(logical_nodes_.empty(),  //
+                          "Logical nodes must be destroyed before transport.");
+        CETL_DEBUG_ASSERT(shared_msg_rx_subscriptions_.empty(),  //
+                          "Shared subscriptions are supposed to go together with logical node sessions.");
     }
 
     // In use (public) for unit tests only.
@@ -209,6 +346,87 @@ private:
         transient_error_handler_ = std::move(handler);
     }
 
+    CETL_NODISCARD cetl::optional<AnyFailure> addMedia(IMedia& media_interface) override
+    {
+        if (nullptr != media_array_.findByInterface(media_interface))
+        {
+            return AlreadyExistsError{};
+        }
+        const auto free_index = media_array_.findFreeIndex();
+        if (!free_index.has_value())
+        {
+            return ArgumentError{};
+        }
+
+        (void) media_array_.emplaceAt(*free_index, *free_index, media_interface, tx_capacity_);
+
+        // The new media should receive the same frames as the others - so it needs RX callback (if there are
+        // active RX ports), and the same filters. Existing sessions start sending to it with their next transfer.
+        //
+        if (hasActiveRxPorts())
+        {
+            ensureMediaRxCallbacks();
+        }
+        scheduleConfigOfFilters();
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> removeMedia(IMedia& media_interface) override
+    {
+        Media* const media = media_array_.findByInterface(media_interface);
+        if ((nullptr == media) || (media_array_.size() <= 1))
+        {
+            return ArgumentError{};
+        }
+
+        // Frames still queued for the media are dropped (but not the ones already pushed to the media).
+        // Media callbacks are released together with the media, so the transport won't call the media anymore.
+        //
+        flushCanardTxQueue(media->canard_tx_queue(), canardInstance());
+        media_array_.resetAt(media->index());
+
+        // Dropped frames might have been the ones which kept TX queues occupied.
+        updateTxCapacityOnDrain();
+
+        return cetl::nullopt;
+    }
+
+    void setRxReassemblyBudget(const cetl::optional<RxReassemblyBudget::Params>& params) override
+    {
+        rxReassemblyLedger().setParams(params);
+    }
+
+    RxReassemblyBudget::Stats getRxReassemblyStats() const noexcept override
+    {
+        return rxReassemblyLedger().getStats();
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IFrameMonitorRxSession>, AnyFailure> makeFrameMonitorRxSession(
+        const FrameMonitorRxParams& params) override
+    {
+        if (frame_monitor_rx_session_ != nullptr)
+        {
+            return AlreadyExistsError{};
+        }
+
+        return FrameMonitorRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<ITransport>, AnyFailure> makeLogicalNode(const NodeId node_id) override
+    {
+        if (node_id > CANARD_NODE_ID_MAX)
+        {
+            return ArgumentError{};
+        }
+        if ((getNodeId() == node_id) || (findLogicalNode(node_id) != nullptr))
+        {
+            return AlreadyExistsError{};
+        }
+
+        return LogicalNode::make(memory(), *this, node_id);
+    }
+
     // MARK: ITransport
 
     CETL_NODISCARD cetl::optional<NodeId> getLocalNodeId() const noexcept override
@@ -234,7 +452,7 @@ private:
         {
             return cetl::nullopt;
         }
-        if (getNodeId() != CANARD_NODE_ID_UNSET)
+        if ((getNodeId() != CANARD_NODE_ID_UNSET) || (findLogicalNode(new_node_id) != nullptr))
         {
             return ArgumentError{};
         }
@@ -314,48 +532,9 @@ private:
                                                            const CanardTransferMetadata& metadata,
                                                            const PayloadFragments        payload_fragments) override
     {
-        // libcanard currently does not support fragmented payloads (at `canardTxPush`).
-        // so we need to concatenate them when there are more than one non-empty fragment.
-        // See https://github.com/OpenCyphal/libcanard/issues/223
-        //
-        const transport::detail::ContiguousPayload payload{memory(), payload_fragments};
-        if ((payload.data() == nullptr) && (payload.size() > 0))
-        {
-            return MemoryError{};
-        }
-
-        const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(executor_.now().time_since_epoch());
-        const auto deadline_us = std::chrono::duration_cast<std::chrono::microseconds>(deadline.time_since_epoch());
-
-        for (Media& media : media_array_)
-        {
-            media.propagateMtuToTxQueue();
-
-            // No Sonar `cpp:S5356` b/c we need to pass payload as a raw data to the libcanard.
-            const std::int32_t result = ::canardTxPush(&media.canard_tx_queue(),
-                                                       &canardInstance(),
-                                                       static_cast<CanardMicrosecond>(deadline_us.count()),
-                                                       &metadata,
-                                                       {payload.size(), payload.data()},  // NOSONAR cpp:S5356
-                                                       static_cast<CanardMicrosecond>(now_us.count()));
-
-            cetl::optional<AnyFailure> failure =
-                tryHandleTransientCanardResult<TransientErrorReport::CanardTxPush>(media, result);
-            if (failure.has_value())
-            {
-                // The handler (if any) just said that it's NOT fine to continue with pushing to other media TX queues,
-                // and the failure should not be ignored but propagated outside.
-                return failure;
-            }
-
-            // No need to try to push next frame when previous one hasn't finished yet.
-            if (!media.tx_callback())
-            {
-                pushNextFrameToMedia(media);
-            }
-        }
-
-        return cetl::nullopt;
+        auto failure = sendTransferFrom(canardInstance(), deadline, metadata, payload_fragments);
+        updateTxCapacityOnPush(failure);
+        return failure;
     }
 
     void onSessionEvent(const SessionEvent::Variant& event_var) override
@@ -363,6 +542,12 @@ private:
         SessionEventHandler handler_with{*this};
         cetl::visit(handler_with, event_var);
 
+        // TX capacity notifications affect neither RX callbacks nor filters.
+        if (cetl::holds_alternative<SessionEvent::MsgTxCapacity>(event_var))
+        {
+            return;
+        }
+
         cancelRxCallbacksIfNoPortsLeft();
         scheduleConfigOfFilters();
     }
@@ -382,6 +567,76 @@ private:
         CETL_DEBUG_ASSERT(result, "Unexpected failure to schedule filter configuration.");
     }
 
+    // MARK: ILogicalNodeHostDelegate
+
+    CETL_NODISCARD ProtocolParams getHostProtocolParams() const noexcept override
+    {
+        return getProtocolParams();
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> sendLogicalNodeTransfer(
+        CanardInstance&               node_canard_instance,
+        const TimePoint               deadline,
+        const CanardTransferMetadata& metadata,
+        const PayloadFragments        payload_fragments) override
+    {
+        auto failure = sendTransferFrom(node_canard_instance, deadline, metadata, payload_fragments);
+        updateTxCapacityOnPush(failure);
+        return failure;
+    }
+
+    void onLogicalNodeLifetime(LogicalNode& node, const bool is_added) override
+    {
+        if (is_added)
+        {
+            const auto node_id       = node.getNodeId();
+            const auto node_existing = logical_nodes_.search(  //
+                [node_id](const LogicalNode& other) {          // predicate
+                    //
+                    return other.compareByNodeId(node_id);
+                },
+                [&node]() { return &node; });  // "factory"
+
+            (void) node_existing;
+        }
+        else
+        {
+            logical_nodes_.remove(&node);
+        }
+    }
+
+    void onLogicalNodeSessionEvent(const SessionEvent::Variant& event_var) override
+    {
+        // RX ports of a logical node are counted by the node itself, so only shared subscriptions of subjects,
+        // TX timestamping and capacity are of interest here.
+        if (const auto* const msg_rx = cetl::get_if<SessionEvent::MsgRxLifetime>(&event_var))
+        {
+            updateSharedMsgRxSubscription(msg_rx->subject_id);
+        }
+        else if (const auto* const timestamping = cetl::get_if<SessionEvent::MsgTxTimestamping>(&event_var))
+        {
+            const SessionEventHandler handler_with{*this};
+            handler_with(*timestamping);
+        }
+        else if (const auto* const capacity = cetl::get_if<SessionEvent::MsgTxCapacity>(&event_var))
+        {
+            const SessionEventHandler handler_with{*this};
+            handler_with(*capacity);
+            return;
+        }
+        else
+        {
+            // Nothing to handle.
+        }
+
+        if (hasActiveRxPorts())
+        {
+            ensureMediaRxCallbacks();
+        }
+        cancelRxCallbacksIfNoPortsLeft();
+        scheduleConfigOfFilters();
+    }
+
     // MARK: Privates:
 
     using Self = TransportImpl;
@@ -421,6 +676,51 @@ private:
             }
         }
 
+        void operator()(const SessionEvent::MsgTxTimestamping& timestamping) const
+        {
+            if (timestamping.is_added)
+            {
+                self_.tx_timestamping_registry_.insertNode(timestamping.node);
+
+                // TX timestamps are reported by media as loopback frames, so we need to pop them.
+                self_.ensureMediaRxCallbacks();
+            }
+            else
+            {
+                self_.tx_timestamping_registry_.removeNode(timestamping.node);
+            }
+        }
+
+        void operator()(const SessionEvent::FrameMonitorRxLifetime& lifetime) const
+        {
+            if (lifetime.is_added)
+            {
+                CETL_DEBUG_ASSERT(self_.frame_monitor_rx_session_ == nullptr, "Only one monitor is expected.");
+                self_.frame_monitor_rx_session_ = &lifetime.delegate;
+                self_.ensureMediaRxCallbacks();
+            }
+            else
+            {
+                CETL_DEBUG_ASSERT(self_.frame_monitor_rx_session_ == &lifetime.delegate, "");
+                self_.frame_monitor_rx_session_ = nullptr;
+            }
+        }
+
+        void operator()(const SessionEvent::MsgTxCapacity& capacity) const
+        {
+            if (capacity.is_added)
+            {
+                self_.tx_capacity_registry_.insertNode(capacity.node);
+
+                // The node might be added right after a failed send (when TX queues are already full).
+                self_.updateTxCapacityOnPush(cetl::nullopt);
+            }
+            else
+            {
+                self_.tx_capacity_registry_.removeNode(capacity.node);
+            }
+        }
+
     private:
         Self& self_;
 
@@ -444,6 +744,165 @@ private:
             return std::move(*make_failure);
         }
 
+        ensureMediaRxCallbacks();
+
+        return session_result;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> sendTransferFrom(CanardInstance&               source_canard_instance,
+                                                               const TimePoint               deadline,
+                                                               const CanardTransferMetadata& metadata,
+                                                               const PayloadFragments        payload_fragments)
+    {
+        // libcanard currently does not support fragmented payloads (at `canardTxPush`).
+        // so we need to concatenate them when there are more than one non-empty fragment.
+        // See https://github.com/OpenCyphal/libcanard/issues/223
+        //
+        const transport::detail::ContiguousPayload payload{memory(), payload_fragments};
+        if ((payload.data() == nullptr) && (payload.size() > 0))
+        {
+            return MemoryError{};
+        }
+
+        const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(executor_.now().time_since_epoch());
+        const auto deadline_us = std::chrono::duration_cast<std::chrono::microseconds>(deadline.time_since_epoch());
+
+        for (Media& media : media_array_)
+        {
+            media.propagateMtuToTxQueue();
+
+            // No Sonar `cpp:S5356` b/c we need to pass payload as a raw data to the libcanard.
+            const std::int32_t result = ::canardTxPush(&media.canard_tx_queue(),
+                                                       &source_canard_instance,
+                                                       static_cast<CanardMicrosecond>(deadline_us.count()),
+                                                       &metadata,
+                                                       {payload.size(), payload.data()},  // NOSONAR cpp:S5356
+                                                       static_cast<CanardMicrosecond>(now_us.count()));
+
+            cetl::optional<AnyFailure> failure =
+                tryHandleTransientCanardResult<TransientErrorReport::CanardTxPush>(media,
+                                                                                   source_canard_instance,
+                                                                                   result);
+            if (failure.has_value())
+            {
+                // The handler (if any) just said that it's NOT fine to continue with pushing to other media TX queues,
+                // and the failure should not be ignored but propagated outside.
+                return failure;
+            }
+
+            // No need to try to push next frame when previous one hasn't finished yet.
+            if (!media.tx_callback())
+            {
+                pushNextFrameToMedia(media);
+            }
+        }
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD LogicalNode* findLogicalNode(const NodeId node_id)
+    {
+        return logical_nodes_.search([node_id](const LogicalNode& other) {  // predicate
+            //
+            return other.compareByNodeId(node_id);
+        });
+    }
+
+    /// @brief Defines summary of message RX sessions of logical nodes for a subject.
+    ///
+    struct LogicalNodesSubscriptions
+    {
+        std::size_t       count;
+        std::size_t       max_extent;
+        CanardMicrosecond min_tid_timeout_usec;
+    };
+
+    CETL_NODISCARD LogicalNodesSubscriptions collectLogicalNodesSubscriptions(const PortId subject_id)
+    {
+        LogicalNodesSubscriptions summary{0, 0, std::numeric_limits<CanardMicrosecond>::max()};
+        logical_nodes_.traverseInOrder([subject_id, &summary](LogicalNode& node) {
+            //
+            if (const CanardRxSubscription* const subscription = findLogicalNodeMsgRxSubscription(node, subject_id))
+            {
+                ++summary.count;
+                summary.max_extent           = std::max(summary.max_extent, subscription->extent);
+                summary.min_tid_timeout_usec = std::min(summary.min_tid_timeout_usec,  //
+                                                        subscription->transfer_id_timeout_usec);
+            }
+        });
+        return summary;
+    }
+
+    CETL_NODISCARD static CanardRxSubscription* findLogicalNodeMsgRxSubscription(LogicalNode& node,
+                                                                                const PortId subject_id)
+    {
+        CanardRxSubscription* subscription = nullptr;
+        (void) ::canardRxGetSubscription(&node.canardInstance(), CanardTransferKindMessage, subject_id, &subscription);
+        return subscription;
+    }
+
+    CETL_NODISCARD SharedMsgRxSubscription* findSharedMsgRxSubscription(const PortId subject_id)
+    {
+        return shared_msg_rx_subscriptions_.search([subject_id](const SharedMsgRxSubscription& other) {  // predicate
+            //
+            return other.compareBySubjectId(subject_id);
+        });
+    }
+
+    /// @brief Makes, updates or destroys the shared subscription of a subject (after a logical node session event).
+    ///
+    void updateSharedMsgRxSubscription(const PortId subject_id)
+    {
+        const auto summary = collectLogicalNodesSubscriptions(subject_id);
+
+        SharedMsgRxSubscription* const shared = findSharedMsgRxSubscription(subject_id);
+        if (shared != nullptr)
+        {
+            if (summary.count > 0)
+            {
+                shared->setExtent(summary.max_extent);
+                return;
+            }
+
+            shared_msg_rx_subscriptions_.remove(shared);
+            shared_msg_rx_allocator_.destroy(shared);
+            shared_msg_rx_allocator_.deallocate(shared, 1);
+            return;
+        }
+        if (summary.count == 0)
+        {
+            return;
+        }
+
+        // Node session has been already made, so if there is no memory for the shared subscription,
+        // the session just won't receive anything (the same way as if its canard subscription couldn't allocate).
+        SharedMsgRxSubscription* const new_shared = shared_msg_rx_allocator_.allocate(1);
+        if (new_shared == nullptr)
+        {
+            return;
+        }
+        shared_msg_rx_allocator_.construct(new_shared, *this, subject_id, summary.max_extent);
+
+        const auto existing = shared_msg_rx_subscriptions_.search(  //
+            [subject_id](const SharedMsgRxSubscription& other) {    // predicate
+                //
+                return other.compareBySubjectId(subject_id);
+            },
+            [new_shared]() { return new_shared; });  // "factory"
+        (void) existing;
+    }
+
+    CETL_NODISCARD std::size_t getLogicalNodesRxPortsCount() const
+    {
+        std::size_t total_rx_ports = 0;
+        logical_nodes_.traverseInOrder([&total_rx_ports](const LogicalNode& node) {  //
+            total_rx_ports += node.getRxPortsCount();
+        });
+        return total_rx_ports;
+    }
+
+    void ensureMediaRxCallbacks()
+    {
         for (Media& media : media_array_)
         {
             if (!media.rx_callback())
@@ -454,8 +913,6 @@ private:
                 });
             }
         }
-
-        return session_result;
     }
 
     template <typename Report, typename... Args>
@@ -478,7 +935,9 @@ private:
     }
 
     template <typename Report>
-    cetl::optional<AnyFailure> tryHandleTransientCanardResult(const Media& media, const std::int32_t result)
+    cetl::optional<AnyFailure> tryHandleTransientCanardResult(const Media&       media,
+                                                              CanardInstance&    culprit,
+                                                              const std::int32_t result)
     {
         cetl::optional<AnyFailure> failure = optAnyFailureFromCanard(result);
         if (!failure)
@@ -486,33 +945,29 @@ private:
             return cetl::nullopt;
         }
 
-        return tryHandleTransientFailure<Report>(std::move(*failure), media.index(), canardInstance());
+        return tryHandleTransientFailure<Report>(std::move(*failure), media.index(), culprit);
     }
 
     CETL_NODISCARD static MediaArray makeMediaArray(cetl::pmr::memory_resource& memory,
-                                                    const std::size_t           media_count,
+                                                    const std::size_t           media_capacity,
                                                     const cetl::span<IMedia*>   media_interfaces,
                                                     const std::size_t           tx_capacity)
     {
-        MediaArray media_array{media_count, &memory};
-
-        // Reserve the space for the whole array (to avoid reallocations).
-        // Capacity will be less than requested in case of out of memory.
-        media_array.reserve(media_count);
-        if (media_array.capacity() >= media_count)
+        // All media slots are allocated at once (to avoid reallocations).
+        // Capacity will be zero in case of out of memory.
+        MediaArray media_array{memory, media_capacity};
+        if (media_array.capacity() >= media_capacity)
         {
             std::size_t index = 0;
             for (IMedia* const media_interface : media_interfaces)
             {
-                if (media_interface != nullptr)
+                if ((media_interface != nullptr) && (index < media_capacity))
                 {
                     IMedia& media = *media_interface;
-                    media_array.emplace_back(index, media, tx_capacity);
+                    (void) media_array.emplaceAt(index, index, media, tx_capacity);
                     index++;
                 }
             }
-            CETL_DEBUG_ASSERT(index == media_count, "");
-            CETL_DEBUG_ASSERT(media_array.size() == media_count, "");
         }
 
         return media_array;
@@ -545,22 +1000,49 @@ private:
         }
 
         const IMedia::PopResult::Metadata& pop_meta = pop_success.value();
+        if (pop_meta.is_tx_loopback)
+        {
+            acceptTxLoopbackFrame(pop_meta, payload);
+            return;
+        }
+        if (frame_monitor_rx_session_ != nullptr)
+        {
+            acceptFrameMonitorRxFrame(media, pop_meta, payload);
+        }
 
         const auto timestamp_us =
             std::chrono::duration_cast<std::chrono::microseconds>(pop_meta.timestamp.time_since_epoch());
+        const auto        timestamp = static_cast<CanardMicrosecond>(timestamp_us.count());
         const CanardFrame canard_frame{pop_meta.can_id, {pop_meta.payload_size, payload.data()}};
 
+        acceptOwnCanardFrame(media, pop_meta, payload, timestamp, canard_frame);
+        if (!logical_nodes_.empty())
+        {
+            acceptLogicalNodesFrame(media, timestamp, canard_frame);
+        }
+    }
+
+    void acceptCanardFrame(CanardInstance&                canard_instance,
+                           const Media&                   media,
+                           const CanardMicrosecond        timestamp,
+                           const CanardFrame&             canard_frame,
+                           const RxReassemblyScope* const rx_reassembly_scope = nullptr)
+    {
         CanardRxTransfer      out_transfer{};
         CanardRxSubscription* out_subscription{};
 
-        const std::int8_t result = ::canardRxAccept(&canardInstance(),
-                                                    static_cast<CanardMicrosecond>(timestamp_us.count()),
+        // Canard memory is accounted only while the frame is being accepted - a complete transfer is handed over
+        // to its session (which might free the transfer buffer right away, f.e. from within its callback).
+        setRxReassemblyScope(rx_reassembly_scope);
+        const std::int8_t result = ::canardRxAccept(&canard_instance,
+                                                    timestamp,
                                                     &canard_frame,
                                                     media.index(),
                                                     &out_transfer,
                                                     &out_subscription);
+        setRxReassemblyScope(nullptr);
 
-        (void) tryHandleTransientCanardResult<TransientErrorReport::CanardRxAccept>(media, result);
+        (void) tryHandleTransientCanardResult<TransientErrorReport::CanardRxAccept>(media, canard_instance, result);
         if (result > 0)
         {
             CETL_DEBUG_ASSERT(out_subscription != nullptr, "Expected subscription.");
@@ -574,6 +1056,228 @@ private:
         }
     }
 
+    /// @brief Passes a received frame to the canard instance of this transport - within the RX reassembly budget.
+    ///
+    /// Only the first frame of a multi-frame message transfer is subject to the budget (see `RxReassemblyBudget`),
+    /// whereas actual payload buffers are accounted by canard memory hooks (see `RxReassemblyScope`).
+    ///
+    void acceptOwnCanardFrame(const Media&                       media,
+                              const IMedia::PopResult::Metadata& pop_meta,
+                              const cetl::span<const cetl::byte> payload,
+                              const CanardMicrosecond            timestamp,
+                              const CanardFrame&                 canard_frame)
+    {
+        const auto can_id_fields = FrameCodec::parseCanId(pop_meta.can_id);
+
+        CanardRxSubscription* subscription = nullptr;
+        if ((!can_id_fields.is_service) && (pop_meta.payload_size <= payload.size()))
+        {
+            (void) ::canardRxGetSubscription(&canardInstance(),
+                                             CanardTransferKindMessage,
+                                             can_id_fields.port_id,
+                                             &subscription);
+        }
+        if ((subscription == nullptr) || (subscription->extent == 0))
+        {
+            acceptCanardFrame(canardInstance(), media, timestamp, canard_frame);
+            return;
+        }
+
+        // No Sonar `cpp:S5357` b/c the raw `user_reference` is part of libcanard api,
+        // and it was set by us at `MessageRxSession` constructor (which is a message session delegate).
+        auto* const delegate = static_cast<IRxSessionDelegate*>(subscription->user_reference);  // NOSONAR cpp:S5357
+        auto&       account  = static_cast<IMsgRxSessionDelegate*>(delegate)->getRxReassemblyAccount();  // NOLINT
+
+        const auto tail_byte     = FrameCodec::parseTailByte(payload.first(pop_meta.payload_size));
+        const bool is_multi_head = tail_byte && tail_byte->is_start_of_transfer && (!tail_byte->is_end_of_transfer);
+        if (!rxReassemblyLedger().admit(account,
+                                        is_multi_head ? subscription->extent : 0,
+                                        can_id_fields.priority,
+                                        pop_meta.timestamp))
+        {
+            return;
+        }
+
+        const RxReassemblyScope scope{account, subscription->extent, can_id_fields.priority, pop_meta.timestamp};
+        acceptCanardFrame(canardInstance(), media, timestamp, canard_frame, &scope);
+    }
+
+    /// @brief Passes a received frame to the logical nodes (see `ICanTransport::makeLogicalNode`).
+    ///
+    /// A service frame is passed only to the node which is the frame destination (according to the Cyphal/CAN
+    /// Specification), whereas a message frame is reassembled only once for all nodes subscribed to its subject
+    /// (see `SharedMsgRxSubscription`).
+    ///
+    void acceptLogicalNodesFrame(const Media& media, const CanardMicrosecond timestamp, const CanardFrame& canard_frame)
+    {
+        const auto can_id_fields = FrameCodec::parseCanId(canard_frame.extended_can_id);
+        if (can_id_fields.is_service)
+        {
+            if (LogicalNode* const node = findLogicalNode(can_id_fields.destination_node_id))
+            {
+                acceptCanardFrame(node->canardInstance(), media, timestamp, canard_frame);
+            }
+            return;
+        }
+
+        SharedMsgRxSubscription* const shared = findSharedMsgRxSubscription(can_id_fields.port_id);
+        if (shared == nullptr)
+        {
+            return;
+        }
+
+        // Transfer-ID timeout of a node session could be changed at any time, so the shared one follows
+        // the shortest of them (in order not to drop transfers which are expected by any of the nodes).
+        shared->setTransferIdTimeout(collectLogicalNodesSubscriptions(can_id_fields.port_id).min_tid_timeout_usec);
+        acceptCanardFrame(logical_nodes_canard_instance_, media, timestamp, canard_frame);
+    }
+
+    /// @brief Delivers a message transfer (reassembled once for all logical nodes) to each subscribed node session.
+    ///
+    /// Each session gets the payload truncated to its own extent. The last session takes over the original
+    /// canard buffer, whereas others get their own copies of the payload (a session which copy can't be allocated
+    /// misses the transfer). The original buffer is freed if it's not taken over (f.e. b/c a session callback
+    /// has destroyed sessions of the other nodes).
+    ///
+    void fanOutLogicalNodesMsgRxTransfer(const PortId subject_id, const CanardRxTransfer& transfer)
+    {
+        struct FanOut
+        {
+            std::size_t sessions_left;
+            bool        is_taken_over;
+        };
+        FanOut fan_out{collectLogicalNodesSubscriptions(subject_id).count, false};
+
+        logical_nodes_.traverseInOrder([this, subject_id, &transfer, &fan_out](LogicalNode& node) {
+            //
+            // Once the original buffer is taken over, it could be already freed (f.e. from within session callback),
+            // so sessions made meanwhile (if any) are skipped.
+            const CanardRxSubscription* const subscription = findLogicalNodeMsgRxSubscription(node, subject_id);
+            if ((subscription == nullptr) || fan_out.is_taken_over)
+            {
+                return;
+            }
+
+            CanardRxTransfer node_transfer = transfer;
+            node_transfer.payload.size     = std::min(transfer.payload.size, subscription->extent);
+            if (fan_out.sessions_left <= 1)
+            {
+                fan_out.is_taken_over = true;
+            }
+            else
+            {
+                --fan_out.sessions_left;
+                if (!copyCanardRxPayload(node_transfer))
+                {
+                    return;
+                }
+            }
+
+            // No Sonar `cpp:S5357` b/c the raw `user_reference` is part of libcanard api,
+            // and it was set by us at `MessageRxSession` constructor.
+            auto* const delegate = static_cast<IRxSessionDelegate*>(subscription->user_reference);  // NOSONAR cpp:S5357
+            delegate->acceptRxTransfer(node_transfer);
+        });
+
+        if (!fan_out.is_taken_over)
+        {
+            freeCanardMemory(transfer.payload.data, transfer.payload.allocated_size);
+        }
+    }
+
+    /// @brief Replaces payload of the given transfer with its own copy (allocated from the transport memory).
+    ///
+    CETL_NODISCARD bool copyCanardRxPayload(CanardRxTransfer& transfer) const
+    {
+        void* copy = nullptr;
+        if (transfer.payload.size > 0)
+        {
+            copy = memory().allocate(transfer.payload.size);
+            if (copy == nullptr)
+            {
+                return false;
+            }
+            (void) std::memcpy(copy, transfer.payload.data, transfer.payload.size);
+        }
+
+        transfer.payload.data           = copy;
+        transfer.payload.allocated_size = transfer.payload.size;
+        return true;
+    }
+
+    /// @brief Reports TX timestamp of a message transfer, which first frame has been looped back by a media.
+    ///
+    /// The frame is parsed here directly (instead of Canard) according to the Cyphal/CAN Specification -
+    /// only the CAN ID and the tail byte are needed to find out the subject and transfer IDs.
+    ///
+    void acceptTxLoopbackFrame(const IMedia::PopResult::Metadata& pop_meta, const cetl::span<const cetl::byte> payload)
+    {
+        if (pop_meta.payload_size > payload.size())
+        {
+            return;
+        }
+        const auto can_id_fields = FrameCodec::parseCanId(pop_meta.can_id);
+        const auto tail_byte     = FrameCodec::parseTailByte(payload.first(pop_meta.payload_size));
+        if (can_id_fields.is_service || (!tail_byte) || (!tail_byte->is_start_of_transfer))
+        {
+            return;
+        }
+
+        if (auto* const node = tx_timestamping_registry_.findNode(can_id_fields.port_id))
+        {
+            node->acceptTxTimestamp(tail_byte->transfer_id, CANARD_TRANSFER_ID_MAX + 1U, pop_meta.timestamp);
+        }
+    }
+
+    /// @brief Parses a received frame (according to the Cyphal/CAN Specification), and passes it to the frame monitor.
+    ///
+    /// Frames which are not valid Cyphal/CAN frames (f.e. without tail byte) are not passed.
+    ///
+    void acceptFrameMonitorRxFrame(const Media&                       media,
+                                   const IMedia::PopResult::Metadata& pop_meta,
+                                   const cetl::span<const cetl::byte> payload)
+    {
+        using Kind = FrameMonitorRxMetadata::Kind;
+
+        if (pop_meta.payload_size > payload.size())
+        {
+            return;
+        }
+        const auto tail_byte = FrameCodec::parseTailByte(payload.first(pop_meta.payload_size));
+        if (!tail_byte)
+        {
+            return;
+        }
+        const auto can_id_fields = FrameCodec::parseCanId(pop_meta.can_id);
+
+        FrameMonitorRxMetadata metadata{};
+        metadata.rx_meta.base.transfer_id = tail_byte->transfer_id;
+        metadata.rx_meta.base.priority    = can_id_fields.priority;
+        metadata.rx_meta.timestamp        = pop_meta.timestamp;
+        metadata.media_index              = media.index();
+        metadata.port_id                  = can_id_fields.port_id;
+        metadata.is_start_of_transfer     = tail_byte->is_start_of_transfer;
+        metadata.is_end_of_transfer       = tail_byte->is_end_of_transfer;
+
+        if (!can_id_fields.is_service)
+        {
+            metadata.kind = Kind::Message;
+            if (!can_id_fields.is_anonymous)
+            {
+                metadata.source_node_id = can_id_fields.source_node_id;
+            }
+        }
+        else
+        {
+            metadata.kind                = can_id_fields.is_request ? Kind::Request : Kind::Response;
+            metadata.source_node_id      = can_id_fields.source_node_id;
+            metadata.destination_node_id = can_id_fields.destination_node_id;
+        }
+
+        // The tail byte is not a part of the payload.
+        frame_monitor_rx_session_->acceptRxFrame(metadata, payload.first(pop_meta.payload_size - 1U));
+    }
+
     std::int8_t handleMediaTxFrame(Media& media, const CanardMicrosecond deadline, CanardMutableFrame& frame)
     {
         //
@@ -623,8 +1327,17 @@ private:
 
     /// @brief Tries to push next frame from TX queue to media.
     ///
+    /// Nothing is pushed if the media already has too many frames in flight - the frames are held in the TX queue,
+    /// so that they still could be reordered by priority, and the media is re-checked a bit later.
+    ///
     void pushNextFrameToMedia(Media& media)
     {
+        if (isTxInFlightLimitReached(media))
+        {
+            scheduleTxInFlightRecheck(media);
+            return;
+        }
+
         auto frame_handler = [this, &media](const CanardMicrosecond deadline,
                                             CanardMutableFrame&     frame) -> std::int8_t {
             //
@@ -652,6 +1365,85 @@ private:
                     return (*frame_handler_ptr)(deadline, *frame);
                 });
         }
+
+        updateTxCapacityOnDrain();
+    }
+
+    /// @brief Gets occupancy of the fullest media TX queue.
+    ///
+    CETL_NODISCARD transport::detail::MsgTxCapacityRegistry::Occupancy getTxOccupancy() const
+    {
+        transport::detail::MsgTxCapacityRegistry::Occupancy occupancy{0, tx_capacity_};
+        for (const Media& media : media_array_)
+        {
+            occupancy.queued_frames = std::max(occupancy.queued_frames, media.canard_tx_queue().size);
+        }
+        return occupancy;
+    }
+
+    void updateTxCapacityOnPush(const cetl::optional<AnyFailure>& failure)
+    {
+        using Registry = transport::detail::MsgTxCapacityRegistry;
+
+        tx_capacity_registry_.onTxPush([this] { return getTxOccupancy(); }, Registry::isOutOfCapacity(failure));
+    }
+
+    /// Notifications are delivered from the executor (rather than right here) b/c TX queues are drained
+    /// from within `send` of any session as well - callbacks of other sessions must not run in the middle of it.
+    ///
+    void updateTxCapacityOnDrain()
+    {
+        if (tx_capacity_registry_.isEmpty())
+        {
+            return;
+        }
+
+        if (!tx_capacity_callback_)
+        {
+            tx_capacity_callback_ = executor_.registerCallback([this](const auto&) {
+                //
+                tx_capacity_registry_.onTxDrain([this] { return getTxOccupancy(); });
+            });
+        }
+
+        const bool result = tx_capacity_callback_.schedule(Callback::Schedule::Once{executor_.now()});
+        (void) result;
+        CETL_DEBUG_ASSERT(result, "Unexpected failure to schedule TX capacity notification.");
+    }
+
+    CETL_NODISCARD bool isTxInFlightLimitReached(const Media& media) const
+    {
+        if (tx_in_flight_limit_ == 0)
+        {
+            return false;
+        }
+
+        const cetl::optional<std::size_t> in_flight = media.interface().getTxInFlightCount();
+        return in_flight.has_value() && (in_flight.value() >= tx_in_flight_limit_);
+    }
+
+    void scheduleTxInFlightRecheck(Media& media)
+    {
+        // Nothing to re-check if there is nothing left to push.
+        if (::canardTxPeek(&media.canard_tx_queue()) == nullptr)
+        {
+            return;
+        }
+
+        if (!media.tx_recheck_callback())
+        {
+            media.tx_recheck_callback() = executor_.registerCallback([this, &media](const auto&) {
+                //
+                pushNextFrameToMedia(media);
+            });
+        }
+
+        constexpr std::chrono::microseconds RecheckPeriod{config::Transport::Can::TxInFlightRecheckPeriodUs()};
+
+        const bool result =
+            media.tx_recheck_callback().schedule(Callback::Schedule::Once{executor_.now() + RecheckPeriod});
+        (void) result;
+        CETL_DEBUG_ASSERT(result, "Unexpected failure to schedule TX in-flight re-check.");
     }
 
     /// @brief Tries to peek the first TX item from the media TX queue which is not expired.
@@ -719,12 +1511,31 @@ private:
         using RxSubscription     = const CanardRxSubscription;
         using RxSubscriptionTree = CanardConcreteTree<RxSubscription>;
 
+        const auto local_node_id = static_cast<CanardNodeID>(getNodeId());
+        const auto is_anonymous  = local_node_id > CANARD_NODE_ID_MAX;
+
+        // Frame monitor session needs to see all frames, so a single accept-all filter supersedes all others.
+        if (frame_monitor_rx_session_ != nullptr)
+        {
+            filters.reserve(1);
+            if (filters.capacity() < 1)
+            {
+                return false;
+            }
+            filters.emplace_back(Filter{0, 0});
+            return true;
+        }
+
+        std::size_t total_tx_timestamping = 0;
+        tx_timestamping_registry_.forEachNode([&total_tx_timestamping](const auto&) { ++total_tx_timestamping; });
+
         // Total "active" RX ports depends on the local node ID. For anonymous nodes,
         // we don't account for service ports (b/c they don't work while being anonymous).
+        // Message TX ports with timestamping are also "active" - we need their loopback frames.
+        // RX ports of logical nodes are always "active" (b/c a logical node can't be anonymous).
         //
-        const auto        local_node_id      = static_cast<CanardNodeID>(getNodeId());
-        const auto        is_anonymous       = local_node_id > CANARD_NODE_ID_MAX;
-        const std::size_t total_active_ports = total_msg_rx_ports_ + (is_anonymous ? 0 : total_svc_rx_ports_);
+        const std::size_t total_active_ports = total_msg_rx_ports_ + (is_anonymous ? 0 : total_svc_rx_ports_) +
+                                               getLogicalNodesRxPortsCount() + total_tx_timestamping;
         if (total_active_ports == 0)
         {
             // No need to allocate memory for zero filters.
@@ -769,14 +1580,68 @@ private:
             ports_count += RxSubscriptionTree::visitCounting(subs_trees[CanardTransferKindResponse], svc_visitor);
         }
 
+        logical_nodes_.traverseInOrder([&filters, &ports_count](LogicalNode& node) {
+            //
+            ports_count += fillLogicalNodeFilters(node, filters);
+        });
+
+        tx_timestamping_registry_.forEachNode([&filters, &ports_count](const auto& node) {
+            // Make and store a single message filter (for loopback frames of the subject).
+            const auto flt = ::canardMakeFilterForSubject(node.getSubjectId());
+            filters.emplace_back(Filter{flt.extended_can_id, flt.extended_mask});
+            ++ports_count;
+        });
+
         (void) ports_count;
         CETL_DEBUG_ASSERT(ports_count == total_active_ports, "");
         return true;
     }
 
+    /// @brief Adds filters for each RX port of a logical node.
+    ///
+    /// Message filters are the same for all nodes (b/c they don't depend on node ID),
+    /// so a message filter is added only if there is no such one yet (f.e. from another node).
+    ///
+    /// @return Total number of visited RX ports of the node.
+    ///
+    static std::size_t fillLogicalNodeFilters(LogicalNode& node, libcyphal::detail::VarArray<Filter>& filters)
+    {
+        using RxSubscription     = const CanardRxSubscription;
+        using RxSubscriptionTree = CanardConcreteTree<RxSubscription>;
+
+        const auto  node_id    = static_cast<CanardNodeID>(node.getNodeId());
+        const auto& subs_trees = node.canardInstance().rx_subscriptions;
+
+        const auto msg_visitor = [&filters](RxSubscription& rx_subscription) {
+            const auto flt = ::canardMakeFilterForSubject(rx_subscription.port_id);
+            if (std::none_of(filters.begin(), filters.end(), [&flt](const Filter& other) {
+                    return (other.id == flt.extended_can_id) && (other.mask == flt.extended_mask);
+                }))
+            {
+                filters.emplace_back(Filter{flt.extended_can_id, flt.extended_mask});
+            }
+        };
+        const auto svc_visitor = [&filters, node_id](RxSubscription& rx_subscription) {
+            const auto flt = ::canardMakeFilterForService(rx_subscription.port_id, node_id);
+            filters.emplace_back(Filter{flt.extended_can_id, flt.extended_mask});
+        };
+
+        return RxSubscriptionTree::visitCounting(subs_trees[CanardTransferKindMessage], msg_visitor) +
+               RxSubscriptionTree::visitCounting(subs_trees[CanardTransferKindRequest], svc_visitor) +
+               RxSubscriptionTree::visitCounting(subs_trees[CanardTransferKindResponse], svc_visitor);
+    }
+
+    /// @brief Checks whether there is anything to receive (and so media RX callbacks are needed).
+    ///
+    CETL_NODISCARD bool hasActiveRxPorts() const
+    {
+        return ((total_msg_rx_ports_ + total_svc_rx_ports_) > 0) || !tx_timestamping_registry_.isEmpty() ||
+               (frame_monitor_rx_session_ != nullptr) || (getLogicalNodesRxPortsCount() > 0);
+    }
+
     void cancelRxCallbacksIfNoPortsLeft()
     {
-        if (0 == (total_msg_rx_ports_ + total_svc_rx_ports_))
+        if (!hasActiveRxPorts())
         {
             for (Media& media : media_array_)
             {
@@ -787,12 +1652,22 @@ private:
 
     // MARK: Data members:
 
-    IExecutor&            executor_;
-    MediaArray            media_array_;
-    std::size_t           total_msg_rx_ports_;
-    std::size_t           total_svc_rx_ports_;
-    TransientErrorHandler transient_error_handler_;
-    Callback::Any         configure_filters_callback_;
+    IExecutor&                                               executor_;
+    MediaArray                                               media_array_;
+    const std::size_t                                        tx_capacity_;
+    const std::size_t                                        tx_in_flight_limit_;
+    std::size_t                                              total_msg_rx_ports_;
+    std::size_t                                              total_svc_rx_ports_;
+    transport::detail::MsgTxTimestampingRegistry             tx_timestamping_registry_;
+    transport::detail::MsgTxCapacityRegistry                 tx_capacity_registry_;
+    IFrameMonitorRxSessionDelegate*                          frame_monitor_rx_session_{nullptr};
+    TransientErrorHandler                                    transient_error_handler_;
+    Callback::Any                                            configure_filters_callback_;
+    Callback::Any                                            tx_capacity_callback_;
+    common::cavl::Tree<LogicalNode>                          logical_nodes_;
+    CanardInstance                                           logical_nodes_canard_instance_;
+    common::cavl::Tree<SharedMsgRxSubscription>              shared_msg_rx_subscriptions_;
+    libcyphal::detail::PmrAllocator<SharedMsgRxSubscription> shared_msg_rx_allocator_;
 
 };  // TransportImpl
 
@@ -804,16 +1679,21 @@ private:
 ///
 /// @param memory Reference to a polymorphic memory resource to use for all allocations.
 /// @param executor Interface of the executor to use.
-/// @param media Collection of redundant media interfaces to use.
+/// @param media Collection of redundant media interfaces to use. Size of the span also defines max number of media
+///              which the transport could have at once - extra `nullptr` entries reserve room for media which
+///              might be added later (see `ICanTransport::addMedia`).
 /// @param tx_capacity Total number of frames that can be queued for transmission per `IMedia` instance.
+/// @param tx_in_flight_limit Max number of frames which are allowed to be in flight per `IMedia` instance
+///                           (see `IMedia::getTxInFlightCount`). Zero means "no limit" (default).
 /// @return Unique pointer to the new CAN transport instance or an error.
 ///
 inline Expected<UniquePtr<ICanTransport>, FactoryFailure> makeTransport(cetl::pmr::memory_resource& memory,
                                                                         IExecutor&                  executor,
                                                                         const cetl::span<IMedia*>   media,
-                                                                        const std::size_t           tx_capacity)
+                                                                        const std::size_t           tx_capacity,
+                                                                        const std::size_t           tx_in_flight_limit = 0)
 {
-    return detail::TransportImpl::make(memory, executor, media, tx_capacity);
+    return detail::TransportImpl::make(memory, executor, media, tx_capacity, tx_in_flight_limit);
 }
 
 }  // namespace can
@@ -7,6 +7,10 @@
 #define LIBCYPHAL_TRANSPORT_CAN_DELEGATE_HPP_INCLUDED
 
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/transport/msg_tx_capacity.hpp"
+#include "libcyphal/transport/msg_tx_timestamping.hpp"
+#include "libcyphal/transport/rx_reassembly_budget.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
@@ -14,6 +18,7 @@
 #include <canard.h>
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -34,6 +39,8 @@ namespace can
 namespace detail
 {
 
+class IFrameMonitorRxSessionDelegate;
+
 /// This internal transport delegate class serves the following purposes:
 /// 1. It provides memory management functions for the Canard library.
 /// 2. It provides a way to convert Canard error codes to `AnyFailure` type.
@@ -198,14 +205,31 @@ public:
     {
         struct MsgRxLifetime
         {
-            bool is_added;
+            bool   is_added;
+            PortId subject_id;
         };
         struct SvcRxLifetime
         {
             bool is_added;
         };
+        struct MsgTxTimestamping
+        {
+            transport::detail::MsgTxTimestampingNode& node;
+            bool                                      is_added;
+        };
+        struct FrameMonitorRxLifetime
+        {
+            IFrameMonitorRxSessionDelegate& delegate;
+            bool                       is_added;
+        };
+        struct MsgTxCapacity
+        {
+            transport::detail::MsgTxCapacityNode& node;
+            bool                                  is_added;
+        };
 
-        using Variant = cetl::variant<MsgRxLifetime, SvcRxLifetime>;
+        using Variant =
+            cetl::variant<MsgRxLifetime, SvcRxLifetime, MsgTxTimestamping, FrameMonitorRxLifetime, MsgTxCapacity>;
 
     };  // SessionEvent
 
@@ -239,6 +263,38 @@ public:
         return memory_;
     }
 
+    /// Gets ledger of payload bytes held by RX reassembly of message RX sessions (see `RxReassemblyScope`).
+    ///
+    CETL_NODISCARD transport::detail::RxReassemblyLedger& rxReassemblyLedger() noexcept
+    {
+        return rx_reassembly_ledger_;
+    }
+    CETL_NODISCARD const transport::detail::RxReassemblyLedger& rxReassemblyLedger() const noexcept
+    {
+        return rx_reassembly_ledger_;
+    }
+
+    /// @brief Defines scope of RX reassembly accounting of a message RX session.
+    ///
+    /// Canard allocates a payload buffer of exactly `extent` bytes per each transfer which is being reassembled,
+    /// and keeps it until the transfer is either complete or restarted. So, while the scope is set (around
+    /// `canardRxAccept` of a message frame), all canard allocations (and deallocations) of such size
+    /// are accounted to the session (see `rxReassemblyLedger`). Buffers of complete transfers are handed over
+    /// to the session, so it releases them from its account by itself (see `MessageRxSession::acceptRxTransfer`).
+    ///
+    struct RxReassemblyScope
+    {
+        transport::detail::RxReassemblyAccount& account;
+        std::size_t                             extent;
+        Priority                                priority;
+        TimePoint                               timestamp;
+    };
+
+    void setRxReassemblyScope(const RxReassemblyScope* const scope) noexcept
+    {
+        rx_reassembly_scope_ = scope;
+    }
+
     CETL_NODISCARD static cetl::optional<AnyFailure> optAnyFailureFromCanard(const std::int32_t result)
     {
         // Canard error results are negative, so we need to negate them to get the error code.
@@ -320,6 +376,16 @@ protected:
 
     ~TransportDelegate() = default;
 
+    /// @brief Makes canard memory resource which allocates from the memory of this delegate.
+    ///
+    /// In use for the own canard instance, and for others which payload buffers are freed by this delegate.
+    ///
+    CETL_NODISCARD CanardMemoryResource makeCanardMemoryResource()
+    {
+        // No Sonar `cpp:S5356` b/c we integrate here with C libcanard memory management.
+        return {this, freeCanardMemory, allocateMemoryForCanard};  // NOSONAR cpp:S5356
+    }
+
 private:
     /// @brief Converts Canard instance to the transport delegate.
     ///
@@ -342,8 +408,14 @@ private:
     CETL_NODISCARD static void* allocateMemoryForCanard(void* const       user_reference,  // NOSONAR cpp:S5008
                                                         const std::size_t amount)
     {
-        const TransportDelegate& self = getSelfFrom(user_reference);
-        return self.memory_.allocate(amount);
+        TransportDelegate& self    = getSelfFrom(user_reference);
+        void* const        pointer = self.memory_.allocate(amount);
+        if ((pointer != nullptr) && self.isInRxReassemblyScope(amount))
+        {
+            const RxReassemblyScope& scope = *self.rx_reassembly_scope_;
+            self.rx_reassembly_ledger_.adopt(scope.account, amount, scope.priority, scope.timestamp);
+        }
+        return pointer;
     }
 
     /// @brief Releases memory allocated for canard instance (by previous `allocateMemoryForCanard` call).
@@ -354,20 +426,25 @@ private:
                                  const std::size_t amount,
                                  void* const       pointer)  // NOSONAR cpp:S5008
     {
-        const TransportDelegate& self = getSelfFrom(user_reference);
+        TransportDelegate& self = getSelfFrom(user_reference);
+        if ((pointer != nullptr) && self.isInRxReassemblyScope(amount))
+        {
+            self.rx_reassembly_ledger_.release(self.rx_reassembly_scope_->account, amount);
+        }
         self.freeCanardMemory(pointer, amount);
     }
 
-    CETL_NODISCARD CanardMemoryResource makeCanardMemoryResource()
+    CETL_NODISCARD bool isInRxReassemblyScope(const std::size_t amount) const noexcept
     {
-        // No Sonar `cpp:S5356` b/c we integrate here with C libcanard memory management.
-        return {this, freeCanardMemory, allocateMemoryForCanard};  // NOSONAR cpp:S5356
+        return (rx_reassembly_scope_ != nullptr) && (rx_reassembly_scope_->extent == amount);
     }
 
     // MARK: Data members:
 
-    cetl::pmr::memory_resource& memory_;
-    CanardInstance              canard_instance_;
+    cetl::pmr::memory_resource&           memory_;
+    CanardInstance                        canard_instance_;
+    transport::detail::RxReassemblyLedger rx_reassembly_ledger_;
+    const RxReassemblyScope*              rx_reassembly_scope_{nullptr};
 
 };  // TransportDelegate
 
@@ -394,6 +471,50 @@ protected:
 
 };  // IRxSessionDelegate
 
+/// This internal session delegate class serves the following purpose: it provides an interface (aka gateway)
+/// to access message RX session from transport (by casting canard's `user_reference` member to this class).
+///
+class IMsgRxSessionDelegate : public IRxSessionDelegate
+{
+public:
+    IMsgRxSessionDelegate(const IMsgRxSessionDelegate&)                = delete;
+    IMsgRxSessionDelegate(IMsgRxSessionDelegate&&) noexcept            = delete;
+    IMsgRxSessionDelegate& operator=(const IMsgRxSessionDelegate&)     = delete;
+    IMsgRxSessionDelegate& operator=(IMsgRxSessionDelegate&&) noexcept = delete;
+
+    /// @brief Gets account of payload bytes held by the session subscription.
+    ///
+    /// See `TransportDelegate::rxReassemblyLedger` and `TransportDelegate::RxReassemblyScope`.
+    ///
+    CETL_NODISCARD virtual transport::detail::RxReassemblyAccount& getRxReassemblyAccount() noexcept = 0;
+
+protected:
+    IMsgRxSessionDelegate()  = default;
+    ~IMsgRxSessionDelegate() = default;
+
+};  // IMsgRxSessionDelegate
+
+/// This internal session delegate class serves the following purpose: it provides an interface (aka gateway)
+/// to access frame monitor RX session from transport (which parses all received frames for the session).
+///
+class IFrameMonitorRxSessionDelegate
+{
+public:
+    IFrameMonitorRxSessionDelegate(const IFrameMonitorRxSessionDelegate&)                = delete;
+    IFrameMonitorRxSessionDelegate(IFrameMonitorRxSessionDelegate&&) noexcept            = delete;
+    IFrameMonitorRxSessionDelegate& operator=(const IFrameMonitorRxSessionDelegate&)     = delete;
+    IFrameMonitorRxSessionDelegate& operator=(IFrameMonitorRxSessionDelegate&&) noexcept = delete;
+
+    /// @brief Accepts a received frame from the transport (any frame, including not monitored ones).
+    ///
+    virtual void acceptRxFrame(const FrameMonitorRxMetadata& metadata, const cetl::span<const cetl::byte> payload) = 0;
+
+protected:
+    IFrameMonitorRxSessionDelegate()  = default;
+    ~IFrameMonitorRxSessionDelegate() = default;
+
+};  // IFrameMonitorRxSessionDelegate
+
 }  // namespace detail
 }  // namespace can
 }  // namespace transport
@@ -0,0 +1,322 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_FAULT_INJECTION_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_FAULT_INJECTION_MEDIA_HPP_INCLUDED
+
+#include "frame_codec.hpp"
+#include "media.hpp"
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/fault_injection.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <canard.h>
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// @brief Defines a CAN media decorator which injects faults into the traffic of the decorated media.
+///
+/// Intended for testing of applications (and of the library itself) against lossy and misbehaving buses:
+/// frame loss, duplication, corruption, delay and reordering of received frames, as well as loss, duplication
+/// and TX back-pressure (the media pretends to be busy) of sent frames. Faults are rolled deterministically
+/// from a seeded pseudo-random sequence, with probabilities per port and per priority (see `FaultInjectionParams`),
+/// so the same seed and the same traffic reproduce the same faults.
+///
+/// The decorator could be used with any executor (including `VirtualTimeScheduler` of unit tests) - delayed frames
+/// and the end of TX busy periods are signaled to the transport by the executor timer callbacks. TX loopback frames
+/// are never faulted (b/c they are just local TX-complete confirmations).
+///
+/// The decorator should outlive the transport which uses it (as any other media).
+///
+class FaultInjectionMedia final : public IMedia
+{
+public:
+    /// @brief Constructs a new fault injecting decorator of the given media.
+    ///
+    /// @param media The decorated media. Must outlive the decorator.
+    /// @param executor The executor in use by the transport. Used for current time, and for delayed notifications.
+    /// @param memory The memory resource for the held (delayed, reordered and duplicated) frames.
+    ///               In case of out of memory, frames are never held (but all other faults are still injected).
+    /// @param params The fault injection parameters.
+    ///
+    FaultInjectionMedia(IMedia&                     media,
+                        IExecutor&                  executor,
+                        cetl::pmr::memory_resource& memory,
+                        FaultInjectionParams        params)
+        : media_{media}
+        , executor_{executor}
+        , injector_{std::move(params)}
+        , held_frames_{memory, injector_.params().max_held_frames}
+        , push_notifier_{executor}
+        , pop_notifier_{executor}
+    {
+    }
+
+    FaultInjectionMedia(const FaultInjectionMedia&)                = delete;
+    FaultInjectionMedia(FaultInjectionMedia&&) noexcept            = delete;
+    FaultInjectionMedia& operator=(const FaultInjectionMedia&)     = delete;
+    FaultInjectionMedia& operator=(FaultInjectionMedia&&) noexcept = delete;
+
+    ~FaultInjectionMedia() = default;
+
+    /// @brief Gets counters of the faults injected so far.
+    ///
+    CETL_NODISCARD const FaultInjectionStats& getStats() const noexcept
+    {
+        return injector_.stats();
+    }
+
+    // MARK: IMedia
+
+    CETL_NODISCARD std::size_t getMtu() const noexcept override
+    {
+        return media_.getMtu();
+    }
+
+    CETL_NODISCARD cetl::optional<MediaFailure> setFilters(const Filters filters) noexcept override
+    {
+        return media_.setFilters(filters);
+    }
+
+    CETL_NODISCARD PushResult::Type push(const TimePoint deadline,
+                                         const CanId     can_id,
+                                         MediaPayload&   payload) noexcept override
+    {
+        auto& stats = injector_.stats();
+
+        const auto rates = injector_.ratesOf(makeFrameInfo(true /* is_tx */, can_id));
+        switch (injector_.rollTxFault(rates))
+        {
+        case FaultInjector::TxFault::Busy:
+        {
+            ++stats.tx_busy;
+            push_notifier_.wakeAt(executor_.now() + injector_.params().tx_busy_duration);
+            return PushResult::Success{false /* is_accepted */};
+        }
+        case FaultInjector::TxFault::Drop:
+        {
+            ++stats.dropped;
+            payload.reset();
+            return PushResult::Success{true /* is_accepted */};
+        }
+        case FaultInjector::TxFault::Duplicate:
+        {
+            pushDuplicate(deadline, can_id, payload.getSpan());
+            break;
+        }
+        case FaultInjector::TxFault::None:
+        {
+            break;
+        }
+        }
+
+        return media_.push(deadline, can_id, payload);
+    }
+
+    CETL_NODISCARD cetl::optional<std::size_t> getTxInFlightCount() const noexcept override
+    {
+        return media_.getTxInFlightCount();
+    }
+
+    CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
+    {
+        const TimePoint now = executor_.now();
+
+        // Held frames (which are due already) go first.
+        if (auto held_frame = held_frames_.popDue(now))
+        {
+            scheduleNextRelease();
+
+            auto metadata         = held_frame->metadata;
+            metadata.timestamp    = now;
+            metadata.payload_size = std::min(metadata.payload_size, payload_buffer.size());
+            (void) std::memcpy(payload_buffer.data(), held_frame->payload.data(), metadata.payload_size);
+            return PopResult::Success{metadata};
+        }
+
+        auto        result  = media_.pop(payload_buffer);
+        auto* const success = cetl::get_if<PopResult::Success>(&result);
+        if ((success == nullptr) || !success->has_value() || (*success)->is_tx_loopback)
+        {
+            return result;
+        }
+        const auto& metadata = **success;
+        const auto  frame    = payload_buffer.first(std::min(metadata.payload_size, payload_buffer.size()));
+
+        auto&      stats = injector_.stats();
+        const auto rates = injector_.ratesOf(makeFrameInfo(false /* is_tx */, metadata.can_id));
+        const auto fault = injector_.rollRxFault(rates);
+        if (fault == FaultInjector::RxFault::Drop)
+        {
+            ++stats.dropped;
+            return PopResult::Success{};
+        }
+        (void) injector_.rollCorruption(rates, frame);
+
+        switch (fault)
+        {
+        case FaultInjector::RxFault::Duplicate:
+        {
+            HeldFrame copy{metadata, frame};
+            if (held_frames_.hold(copy, now, false /* until_next */))
+            {
+                ++stats.duplicated;
+            }
+            break;
+        }
+        case FaultInjector::RxFault::Delay:
+        {
+            HeldFrame delayed{metadata, frame};
+            if (held_frames_.hold(delayed, now + injector_.randomDelay(), false /* until_next */))
+            {
+                ++stats.delayed;
+                scheduleNextRelease();
+                return PopResult::Success{};
+            }
+            break;
+        }
+        case FaultInjector::RxFault::Reorder:
+        {
+            HeldFrame reordered{metadata, frame};
+            if (held_frames_.hold(reordered, now + injector_.params().max_delay, true /* until_next */))
+            {
+                ++stats.reordered;
+                scheduleNextRelease();
+                return PopResult::Success{};
+            }
+            break;
+        }
+        case FaultInjector::RxFault::Drop:
+        case FaultInjector::RxFault::None:
+        {
+            break;
+        }
+        }
+
+        // This frame is delivered, so reordered frames (if any) could go right after it.
+        held_frames_.releaseUntilNext(now);
+        scheduleNextRelease();
+        return result;
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPushCallback(IExecutor::Callback::Function&& function) override
+    {
+        return push_notifier_.registerCallback(std::move(function), [this](IExecutor::Callback::Function&& fn) {
+            //
+            return media_.registerPushCallback(std::move(fn));
+        });
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPopCallback(IExecutor::Callback::Function&& function) override
+    {
+        return pop_notifier_.registerCallback(std::move(function), [this](IExecutor::Callback::Function&& fn) {
+            //
+            return media_.registerPopCallback(std::move(fn));
+        });
+    }
+
+    CETL_NODISCARD cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return media_.getTxMemoryResource();
+    }
+
+private:
+    using FaultInjector = transport::detail::FaultInjector;
+
+    /// @brief Defines a received frame which is held by the decorator.
+    ///
+    struct HeldFrame final
+    {
+        HeldFrame(const PopResult::Metadata& metadata_, const cetl::span<const cetl::byte> frame)
+            : metadata{metadata_}
+        {
+            metadata.payload_size = std::min(frame.size(), payload.size());
+            (void) std::copy_n(frame.data(), metadata.payload_size, payload.begin());
+        }
+
+        PopResult::Metadata                    metadata;
+        std::array<cetl::byte, CANARD_MTU_MAX> payload{};
+    };
+
+    /// Parses frame transport metadata from its CAN ID (see Cyphal/CAN Specification).
+    ///
+    CETL_NODISCARD static FaultFrameInfo makeFrameInfo(const bool is_tx, const CanId can_id) noexcept
+    {
+        const auto fields = detail::FrameCodec::parseCanId(can_id);
+        return FaultFrameInfo{is_tx, fields.is_service, fields.port_id, fields.priority};
+    }
+
+    /// Pushes a copy of the frame to the decorated media.
+    ///
+    void pushDuplicate(const TimePoint deadline, const CanId can_id, const cetl::span<const cetl::byte> frame)
+    {
+        if (frame.empty())
+        {
+            return;
+        }
+
+        cetl::pmr::memory_resource& tx_memory = media_.getTxMemoryResource();
+
+        // No Sonar `cpp:S5356` b/c we integrate here with low level PMR management.
+        auto* const buffer = static_cast<cetl::byte*>(tx_memory.allocate(frame.size()));  // NOSONAR cpp:S5356
+        if (buffer == nullptr)
+        {
+            return;
+        }
+        (void) std::memcpy(buffer, frame.data(), frame.size());
+
+        // The copy is freed by its destructor in case the media hasn't taken it.
+        MediaPayload copy{frame.size(), buffer, frame.size(), &tx_memory};
+        const auto   result = media_.push(deadline, can_id, copy);
+        if (const auto* const success = cetl::get_if<PushResult::Success>(&result))
+        {
+            if (success->is_accepted)
+            {
+                ++injector_.stats().duplicated;
+            }
+        }
+    }
+
+    void scheduleNextRelease()
+    {
+        if (const auto release_time = held_frames_.nextReleaseTime())
+        {
+            pop_notifier_.wakeAt(*release_time);
+        }
+    }
+
+    // MARK: Data members:
+
+    IMedia&                                       media_;
+    IExecutor&                                    executor_;
+    FaultInjector                                 injector_;
+    transport::detail::FaultHeldFrames<HeldFrame> held_frames_;
+    transport::detail::FaultInjectionNotifier     push_notifier_;
+    transport::detail::FaultInjectionNotifier     pop_notifier_;
+
+};  // FaultInjectionMedia
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_FAULT_INJECTION_MEDIA_HPP_INCLUDED
@@ -0,0 +1,180 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_FRAME_CODEC_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_FRAME_CODEC_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/transport/types.hpp"
+
+#include <canard.h>
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// Internal implementation details of the CAN transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Implements parsing of Cyphal/CAN frames (see Cyphal/CAN Specification).
+///
+/// In use where the transport inspects frames by itself (instead of the Canard library),
+/// namely for fault injection, TX loopback timestamping, the frame monitor and dispatching to logical nodes.
+///
+struct FrameCodec final
+{
+    /// Running CRC of a multi-frame transfer (see `addTransferCrc`).
+    using TransferCrc = std::uint16_t;
+
+    /// Size of the transfer CRC (which follows the padded payload of a multi-frame transfer).
+    static constexpr std::size_t TransferCrcSize = 2U;
+
+    static constexpr TransferCrc TransferCrcInitial = 0xFFFFU;
+
+    /// Transport metadata of a frame which is encoded in its CAN ID.
+    ///
+    struct CanIdFields
+    {
+        /// Priority of the transfer.
+        Priority priority;
+
+        /// Whether the frame belongs to a service transfer (rather than to a message one).
+        bool is_service;
+
+        /// Whether the service frame belongs to a request (rather than to a response). Not in use for messages.
+        bool is_request;
+
+        /// Whether the message frame is anonymous (and so its source node ID is a pseudo-ID). Not in use for services.
+        bool is_anonymous;
+
+        /// Subject ID (for messages) or service ID (for requests and responses).
+        PortId port_id;
+
+        /// Node ID of the source.
+        NodeId source_node_id;
+
+        /// Node ID of the destination. Not in use for messages.
+        NodeId destination_node_id;
+    };
+
+    /// Transfer metadata of a frame which is encoded in its tail byte (the last byte of the frame payload).
+    ///
+    struct TailByte
+    {
+        /// Transfer ID modulo 32.
+        TransferId transfer_id;
+
+        /// Whether the frame is the first one of its transfer.
+        bool is_start_of_transfer;
+
+        /// Whether the frame is the last one of its transfer.
+        bool is_end_of_transfer;
+    };
+
+    /// Parses transport metadata out of the given CAN ID.
+    ///
+    CETL_NODISCARD static CanIdFields parseCanId(const CanId can_id) noexcept
+    {
+        CanIdFields fields{};
+        fields.priority       = static_cast<Priority>((can_id >> PriorityOffset) & PriorityMask);
+        fields.is_service     = (can_id & ServiceNotMessageBit) != 0;
+        fields.source_node_id = static_cast<NodeId>(can_id & CANARD_NODE_ID_MAX);
+        if (fields.is_service)
+        {
+            fields.is_request          = (can_id & RequestNotResponseBit) != 0;
+            fields.port_id             = static_cast<PortId>((can_id >> ServiceIdOffset) & CANARD_SERVICE_ID_MAX);
+            fields.destination_node_id = static_cast<NodeId>((can_id >> DestinationOffset) & CANARD_NODE_ID_MAX);
+        }
+        else
+        {
+            fields.is_anonymous = (can_id & AnonymousMessageBit) != 0;
+            fields.port_id      = static_cast<PortId>((can_id >> SubjectIdOffset) & CANARD_SUBJECT_ID_MAX);
+        }
+        return fields;
+    }
+
+    /// Parses the tail byte of the given frame payload.
+    ///
+    /// @return `nullopt` if the payload is empty (and so it's not a valid Cyphal/CAN frame).
+    ///
+    CETL_NODISCARD static cetl::optional<TailByte> parseTailByte(const cetl::span<const cetl::byte> payload) noexcept
+    {
+        if (payload.empty())
+        {
+            return cetl::nullopt;
+        }
+        const auto tail_byte = static_cast<std::uint8_t>(payload.back());
+        return TailByte{static_cast<TransferId>(tail_byte & CANARD_TRANSFER_ID_MAX),
+                        (tail_byte & StartOfTransferBit) != 0,
+                        (tail_byte & EndOfTransferBit) != 0};
+    }
+
+    /// Whether a single-frame transfer has the transfer CRC as well - it doesn't on CAN.
+    ///
+    CETL_NODISCARD static constexpr bool hasSingleFrameTransferCrc() noexcept
+    {
+        return false;
+    }
+
+    /// Adds data to the running CRC-16/CCITT-FALSE of a multi-frame transfer.
+    ///
+    CETL_NODISCARD static TransferCrc addTransferCrc(TransferCrc       crc,
+                                                     const cetl::byte* data,
+                                                     const std::size_t size) noexcept
+    {
+        constexpr TransferCrc Poly = 0x1021U;
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            crc ^= static_cast<TransferCrc>(static_cast<std::uint8_t>(data[i]) << 8U);  // NOLINT(*-pointer-arithmetic)
+            for (std::uint8_t bit = 0; bit < 8U; ++bit)
+            {
+                crc = ((crc & 0x8000U) != 0U) ? static_cast<TransferCrc>((crc << 1U) ^ Poly)
+                                              : static_cast<TransferCrc>(crc << 1U);
+            }
+        }
+        return crc;
+    }
+
+    /// Checks the running CRC of a whole transfer, including the transfer CRC itself (which yields zero residue).
+    ///
+    CETL_NODISCARD static constexpr bool isTransferCrcResidue(const TransferCrc crc) noexcept
+    {
+        return crc == 0U;
+    }
+
+private:
+    static constexpr CanId        PriorityMask          = 0x7U;
+    static constexpr CanId        ServiceNotMessageBit  = 1UL << 25U;
+    static constexpr CanId        RequestNotResponseBit = 1UL << 24U;
+    static constexpr CanId        AnonymousMessageBit   = 1UL << 24U;
+    static constexpr std::uint8_t PriorityOffset        = 26U;
+    static constexpr std::uint8_t SubjectIdOffset       = 8U;
+    static constexpr std::uint8_t ServiceIdOffset       = 14U;
+    static constexpr std::uint8_t DestinationOffset     = 7U;
+    static constexpr std::uint8_t StartOfTransferBit    = 1U << 7U;
+    static constexpr std::uint8_t EndOfTransferBit      = 1U << 6U;
+
+};  // FrameCodec
+
+}  // namespace detail
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_FRAME_CODEC_HPP_INCLUDED
@@ -0,0 +1,139 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_FRAME_MONITOR_RX_SESSION_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_FRAME_MONITOR_RX_SESSION_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame_codec.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/types.hpp"
+
+#include <canard.h>
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// Internal implementation details of the CAN transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A class to represent a frame monitor (aka promiscuous) RX session.
+///
+/// While the session exists, the transport configures media with a single accept-all filter,
+/// and passes each received frame (parsed according to the Cyphal/CAN Specification) to the session.
+///
+class FrameMonitorRxSession final : private IFrameMonitorRxSessionDelegate, public IFrameMonitorRxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IFrameMonitorRxSession, FrameMonitorRxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IFrameMonitorRxSession>, AnyFailure> make(
+        TransportDelegate&          delegate,
+        const FrameMonitorRxParams& params)
+    {
+        if ((params.subject_id_first > params.subject_id_last) || (params.subject_id_last > CANARD_SUBJECT_ID_MAX))
+        {
+            return ArgumentError{};
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    FrameMonitorRxSession(const Spec, TransportDelegate& delegate, const FrameMonitorRxParams& params)
+        : delegate_{delegate}
+        , params_{params}
+        , reassembler_{delegate.memory(), params.reassembly_extent_bytes}
+    {
+        delegate_.onSessionEvent(TransportDelegate::SessionEvent::FrameMonitorRxLifetime{*this, true /* is_added */});
+    }
+
+    FrameMonitorRxSession(const FrameMonitorRxSession&)                = delete;
+    FrameMonitorRxSession(FrameMonitorRxSession&&) noexcept            = delete;
+    FrameMonitorRxSession& operator=(const FrameMonitorRxSession&)     = delete;
+    FrameMonitorRxSession& operator=(FrameMonitorRxSession&&) noexcept = delete;
+
+    ~FrameMonitorRxSession()
+    {
+        delegate_.onSessionEvent(TransportDelegate::SessionEvent::FrameMonitorRxLifetime{*this, false /* is_added */});
+    }
+
+private:
+    // MARK: IFrameMonitorRxSession
+
+    CETL_NODISCARD FrameMonitorRxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    void setOnFrameCallback(OnFrameCallback::Function&& function) override
+    {
+        on_frame_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IFrameMonitorRxSessionDelegate
+
+    void acceptRxFrame(const FrameMonitorRxMetadata& metadata, const cetl::span<const cetl::byte> payload) override
+    {
+        if (!on_frame_cb_fn_ || !transport::detail::isMonitoredBy(params_, metadata))
+        {
+            return;
+        }
+
+        if (params_.reassembly_extent_bytes == 0U)
+        {
+            on_frame_cb_fn_(OnFrameCallback::Arg{metadata, payload});
+            return;
+        }
+        reassembler_.accept(metadata,
+                            payload,
+                            [this](const FrameMonitorRxMetadata&      transfer_metadata,
+                                   const cetl::span<const cetl::byte> transfer_payload) {
+                                on_frame_cb_fn_(OnFrameCallback::Arg{transfer_metadata, transfer_payload});
+                            });
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                                      delegate_;
+    const FrameMonitorRxParams                              params_;
+    OnFrameCallback::Function                               on_frame_cb_fn_;
+    transport::detail::FrameMonitorReassembler<FrameCodec> reassembler_;
+
+};  // FrameMonitorRxSession
+
+}  // namespace detail
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_FRAME_MONITOR_RX_SESSION_HPP_INCLUDED
@@ -0,0 +1,305 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_LOGICAL_NODE_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_LOGICAL_NODE_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "msg_rx_session.hpp"
+#include "msg_tx_session.hpp"
+#include "svc_rx_sessions.hpp"
+#include "svc_tx_sessions.hpp"
+
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <canard.h>
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// Internal implementation details of the CAN transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+class LogicalNode;
+
+/// This internal delegate class serves the following purpose: it provides an interface (aka gateway)
+/// to access the host transport (the one which owns media) from its logical nodes.
+///
+class ILogicalNodeHostDelegate
+{
+public:
+    ILogicalNodeHostDelegate(const ILogicalNodeHostDelegate&)                = delete;
+    ILogicalNodeHostDelegate(ILogicalNodeHostDelegate&&) noexcept            = delete;
+    ILogicalNodeHostDelegate& operator=(const ILogicalNodeHostDelegate&)     = delete;
+    ILogicalNodeHostDelegate& operator=(ILogicalNodeHostDelegate&&) noexcept = delete;
+
+    /// @brief Gets protocol parameters of the host transport (they are the same for all its logical nodes).
+    ///
+    CETL_NODISCARD virtual ProtocolParams getHostProtocolParams() const noexcept = 0;
+
+    /// @brief Sends transfer of a logical node to each media canard TX queue of the host transport.
+    ///
+    /// @param node_canard_instance The canard instance of the logical node - its node ID is the source one.
+    ///
+    CETL_NODISCARD virtual cetl::optional<AnyFailure> sendLogicalNodeTransfer(
+        CanardInstance&               node_canard_instance,
+        const TimePoint               deadline,
+        const CanardTransferMetadata& metadata,
+        const PayloadFragments        payload_fragments) = 0;
+
+    /// @brief Called when a logical node is made or destroyed.
+    ///
+    virtual void onLogicalNodeLifetime(LogicalNode& node, const bool is_added) = 0;
+
+    /// @brief Called on a session event of a logical node (after the node has handled it).
+    ///
+    virtual void onLogicalNodeSessionEvent(const TransportDelegate::SessionEvent::Variant& event_var) = 0;
+
+protected:
+    ILogicalNodeHostDelegate()  = default;
+    ~ILogicalNodeHostDelegate() = default;
+
+};  // ILogicalNodeHostDelegate
+
+// MARK: -
+
+/// @brief A class to represent a logical node of a CAN transport.
+///
+/// The logical node is a lightweight transport which has its own local node ID, but shares media (TX queues,
+/// RX callbacks and filters) of its host transport. Received frames are popped (and parsed) by the host only once:
+/// service frames are demultiplexed to the logical node by their destination node ID, and message frames are
+/// passed to the node only if it has a subscription for the subject. Transfers of the node are sent with
+/// its node ID as the source one.
+///
+/// The node has its own canard instance (for its node ID and subscriptions), but it shares memory resource
+/// of the host - so that TX queue items pushed on behalf of the node could be freed by the host canard instance.
+///
+class LogicalNode final : private TransportDelegate, public ITransport, public common::cavl::Node<LogicalNode>
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<ITransport, LogicalNode>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<ITransport>, AnyFailure> make(cetl::pmr::memory_resource& memory,
+                                                                           ILogicalNodeHostDelegate&   host,
+                                                                           const NodeId                node_id)
+    {
+        if (node_id > CANARD_NODE_ID_MAX)
+        {
+            return ArgumentError{};
+        }
+
+        auto node = libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, memory, host, node_id);
+        if (node == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return node;
+    }
+
+    LogicalNode(const Spec, cetl::pmr::memory_resource& memory, ILogicalNodeHostDelegate& host, const NodeId node_id)
+        : TransportDelegate{memory}
+        , host_{host}
+        , total_rx_ports_{0}
+    {
+        setNodeId(node_id);
+
+        host_.onLogicalNodeLifetime(*this, true /* is_added */);
+    }
+
+    LogicalNode(const LogicalNode&)                = delete;
+    LogicalNode(LogicalNode&&) noexcept            = delete;
+    LogicalNode& operator=(const LogicalNode&)     = delete;
+    LogicalNode& operator=(LogicalNode&&) noexcept = delete;
+
+    ~LogicalNode()
+    {
+        CETL_DEBUG_ASSERT(total_rx_ports_ == 0,  //
+                          "RX sessions must be destroyed before logical node.");
+
+        host_.onLogicalNodeLifetime(*this, false /* is_added */);
+    }
+
+    using TransportDelegate::canardInstance;
+    using TransportDelegate::getNodeId;
+
+    CETL_NODISCARD std::int32_t compareByNodeId(const NodeId node_id) const noexcept
+    {
+        return static_cast<std::int32_t>(node_id) - static_cast<std::int32_t>(getNodeId());
+    }
+
+    /// @brief Gets total number of active message and service RX ports of the node.
+    ///
+    CETL_NODISCARD std::size_t getRxPortsCount() const noexcept
+    {
+        return total_rx_ports_;
+    }
+
+private:
+    // MARK: ITransport
+
+    CETL_NODISCARD cetl::optional<NodeId> getLocalNodeId() const noexcept override
+    {
+        return cetl::make_optional(getNodeId());
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> setLocalNodeId(const NodeId new_node_id) noexcept override
+    {
+        // Node ID of a logical node is fixed at its creation - only the same node ID is allowed.
+        if (getNodeId() != new_node_id)
+        {
+            return ArgumentError{};
+        }
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD ProtocolParams getProtocolParams() const noexcept override
+    {
+        return host_.getHostProtocolParams();
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeMessageRxSession(
+        const MessageRxParams& params) override
+    {
+        return makeRxSession<IMessageRxSession, MessageRxSession>(CanardTransferKindMessage, params.subject_id, params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageTxSession>, AnyFailure> makeMessageTxSession(
+        const MessageTxParams& params) override
+    {
+        return MessageTxSession::make(*this, params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestRxSession>, AnyFailure> makeRequestRxSession(
+        const RequestRxParams& params) override
+    {
+        return makeRxSession<IRequestRxSession, SvcRequestRxSession>(CanardTransferKindRequest,
+                                                                     params.service_id,
+                                                                     params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestTxSession>, AnyFailure> makeRequestTxSession(
+        const RequestTxParams& params) override
+    {
+        return SvcRequestTxSession::make(*this, params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseRxSession>, AnyFailure> makeResponseRxSession(
+        const ResponseRxParams& params) override
+    {
+        return makeRxSession<IResponseRxSession, SvcResponseRxSession>(CanardTransferKindResponse,
+                                                                       params.service_id,
+                                                                       params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseTxSession>, AnyFailure> makeResponseTxSession(
+        const ResponseTxParams& params) override
+    {
+        return SvcResponseTxSession::make(*this, params);
+    }
+
+    // MARK: TransportDelegate
+
+    CETL_NODISCARD cetl::optional<AnyFailure> sendTransfer(const TimePoint               deadline,
+                                                           const CanardTransferMetadata& metadata,
+                                                           const PayloadFragments        payload_fragments) override
+    {
+        return host_.sendLogicalNodeTransfer(canardInstance(), deadline, metadata, payload_fragments);
+    }
+
+    void onSessionEvent(const SessionEvent::Variant& event_var) override
+    {
+        // RX ports are counted by the node itself (b/c subscriptions are in its own canard instance),
+        // whereas everything else (like TX timestamping) is served by the host.
+        //
+        if (const auto* const msg_rx = cetl::get_if<SessionEvent::MsgRxLifetime>(&event_var))
+        {
+            countRxPort(msg_rx->is_added);
+        }
+        else if (const auto* const svc_rx = cetl::get_if<SessionEvent::SvcRxLifetime>(&event_var))
+        {
+            countRxPort(svc_rx->is_added);
+        }
+        else
+        {
+            // Nothing to count.
+        }
+
+        host_.onLogicalNodeSessionEvent(event_var);
+    }
+
+    // MARK: Privates:
+
+    template <typename Interface, typename Factory, typename RxParams>
+    CETL_NODISCARD auto makeRxSession(const CanardTransferKind transfer_kind,
+                                      const PortId             port_id,
+                                      const RxParams&          rx_params) -> Expected<UniquePtr<Interface>, AnyFailure>
+    {
+        const std::int8_t has_port = ::canardRxGetSubscription(&canardInstance(), transfer_kind, port_id, nullptr);
+        CETL_DEBUG_ASSERT(has_port >= 0, "There is no way currently to get an error here.");
+        if (has_port > 0)
+        {
+            return AlreadyExistsError{};
+        }
+
+        return Factory::make(*this, rx_params);
+    }
+
+    void countRxPort(const bool is_added)
+    {
+        if (is_added)
+        {
+            ++total_rx_ports_;
+        }
+        else
+        {
+            // We are not going to allow negative number of ports.
+            CETL_DEBUG_ASSERT(total_rx_ports_ > 0, "");
+            total_rx_ports_ -= std::min(static_cast<std::size_t>(1), total_rx_ports_);
+        }
+    }
+
+    // MARK: Data members:
+
+    ILogicalNodeHostDelegate& host_;
+    std::size_t               total_rx_ports_;
+
+};  // LogicalNode
+
+}  // namespace detail
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_LOGICAL_NODE_HPP_INCLUDED
@@ -94,8 +94,30 @@ public:
     virtual PushResult::Type push(const TimePoint deadline, const CanId can_id, MediaPayload& payload) noexcept = 0;
     ///@}
 
+    /// @brief Gets number of frames which were accepted by `push`, but have not left the media yet (aka "in flight").
+    ///
+    /// F.e. Linux socketcan implementation may derive it from the socket TX queue depth (`SIOCOUTQ`),
+    /// or count TX-complete (loopback) confirmations. The transport uses this number to keep only a small
+    /// (configurable) number of frames outstanding in the media, and holds the rest in its own priority ordered
+    /// TX queue. Otherwise, a new high priority frame would have to wait behind already accepted low priority frames
+    /// (which are queued in the OS or in the driver FIFO), defeating CAN arbitration.
+    ///
+    /// @return Number of frames in flight; `nullopt` if the media can't tell it (default) -
+    ///         in such case the transport doesn't limit number of frames in flight.
+    ///
+    virtual cetl::optional<std::size_t> getTxInFlightCount() const noexcept
+    {
+        return cetl::nullopt;
+    }
+
     /// @brief Takes the next payload fragment (aka CAN frame) from the reception queue unless it's empty.
     ///
+    /// A media may also pop its own (earlier pushed) frames as TX-complete confirmations (aka loopback frames),
+    /// f.e. Linux socketcan reports them with `MSG_CONFIRM` flag. Such frames should be marked by `is_tx_loopback`,
+    /// and their `timestamp` should be the time when the frame has actually left the media. The transport
+    /// never treats loopback frames as received ones - it uses them only to report TX timestamps of messages
+    /// (see `IMessageTxSession::setOnTxTimestampCallback`).
+    ///
     /// @param payload_buffer The payload of the frame will be written into the mutable `payload_buffer` (aka span).
     /// @return Description of a received fragment if available; otherwise an empty optional is returned immediately.
     ///         `nodiscard` is used to prevent ignoring the return value, which contains not only possible media error,
@@ -108,6 +130,7 @@ public:
             TimePoint   timestamp;
             CanId       can_id{};
             std::size_t payload_size{};
+            bool        is_tx_loopback{false};
         };
         using Success = cetl::optional<Metadata>;
         using Failure = MediaFailure;
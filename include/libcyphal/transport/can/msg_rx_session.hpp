@@ -11,6 +11,7 @@
 #include "libcyphal/errors.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/rx_reassembly_budget.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
@@ -38,7 +39,9 @@ namespace detail
 
 /// @brief A class to represent a message subscriber RX session.
 ///
-class MessageRxSession final : private IRxSessionDelegate, public IMessageRxSession
+class MessageRxSession final : private IMsgRxSessionDelegate,
+                               private transport::detail::RxReassemblyAccount,
+                               public IMessageRxSession
 {
     /// @brief Defines private specification for making interface unique ptr.
     ///
@@ -72,11 +75,34 @@ public:
         , params_{params}
         , subscription_{}
     {
-        const std::int8_t result = ::canardRxSubscribe(&delegate.canardInstance(),
+        subscribe(CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+
+        using MsgRxLifetime = TransportDelegate::SessionEvent::MsgRxLifetime;
+        delegate_.onSessionEvent(MsgRxLifetime{true /* is_added */, params_.subject_id});
+    }
+
+    MessageRxSession(const MessageRxSession&)                = delete;
+    MessageRxSession(MessageRxSession&&) noexcept            = delete;
+    MessageRxSession& operator=(const MessageRxSession&)     = delete;
+    MessageRxSession& operator=(MessageRxSession&&) noexcept = delete;
+
+    ~MessageRxSession()
+    {
+        unsubscribe();
+        delegate_.rxReassemblyLedger().releaseAll(*this);
+
+        using MsgRxLifetime = TransportDelegate::SessionEvent::MsgRxLifetime;
+        delegate_.onSessionEvent(MsgRxLifetime{false /* is_added */, params_.subject_id});
+    }
+
+private:
+    void subscribe(const CanardMicrosecond transfer_id_timeout_usec)
+    {
+        const std::int8_t result = ::canardRxSubscribe(&delegate_.canardInstance(),
                                                        CanardTransferKindMessage,
                                                        params_.subject_id,
                                                        params_.extent_bytes,
-                                                       CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
+                                                       transfer_id_timeout_usec,
                                                        &subscription_);
         (void) result;
         CETL_DEBUG_ASSERT(result >= 0, "There is no way currently to get an error here.");
@@ -84,27 +110,17 @@ public:
 
         // No Sonar `cpp:S5356` b/c we integrate here with C libcanard API.
         subscription_.user_reference = static_cast<IRxSessionDelegate*>(this);  // NOSONAR cpp:S5356
-
-        delegate_.onSessionEvent(TransportDelegate::SessionEvent::MsgRxLifetime{true /* is_added */});
     }
 
-    MessageRxSession(const MessageRxSession&)                = delete;
-    MessageRxSession(MessageRxSession&&) noexcept            = delete;
-    MessageRxSession& operator=(const MessageRxSession&)     = delete;
-    MessageRxSession& operator=(MessageRxSession&&) noexcept = delete;
-
-    ~MessageRxSession()
+    void unsubscribe()
     {
         const std::int8_t result =
             ::canardRxUnsubscribe(&delegate_.canardInstance(), CanardTransferKindMessage, params_.subject_id);
         (void) result;
         CETL_DEBUG_ASSERT(result >= 0, "There is no way currently to get an error here.");
         CETL_DEBUG_ASSERT(result > 0, "Subscription supposed to be made at constructor.");
-
-        delegate_.onSessionEvent(TransportDelegate::SessionEvent::MsgRxLifetime{false /* is_added */});
     }
 
-private:
     // MARK: IMessageRxSession
 
     CETL_NODISCARD MessageRxParams getParams() const noexcept override
@@ -159,6 +175,24 @@ private:
                                                       buffer,
                                                       transfer.payload.size};
 
+        // The payload buffer is not held by the subscription anymore (see `TransportDelegate::RxReassemblyScope`).
+        auto& ledger = delegate_.rxReassemblyLedger();
+        if (transfer.payload.allocated_size == params_.extent_bytes)
+        {
+            ledger.release(*this, transfer.payload.allocated_size);
+        }
+
+        // Transfer-ID state of the lizard is lost on eviction, so deduplication is done here for a while.
+        if (ledger.isEnabled())
+        {
+            const Duration tid_timeout{std::chrono::microseconds{subscription_.transfer_id_timeout_usec}};
+            if (isDuplicateAfterEviction(publisher_node_id, transfer_id, timestamp, tid_timeout))
+            {
+                return;
+            }
+            onTransferDelivered(publisher_node_id, transfer_id, timestamp);
+        }
+
         const MessageRxMetadata meta{{{transfer_id, priority}, timestamp}, publisher_node_id};
         MessageRxTransfer       msg_rx_transfer{meta, ScatteredBuffer{std::move(canard_memory)}};
         if (on_receive_cb_fn_)
@@ -169,6 +203,25 @@ private:
         (void) last_rx_transfer_.emplace(std::move(msg_rx_transfer));
     }
 
+    // MARK: IMsgRxSessionDelegate
+
+    transport::detail::RxReassemblyAccount& getRxReassemblyAccount() noexcept override
+    {
+        return *this;
+    }
+
+    // MARK: RxReassemblyAccount
+
+    void abortReassemblies() override
+    {
+        // Libcanard doesn't provide a way to abort an individual transfer (or remote node state),
+        // so we re-subscribe (keeping current transfer-ID timeout), which frees all sessions of the subscription.
+        // The subscription is re-made in place, so references to it stay valid.
+        const auto tid_timeout_usec = subscription_.transfer_id_timeout_usec;
+        unsubscribe();
+        subscribe(tid_timeout_usec);
+    }
+
     // MARK: Data members:
 
     TransportDelegate&                delegate_;
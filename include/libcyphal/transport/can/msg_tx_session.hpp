@@ -10,6 +10,8 @@
 
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/msg_tx_capacity.hpp"
+#include "libcyphal/transport/msg_tx_timestamping.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
@@ -17,6 +19,9 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <cstddef>
+#include <utility>
+
 namespace libcyphal
 {
 namespace transport
@@ -62,9 +67,30 @@ public:
     MessageTxSession(const Spec, TransportDelegate& delegate, const MessageTxParams& params)
         : delegate_{delegate}
         , params_{params}
+        , timestamping_node_{params.subject_id}
     {
     }
 
+    MessageTxSession(const MessageTxSession&)                = delete;
+    MessageTxSession(MessageTxSession&&) noexcept            = delete;
+    MessageTxSession& operator=(const MessageTxSession&)     = delete;
+    MessageTxSession& operator=(MessageTxSession&&) noexcept = delete;
+
+    ~MessageTxSession()
+    {
+        using MsgTxTimestamping = TransportDelegate::SessionEvent::MsgTxTimestamping;
+        using MsgTxCapacity     = TransportDelegate::SessionEvent::MsgTxCapacity;
+
+        if (timestamping_node_.isTimestampingLinked())
+        {
+            delegate_.onSessionEvent(MsgTxTimestamping{timestamping_node_, false /* is_added */});
+        }
+        if (capacity_node_.isCapacityLinked())
+        {
+            delegate_.onSessionEvent(MsgTxCapacity{capacity_node_, false /* is_added */});
+        }
+    }
+
 private:
     // MARK: IMessageTxSession
 
@@ -82,13 +108,48 @@ private:
                                                             CANARD_NODE_ID_UNSET,
                                                             static_cast<CanardTransferID>(metadata.base.transfer_id)};
 
-        return delegate_.sendTransfer(metadata.deadline, canard_metadata, payload_fragments);
+        auto failure = delegate_.sendTransfer(metadata.deadline, canard_metadata, payload_fragments);
+        if (!failure)
+        {
+            timestamping_node_.onTransferSent(metadata.base.transfer_id);
+        }
+        return failure;
+    }
+
+    void setOnTxTimestampCallback(OnTxTimestampCallback::Function&& function) override
+    {
+        using MsgTxTimestamping = TransportDelegate::SessionEvent::MsgTxTimestamping;
+
+        if (timestamping_node_.isTimestampingLinked())
+        {
+            delegate_.onSessionEvent(MsgTxTimestamping{timestamping_node_, false /* is_added */});
+        }
+        if (timestamping_node_.setCallback(std::move(function)))
+        {
+            delegate_.onSessionEvent(MsgTxTimestamping{timestamping_node_, true /* is_added */});
+        }
+    }
+
+    void setOnTxCapacityCallback(OnTxCapacityCallback::Function&& function, const std::size_t watermark) override
+    {
+        using MsgTxCapacity = TransportDelegate::SessionEvent::MsgTxCapacity;
+
+        if (capacity_node_.isCapacityLinked())
+        {
+            delegate_.onSessionEvent(MsgTxCapacity{capacity_node_, false /* is_added */});
+        }
+        if (capacity_node_.setCallback(std::move(function), watermark))
+        {
+            delegate_.onSessionEvent(MsgTxCapacity{capacity_node_, true /* is_added */});
+        }
     }
 
     // MARK: Data members:
 
-    TransportDelegate&    delegate_;
-    const MessageTxParams params_;
+    TransportDelegate&                       delegate_;
+    const MessageTxParams                    params_;
+    transport::detail::MsgTxTimestampingNode timestamping_node_;
+    transport::detail::MsgTxCapacityNode     capacity_node_;
 
 };  // MessageTxSession
 
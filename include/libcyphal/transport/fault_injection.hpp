@@ -0,0 +1,563 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_FAULT_INJECTION_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_FAULT_INJECTION_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Defines probabilities of faults injected by the fault injecting media decorators.
+///
+/// Each probability is in the [0, 1] range, where zero (the default) means "never", and one means "always".
+/// Drop, duplicate, delay and reorder faults are mutually exclusive per frame (and are rolled in this order),
+/// whereas corruption could be combined with any of them (except drop).
+///
+struct FaultRates final
+{
+    /// Probability that a frame is lost.
+    float drop{};
+
+    /// Probability that a frame is delivered twice.
+    float duplicate{};
+
+    /// Probability that a random bit of a received frame is flipped.
+    float corrupt{};
+
+    /// Probability that a received frame is delivered later - by a random time up to the max delay.
+    float delay{};
+
+    /// Probability that a received frame is held back, and so overtaken by the next received frame.
+    float reorder{};
+
+    /// Probability that a frame to be sent is rejected as if the media is busy (aka TX back-pressure).
+    float tx_busy{};
+};
+
+/// @brief Defines transport metadata of a frame, which fault rates are requested for.
+///
+struct FaultFrameInfo final
+{
+    /// Whether the frame is being sent (`true`) or received (`false`).
+    bool is_tx;
+
+    /// Whether the frame is a service (request or response) one.
+    bool is_service;
+
+    /// Subject ID (for messages) or service ID (for requests and responses).
+    PortId port_id;
+
+    /// Priority of the frame transfer.
+    Priority priority;
+};
+
+/// @brief Defines parameters of the fault injecting media decorators.
+///
+/// Rates of a frame are resolved in the following order: the per port function (if any, and if it has returned
+/// a value for the frame), then the per priority rates (if any for the frame priority), and then the default rates.
+/// Frames which are not valid Cyphal frames (so their port and priority are unknown) get the default rates.
+///
+struct FaultInjectionParams final
+{
+    /// @brief Defines signature of the per port rates function.
+    ///
+    /// Returns `nullopt` if rates of the frame should be resolved by its priority (or by default).
+    ///
+    using PortRatesFunction = cetl::pmr::function<cetl::optional<FaultRates>(const FaultFrameInfo& info),
+                                                  config::Transport::FaultInjection_PortRatesFunctionMaxSize()>;
+
+    /// Number of priority levels.
+    static constexpr std::size_t PriorityCount = static_cast<std::size_t>(Priority::Optional) + 1U;
+
+    /// Seed of the pseudo-random sequence - the same seed (and the same traffic) produces the same faults.
+    std::uint64_t seed{1};
+
+    /// Default fault rates.
+    FaultRates rates{};
+
+    /// Optional fault rates per priority (indexed by the priority value).
+    std::array<cetl::optional<FaultRates>, PriorityCount> priority_rates{};
+
+    /// Optional function which provides fault rates per port.
+    PortRatesFunction port_rates{};
+
+    /// Max time by which a delayed frame is delivered later. Also limits time of holding a reordered frame.
+    Duration max_delay{std::chrono::milliseconds{100}};
+
+    /// Time after which a (seemingly) busy media notifies the transport that it's ready to send again.
+    Duration tx_busy_duration{std::chrono::milliseconds{1}};
+
+    /// Max number of frames held (for delay, reorder or duplication) per media (or per RX socket).
+    /// When there is no room to hold a frame, it's delivered as is.
+    std::size_t max_held_frames{16};
+};
+
+/// @brief Defines counters of faults which were actually injected by a fault injecting media decorator.
+///
+struct FaultInjectionStats final
+{
+    std::size_t dropped{0};
+    std::size_t duplicated{0};
+    std::size_t corrupted{0};
+    std::size_t delayed{0};
+    std::size_t reordered{0};
+    std::size_t tx_busy{0};
+};
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Rolls faults of frames according to the fault injection parameters.
+///
+/// Uses the SplitMix64 pseudo-random generator - it's tiny, fast, and good enough for testing purposes.
+/// Zero (and one) probabilities don't consume the pseudo-random sequence, so enabling of one kind of faults
+/// for some ports doesn't change faults of other ports (as long as traffic is the same).
+///
+class FaultInjector final
+{
+public:
+    enum class RxFault : std::uint8_t
+    {
+        None,
+        Drop,
+        Duplicate,
+        Delay,
+        Reorder,
+    };
+
+    enum class TxFault : std::uint8_t
+    {
+        None,
+        Busy,
+        Drop,
+        Duplicate,
+    };
+
+    explicit FaultInjector(FaultInjectionParams&& params)
+        : params_{std::move(params)}
+        , state_{params_.seed}
+    {
+    }
+
+    CETL_NODISCARD const FaultInjectionParams& params() const noexcept
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD FaultInjectionStats& stats() noexcept
+    {
+        return stats_;
+    }
+
+    CETL_NODISCARD const FaultInjectionStats& stats() const noexcept
+    {
+        return stats_;
+    }
+
+    CETL_NODISCARD FaultRates ratesOf(const cetl::optional<FaultFrameInfo>& info) const
+    {
+        if (!info.has_value())
+        {
+            return params_.rates;
+        }
+        if (params_.port_rates)
+        {
+            if (const auto port_rates = params_.port_rates(*info))
+            {
+                return *port_rates;
+            }
+        }
+        const auto& priority_rates = params_.priority_rates[static_cast<std::size_t>(info->priority)];
+        return priority_rates.has_value() ? *priority_rates : params_.rates;
+    }
+
+    CETL_NODISCARD RxFault rollRxFault(const FaultRates& rates)
+    {
+        if (roll(rates.drop))
+        {
+            return RxFault::Drop;
+        }
+        if (roll(rates.duplicate))
+        {
+            return RxFault::Duplicate;
+        }
+        if (roll(rates.delay))
+        {
+            return RxFault::Delay;
+        }
+        return roll(rates.reorder) ? RxFault::Reorder : RxFault::None;
+    }
+
+    CETL_NODISCARD TxFault rollTxFault(const FaultRates& rates)
+    {
+        if (roll(rates.tx_busy))
+        {
+            return TxFault::Busy;
+        }
+        if (roll(rates.drop))
+        {
+            return TxFault::Drop;
+        }
+        return roll(rates.duplicate) ? TxFault::Duplicate : TxFault::None;
+    }
+
+    /// Rolls corruption of a frame, and if so flips a random bit of the given frame bytes.
+    ///
+    /// @return `true` if the frame has been corrupted.
+    ///
+    bool rollCorruption(const FaultRates& rates, const cetl::span<cetl::byte> frame)
+    {
+        if (frame.empty() || !roll(rates.corrupt))
+        {
+            return false;
+        }
+
+        constexpr std::uint64_t BitsPerByte = 8U;
+
+        const std::uint64_t bit_index = next() % (frame.size() * BitsPerByte);
+        frame[bit_index / BitsPerByte] ^= static_cast<cetl::byte>(1U << (bit_index % BitsPerByte));
+        ++stats_.corrupted;
+        return true;
+    }
+
+    /// Gets a random delay in the [0, max_delay] range.
+    ///
+    CETL_NODISCARD Duration randomDelay()
+    {
+        const auto max_delay = static_cast<std::uint64_t>(std::max(params_.max_delay.count(), Duration::rep{0}));
+        return Duration{static_cast<Duration::rep>(next() % (max_delay + 1U))};
+    }
+
+private:
+    CETL_NODISCARD bool roll(const float probability)
+    {
+        if (probability <= 0.0F)
+        {
+            return false;
+        }
+        if (probability >= 1.0F)
+        {
+            return true;
+        }
+
+        // The top 24 bits make a uniform value in the [0, 1) range (exactly representable by `float`).
+        constexpr float Scale = 1.0F / 16777216.0F;
+        return (static_cast<float>(next() >> 40U) * Scale) < probability;
+    }
+
+    CETL_NODISCARD std::uint64_t next() noexcept
+    {
+        state_ += 0x9E3779B97F4A7C15ULL;
+        std::uint64_t value = state_;
+        value               = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        value               = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31U);
+    }
+
+    // MARK: Data members:
+
+    const FaultInjectionParams params_;
+    std::uint64_t              state_;
+    FaultInjectionStats        stats_{};
+
+};  // FaultInjector
+
+/// @brief Holds frames (delayed, reordered or duplicated ones) until their release time.
+///
+/// All slots are allocated at once (at construction), so holding of a frame never allocates memory.
+/// Frames are released in order of their release times (and in order of holding for the same time).
+///
+template <typename Frame>
+class FaultHeldFrames final
+{
+public:
+    FaultHeldFrames(cetl::pmr::memory_resource& memory, const std::size_t capacity)
+        : entries_{capacity, &memory}
+    {
+        // Capacity will be zero in case of out of memory (and so nothing will be ever held).
+        entries_.reserve(capacity);
+        if (entries_.capacity() >= capacity)
+        {
+            for (std::size_t index = 0; index < capacity; ++index)
+            {
+                entries_.emplace_back();
+            }
+        }
+    }
+
+    /// Holds the frame (if there is room for it).
+    ///
+    /// @param frame The frame to hold. It's moved from only if the frame has been held.
+    /// @param release_time The time when the frame should be released.
+    /// @param until_next If `true` then the frame is released earlier - right after the next delivered frame.
+    /// @return `true` if the frame has been held.
+    ///
+    bool hold(Frame& frame, const TimePoint release_time, const bool until_next)
+    {
+        for (auto& entry : entries_)
+        {
+            if (!entry.has_value())
+            {
+                entry.emplace(Entry{std::move(frame), release_time, next_sequence_++, until_next});
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Makes frames which wait for the next delivered frame to be released at the given time.
+    ///
+    void releaseUntilNext(const TimePoint now)
+    {
+        for (auto& entry : entries_)
+        {
+            if (entry.has_value() && entry->until_next)
+            {
+                entry->until_next   = false;
+                entry->release_time = std::min(entry->release_time, now);
+            }
+        }
+    }
+
+    CETL_NODISCARD cetl::optional<TimePoint> nextReleaseTime() const
+    {
+        const auto index = findNext();
+        return index.has_value() ? cetl::optional<TimePoint>{entries_[*index]->release_time} : cetl::nullopt;
+    }
+
+    /// Pops the next frame if its release time has come.
+    ///
+    CETL_NODISCARD cetl::optional<Frame> popDue(const TimePoint now)
+    {
+        const auto index = findNext();
+        if (!index.has_value() || (entries_[*index]->release_time > now))
+        {
+            return cetl::nullopt;
+        }
+
+        cetl::optional<Frame> frame{std::move(entries_[*index]->frame)};
+        entries_[*index].reset();
+        return frame;
+    }
+
+private:
+    struct Entry
+    {
+        Frame         frame;
+        TimePoint     release_time;
+        std::uint64_t sequence;
+        bool          until_next;
+    };
+
+    /// Finds index of the entry which should be released first.
+    ///
+    CETL_NODISCARD cetl::optional<std::size_t> findNext() const
+    {
+        cetl::optional<std::size_t> next;
+        for (std::size_t index = 0; index < entries_.size(); ++index)
+        {
+            const auto& entry = entries_[index];
+            if (!entry.has_value())
+            {
+                continue;
+            }
+            if (!next.has_value() || (entry->release_time < entries_[*next]->release_time) ||
+                ((entry->release_time == entries_[*next]->release_time) &&
+                 (entry->sequence < entries_[*next]->sequence)))
+            {
+                next = index;
+            }
+        }
+        return next;
+    }
+
+    // MARK: Data members:
+
+    libcyphal::detail::VarArray<cetl::optional<Entry>> entries_;
+    std::uint64_t                                      next_sequence_{0};
+
+};  // FaultHeldFrames
+
+/// @brief Relays readiness notifications of a decorated media (or socket) to the transport,
+///        and allows the decorator to notify the transport at its own time (f.e. when a delayed frame is due).
+///
+/// The transport gets its own callback handle (as usual), so that releasing of the handle stops
+/// both the decorated media notifications, and the extra ones of the decorator.
+///
+class FaultInjectionNotifier final
+{
+    using Callback = IExecutor::Callback;
+
+    /// @brief Defines the callback handle which is returned to the transport.
+    ///
+    class Handle final : public Callback::Interface
+    {
+    public:
+        Handle(FaultInjectionNotifier& notifier, const std::size_t generation)
+            : notifier_{&notifier}
+            , generation_{generation}
+        {
+        }
+
+        Handle(Handle&& other) noexcept
+            : notifier_{std::exchange(other.notifier_, nullptr)}
+            , generation_{other.generation_}
+        {
+        }
+
+        ~Handle()
+        {
+            if (isCurrent())
+            {
+                notifier_->release();
+            }
+        }
+
+        Handle(const Handle&)                = delete;
+        Handle& operator=(const Handle&)     = delete;
+        Handle& operator=(Handle&&) noexcept = delete;
+
+        // MARK: Callback::Interface
+
+        void schedule(const Callback::Schedule::Variant& schedule) override
+        {
+            if (isCurrent())
+            {
+                (void) notifier_->media_callback_.schedule(schedule);
+            }
+        }
+
+    private:
+        CETL_NODISCARD bool isCurrent() const noexcept
+        {
+            return (notifier_ != nullptr) && (notifier_->generation_ == generation_);
+        }
+
+        FaultInjectionNotifier* notifier_;
+        std::size_t             generation_;
+
+    };  // Handle
+
+public:
+    explicit FaultInjectionNotifier(IExecutor& executor)
+        : executor_{executor}
+    {
+    }
+
+    ~FaultInjectionNotifier() = default;
+
+    FaultInjectionNotifier(const FaultInjectionNotifier&)                = delete;
+    FaultInjectionNotifier(FaultInjectionNotifier&&) noexcept            = delete;
+    FaultInjectionNotifier& operator=(const FaultInjectionNotifier&)     = delete;
+    FaultInjectionNotifier& operator=(FaultInjectionNotifier&&) noexcept = delete;
+
+    /// Registers the transport callback function.
+    ///
+    /// @param function The transport callback function.
+    /// @param register_at_media The function which registers a callback at the decorated media (or socket).
+    /// @return The handle to be returned to the transport.
+    ///
+    template <typename RegisterAtMedia>
+    CETL_NODISCARD Callback::Any registerCallback(Callback::Function&& function, RegisterAtMedia&& register_at_media)
+    {
+        release();
+        ++generation_;
+
+        function_.emplace(std::move(function));
+        media_callback_ = std::forward<RegisterAtMedia>(register_at_media)([this](const auto& arg) {
+            //
+            notify(arg);
+        });
+        wake_callback_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            wake_at_.reset();
+            notify(arg);
+        });
+        if (wake_at_.has_value())
+        {
+            (void) wake_callback_.schedule(Callback::Schedule::Once{*wake_at_});
+        }
+
+        return Callback::Any{Handle{*this, generation_}};
+    }
+
+    /// Notifies the transport at the given time (or earlier if there is already an earlier notification pending).
+    ///
+    void wakeAt(const TimePoint time_point)
+    {
+        if (wake_at_.has_value() && (*wake_at_ <= time_point))
+        {
+            return;
+        }
+        wake_at_ = time_point;
+        (void) wake_callback_.schedule(Callback::Schedule::Once{time_point});
+    }
+
+private:
+    void notify(const Callback::Arg& arg)
+    {
+        if (!function_.has_value())
+        {
+            return;
+        }
+
+        // The function is moved out during the call b/c the transport might release its handle
+        // (and so the function itself) from inside of the call.
+        const std::size_t  generation = generation_;
+        Callback::Function function   = std::move(*function_);
+        function(arg);
+        if ((generation == generation_) && function_.has_value())
+        {
+            *function_ = std::move(function);
+        }
+    }
+
+    void release()
+    {
+        wake_callback_.reset();
+        media_callback_.reset();
+        function_.reset();
+        wake_at_.reset();
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                         executor_;
+    std::size_t                        generation_{0};
+    cetl::optional<Callback::Function> function_;
+    Callback::Any                      media_callback_;
+    Callback::Any                      wake_callback_;
+    cetl::optional<TimePoint>          wake_at_;
+
+};  // FaultInjectionNotifier
+
+}  // namespace detail
+
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_FAULT_INJECTION_HPP_INCLUDED
@@ -0,0 +1,355 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_FRAME_MONITOR_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_FRAME_MONITOR_SESSIONS_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/session.hpp"
+#include "libcyphal/transport/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Defines parameters of a frame monitor (aka promiscuous) RX session.
+///
+struct FrameMonitorRxParams final
+{
+    /// The first (the lowest) subject ID of message frames to be monitored.
+    PortId subject_id_first{};
+
+    /// The last (the highest, inclusive) subject ID of message frames to be monitored.
+    PortId subject_id_last{};
+
+    /// Whether service (request and response) frames of any service ID should be monitored as well.
+    bool with_services{};
+
+    /// Max size (in bytes) of a reassembled transfer payload, or zero (the default) to deliver frames as is.
+    ///
+    /// When non-zero, the session reassembles multi-frame transfers, and the callback receives whole transfers
+    /// instead of frames - with metadata of their first frame (marked as both the first and the last one).
+    /// Transfer CRC is verified and removed; payload beyond this size is truncated (like by the transfer extent).
+    std::size_t reassembly_extent_bytes{};
+};
+
+/// @brief Defines metadata of a frame received by a frame monitor RX session.
+///
+struct FrameMonitorRxMetadata final
+{
+    /// @brief Defines kind of the transfer which the frame belongs to.
+    ///
+    enum class Kind : std::uint8_t
+    {
+        Message,
+        Request,
+        Response,
+    };
+
+    /// Transfer ID and priority of the transfer, and the frame reception timestamp.
+    TransferRxMetadata rx_meta;
+
+    /// Kind of the transfer.
+    Kind kind;
+
+    /// Subject ID (for messages) or service ID (for requests and responses).
+    PortId port_id;
+
+    /// Node ID of the source (`nullopt` for anonymous messages).
+    cetl::optional<NodeId> source_node_id;
+
+    /// Node ID of the destination (`nullopt` for messages, which are broadcast).
+    cetl::optional<NodeId> destination_node_id;
+
+    /// Index of the redundant media interface which has received the frame.
+    std::uint8_t media_index;
+
+    /// Whether the frame is the first one of its transfer.
+    bool is_start_of_transfer;
+
+    /// Whether the frame is the last one of its transfer. A single-frame transfer is both the first and the last one.
+    bool is_end_of_transfer;
+};
+
+/// @brief Defines an abstract interface of a transport layer frame monitor (aka promiscuous) receive session.
+///
+/// In contrast to other RX sessions, the frame monitor session is not bound to a single port. Instead, it receives
+/// frames of all transfers (of a range of subjects, and optionally of all services) from all nodes on the bus,
+/// including service transfers addressed to other nodes. It's intended for tools which need to see all the traffic,
+/// like bus loggers, analyzers and bridges - without making a dedicated RX session per each port.
+///
+/// By default, frames are delivered as is (in order of their arrival), together with parsed transport metadata.
+/// The session doesn't reassemble multi-frame transfers (and so doesn't hold any per port or per transfer state) -
+/// it's up to the user to combine frames (if needed) using their transfer IDs and start/end of transfer flags.
+/// Frame payload is delivered without transport header (or CAN tail byte), but multi-frame transfer CRC bytes
+/// (at the end of the transfer payload) are delivered as is. Alternatively, the session could reassemble transfers
+/// by itself (see `FrameMonitorRxParams::reassembly_extent_bytes`) - f.e. for bridges which forward whole transfers.
+///
+/// Frames of the transport itself (f.e. TX loopback ones) are not delivered. The frame monitor session doesn't affect
+/// reception by other RX sessions. There could be only one frame monitor session per transport at a time.
+///
+/// Use transport's `makeFrameMonitorRxSession` factory function to create an instance of this interface.
+///
+/// @see ISession
+///
+class IFrameMonitorRxSession : public ISession
+{
+public:
+    IFrameMonitorRxSession(const IFrameMonitorRxSession&)                = delete;
+    IFrameMonitorRxSession(IFrameMonitorRxSession&&) noexcept            = delete;
+    IFrameMonitorRxSession& operator=(const IFrameMonitorRxSession&)     = delete;
+    IFrameMonitorRxSession& operator=(IFrameMonitorRxSession&&) noexcept = delete;
+
+    /// @brief Returns the parameters of the frame monitor reception session.
+    ///
+    virtual FrameMonitorRxParams getParams() const noexcept = 0;
+
+    /// @brief Umbrella type for frame reception callback entities.
+    ///
+    struct OnFrameCallback
+    {
+        /// @brief Defines standard arguments for frame reception callback.
+        ///
+        struct Arg
+        {
+            /// Metadata of the received frame.
+            const FrameMonitorRxMetadata& metadata;
+
+            /// The frame payload. It's valid only during the callback call.
+            cetl::span<const cetl::byte> payload;
+        };
+
+        /// @brief Defines signature of the frame reception callback function.
+        ///
+        static constexpr std::size_t FunctionMaxSize =
+            config::Transport::IFrameMonitorRxSession_OnFrameCallback_FunctionMaxSize();
+        using Function = cetl::pmr::function<void(const Arg&), FunctionMaxSize>;
+
+    };  // OnFrameCallback
+
+    /// @brief Sets the frame reception callback.
+    ///
+    /// Frames received while there is no callback are dropped (there is no queue of frames).
+    ///
+    /// @param function The callback function, which will be called on each frame reception.
+    ///
+    virtual void setOnFrameCallback(OnFrameCallback::Function&& function) = 0;
+
+protected:
+    IFrameMonitorRxSession()  = default;
+    ~IFrameMonitorRxSession() = default;
+
+};  // IFrameMonitorRxSession
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Checks whether a frame (with the given metadata) should be delivered to a frame monitor session.
+///
+CETL_NODISCARD inline bool isMonitoredBy(const FrameMonitorRxParams& params, const FrameMonitorRxMetadata& metadata)
+{
+    if (metadata.kind != FrameMonitorRxMetadata::Kind::Message)
+    {
+        return params.with_services;
+    }
+    return (metadata.port_id >= params.subject_id_first) && (metadata.port_id <= params.subject_id_last);
+}
+
+/// @brief Reassembles multi-frame transfers received by a frame monitor RX session.
+///
+/// There is a fixed number of concurrent reassemblies (see `FrameMonitorRxSession_ReassemblySlotsCapacity`),
+/// each one is keyed by the transfer kind, port, source and destination nodes, and the media interface.
+/// Frames of a transfer are expected in order, so a transfer with a lost, reordered or corrupted frame fails
+/// the transfer CRC check, and is dropped. Transfers from redundant media interfaces are not deduplicated -
+/// each interface delivers its own copy (the same way as frames are delivered).
+///
+/// @tparam FrameCodec Transport specific codec, which provides the transfer CRC.
+///
+template <typename FrameCodec>
+class FrameMonitorReassembler final
+{
+public:
+    FrameMonitorReassembler(cetl::pmr::memory_resource& memory, const std::size_t extent_bytes)
+        : memory_{memory}
+        , extent_bytes_{extent_bytes}
+        , slots_{}
+    {
+    }
+
+    FrameMonitorReassembler(const FrameMonitorReassembler&)                = delete;
+    FrameMonitorReassembler(FrameMonitorReassembler&&) noexcept            = delete;
+    FrameMonitorReassembler& operator=(const FrameMonitorReassembler&)     = delete;
+    FrameMonitorReassembler& operator=(FrameMonitorReassembler&&) noexcept = delete;
+
+    ~FrameMonitorReassembler()
+    {
+        for (auto& slot : slots_)
+        {
+            if (slot.buffer != nullptr)
+            {
+                memory_.deallocate(slot.buffer, extent_bytes_);
+            }
+        }
+    }
+
+    /// @brief Accepts the next frame, and calls the given action if the frame completes a transfer.
+    ///
+    /// The action is called with metadata and payload of the whole transfer. The payload is valid only
+    /// during the action call. The action is the last thing done by this method, so it's safe to destroy
+    /// the reassembler from within the action.
+    ///
+    template <typename Action>
+    void accept(const FrameMonitorRxMetadata& metadata, const cetl::span<const cetl::byte> payload, Action&& action)
+    {
+        if (metadata.is_start_of_transfer && metadata.is_end_of_transfer)
+        {
+            acceptSingleFrame(metadata, payload, std::forward<Action>(action));
+            return;
+        }
+
+        Slot* const slot = metadata.is_start_of_transfer ? startSlot(metadata) : findSlot(metadata);
+        if (slot == nullptr)
+        {
+            return;
+        }
+
+        slot->crc = FrameCodec::addTransferCrc(slot->crc, payload.data(), payload.size());
+        if (slot->size < extent_bytes_)
+        {
+            const auto chunk_size = std::min(payload.size(), extent_bytes_ - slot->size);
+            std::copy_n(payload.data(), chunk_size, slot->buffer + slot->size);  // NOLINT(*-pointer-arithmetic)
+        }
+        slot->size += payload.size();
+
+        if (metadata.is_end_of_transfer)
+        {
+            slot->is_active = false;
+
+            const std::size_t crc_size = FrameCodec::TransferCrcSize;
+            if ((slot->size >= crc_size) && FrameCodec::isTransferCrcResidue(slot->crc))
+            {
+                const auto size = std::min(slot->size - crc_size, extent_bytes_);
+                std::forward<Action>(action)(slot->metadata, cetl::span<const cetl::byte>{slot->buffer, size});
+            }
+        }
+    }
+
+private:
+    using TransferCrc = typename FrameCodec::TransferCrc;
+
+    struct Slot
+    {
+        FrameMonitorRxMetadata metadata;
+        cetl::byte*            buffer;
+        std::size_t            size;
+        TransferCrc            crc;
+        bool                   is_active;
+    };
+
+    template <typename Action>
+    void acceptSingleFrame(const FrameMonitorRxMetadata&      metadata,
+                           const cetl::span<const cetl::byte> payload,
+                           Action&&                           action) const
+    {
+        std::size_t size = payload.size();
+        if (FrameCodec::hasSingleFrameTransferCrc())
+        {
+            const std::size_t crc_size = FrameCodec::TransferCrcSize;
+            if ((size < crc_size) ||
+                !FrameCodec::isTransferCrcResidue(
+                    FrameCodec::addTransferCrc(FrameCodec::TransferCrcInitial, payload.data(), size)))
+            {
+                return;
+            }
+            size -= crc_size;
+        }
+        std::forward<Action>(action)(metadata, payload.first(std::min(size, extent_bytes_)));
+    }
+
+    /// Finds a slot for a new transfer - either the one of the same key (the previous transfer is abandoned),
+    /// or an inactive one, or the least recently started one.
+    ///
+    CETL_NODISCARD Slot* startSlot(const FrameMonitorRxMetadata& metadata)
+    {
+        Slot* chosen = nullptr;
+        for (auto& slot : slots_)
+        {
+            if (slot.is_active && isSameKey(slot.metadata, metadata))
+            {
+                chosen = &slot;
+                break;
+            }
+            if ((chosen == nullptr) || (chosen->is_active && !slot.is_active) ||
+                (chosen->is_active && (slot.metadata.rx_meta.timestamp < chosen->metadata.rx_meta.timestamp)))
+            {
+                chosen = &slot;
+            }
+        }
+
+        if (chosen->buffer == nullptr)
+        {
+            chosen->buffer = static_cast<cetl::byte*>(memory_.allocate(extent_bytes_));  // NOSONAR cpp:S5356 cpp:S5357
+            if (chosen->buffer == nullptr)
+            {
+                return nullptr;
+            }
+        }
+
+        chosen->metadata                    = metadata;
+        chosen->metadata.is_end_of_transfer = true;
+        chosen->size                        = 0;
+        chosen->crc                         = FrameCodec::TransferCrcInitial;
+        chosen->is_active                   = true;
+        return chosen;
+    }
+
+    CETL_NODISCARD Slot* findSlot(const FrameMonitorRxMetadata& metadata)
+    {
+        for (auto& slot : slots_)
+        {
+            if (slot.is_active && isSameKey(slot.metadata, metadata) &&
+                (slot.metadata.rx_meta.base.transfer_id == metadata.rx_meta.base.transfer_id))
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    CETL_NODISCARD static bool isSameKey(const FrameMonitorRxMetadata& lhs, const FrameMonitorRxMetadata& rhs)
+    {
+        return (lhs.kind == rhs.kind) && (lhs.port_id == rhs.port_id) && (lhs.source_node_id == rhs.source_node_id) &&
+               (lhs.destination_node_id == rhs.destination_node_id) && (lhs.media_index == rhs.media_index);
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&                                                           memory_;
+    const std::size_t                                                                     extent_bytes_;
+    std::array<Slot, config::Transport::FrameMonitorRxSession_ReassemblySlotsCapacity()> slots_;
+
+};  // FrameMonitorReassembler
+
+}  // namespace detail
+
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_FRAME_MONITOR_SESSIONS_HPP_INCLUDED
@@ -0,0 +1,234 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_MEDIA_SLOTS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_MEDIA_SLOTS_HPP_INCLUDED
+
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines fixed capacity storage of redundant media of a transport.
+///
+/// Each media occupies its own slot, and position of the slot is the media index (aka redundant interface index
+/// of the lizards). All slots are allocated at once (at the transport construction), so media objects never move
+/// in memory, and could be safely referenced by executor callbacks. Removal of a media frees its slot for a media
+/// added later, whereas indices of all other media stay intact (so that their RX redundancy state stays valid).
+///
+/// Iteration skips free slots, and goes in the order of media indices.
+///
+template <typename Media>
+class MediaSlots final
+{
+    using Slot = cetl::optional<Media>;
+
+    template <typename SlotT, typename MediaT>
+    class IteratorImpl final
+    {
+    public:
+        IteratorImpl(SlotT* const curr, SlotT* const end) noexcept
+            : curr_{curr}
+            , end_{end}
+        {
+            skipFreeSlots();
+        }
+
+        MediaT& operator*() const noexcept
+        {
+            return **curr_;
+        }
+
+        IteratorImpl& operator++() noexcept
+        {
+            ++curr_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            skipFreeSlots();
+            return *this;
+        }
+
+        bool operator==(const IteratorImpl& other) const noexcept
+        {
+            return curr_ == other.curr_;
+        }
+
+        bool operator!=(const IteratorImpl& other) const noexcept
+        {
+            return curr_ != other.curr_;
+        }
+
+    private:
+        void skipFreeSlots() noexcept
+        {
+            while ((curr_ != end_) && !curr_->has_value())
+            {
+                ++curr_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+        }
+
+        SlotT* curr_;
+        SlotT* end_;
+
+    };  // IteratorImpl
+
+public:
+    using iterator       = IteratorImpl<Slot, Media>;
+    using const_iterator = IteratorImpl<const Slot, const Media>;
+
+    MediaSlots(cetl::pmr::memory_resource& memory, const std::size_t capacity)
+        : slots_{capacity, &memory}
+    {
+        // Reserve the space for all slots at once (to avoid reallocations).
+        // Capacity will be zero in case of out of memory.
+        slots_.reserve(capacity);
+        if (slots_.capacity() >= capacity)
+        {
+            for (std::size_t index = 0; index < capacity; ++index)
+            {
+                slots_.emplace_back();
+            }
+        }
+    }
+
+    MediaSlots(MediaSlots&&) noexcept = default;
+
+    MediaSlots(const MediaSlots&)                = delete;
+    MediaSlots& operator=(const MediaSlots&)     = delete;
+    MediaSlots& operator=(MediaSlots&&) noexcept = delete;
+
+    ~MediaSlots() = default;
+
+    /// @brief Gets total number of slots (both occupied and free ones).
+    ///
+    CETL_NODISCARD std::size_t capacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+    /// @brief Gets number of occupied slots (aka number of media).
+    ///
+    CETL_NODISCARD std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator{slots_.data(), slotsEnd()};
+    }
+
+    iterator end() noexcept
+    {
+        return iterator{slotsEnd(), slotsEnd()};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{slots_.data(), slotsEnd()};
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator{slotsEnd(), slotsEnd()};
+    }
+
+    /// @brief Finds media by its index.
+    ///
+    /// @return Pointer to the media, or `nullptr` if the slot is free (or out of range).
+    ///
+    CETL_NODISCARD Media* find(const std::size_t index) noexcept
+    {
+        return ((index < slots_.size()) && slots_[index].has_value()) ? &(*slots_[index]) : nullptr;
+    }
+
+    /// @brief Finds media by its interface.
+    ///
+    /// @return Pointer to the media, or `nullptr` if there is no such media.
+    ///
+    template <typename Interface>
+    CETL_NODISCARD Media* findByInterface(const Interface& interface) noexcept
+    {
+        for (Media& media : *this)
+        {
+            if (&media.interface() == &interface)
+            {
+                return &media;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Finds the lowest free slot index.
+    ///
+    CETL_NODISCARD cetl::optional<std::size_t> findFreeIndex() const noexcept
+    {
+        for (std::size_t index = 0; index < slots_.size(); ++index)
+        {
+            if (!slots_[index].has_value())
+            {
+                return index;
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    /// @brief Constructs a new media at the given free slot.
+    ///
+    template <typename... Args>
+    Media& emplaceAt(const std::size_t index, Args&&... args)
+    {
+        CETL_DEBUG_ASSERT((index < slots_.size()) && !slots_[index].has_value(), "Slot must be free.");
+
+        ++size_;
+        return slots_[index].emplace(std::forward<Args>(args)...);
+    }
+
+    /// @brief Destroys media at the given slot (if any), and so frees the slot.
+    ///
+    void resetAt(const std::size_t index) noexcept
+    {
+        if ((index < slots_.size()) && slots_[index].has_value())
+        {
+            slots_[index].reset();
+            --size_;
+        }
+    }
+
+private:
+    Slot* slotsEnd() noexcept
+    {
+        return slots_.data() + slots_.size();  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    const Slot* slotsEnd() const noexcept
+    {
+        return slots_.data() + slots_.size();  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    // MARK: Data members:
+
+    libcyphal::detail::VarArray<Slot> slots_;
+    std::size_t                       size_{0};
+
+};  // MediaSlots
+
+}  // namespace detail
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_MEDIA_SLOTS_HPP_INCLUDED
@@ -122,6 +122,85 @@ public:
     virtual cetl::optional<AnyFailure> send(const TransferTxMetadata& metadata,
                                             const PayloadFragments    payload_fragments) = 0;
 
+    /// @brief Umbrella type for transmission timestamp callback entities.
+    ///
+    struct OnTxTimestampCallback
+    {
+        /// @brief Defines standard arguments for transmission timestamp callback.
+        ///
+        struct Arg
+        {
+            /// Transfer ID of the sent message.
+            TransferId transfer_id;
+
+            /// Time when the first frame of the transfer has actually left the media interface.
+            /// The time is reported by the media, so it is only as precise as the media (and its driver) could be.
+            TimePoint timestamp;
+        };
+
+        /// @brief Defines signature of the transmission timestamp callback function.
+        ///
+        static constexpr std::size_t FunctionMaxSize =
+            config::Transport::IMessageTxSession_OnTxTimestampCallback_FunctionMaxSize();
+        using Function = cetl::pmr::function<void(const Arg&), FunctionMaxSize>;
+
+    };  // OnTxTimestampCallback
+
+    /// @brief Sets the transmission timestamp callback.
+    ///
+    /// The callback is called (at most once per transfer, even with redundant media) when the media
+    /// has reported that the first frame of a sent transfer has been actually transmitted.
+    /// Only media which support such reports will trigger the callback (see f.e. `can::IMedia::PopResult`
+    /// or `udp::ITxSocket::SendResult`), so the callback might be never called at all.
+    /// Default implementation does nothing - timestamps are not supported by the transport.
+    ///
+    /// @param function The callback function. Empty function disables the timestamping.
+    ///
+    virtual void setOnTxTimestampCallback(OnTxTimestampCallback::Function&& function)
+    {
+        (void) function;
+    }
+
+    /// @brief Umbrella type for TX capacity callback entities.
+    ///
+    struct OnTxCapacityCallback
+    {
+        /// @brief Defines standard arguments for TX capacity callback.
+        ///
+        struct Arg
+        {
+            /// Number of free frame slots in the fullest TX queue of the transport (at the moment of the call).
+            std::size_t free_frames;
+        };
+
+        /// @brief Defines signature of the TX capacity callback function.
+        ///
+        static constexpr std::size_t FunctionMaxSize =
+            config::Transport::IMessageTxSession_OnTxCapacityCallback_FunctionMaxSize();
+        using Function = cetl::pmr::function<void(const Arg&), FunctionMaxSize>;
+
+    };  // OnTxCapacityCallback
+
+    /// @brief Sets the TX capacity (aka flow control) callback.
+    ///
+    /// Intended for producers which would like to retry (or resume) sending after a `CapacityError`
+    /// (`MemoryError` for CAN) instead of polling. The callback is edge-triggered: it is called once occupancy
+    /// of TX queues, which previously has reached the `watermark` (or a send has failed b/c of lack of room),
+    /// drops below the `watermark` again. Occupancy is the number of frames in the fullest TX queue
+    /// of the transport (across all its media), and it's evaluated on the existing TX paths - when a transfer
+    /// is sent, and when queues are drained to the media. The callback is called from the executor
+    /// (and so never from within `send` of this or any other session). Default implementation does nothing.
+    ///
+    /// @param function The callback function. Empty function disables the notification.
+    /// @param watermark The low watermark (in frames) of TX queue occupancy. Zero means that the callback
+    ///                  is called once TX queues become empty (after having at least one frame queued).
+    ///
+    virtual void setOnTxCapacityCallback(OnTxCapacityCallback::Function&& function, const std::size_t watermark)
+    {
+        (void) function;
+        (void) watermark;
+    }
+
 protected:
     IMessageTxSession()  = default;
     ~IMessageTxSession() = default;
@@ -0,0 +1,271 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_MSG_TX_CAPACITY_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_MSG_TX_CAPACITY_HPP_INCLUDED
+
+#include "errors.hpp"
+#include "msg_sessions.hpp"
+
+#include "libcyphal/common/cavl/cavl.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines a node of a message TX session which wants to be notified about available TX capacity.
+///
+/// The node is owned by its session, and it's linked to the transport registry
+/// only while the session has a non-empty capacity callback.
+///
+/// The notification is edge-triggered: the node is "armed" when occupancy of TX queues reaches its watermark
+/// (or the queues are full), and the callback is called once occupancy drops below the watermark again.
+/// Zero watermark stands for "empty queues" - the node is armed by any queued frame,
+/// and the callback is called once the queues become empty.
+///
+class MsgTxCapacityNode final : public common::cavl::Node<MsgTxCapacityNode>
+{
+public:
+    using Callback = IMessageTxSession::OnTxCapacityCallback;
+
+    MsgTxCapacityNode()  = default;
+    ~MsgTxCapacityNode() = default;
+
+    MsgTxCapacityNode(const MsgTxCapacityNode&)                = delete;
+    MsgTxCapacityNode(MsgTxCapacityNode&&) noexcept            = delete;
+    MsgTxCapacityNode& operator=(const MsgTxCapacityNode&)     = delete;
+    MsgTxCapacityNode& operator=(MsgTxCapacityNode&&) noexcept = delete;
+
+    CETL_NODISCARD bool isCapacityLinked() const noexcept
+    {
+        return isLinked();
+    }
+
+    /// Nodes don't have any natural key, so they are ordered by their addresses.
+    ///
+    CETL_NODISCARD std::int8_t compareByAddress(const MsgTxCapacityNode* const other) const noexcept
+    {
+        if (std::less<const MsgTxCapacityNode*>{}(other, this))
+        {
+            return -1;
+        }
+        return (other == this) ? 0 : 1;
+    }
+
+    /// @brief Sets new callback, and returns `true` if the node has to be (re)linked to the registry.
+    ///
+    bool setCallback(Callback::Function&& function, const std::size_t watermark) noexcept
+    {
+        callback_  = std::move(function);
+        watermark_ = watermark;
+        is_armed_  = false;
+        return static_cast<bool>(callback_);
+    }
+
+    /// @brief Arms the node if the current occupancy of TX queues has reached the watermark.
+    ///
+    void armIfReached(const std::size_t queued_frames, const std::size_t capacity) noexcept
+    {
+        if (!isBelowWatermark(queued_frames) || (queued_frames >= capacity))
+        {
+            arm();
+        }
+    }
+
+    void arm() noexcept
+    {
+        is_armed_ = true;
+    }
+
+    CETL_NODISCARD bool isDue(const std::size_t queued_frames, const std::uint32_t drain_epoch) const noexcept
+    {
+        return is_armed_ && isBelowWatermark(queued_frames) && (notified_epoch_ != drain_epoch);
+    }
+
+    /// @brief Disarms the node and calls its callback.
+    ///
+    /// The node is not touched after the callback has returned, so the callback is free
+    /// to reset itself (or even destroy its session).
+    ///
+    void notify(const std::size_t queued_frames, const std::size_t capacity, const std::uint32_t drain_epoch)
+    {
+        is_armed_       = false;
+        notified_epoch_ = drain_epoch;
+
+        callback_(Callback::Arg{capacity - std::min(queued_frames, capacity)});
+    }
+
+private:
+    CETL_NODISCARD bool isBelowWatermark(const std::size_t queued_frames) const noexcept
+    {
+        return (watermark_ == 0) ? (queued_frames == 0) : (queued_frames < watermark_);
+    }
+
+    // MARK: Data members:
+
+    Callback::Function callback_;
+    std::size_t        watermark_{0};
+    bool               is_armed_{false};
+    std::uint32_t      notified_epoch_{0};
+
+};  // MsgTxCapacityNode
+
+/// @brief Defines a transport registry of message TX sessions which want TX capacity notifications.
+///
+/// The transport updates the registry with occupancy of its TX queues whenever the occupancy could change -
+/// after pushing a new transfer (see `onTxPush`), and after draining TX queues to the media (see `onTxDrain`).
+///
+class MsgTxCapacityRegistry final
+{
+public:
+    MsgTxCapacityRegistry() = default;
+
+    MsgTxCapacityRegistry(const MsgTxCapacityRegistry&)                = delete;
+    MsgTxCapacityRegistry(MsgTxCapacityRegistry&&) noexcept            = delete;
+    MsgTxCapacityRegistry& operator=(const MsgTxCapacityRegistry&)     = delete;
+    MsgTxCapacityRegistry& operator=(MsgTxCapacityRegistry&&) noexcept = delete;
+
+    ~MsgTxCapacityRegistry()
+    {
+        CETL_DEBUG_ASSERT(nodes_.empty(), "All capacity nodes must be removed before the registry.");
+    }
+
+    CETL_NODISCARD bool isEmpty() const noexcept
+    {
+        return nodes_.empty();
+    }
+
+    void insertNode(MsgTxCapacityNode& node)
+    {
+        CETL_DEBUG_ASSERT(!node.isCapacityLinked(), "");
+
+        const auto node_existing = nodes_.search(      //
+            [&node](const MsgTxCapacityNode& other) {  // predicate
+                //
+                return other.compareByAddress(&node);
+            },
+            [&node]() { return &node; });  // "factory"
+
+        (void) node_existing;
+    }
+
+    void removeNode(MsgTxCapacityNode& node)
+    {
+        if (node.isCapacityLinked())
+        {
+            nodes_.remove(&node);
+        }
+    }
+
+    /// @brief Defines occupancy of transport TX queues.
+    ///
+    struct Occupancy
+    {
+        /// Number of frames in the fullest TX queue.
+        std::size_t queued_frames;
+
+        /// Capacity of the TX queue (in frames).
+        std::size_t capacity;
+    };
+
+    /// @brief Checks whether a transfer has failed to be sent b/c of lack of room in TX queues.
+    ///
+    /// Note that some transports (like CAN) report full TX queue as a memory failure.
+    ///
+    CETL_NODISCARD static bool isOutOfCapacity(const cetl::optional<AnyFailure>& failure) noexcept
+    {
+        return failure.has_value() &&
+               (cetl::holds_alternative<CapacityError>(*failure) || cetl::holds_alternative<MemoryError>(*failure));
+    }
+
+    /// @brief Updates registered nodes after a transfer has been pushed (or failed to be pushed) to TX queues.
+    ///
+    /// Occupancy could only grow here, so nodes are just armed - either b/c their watermark has been reached,
+    /// or b/c the transfer didn't fit into TX queues at all (which could happen for a multi-frame transfer
+    /// even if occupancy is still below the watermark).
+    ///
+    template <typename GetOccupancy>
+    void onTxPush(const GetOccupancy& get_occupancy, const bool is_out_of_capacity)
+    {
+        if (nodes_.empty())
+        {
+            return;
+        }
+
+        const Occupancy occupancy = get_occupancy();
+        nodes_.traverseInOrder([&occupancy, is_out_of_capacity](MsgTxCapacityNode& node) {
+            //
+            if (is_out_of_capacity)
+            {
+                node.arm();
+            }
+            node.armIfReached(occupancy.queued_frames, occupancy.capacity);
+        });
+    }
+
+    /// @brief Updates registered nodes after TX queues have been drained to the media.
+    ///
+    /// Expected to be called from the executor (see `updateTxCapacityOnDrain` of transports), and never from
+    /// within a transfer sending. Callbacks are called outside of the tree traversal (one due node at a time),
+    /// so they are free to (re)set callbacks, destroy sessions or even send new transfers. The latter changes
+    /// occupancy, hence it's re-fetched (via `get_occupancy`) before each next notification. A node is notified
+    /// at most once per drain (even if its callback has failed to send and so re-armed the node).
+    ///
+    template <typename GetOccupancy>
+    void onTxDrain(const GetOccupancy& get_occupancy)
+    {
+        if (nodes_.empty())
+        {
+            return;
+        }
+        ++drain_epoch_;
+
+        while (true)
+        {
+            const Occupancy occupancy = get_occupancy();
+
+            auto* const due_node = nodes_.traverseInOrder(  //
+                [this, &occupancy](MsgTxCapacityNode& node) -> MsgTxCapacityNode* {
+                    //
+                    node.armIfReached(occupancy.queued_frames, occupancy.capacity);
+                    return node.isDue(occupancy.queued_frames, drain_epoch_) ? &node : nullptr;
+                });
+            if (due_node == nullptr)
+            {
+                break;
+            }
+            due_node->notify(occupancy.queued_frames, occupancy.capacity, drain_epoch_);
+        }
+    }
+
+private:
+    // MARK: Data members:
+
+    common::cavl::Tree<MsgTxCapacityNode> nodes_;
+    std::uint32_t                         drain_epoch_{0};
+
+};  // MsgTxCapacityRegistry
+
+}  // namespace detail
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_MSG_TX_CAPACITY_HPP_INCLUDED
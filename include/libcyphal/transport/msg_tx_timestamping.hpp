@@ -0,0 +1,201 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_MSG_TX_TIMESTAMPING_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_MSG_TX_TIMESTAMPING_HPP_INCLUDED
+
+#include "msg_sessions.hpp"
+#include "types.hpp"
+
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines a node of a message TX session which wants to be notified about TX timestamps of its transfers.
+///
+/// The node is owned by its session, and it's linked to the transport registry
+/// only while the session has a non-empty timestamp callback.
+///
+class MsgTxTimestampingNode final : public common::cavl::Node<MsgTxTimestampingNode>
+{
+public:
+    using Callback = IMessageTxSession::OnTxTimestampCallback;
+
+    explicit MsgTxTimestampingNode(const PortId subject_id)
+        : subject_id_{subject_id}
+    {
+    }
+
+    ~MsgTxTimestampingNode() = default;
+
+    MsgTxTimestampingNode(const MsgTxTimestampingNode&)                = delete;
+    MsgTxTimestampingNode(MsgTxTimestampingNode&&) noexcept            = delete;
+    MsgTxTimestampingNode& operator=(const MsgTxTimestampingNode&)     = delete;
+    MsgTxTimestampingNode& operator=(MsgTxTimestampingNode&&) noexcept = delete;
+
+    CETL_NODISCARD PortId getSubjectId() const noexcept
+    {
+        return subject_id_;
+    }
+
+    CETL_NODISCARD bool isTimestampingLinked() const noexcept
+    {
+        return isLinked();
+    }
+
+    CETL_NODISCARD std::int32_t compareBySubjectId(const PortId subject_id) const noexcept
+    {
+        return static_cast<std::int32_t>(subject_id) - static_cast<std::int32_t>(subject_id_);
+    }
+
+    /// @brief Sets new callback, and returns `true` if the node has to be (re)linked to the registry.
+    ///
+    bool setCallback(Callback::Function&& function) noexcept
+    {
+        callback_      = std::move(function);
+        last_reported_ = cetl::nullopt;
+        return static_cast<bool>(callback_);
+    }
+
+    /// @brief Remembers transfer ID of the latest sent transfer.
+    ///
+    /// Needed to restore full transfer IDs from the truncated ones (like 5-bit CAN transfer IDs).
+    ///
+    void onTransferSent(const TransferId transfer_id) noexcept
+    {
+        last_sent_transfer_id_ = transfer_id;
+    }
+
+    /// @brief Accepts TX timestamp of a transfer from the transport.
+    ///
+    /// Reports of the same transfer (f.e. from redundant media) are delivered to the callback only once.
+    ///
+    /// @param transfer_id Transfer ID of the timestamped transfer. Could be truncated by the `modulo`.
+    /// @param modulo Modulo of the truncated transfer ID. Zero means that the transfer ID is not truncated.
+    /// @param timestamp The transmission timestamp reported by a media.
+    ///
+    void acceptTxTimestamp(const TransferId transfer_id, const TransferId modulo, const TimePoint timestamp)
+    {
+        TransferId full_transfer_id = transfer_id;
+        if (modulo > 0)
+        {
+            // The most recent transfer which has the same (truncated) transfer ID.
+            full_transfer_id = last_sent_transfer_id_ - ((last_sent_transfer_id_ - transfer_id) % modulo);
+        }
+
+        if ((!callback_) || (last_reported_ && (*last_reported_ == full_transfer_id)))
+        {
+            return;
+        }
+        last_reported_ = full_transfer_id;
+
+        callback_(Callback::Arg{full_transfer_id, timestamp});
+    }
+
+private:
+    // MARK: Data members:
+
+    const PortId               subject_id_;
+    Callback::Function         callback_;
+    TransferId                 last_sent_transfer_id_{0};
+    cetl::optional<TransferId> last_reported_;
+
+};  // MsgTxTimestampingNode
+
+/// @brief Defines a transport registry of message TX sessions which want TX timestamps.
+///
+/// Nodes are searched by subject ID when a media reports TX timestamp of a message frame.
+///
+class MsgTxTimestampingRegistry final
+{
+public:
+    MsgTxTimestampingRegistry() = default;
+
+    MsgTxTimestampingRegistry(const MsgTxTimestampingRegistry&)                = delete;
+    MsgTxTimestampingRegistry(MsgTxTimestampingRegistry&&) noexcept            = delete;
+    MsgTxTimestampingRegistry& operator=(const MsgTxTimestampingRegistry&)     = delete;
+    MsgTxTimestampingRegistry& operator=(MsgTxTimestampingRegistry&&) noexcept = delete;
+
+    ~MsgTxTimestampingRegistry()
+    {
+        CETL_DEBUG_ASSERT(nodes_.empty(), "All timestamping nodes must be removed before the registry.");
+    }
+
+    CETL_NODISCARD bool isEmpty() const noexcept
+    {
+        return nodes_.empty();
+    }
+
+    /// @brief Inserts the node into the registry.
+    ///
+    /// Only one node per subject could be registered - if there is already another node for the same subject
+    /// (f.e. from a different TX session of the same subject), the given node stays unlinked.
+    ///
+    void insertNode(MsgTxTimestampingNode& node)
+    {
+        CETL_DEBUG_ASSERT(!node.isTimestampingLinked(), "");
+
+        const auto subject_id    = node.getSubjectId();
+        const auto node_existing = nodes_.search(              //
+            [subject_id](const MsgTxTimestampingNode& other) {  // predicate
+                //
+                return other.compareBySubjectId(subject_id);
+            },
+            [&node]() { return &node; });  // "factory"
+
+        (void) node_existing;
+    }
+
+    void removeNode(MsgTxTimestampingNode& node)
+    {
+        if (node.isTimestampingLinked())
+        {
+            nodes_.remove(&node);
+        }
+    }
+
+    CETL_NODISCARD MsgTxTimestampingNode* findNode(const PortId subject_id)
+    {
+        return nodes_.search([subject_id](const MsgTxTimestampingNode& other) {  // predicate
+            //
+            return other.compareBySubjectId(subject_id);
+        });
+    }
+
+    template <typename Action>
+    void forEachNode(const Action& action)
+    {
+        nodes_.traverseInOrder(action);
+    }
+
+private:
+    // MARK: Data members:
+
+    common::cavl::Tree<MsgTxTimestampingNode> nodes_;
+
+};  // MsgTxTimestampingRegistry
+
+}  // namespace detail
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_MSG_TX_TIMESTAMPING_HPP_INCLUDED
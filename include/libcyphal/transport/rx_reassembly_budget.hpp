@@ -0,0 +1,467 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_RX_REASSEMBLY_BUDGET_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_RX_REASSEMBLY_BUDGET_HPP_INCLUDED
+
+#include "types.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Umbrella type for RX reassembly memory budget entities.
+///
+/// Lizards keep received frames (or their payload buffers) of multi-frame transfers until the whole transfer
+/// is reassembled. Without a limit, a burst of large transfers (f.e. from a misbehaving node) may exhaust
+/// the RX memory, so that unrelated (and more important) traffic starts failing indiscriminately.
+/// With the budget, before a frame is handed over to a message subscription, the transport checks whether
+/// the memory it needs fits, and if not, it aborts in-progress reassemblies of the least important
+/// (by priority) and then the oldest message RX sessions first. Sessions which reassemble more important
+/// transfers than the incoming frame are never aborted - the frame is dropped instead.
+///
+/// Lizards can't abort an individual transfer, so the granularity of an eviction is a whole message RX session
+/// (all its in-progress transfers). Transfer-ID deduplication is preserved across an eviction for up to
+/// `config::Transport::RxReassemblyBudget_DeliveredSourcesCapacity` recently heard sources of the session.
+/// Only memory of message RX sessions is accounted (neither service ones, nor logical nodes).
+///
+struct RxReassemblyBudget
+{
+    /// @brief Defines limits of the budget. Zero means no limit.
+    ///
+    struct Params
+    {
+        /// Max total number of bytes held by all message RX sessions.
+        std::size_t total_bytes;
+
+        /// Max number of bytes held by a single message RX session (aka per subject port).
+        std::size_t per_port_bytes;
+    };
+
+    /// @brief Defines cumulative statistics of the budget enforcement.
+    ///
+    struct Stats
+    {
+        /// Number of times in-progress reassemblies of a session have been aborted.
+        std::uint64_t evictions;
+
+        /// Number of frames dropped b/c they didn't fit into the budget.
+        std::uint64_t dropped_frames;
+    };
+
+};  // RxReassemblyBudget
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+class RxReassemblyLedger;
+
+/// @brief Defines RX reassembly account of a message RX session.
+///
+/// The account is owned by its session, and it's linked to the transport ledger only while the session
+/// holds some reassembly memory (so only such sessions are considered for eviction).
+///
+class RxReassemblyAccount
+{
+public:
+    RxReassemblyAccount(const RxReassemblyAccount&)                = delete;
+    RxReassemblyAccount(RxReassemblyAccount&&) noexcept            = delete;
+    RxReassemblyAccount& operator=(const RxReassemblyAccount&)     = delete;
+    RxReassemblyAccount& operator=(RxReassemblyAccount&&) noexcept = delete;
+
+    /// Number of bytes currently held by reassembly of the session. Zero if nothing is being reassembled.
+    ///
+    CETL_NODISCARD std::size_t getBytes() const noexcept
+    {
+        return bytes_;
+    }
+
+    /// The most important priority among frames adopted since the reassembly has started.
+    ///
+    CETL_NODISCARD Priority getPriority() const noexcept
+    {
+        return priority_;
+    }
+
+    /// The time point when the reassembly has started (aka when `getBytes` became non-zero).
+    ///
+    CETL_NODISCARD TimePoint getSince() const noexcept
+    {
+        return since_;
+    }
+
+    /// @brief Remembers the delivered transfer, so that its duplicates could be rejected after an eviction.
+    ///
+    /// Only the latest transfer per source is remembered, and the least recently heard source is forgotten
+    /// when a new one appears. Anonymous transfers are not remembered (they are never deduplicated).
+    ///
+    void onTransferDelivered(const cetl::optional<NodeId> source_node_id,
+                             const TransferId             transfer_id,
+                             const TimePoint              timestamp) noexcept
+    {
+        if (!source_node_id.has_value())
+        {
+            return;
+        }
+
+        Delivered* slot = &delivered_.front();
+        for (Delivered& delivered : delivered_)
+        {
+            if (delivered.is_valid && (delivered.source_node_id == *source_node_id))
+            {
+                slot = &delivered;
+                break;
+            }
+            if ((!delivered.is_valid) || (slot->is_valid && (delivered.timestamp < slot->timestamp)))
+            {
+                slot = &delivered;
+            }
+        }
+        *slot = Delivered{*source_node_id, transfer_id, timestamp, true};
+    }
+
+    /// @brief Checks whether the transfer is a duplicate, which the lizard couldn't detect b/c of an eviction.
+    ///
+    /// The lizard forgets transfer-ID state of all sources of an evicted session, so within the transfer-ID
+    /// timeout after an eviction the session has to check itself that the transfer was not delivered already.
+    ///
+    CETL_NODISCARD bool isDuplicateAfterEviction(const cetl::optional<NodeId> source_node_id,
+                                                 const TransferId             transfer_id,
+                                                 const TimePoint              timestamp,
+                                                 const Duration               transfer_id_timeout) const noexcept
+    {
+        if ((!source_node_id.has_value()) || (!evicted_at_.has_value()) ||
+            ((timestamp - *evicted_at_) >= transfer_id_timeout))
+        {
+            return false;
+        }
+        for (const Delivered& delivered : delivered_)
+        {
+            if (delivered.is_valid && (delivered.source_node_id == *source_node_id) &&
+                (delivered.transfer_id == transfer_id) && ((timestamp - delivered.timestamp) < transfer_id_timeout))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Aborts all in-progress reassemblies of the session, and releases their memory.
+    ///
+    /// Called by the ledger on eviction. The implementation is expected to release (see `RxReassemblyLedger`)
+    /// all bytes of the account.
+    ///
+    virtual void abortReassemblies() = 0;
+
+protected:
+    RxReassemblyAccount()  = default;
+    ~RxReassemblyAccount() = default;
+
+private:
+    friend class RxReassemblyLedger;
+
+    struct Delivered
+    {
+        NodeId     source_node_id{};
+        TransferId transfer_id{};
+        TimePoint  timestamp{};
+        bool       is_valid{false};
+    };
+
+    // MARK: Data members:
+
+    std::size_t               bytes_{0};
+    Priority                  priority_{Priority::Optional};
+    TimePoint                 since_{};
+    cetl::optional<TimePoint> evicted_at_;
+    RxReassemblyAccount*      prev_{nullptr};
+    RxReassemblyAccount*      next_{nullptr};
+
+    std::array<Delivered, config::Transport::RxReassemblyBudget_DeliveredSourcesCapacity()> delivered_{};
+
+};  // RxReassemblyAccount
+
+/// @brief Defines transport ledger of RX reassembly memory, which enforces the budget.
+///
+/// The total of held bytes is maintained as a running sum, and accounts which hold some bytes are indexed
+/// per priority (the oldest reassembly first), so neither admission nor victim selection scan all sessions.
+///
+class RxReassemblyLedger final
+{
+public:
+    RxReassemblyLedger()  = default;
+    ~RxReassemblyLedger() = default;
+
+    RxReassemblyLedger(const RxReassemblyLedger&)                = delete;
+    RxReassemblyLedger(RxReassemblyLedger&&) noexcept            = delete;
+    RxReassemblyLedger& operator=(const RxReassemblyLedger&)     = delete;
+    RxReassemblyLedger& operator=(RxReassemblyLedger&&) noexcept = delete;
+
+    CETL_NODISCARD bool isEnabled() const noexcept
+    {
+        return params_.has_value();
+    }
+
+    void setParams(const cetl::optional<RxReassemblyBudget::Params>& params) noexcept
+    {
+        params_.reset();
+        if (params.has_value() && ((params->total_bytes > 0) || (params->per_port_bytes > 0)))
+        {
+            params_ = *params;
+        }
+    }
+
+    CETL_NODISCARD RxReassemblyBudget::Stats getStats() const noexcept
+    {
+        return stats_;
+    }
+
+    /// Gets total number of bytes currently held by all accounts.
+    ///
+    CETL_NODISCARD std::size_t getTotalBytes() const noexcept
+    {
+        return total_bytes_;
+    }
+
+    /// @brief Makes room (if needed, and if possible) for the given number of bytes of a frame.
+    ///
+    /// Evicts the account itself if its port budget is exceeded, and then the least important
+    /// (and then the oldest) accounts if the total budget is exceeded - but never accounts
+    /// which reassemble more important transfers than the frame. Frames which can't be admitted are counted
+    /// as dropped, and are not supposed to be handed over to the lizard.
+    ///
+    /// @param account The account of the session which the frame is for.
+    /// @param frame_bytes Number of bytes which the frame will make the account to hold.
+    /// @param frame_priority The priority of the frame.
+    /// @param now The current time (aka reception time of the frame).
+    /// @return `true` if the bytes fit into the budget (possibly after some evictions), or there is no budget.
+    ///
+    bool admit(RxReassemblyAccount& account,
+               const std::size_t    frame_bytes,
+               const Priority       frame_priority,
+               const TimePoint      now)
+    {
+        if ((!params_.has_value()) || (frame_bytes == 0))
+        {
+            return true;
+        }
+        const RxReassemblyBudget::Params params = *params_;
+
+        // 1. The port budget - the only candidate for eviction is the account itself.
+        //
+        if ((params.per_port_bytes > 0) && ((account.bytes_ + frame_bytes) > params.per_port_bytes))
+        {
+            if ((frame_bytes > params.per_port_bytes) || (account.priority_ < frame_priority))
+            {
+                ++stats_.dropped_frames;
+                return false;
+            }
+            evict(account, now);
+        }
+
+        // 2. The total budget - evict the least important (and then the oldest) accounts first.
+        //
+        if (params.total_bytes > 0)
+        {
+            if (frame_bytes > params.total_bytes)
+            {
+                ++stats_.dropped_frames;
+                return false;
+            }
+            while ((total_bytes_ + frame_bytes) > params.total_bytes)
+            {
+                RxReassemblyAccount* const victim = findVictim(frame_priority);
+                if (victim == nullptr)
+                {
+                    ++stats_.dropped_frames;
+                    return false;
+                }
+                evict(*victim, now);
+            }
+        }
+
+        return true;
+    }
+
+    /// Adds bytes (of a frame which is being handed over to the lizard) to the account.
+    ///
+    void adopt(RxReassemblyAccount& account,
+               const std::size_t    bytes,
+               const Priority       priority,
+               const TimePoint      timestamp) noexcept
+    {
+        if (bytes == 0)
+        {
+            return;
+        }
+        total_bytes_ += bytes;
+
+        if (account.bytes_ == 0)
+        {
+            account.bytes_    = bytes;
+            account.priority_ = priority;
+            account.since_    = timestamp;
+            link(account);
+            return;
+        }
+        account.bytes_ += bytes;
+        if (priority < account.priority_)
+        {
+            unlink(account);
+            account.priority_ = priority;
+            link(account);
+        }
+    }
+
+    /// Subtracts bytes (f.e. of a delivered transfer, or of discarded frames) from the account.
+    ///
+    void release(RxReassemblyAccount& account, const std::size_t bytes) noexcept
+    {
+        const std::size_t released = (bytes < account.bytes_) ? bytes : account.bytes_;
+        if (released == 0)
+        {
+            return;
+        }
+        total_bytes_ -= released;
+        account.bytes_ -= released;
+        if (account.bytes_ == 0)
+        {
+            unlink(account);
+        }
+    }
+
+    /// Releases all bytes of the account (f.e. when its session is destroyed).
+    ///
+    void releaseAll(RxReassemblyAccount& account) noexcept
+    {
+        release(account, account.bytes_);
+    }
+
+private:
+    static constexpr std::size_t PrioritiesCount = static_cast<std::size_t>(Priority::Optional) + 1U;
+
+    struct Fifo
+    {
+        RxReassemblyAccount* head{nullptr};
+        RxReassemblyAccount* tail{nullptr};
+    };
+
+    CETL_NODISCARD Fifo& fifoOf(const Priority priority) noexcept
+    {
+        // No lint b/c priority is always in range of the enum.
+        return by_priority_[static_cast<std::size_t>(priority)];  // NOLINT(*-pro-bounds-constant-array-index)
+    }
+
+    /// Links the account to its priority queue - ordered by the reassembly start time.
+    ///
+    /// Normally the account goes to the tail (it has just started a reassembly); only an account which priority
+    /// has been raised may go deeper, so the walk is short.
+    ///
+    void link(RxReassemblyAccount& account) noexcept
+    {
+        Fifo&                fifo = fifoOf(account.priority_);
+        RxReassemblyAccount* prev = fifo.tail;
+        while ((prev != nullptr) && (account.since_ < prev->since_))
+        {
+            prev = prev->prev_;
+        }
+        RxReassemblyAccount* const next = (prev == nullptr) ? fifo.head : prev->next_;
+
+        account.prev_ = prev;
+        account.next_ = next;
+        if (prev == nullptr)
+        {
+            fifo.head = &account;
+        }
+        else
+        {
+            prev->next_ = &account;
+        }
+        if (next == nullptr)
+        {
+            fifo.tail = &account;
+        }
+        else
+        {
+            next->prev_ = &account;
+        }
+    }
+
+    void unlink(RxReassemblyAccount& account) noexcept
+    {
+        Fifo& fifo = fifoOf(account.priority_);
+        if (account.prev_ == nullptr)
+        {
+            fifo.head = account.next_;
+        }
+        else
+        {
+            account.prev_->next_ = account.next_;
+        }
+        if (account.next_ == nullptr)
+        {
+            fifo.tail = account.prev_;
+        }
+        else
+        {
+            account.next_->prev_ = account.prev_;
+        }
+        account.prev_ = nullptr;
+        account.next_ = nullptr;
+    }
+
+    /// Finds the oldest account of the least important priority, which is not more important than the frame.
+    ///
+    CETL_NODISCARD RxReassemblyAccount* findVictim(const Priority frame_priority) const noexcept
+    {
+        for (auto index = by_priority_.size(); index > static_cast<std::size_t>(frame_priority); --index)
+        {
+            // No lint b/c `index` is bound by the array size.
+            if (RxReassemblyAccount* const head = by_priority_[index - 1U].head)  // NOLINT
+            {
+                return head;
+            }
+        }
+        return nullptr;
+    }
+
+    void evict(RxReassemblyAccount& account, const TimePoint now)
+    {
+        ++stats_.evictions;
+        account.evicted_at_ = now;
+        account.abortReassemblies();
+
+        // Whatever is left in the account (normally nothing) is stale by now.
+        releaseAll(account);
+    }
+
+    // MARK: Data members:
+
+    cetl::optional<RxReassemblyBudget::Params> params_;
+    RxReassemblyBudget::Stats                  stats_{};
+    std::size_t                                total_bytes_{0};
+    std::array<Fifo, PrioritiesCount>          by_priority_{};
+
+};  // RxReassemblyLedger
+
+}  // namespace detail
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_RX_REASSEMBLY_BUDGET_HPP_INCLUDED
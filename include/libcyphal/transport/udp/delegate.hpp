@@ -6,7 +6,12 @@
 #ifndef LIBCYPHAL_TRANSPORT_UDP_DELEGATE_HPP_INCLUDED
 #define LIBCYPHAL_TRANSPORT_UDP_DELEGATE_HPP_INCLUDED
 
+#include "libcyphal/common/cavl/cavl.hpp"
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/transport/msg_tx_capacity.hpp"
+#include "libcyphal/transport/msg_tx_timestamping.hpp"
+#include "libcyphal/transport/rx_reassembly_budget.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/transport/udp/tx_rx_sockets.hpp"
@@ -21,6 +26,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <utility>
 
 namespace libcyphal
@@ -36,6 +42,8 @@ namespace udp
 namespace detail
 {
 
+class IFrameMonitorRxSessionDelegate;
+
 struct AnyUdpardTxMetadata
 {
     struct Publish
@@ -68,6 +76,57 @@ struct AnyUdpardTxMetadata
 
 };  // AnyUdpardTxMetadata
 
+/// @brief Defines a node of a message TX session in the transport tree of alive message TX sessions.
+///
+/// The tree lets the transport know which subjects are in use by regular message TX sessions
+/// (see `IUdpTransport::sendMessageStream` about possible collisions of transfer ids).
+/// There could be several sessions per subject, so nodes are ordered by subject id first, and then by address.
+///
+class MsgTxSessionNode final : public common::cavl::Node<MsgTxSessionNode>
+{
+public:
+    explicit MsgTxSessionNode(const PortId subject_id) noexcept
+        : subject_id_{subject_id}
+    {
+    }
+
+    ~MsgTxSessionNode() = default;
+
+    MsgTxSessionNode(const MsgTxSessionNode&)                = delete;
+    MsgTxSessionNode(MsgTxSessionNode&&) noexcept            = delete;
+    MsgTxSessionNode& operator=(const MsgTxSessionNode&)     = delete;
+    MsgTxSessionNode& operator=(MsgTxSessionNode&&) noexcept = delete;
+
+    CETL_NODISCARD std::int8_t compareBySubjectId(const PortId subject_id) const noexcept
+    {
+        if (subject_id == subject_id_)
+        {
+            return 0;
+        }
+        return (subject_id > subject_id_) ? +1 : -1;
+    }
+
+    CETL_NODISCARD std::int8_t compareWith(const MsgTxSessionNode& other) const noexcept
+    {
+        const std::int8_t by_subject_id = compareBySubjectId(other.subject_id_);
+        if (by_subject_id != 0)
+        {
+            return by_subject_id;
+        }
+        if (std::less<const MsgTxSessionNode*>{}(this, &other))
+        {
+            return +1;
+        }
+        return (this == &other) ? 0 : -1;
+    }
+
+private:
+    // MARK: Data members:
+
+    const PortId subject_id_;
+
+};  // MsgTxSessionNode
+
 /// This internal transport delegate class serves the following purposes:
 /// 1. It provides memory management functions for the Udpard library.
 /// 2. It provides a way to convert Udpard error codes to `AnyFailure` type.
@@ -192,7 +251,37 @@ public:
             PortId service_id;
         };
 
-        using Variant = cetl::variant<MsgDestroyed, SvcRequestDestroyed, SvcResponseDestroyed>;
+        struct MsgTxTimestamping
+        {
+            transport::detail::MsgTxTimestampingNode& node;
+            bool                                      is_added;
+        };
+
+        struct FrameMonitorRxLifetime
+        {
+            IFrameMonitorRxSessionDelegate& delegate;
+            bool                       is_added;
+        };
+
+        struct MsgTxCapacity
+        {
+            transport::detail::MsgTxCapacityNode& node;
+            bool                                  is_added;
+        };
+
+        struct MsgTxLifetime
+        {
+            MsgTxSessionNode& node;
+            bool              is_added;
+        };
+
+        using Variant = cetl::variant<MsgDestroyed,
+                                      SvcRequestDestroyed,
+                                      SvcResponseDestroyed,
+                                      MsgTxTimestamping,
+                                      FrameMonitorRxLifetime,
+                                      MsgTxCapacity,
+                                      MsgTxLifetime>;
 
     };  // SessionEvent
 
@@ -253,6 +342,44 @@ public:
         return {memoryResources().session, memoryResources().fragment, memoryResources().payload};
     }
 
+    /// Makes RX memory resources where discarded payload buffers are freed via the given memory resource.
+    ///
+    /// In use by message RX sessions to account payload buffers held by their subscriptions
+    /// (see `IUdpTransport::RxReassemblyBudget`). The given resource must forward to `getPayloadMemory`.
+    ///
+    CETL_NODISCARD UdpardRxMemoryResources makeUdpardRxMemoryResources(cetl::pmr::memory_resource& payload) const
+    {
+        return {memoryResources().session,
+                memoryResources().fragment,
+                makeUdpardMemoryDeleter(&payload, memoryResources().general)};
+    }
+
+    /// Gets memory resource of RX payload buffers (aka the "payload" one).
+    ///
+    CETL_NODISCARD cetl::pmr::memory_resource& getPayloadMemory() const noexcept
+    {
+        // No Sonar `cpp:S5357` b/c the raw `user_reference` is part of libudpard api,
+        // and it was set by us at `makeUdpardMemoryDeleter` call.
+        auto* const mr =
+            static_cast<cetl::pmr::memory_resource*>(memoryResources().payload.user_reference);  // NOSONAR cpp:S5357
+        CETL_DEBUG_ASSERT(mr != nullptr, "Memory resource should not be null.");
+        return *mr;
+    }
+
+    /// Gets ledger of payload bytes held by RX reassembly of message RX sessions.
+    ///
+    /// Maintained by the sessions themselves (see `IUdpTransport::RxReassemblyBudget`),
+    /// so that the transport could enforce the budget without iterating all sessions per each received frame.
+    ///
+    CETL_NODISCARD transport::detail::RxReassemblyLedger& rxReassemblyLedger() noexcept
+    {
+        return rx_reassembly_ledger_;
+    }
+    CETL_NODISCARD const transport::detail::RxReassemblyLedger& rxReassemblyLedger() const noexcept
+    {
+        return rx_reassembly_ledger_;
+    }
+
     /// Pops and frees Udpard TX queue item(s).
     ///
     /// @param tx_queue The TX queue from which the item should be popped.
@@ -383,9 +510,10 @@ private:
 
     // MARK: Data members:
 
-    UdpardNodeID          udpard_node_id_;
-    const MemoryResources memory_resources_;
-    UdpardRxRPCDispatcher rpc_dispatcher_;
+    UdpardNodeID                          udpard_node_id_;
+    const MemoryResources                 memory_resources_;
+    UdpardRxRPCDispatcher                 rpc_dispatcher_;
+    transport::detail::RxReassemblyLedger rx_reassembly_ledger_;
 
 };  // TransportDelegate
 
@@ -429,12 +557,73 @@ public:
 
     CETL_NODISCARD virtual UdpardRxSubscription& getSubscription() = 0;
 
+    /// @brief Gets account of payload bytes held by the session subscription (see `rxReassemblyLedger`).
+    ///
+    CETL_NODISCARD virtual transport::detail::RxReassemblyAccount& getRxReassemblyAccount() noexcept = 0;
+
 protected:
     IMsgRxSessionDelegate()  = default;
     ~IMsgRxSessionDelegate() = default;
 
 };  // IMsgRxSessionDelegate
 
+/// This internal session delegate class serves the following purpose:
+/// it provides an interface (aka gateway) to access Message Stream RX session from transport.
+///
+/// In contrast to `IMsgRxSessionDelegate`, there is no Udpard subscription behind such session -
+/// raw datagrams are passed to the session as is, and the session parses them by itself.
+///
+class IMsgStreamRxSessionDelegate
+{
+public:
+    IMsgStreamRxSessionDelegate(const IMsgStreamRxSessionDelegate&)                = delete;
+    IMsgStreamRxSessionDelegate(IMsgStreamRxSessionDelegate&&) noexcept            = delete;
+    IMsgStreamRxSessionDelegate& operator=(const IMsgStreamRxSessionDelegate&)     = delete;
+    IMsgStreamRxSessionDelegate& operator=(IMsgStreamRxSessionDelegate&&) noexcept = delete;
+
+    /// @brief Gets the subject ID of the session.
+    ///
+    CETL_NODISCARD virtual PortId getSubjectId() const noexcept = 0;
+
+    /// @brief Accepts a datagram received by the transport from the subject multicast group.
+    ///
+    /// @param timestamp The time point when the datagram was received by the media RX socket.
+    /// @param datagram The raw datagram (header and payload). It's valid only during this call.
+    ///
+    virtual void acceptRxDatagram(const TimePoint timestamp, const cetl::span<const cetl::byte> datagram) = 0;
+
+protected:
+    IMsgStreamRxSessionDelegate()  = default;
+    ~IMsgStreamRxSessionDelegate() = default;
+
+};  // IMsgStreamRxSessionDelegate
+
+/// This internal session delegate class serves the following purpose: it provides an interface (aka gateway)
+/// to access frame monitor RX session from transport
+/// (which parses all datagrams of the frame monitor sockets for the session).
+///
+class IFrameMonitorRxSessionDelegate
+{
+public:
+    IFrameMonitorRxSessionDelegate(const IFrameMonitorRxSessionDelegate&)                = delete;
+    IFrameMonitorRxSessionDelegate(IFrameMonitorRxSessionDelegate&&) noexcept            = delete;
+    IFrameMonitorRxSessionDelegate& operator=(const IFrameMonitorRxSessionDelegate&)     = delete;
+    IFrameMonitorRxSessionDelegate& operator=(IFrameMonitorRxSessionDelegate&&) noexcept = delete;
+
+    /// @brief Gets the parameters of the session (in use to make media frame monitor RX sockets).
+    ///
+    CETL_NODISCARD virtual FrameMonitorRxParams getFrameMonitorParams() const noexcept = 0;
+
+    /// @brief Accepts a received frame from the transport (any frame, including not monitored ones).
+    ///
+    virtual void acceptRxFrame(const FrameMonitorRxMetadata& metadata, const cetl::span<const cetl::byte> payload) = 0;
+
+protected:
+    IFrameMonitorRxSessionDelegate()  = default;
+    ~IFrameMonitorRxSessionDelegate() = default;
+
+};  // IFrameMonitorRxSessionDelegate
+
 }  // namespace detail
 }  // namespace udp
 }  // namespace transport
@@ -0,0 +1,493 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_FAULT_INJECTION_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_FAULT_INJECTION_MEDIA_HPP_INCLUDED
+
+#include "frame_codec.hpp"
+#include "media.hpp"
+#include "tx_rx_sockets.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/fault_injection.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <udpard.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// Internal implementation details of the UDP transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// Parses frame transport metadata from the Cyphal/UDP frame header.
+///
+/// @return `nullopt` if the datagram is not a valid Cyphal/UDP frame.
+///
+CETL_NODISCARD inline cetl::optional<FaultFrameInfo> makeFaultFrameInfo(const bool                         is_tx,
+                                                                        const cetl::span<const cetl::byte> datagram)
+{
+    const auto header = FrameCodec::deserializeHeader(datagram);
+    if (!header.has_value())
+    {
+        return cetl::nullopt;
+    }
+
+    return FaultFrameInfo{is_tx, header->isService(), header->getPortId(), static_cast<Priority>(header->priority)};
+}
+
+/// @brief Defines a TX socket decorator which injects faults into the sent datagrams.
+///
+class FaultInjectionTxSocket final : public ITxSocket
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<ITxSocket, FaultInjectionTxSocket>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static UniquePtr<ITxSocket> make(cetl::pmr::memory_resource&       memory,
+                                                    IExecutor&                        executor,
+                                                    transport::detail::FaultInjector& injector,
+                                                    UniquePtr<ITxSocket>&&            socket)
+    {
+        return libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, executor, injector, std::move(socket));
+    }
+
+    FaultInjectionTxSocket(const Spec,
+                           IExecutor&                        executor,
+                           transport::detail::FaultInjector& injector,
+                           UniquePtr<ITxSocket>&&            socket)
+        : executor_{executor}
+        , injector_{injector}
+        , socket_{std::move(socket)}
+        , notifier_{executor}
+    {
+    }
+
+    FaultInjectionTxSocket(const FaultInjectionTxSocket&)                = delete;
+    FaultInjectionTxSocket(FaultInjectionTxSocket&&) noexcept            = delete;
+    FaultInjectionTxSocket& operator=(const FaultInjectionTxSocket&)     = delete;
+    FaultInjectionTxSocket& operator=(FaultInjectionTxSocket&&) noexcept = delete;
+
+    ~FaultInjectionTxSocket() = default;
+
+private:
+    using FaultInjector = transport::detail::FaultInjector;
+
+    // MARK: ITxSocket
+
+    CETL_NODISCARD std::size_t getMtu() const noexcept override
+    {
+        return socket_->getMtu();
+    }
+
+    SendResult::Type send(const TimePoint        deadline,
+                          const IpEndpoint       multicast_endpoint,
+                          const std::uint8_t     dscp,
+                          const PayloadFragments payload_fragments) override
+    {
+        auto& stats = injector_.stats();
+
+        const auto rates = injector_.ratesOf(makeFrameInfo(payload_fragments));
+        switch (injector_.rollTxFault(rates))
+        {
+        case FaultInjector::TxFault::Busy:
+        {
+            ++stats.tx_busy;
+            notifier_.wakeAt(executor_.now() + injector_.params().tx_busy_duration);
+            return SendResult::Success{false /* is_accepted */};
+        }
+        case FaultInjector::TxFault::Drop:
+        {
+            ++stats.dropped;
+            return SendResult::Success{true /* is_accepted */};
+        }
+        case FaultInjector::TxFault::Duplicate:
+        {
+            auto        result  = socket_->send(deadline, multicast_endpoint, dscp, payload_fragments);
+            const auto* success = cetl::get_if<SendResult::Success>(&result);
+            if ((success != nullptr) && success->is_accepted)
+            {
+                // The fragments are not owned by the socket, so the very same datagram could be sent again.
+                const auto duplicate = socket_->send(deadline, multicast_endpoint, dscp, payload_fragments);
+                if (const auto* const dup_success = cetl::get_if<SendResult::Success>(&duplicate))
+                {
+                    stats.duplicated += dup_success->is_accepted ? 1U : 0U;
+                }
+            }
+            return result;
+        }
+        case FaultInjector::TxFault::None:
+        {
+            break;
+        }
+        }
+
+        return socket_->send(deadline, multicast_endpoint, dscp, payload_fragments);
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+    {
+        return notifier_.registerCallback(std::move(function), [this](IExecutor::Callback::Function&& fn) {
+            //
+            return socket_->registerCallback(std::move(fn));
+        });
+    }
+
+    /// Gathers the frame header (which might be split between fragments), and parses it.
+    ///
+    CETL_NODISCARD static cetl::optional<FaultFrameInfo> makeFrameInfo(const PayloadFragments payload_fragments)
+    {
+        std::array<cetl::byte, FrameCodec::HeaderSize> header{};
+        std::size_t                                    size = 0;
+        for (const auto fragment : payload_fragments)
+        {
+            const std::size_t chunk = std::min(fragment.size(), header.size() - size);
+            (void) std::copy_n(fragment.data(), chunk, header.begin() + static_cast<std::ptrdiff_t>(size));
+            size += chunk;
+        }
+        return makeFaultFrameInfo(true /* is_tx */, {header.data(), size});
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                                executor_;
+    FaultInjector&                            injector_;
+    UniquePtr<ITxSocket>                      socket_;
+    transport::detail::FaultInjectionNotifier notifier_;
+
+};  // FaultInjectionTxSocket
+
+/// @brief Defines an RX socket decorator which injects faults into the received datagrams.
+///
+/// Each RX socket holds its own delayed, reordered and duplicated datagrams.
+///
+class FaultInjectionRxSocket final : public IRxSocket
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IRxSocket, FaultInjectionRxSocket>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static UniquePtr<IRxSocket> make(cetl::pmr::memory_resource&       memory,
+                                                    IExecutor&                        executor,
+                                                    transport::detail::FaultInjector& injector,
+                                                    UniquePtr<IRxSocket>&&            socket)
+    {
+        return libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, memory, executor, injector, std::move(socket));
+    }
+
+    FaultInjectionRxSocket(const Spec,
+                           cetl::pmr::memory_resource&       memory,
+                           IExecutor&                        executor,
+                           transport::detail::FaultInjector& injector,
+                           UniquePtr<IRxSocket>&&            socket)
+        : executor_{executor}
+        , injector_{injector}
+        , socket_{std::move(socket)}
+        , held_datagrams_{memory, injector.params().max_held_frames}
+        , notifier_{executor}
+    {
+    }
+
+    FaultInjectionRxSocket(const FaultInjectionRxSocket&)                = delete;
+    FaultInjectionRxSocket(FaultInjectionRxSocket&&) noexcept            = delete;
+    FaultInjectionRxSocket& operator=(const FaultInjectionRxSocket&)     = delete;
+    FaultInjectionRxSocket& operator=(FaultInjectionRxSocket&&) noexcept = delete;
+
+    ~FaultInjectionRxSocket() = default;
+
+private:
+    using FaultInjector = transport::detail::FaultInjector;
+    using Datagram      = ReceiveResult::Metadata;
+
+    // MARK: IRxSocket
+
+    CETL_NODISCARD ReceiveResult::Type receive() override
+    {
+        const TimePoint now = executor_.now();
+
+        // Held datagrams (which are due already) go first.
+        if (auto held_datagram = held_datagrams_.popDue(now))
+        {
+            scheduleNextRelease();
+
+            held_datagram->timestamp = now;
+            return ReceiveResult::Success{std::move(*held_datagram)};
+        }
+
+        auto        result  = socket_->receive();
+        auto* const success = cetl::get_if<ReceiveResult::Success>(&result);
+        if ((success == nullptr) || !success->has_value())
+        {
+            return result;
+        }
+        auto&                        datagram = **success;
+        const cetl::span<cetl::byte> bytes{datagram.payload_ptr.get(), datagram.payload_ptr.get_deleter().size()};
+
+        auto&      stats = injector_.stats();
+        const auto rates = injector_.ratesOf(makeFaultFrameInfo(false /* is_tx */, bytes));
+        const auto fault = injector_.rollRxFault(rates);
+        if (fault == FaultInjector::RxFault::Drop)
+        {
+            ++stats.dropped;
+            return ReceiveResult::Success{};
+        }
+        // The header is protected by its own CRC (so its corruption is equivalent to a drop),
+        // hence only the frame payload (which is protected by the transfer CRC) is corrupted.
+        if (bytes.size() > FrameCodec::HeaderSize)
+        {
+            (void) injector_.rollCorruption(rates, bytes.subspan(FrameCodec::HeaderSize));
+        }
+
+        switch (fault)
+        {
+        case FaultInjector::RxFault::Duplicate:
+        {
+            auto copy = makeCopyOf(datagram);
+            if (copy.has_value() && held_datagrams_.hold(*copy, now, false /* until_next */))
+            {
+                ++stats.duplicated;
+            }
+            break;
+        }
+        case FaultInjector::RxFault::Delay:
+        {
+            if (held_datagrams_.hold(datagram, now + injector_.randomDelay(), false /* until_next */))
+            {
+                ++stats.delayed;
+                scheduleNextRelease();
+                return ReceiveResult::Success{};
+            }
+            break;
+        }
+        case FaultInjector::RxFault::Reorder:
+        {
+            if (held_datagrams_.hold(datagram, now + injector_.params().max_delay, true /* until_next */))
+            {
+                ++stats.reordered;
+                scheduleNextRelease();
+                return ReceiveResult::Success{};
+            }
+            break;
+        }
+        case FaultInjector::RxFault::Drop:
+        case FaultInjector::RxFault::None:
+        {
+            break;
+        }
+        }
+
+        // This datagram is delivered, so reordered datagrams (if any) could go right after it.
+        held_datagrams_.releaseUntilNext(now);
+        scheduleNextRelease();
+        return result;
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+    {
+        return notifier_.registerCallback(std::move(function), [this](IExecutor::Callback::Function&& fn) {
+            //
+            return socket_->registerCallback(std::move(fn));
+        });
+    }
+
+    /// Makes a copy of the datagram (using the same memory resource as the original one).
+    ///
+    CETL_NODISCARD static cetl::optional<Datagram> makeCopyOf(const Datagram& datagram)
+    {
+        const auto&                       deleter = datagram.payload_ptr.get_deleter();
+        cetl::pmr::memory_resource* const memory  = deleter.resource();
+        if ((memory == nullptr) || (deleter.size() == 0))
+        {
+            return cetl::nullopt;
+        }
+
+        // No Sonar `cpp:S5356` b/c we integrate here with low level PMR management.
+        auto* const buffer = static_cast<cetl::byte*>(memory->allocate(deleter.size()));  // NOSONAR cpp:S5356
+        if (buffer == nullptr)
+        {
+            return cetl::nullopt;
+        }
+        (void) std::memcpy(buffer, datagram.payload_ptr.get(), deleter.size());
+
+        return Datagram{datagram.timestamp, {buffer, PmrRawBytesDeleter{deleter.size(), memory}}};
+    }
+
+    void scheduleNextRelease()
+    {
+        if (const auto release_time = held_datagrams_.nextReleaseTime())
+        {
+            notifier_.wakeAt(*release_time);
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                                   executor_;
+    FaultInjector&                               injector_;
+    UniquePtr<IRxSocket>                         socket_;
+    transport::detail::FaultHeldFrames<Datagram> held_datagrams_;
+    transport::detail::FaultInjectionNotifier    notifier_;
+
+};  // FaultInjectionRxSocket
+
+}  // namespace detail
+
+/// @brief Defines a UDP media decorator which injects faults into the traffic of the decorated media.
+///
+/// Intended for testing of applications (and of the library itself) against lossy and misbehaving networks:
+/// datagram loss, duplication, corruption, delay and reordering of received datagrams, as well as loss, duplication
+/// and TX back-pressure (the socket pretends to be busy) of sent datagrams. Faults are rolled deterministically
+/// from a seeded pseudo-random sequence, with probabilities per port and per priority (see `FaultInjectionParams`),
+/// so the same seed and the same traffic reproduce the same faults.
+///
+/// All sockets made by the decorated media are decorated as well (and share the same pseudo-random sequence).
+/// The decorator could be used with any executor (including `VirtualTimeScheduler` of unit tests) - delayed datagrams
+/// and the end of TX busy periods are signaled to the transport by the executor timer callbacks.
+///
+/// The decorator should outlive the transport which uses it (as any other media).
+///
+class FaultInjectionMedia final : public IMedia
+{
+public:
+    /// @brief Constructs a new fault injecting decorator of the given media.
+    ///
+    /// @param media The decorated media. Must outlive the decorator.
+    /// @param executor The executor in use by the transport. Used for current time, and for delayed notifications.
+    /// @param memory The memory resource for the decorated sockets (and their held datagrams).
+    /// @param params The fault injection parameters.
+    ///
+    FaultInjectionMedia(IMedia&                     media,
+                        IExecutor&                  executor,
+                        cetl::pmr::memory_resource& memory,
+                        FaultInjectionParams        params)
+        : media_{media}
+        , executor_{executor}
+        , memory_{memory}
+        , injector_{std::move(params)}
+    {
+    }
+
+    FaultInjectionMedia(const FaultInjectionMedia&)                = delete;
+    FaultInjectionMedia(FaultInjectionMedia&&) noexcept            = delete;
+    FaultInjectionMedia& operator=(const FaultInjectionMedia&)     = delete;
+    FaultInjectionMedia& operator=(FaultInjectionMedia&&) noexcept = delete;
+
+    ~FaultInjectionMedia() = default;
+
+    /// @brief Gets counters of the faults injected so far (by all sockets of the media).
+    ///
+    CETL_NODISCARD const FaultInjectionStats& getStats() const noexcept
+    {
+        return injector_.stats();
+    }
+
+    // MARK: IMedia
+
+    CETL_NODISCARD MakeTxSocketResult::Type makeTxSocket() override
+    {
+        return decorateTxSocket(media_.makeTxSocket());
+    }
+
+    CETL_NODISCARD MakeTxSocketResult::Type makeBandTxSocket(const TxBandParams& params) override
+    {
+        return decorateTxSocket(media_.makeBandTxSocket(params));
+    }
+
+    CETL_NODISCARD MakeRxSocketResult::Type makeRxSocket(const IpEndpoint& multicast_endpoint) override
+    {
+        return decorateRxSocket(media_.makeRxSocket(multicast_endpoint));
+    }
+
+    CETL_NODISCARD MakeRxSocketResult::Type makeFrameMonitorRxSocket(const FrameMonitorRxParams& params) override
+    {
+        return decorateRxSocket(media_.makeFrameMonitorRxSocket(params));
+    }
+
+    CETL_NODISCARD cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return media_.getTxMemoryResource();
+    }
+
+private:
+    CETL_NODISCARD MakeTxSocketResult::Type decorateTxSocket(MakeTxSocketResult::Type&& maybe_socket)
+    {
+        auto* const socket = cetl::get_if<MakeTxSocketResult::Success>(&maybe_socket);
+        if (socket == nullptr)
+        {
+            return std::move(maybe_socket);
+        }
+
+        auto decorated = detail::FaultInjectionTxSocket::make(memory_, executor_, injector_, std::move(*socket));
+        if (decorated == nullptr)
+        {
+            return MemoryError{};
+        }
+        return decorated;
+    }
+
+    CETL_NODISCARD MakeRxSocketResult::Type decorateRxSocket(MakeRxSocketResult::Type&& maybe_socket)
+    {
+        auto* const socket = cetl::get_if<MakeRxSocketResult::Success>(&maybe_socket);
+        if (socket == nullptr)
+        {
+            return std::move(maybe_socket);
+        }
+
+        auto decorated = detail::FaultInjectionRxSocket::make(memory_, executor_, injector_, std::move(*socket));
+        if (decorated == nullptr)
+        {
+            return MemoryError{};
+        }
+        return decorated;
+    }
+
+    // MARK: Data members:
+
+    IMedia&                          media_;
+    IExecutor&                       executor_;
+    cetl::pmr::memory_resource&      memory_;
+    transport::detail::FaultInjector injector_;
+
+};  // FaultInjectionMedia
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_FAULT_INJECTION_MEDIA_HPP_INCLUDED
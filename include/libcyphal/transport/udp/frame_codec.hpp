@@ -0,0 +1,296 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_FRAME_CODEC_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_FRAME_CODEC_HPP_INCLUDED
+
+#include "tx_rx_sockets.hpp"
+
+#include "libcyphal/transport/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <udpard.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// Internal implementation details of the UDP transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Implements encoding/decoding of Cyphal/UDP frames (see Cyphal/UDP Specification).
+///
+/// In use where the transport builds or parses datagrams by itself (instead of the Udpard library),
+/// namely for streaming of large transfers - Udpard needs the whole transfer payload in memory at once.
+/// Udpard doesn't expose its own header serializer (nor the transfer CRC), so this is the only codec
+/// shared by all such paths, and its output is verified against the Udpard built datagrams by unit tests.
+///
+struct FrameCodec final
+{
+    /// Size of the Cyphal/UDP frame header (which is prepended to each datagram payload).
+    static constexpr std::size_t HeaderSize = 24U;
+
+    /// Size of the transfer CRC (which follows the transfer payload, possibly split between frames).
+    static constexpr std::size_t TransferCrcSize = 4U;
+
+    /// Running CRC of a transfer (see `addTransferCrc`).
+    using TransferCrc = std::uint32_t;
+
+    static constexpr TransferCrc TransferCrcInitial = 0xFFFFFFFFUL;
+    static constexpr TransferCrc TransferCrcXor     = 0xFFFFFFFFUL;
+
+    struct Header
+    {
+        UdpardPriority   priority;
+        UdpardNodeID     source_node_id;
+        UdpardNodeID     destination_node_id;
+        std::uint16_t    data_specifier;
+        UdpardTransferID transfer_id;
+        std::uint32_t    frame_index;
+        bool             end_of_transfer;
+
+        /// Whether the frame belongs to a service transfer (rather than to a message one).
+        ///
+        bool isService() const noexcept
+        {
+            return (data_specifier & ServiceNotMessageBit) != 0U;
+        }
+
+        /// Whether the service frame belongs to a request (rather than to a response).
+        ///
+        bool isRequest() const noexcept
+        {
+            return isService() && ((data_specifier & RequestNotResponseBit) != 0U);
+        }
+
+        /// Gets subject ID (for messages) or service ID (for requests and responses).
+        ///
+        PortId getPortId() const noexcept
+        {
+            return isService() ? static_cast<PortId>(data_specifier & UDPARD_SERVICE_ID_MAX)
+                               : static_cast<PortId>(data_specifier);
+        }
+    };
+
+    /// Serializes the header into the first `HeaderSize` bytes of the given datagram buffer.
+    ///
+    static void serializeHeader(const Header& header, cetl::byte* const datagram)
+    {
+        std::array<std::uint8_t, HeaderSize> buffer{};
+        auto*                                ptr = buffer.data();
+
+        const auto put_le = [&ptr](const std::uint64_t value, const std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                *ptr++ = static_cast<std::uint8_t>((value >> (i * 8U)) & 0xFFU);  // NOLINT
+            }
+        };
+        put_le(HeaderVersion, 1);
+        put_le(static_cast<std::uint64_t>(header.priority), 1);
+        put_le(header.source_node_id, 2);
+        put_le(header.destination_node_id, 2);
+        put_le(header.data_specifier, 2);
+        put_le(header.transfer_id, 8);
+        put_le(header.frame_index | (header.end_of_transfer ? FrameIndexEotMask : 0U), 4);
+        put_le(0, 2);  // User data.
+
+        // Header CRC is in the big endian format.
+        const std::uint16_t header_crc = computeHeaderCrc(buffer.data(), HeaderSize - 2U);
+        *ptr++                         = static_cast<std::uint8_t>(header_crc >> 8U);    // NOLINT
+        *ptr                           = static_cast<std::uint8_t>(header_crc & 0xFFU);  // NOLINT
+
+        // No Sonar `cpp:S5356` b/c we copy raw header bytes into the raw datagram buffer.
+        (void) std::memcpy(datagram, buffer.data(), buffer.size());  // NOSONAR cpp:S5356
+    }
+
+    /// Deserializes and validates the header of the given datagram.
+    ///
+    /// @return The header if the datagram is long enough, and its header has supported version and valid CRC;
+    ///         otherwise `nullopt`.
+    ///
+    CETL_NODISCARD static cetl::optional<Header> deserializeHeader(const cetl::span<const cetl::byte> datagram)
+    {
+        if (datagram.size() < HeaderSize)
+        {
+            return cetl::nullopt;
+        }
+
+        std::array<std::uint8_t, HeaderSize> buffer{};
+        // No Sonar `cpp:S5356` b/c we copy raw datagram bytes into the raw header buffer.
+        (void) std::memcpy(buffer.data(), datagram.data(), buffer.size());  // NOSONAR cpp:S5356
+
+        const auto header_crc = static_cast<std::uint16_t>((buffer[HeaderSize - 2U] << 8U) | buffer[HeaderSize - 1U]);
+        if ((buffer[0] != HeaderVersion) || (computeHeaderCrc(buffer.data(), HeaderSize - 2U) != header_crc))
+        {
+            return cetl::nullopt;
+        }
+
+        const auto* ptr    = buffer.data() + 1;  // NOLINT(*-pointer-arithmetic)
+        const auto  get_le = [&ptr](const std::size_t size) {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                value |= static_cast<std::uint64_t>(*ptr++) << (i * 8U);  // NOLINT
+            }
+            return value;
+        };
+        Header header{};
+        header.priority            = static_cast<UdpardPriority>(get_le(1));
+        header.source_node_id      = static_cast<UdpardNodeID>(get_le(2));
+        header.destination_node_id = static_cast<UdpardNodeID>(get_le(2));
+        header.data_specifier      = static_cast<std::uint16_t>(get_le(2));
+        header.transfer_id         = get_le(8);
+        const auto frame_index_eot = static_cast<std::uint32_t>(get_le(4));
+        header.frame_index         = frame_index_eot & ~FrameIndexEotMask;
+        header.end_of_transfer     = (frame_index_eot & FrameIndexEotMask) != 0U;
+
+        if (static_cast<std::size_t>(header.priority) > UDPARD_PRIORITY_MAX)
+        {
+            return cetl::nullopt;
+        }
+        return header;
+    }
+
+    /// Gets priority of the given datagram without full validation of its header.
+    ///
+    /// Intended for cheap per datagram decisions (f.e. admission to RX reassembly) before the datagram
+    /// is passed to Udpard, which does the validation anyway. Malformed datagrams get the lowest priority.
+    ///
+    CETL_NODISCARD static UdpardPriority peekPriority(const cetl::span<const cetl::byte> datagram) noexcept
+    {
+        const auto priority = (datagram.size() < HeaderSize) ? static_cast<std::uint8_t>(UDPARD_PRIORITY_MAX)
+                                                             : static_cast<std::uint8_t>(datagram[1]);
+        return static_cast<UdpardPriority>((priority > UDPARD_PRIORITY_MAX) ? UDPARD_PRIORITY_MAX : priority);
+    }
+
+    /// Adds data to the running CRC-32C (Castagnoli) of the transfer payload.
+    ///
+    /// Table-driven (byte at a time) b/c streamed transfers could be MB-scale.
+    ///
+    CETL_NODISCARD static std::uint32_t addTransferCrc(std::uint32_t     crc,
+                                                       const cetl::byte* data,
+                                                       const std::size_t size) noexcept
+    {
+        const auto& table = transferCrcTable();
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const auto octet = static_cast<std::uint32_t>(data[i]);  // NOLINT(*-pointer-arithmetic)
+            crc              = (crc >> 8U) ^ table[(crc ^ octet) & 0xFFU];
+        }
+        return crc;
+    }
+
+    /// Whether a single-frame transfer has the transfer CRC as well - it does on UDP.
+    ///
+    CETL_NODISCARD static constexpr bool hasSingleFrameTransferCrc() noexcept
+    {
+        return true;
+    }
+
+    /// Checks the running CRC of a whole transfer, including the transfer CRC itself (before the output XOR).
+    ///
+    CETL_NODISCARD static constexpr bool isTransferCrcResidue(const TransferCrc crc) noexcept
+    {
+        return crc == 0xB798B438UL;
+    }
+
+    /// Makes the multicast group endpoint of the given subject.
+    ///
+    CETL_NODISCARD static IpEndpoint makeSubjectEndpoint(const PortId subject_id) noexcept
+    {
+        // Per Cyphal/UDP Specification, messages are sent to the `239.0.x.x` multicast group of the subject.
+        constexpr std::uint32_t SubjectMulticastPrefix = 0xEF000000UL;
+        constexpr std::uint16_t UdpPort                = 9382U;
+
+        return {SubjectMulticastPrefix | static_cast<std::uint32_t>(subject_id), UdpPort};
+    }
+
+private:
+    static constexpr std::uint8_t  HeaderVersion         = 1U;
+    static constexpr std::uint32_t FrameIndexEotMask     = 0x80000000UL;
+    static constexpr std::uint16_t ServiceNotMessageBit  = 1U << 15U;
+    static constexpr std::uint16_t RequestNotResponseBit = 1U << 14U;
+
+    /// Lookup table of CRC-32C (reflected polynomial 0x82F63B78) - the same one as Udpard uses internally.
+    ///
+    CETL_NODISCARD static const std::array<std::uint32_t, 256>& transferCrcTable() noexcept
+    {
+        static constexpr std::array<std::uint32_t, 256> Table{{
+            0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU,
+            0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU, 0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U,
+            0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+            0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU, 0xBC267848U, 0x4E4DFB4BU,
+            0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU, 0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
+            0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+            0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU, 0x1642AE59U, 0xE4292D5AU,
+            0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU, 0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U,
+            0x417B1DBCU, 0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+            0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
+            0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U, 0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U,
+            0xDBFC821CU, 0x2997011FU, 0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+            0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U,
+            0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U, 0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U,
+            0x7198540DU, 0x83F3D70EU, 0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+            0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U,
+            0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU, 0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U,
+            0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+            0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU, 0xB4091BFFU, 0x466298FCU,
+            0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU, 0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
+            0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+            0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U, 0x0E330A81U, 0xFC588982U,
+            0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU, 0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U,
+            0x38CC2A06U, 0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+            0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
+            0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU, 0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U,
+            0xD3D3E1ABU, 0x21B862A8U, 0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+            0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU,
+            0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU, 0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U,
+            0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+            0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU,
+            0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU, 0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U,
+        }};
+        return Table;
+    }
+
+    /// CRC-16/CCITT-FALSE of the header.
+    ///
+    CETL_NODISCARD static std::uint16_t computeHeaderCrc(const std::uint8_t* data, const std::size_t size)
+    {
+        constexpr std::uint16_t Poly = 0x1021U;
+
+        std::uint16_t crc = 0xFFFFU;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            crc ^= static_cast<std::uint16_t>(data[i] << 8U);  // NOLINT(*-pointer-arithmetic)
+            for (std::uint8_t bit = 0; bit < 8U; ++bit)
+            {
+                crc = ((crc & 0x8000U) != 0U) ? static_cast<std::uint16_t>((crc << 1U) ^ Poly)
+                                              : static_cast<std::uint16_t>(crc << 1U);
+            }
+        }
+        return crc;
+    }
+
+};  // FrameCodec
+
+}  // namespace detail
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_FRAME_CODEC_HPP_INCLUDED
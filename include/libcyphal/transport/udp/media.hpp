@@ -9,10 +9,15 @@
 #include "tx_rx_sockets.hpp"
 
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace libcyphal
 {
 namespace transport
@@ -61,6 +66,47 @@ public:
     virtual MakeTxSocketResult::Type makeTxSocket() = 0;
     ///@}
 
+    /// Defines parameters of a TX socket dedicated to a single priority band.
+    ///
+    /// @see makeBandTxSocket
+    ///
+    struct TxBandParams
+    {
+        /// Index of the band. Zero is the band with the highest priority transfers.
+        std::uint8_t band_index;
+
+        /// Total number of bands per media.
+        std::uint8_t bands_count;
+
+        /// The highest (numerically the lowest) transfer priority served by the band.
+        Priority highest_priority;
+
+        /// The lowest (numerically the highest) transfer priority served by the band.
+        Priority lowest_priority;
+
+        /// Maximum number of datagrams which the socket should let to be outstanding in the OS
+        /// (socket buffer, queuing discipline, NIC queue) at any moment. Zero means "no limit".
+        /// A socket implementation is expected to stop accepting datagrams (`is_accepted == false`)
+        /// until the outstanding datagrams have left the interface.
+        std::size_t max_pending_datagrams;
+    };
+
+    /// Constructs a new TX socket bound to this media, and dedicated to the given priority band.
+    ///
+    /// It's called by the transport layer (per each such media, and per each of its priority bands) instead of
+    /// the `makeTxSocket` method. The very same sharing and failure handling rules (as described for `makeTxSocket`)
+    /// are applied per each band. A media implementation is supposed to configure the socket according to the band,
+    /// f.e. by setting OS level socket priority (like Linux `SO_PRIORITY`), so that datagrams of higher priority
+    /// bands are not blocked behind already accepted datagrams of lower priority bands.
+    ///
+    /// Default implementation ignores the band parameters, and just delegates to the `makeTxSocket` method.
+    ///
+    virtual MakeTxSocketResult::Type makeBandTxSocket(const TxBandParams& params)
+    {
+        (void) params;
+        return makeTxSocket();
+    }
+
     /// Constructs a new RX socket bound to the specified multicast group endpoint.
     ///
     /// It's called by the transport layer (per each such media) on attempt to create a new RX session.
@@ -99,6 +145,24 @@ public:
     virtual MakeRxSocketResult::Type makeRxSocket(const IpEndpoint& multicast_endpoint) = 0;
     ///@}
 
+    /// Constructs a new RX socket which receives datagrams of many multicast groups at once.
+    ///
+    /// It's called by the transport layer (per each such media) on creation of a frame monitor RX session
+    /// (see `IUdpTransport::makeFrameMonitorRxSession`). The socket is expected to be a member of multicast groups
+    /// of all subjects in the `[subject_id_first, subject_id_last]` range, and also of service groups of all nodes
+    /// if `with_services` is set (f.e. by a single socket bound to the Cyphal/UDP port, and joined to the groups).
+    /// Datagrams of non-member groups (if any) are filtered out by the transport, so a media might join
+    /// a wider set of groups if it's cheaper for its platform. The socket is released together with the session.
+    ///
+    /// The same failure handling rules (as described for `makeRxSocket`) are applied.
+    /// Default implementation reports `ArgumentError`, which means that the media doesn't support monitoring.
+    ///
+    virtual MakeRxSocketResult::Type makeFrameMonitorRxSocket(const FrameMonitorRxParams& params)
+    {
+        (void) params;
+        return ArgumentError{};
+    }
+
     /// Gets the memory resource for the TX frame payload buffers.
     ///
     /// The lizard or the client can both allocate and deallocate memory using this memory resource.
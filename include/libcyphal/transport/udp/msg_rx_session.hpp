@@ -12,6 +12,7 @@
 #include "libcyphal/errors.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/rx_reassembly_budget.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
@@ -20,6 +21,7 @@
 #include <udpard.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -38,7 +40,9 @@ namespace detail
 
 /// @brief A class to represent a message subscriber RX session.
 ///
-class MessageRxSession final : private IMsgRxSessionDelegate, public IMessageRxSession
+class MessageRxSession final : private IMsgRxSessionDelegate,
+                               private transport::detail::RxReassemblyAccount,
+                               public IMessageRxSession
 {
     /// @brief Defines private specification for making interface unique ptr.
     ///
@@ -76,12 +80,13 @@ public:
                      RxSessionTreeNode::Message& rx_session_node)
         : delegate_{delegate}
         , params_{params}
+        , reassembly_memory_{delegate.getPayloadMemory(), delegate.rxReassemblyLedger(), *this}
         , subscription_{}
     {
         const std::int8_t result = ::udpardRxSubscriptionInit(&subscription_,
                                                               params.subject_id,
                                                               params.extent_bytes,
-                                                              delegate.makeUdpardRxMemoryResources());
+                                                              delegate.makeUdpardRxMemoryResources(reassembly_memory_));
         (void) result;
         CETL_DEBUG_ASSERT(result == 0, "There is no way currently to get an error here.");
 
@@ -96,6 +101,7 @@ public:
     ~MessageRxSession()
     {
         ::udpardRxSubscriptionFree(&subscription_);
+        delegate_.rxReassemblyLedger().releaseAll(*this);
 
         delegate_.onSessionEvent(TransportDelegate::SessionEvent::MsgDestroyed{params_.subject_id});
     }
@@ -107,6 +113,78 @@ public:
     }
 
 private:
+    /// @brief Accounts payload buffers held by the subscription (see `TransportDelegate::rxReassemblyLedger`).
+    ///
+    /// Udpard hands a received buffer over either back to this memory resource (when the buffer is discarded,
+    /// or the subscription is freed), or to the session as part of a completed transfer.
+    /// The latter buffers are not held by the subscription anymore, so they are released by `acceptRxTransfer`.
+    ///
+    class ReassemblyMemory final : public cetl::pmr::memory_resource
+    {
+    public:
+        ReassemblyMemory(cetl::pmr::memory_resource&            upstream,
+                         transport::detail::RxReassemblyLedger&  ledger,
+                         transport::detail::RxReassemblyAccount& account)
+            : upstream_{upstream}
+            , ledger_{ledger}
+            , account_{account}
+        {
+        }
+
+        ~ReassemblyMemory() override = default;
+
+        ReassemblyMemory(const ReassemblyMemory&)                = delete;
+        ReassemblyMemory(ReassemblyMemory&&) noexcept            = delete;
+        ReassemblyMemory& operator=(const ReassemblyMemory&)     = delete;
+        ReassemblyMemory& operator=(ReassemblyMemory&&) noexcept = delete;
+
+        void release(const std::size_t size) noexcept
+        {
+            ledger_.release(account_, size);
+        }
+
+    private:
+        // MARK: cetl::pmr::memory_resource
+
+        void* do_allocate(std::size_t size_bytes, std::size_t alignment) override
+        {
+            return upstream_.allocate(size_bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, std::size_t size_bytes, std::size_t alignment) override
+        {
+            release(size_bytes);
+            upstream_.deallocate(ptr, size_bytes, alignment);
+        }
+
+        bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+        {
+            return (&rhs == this);
+        }
+
+        // MARK: Data members:
+
+        cetl::pmr::memory_resource&             upstream_;
+        transport::detail::RxReassemblyLedger&  ledger_;
+        transport::detail::RxReassemblyAccount& account_;
+
+    };  // ReassemblyMemory
+
+    void reinitSubscription()
+    {
+        // Libudpard doesn't provide a way to abort an individual transfer (or remote node state),
+        // so we re-initialize the whole subscription (keeping its current transfer-ID timeout).
+        // The subscription is re-initialized in place, so references to it (f.e. from the transport) stay valid.
+        const auto tid_timeout_usec = subscription_.port.transfer_id_timeout_usec;
+        const auto memory_resources = delegate_.makeUdpardRxMemoryResources(reassembly_memory_);
+        ::udpardRxSubscriptionFree(&subscription_);
+        const std::int8_t result =
+            ::udpardRxSubscriptionInit(&subscription_, params_.subject_id, params_.extent_bytes, memory_resources);
+        (void) result;
+        CETL_DEBUG_ASSERT(result == 0, "There is no way currently to get an error here.");
+        subscription_.port.transfer_id_timeout_usec = tid_timeout_usec;
+    }
+
     // MARK: IMessageRxSession
 
     CETL_NODISCARD MessageRxParams getParams() const noexcept override
@@ -154,8 +232,23 @@ private:
                 ? cetl::nullopt
                 : cetl::make_optional<NodeId>(inout_transfer.source_node_id);
 
+        for (const UdpardFragment* frag = &inout_transfer.payload; frag != nullptr; frag = frag->next)
+        {
+            reassembly_memory_.release(frag->origin.size);
+        }
         TransportDelegate::UdpardMemory udpard_memory{delegate_, inout_transfer};
 
+        // Transfer-ID state of the lizard is lost on eviction, so deduplication is done here for a while.
+        if (delegate_.rxReassemblyLedger().isEnabled())
+        {
+            const Duration tid_timeout{std::chrono::microseconds{subscription_.port.transfer_id_timeout_usec}};
+            if (isDuplicateAfterEviction(publisher_node_id, transfer_id, timestamp, tid_timeout))
+            {
+                return;
+            }
+            onTransferDelivered(publisher_node_id, transfer_id, timestamp);
+        }
+
         const MessageRxMetadata meta{{{transfer_id, priority}, timestamp}, publisher_node_id};
         MessageRxTransfer       msg_rx_transfer{meta, ScatteredBuffer{std::move(udpard_memory)}};
         if (on_receive_cb_fn_)
@@ -173,10 +266,23 @@ private:
         return subscription_;
     }
 
+    transport::detail::RxReassemblyAccount& getRxReassemblyAccount() noexcept override
+    {
+        return *this;
+    }
+
+    // MARK: RxReassemblyAccount
+
+    void abortReassemblies() override
+    {
+        reinitSubscription();
+    }
+
     // MARK: Data members:
 
     TransportDelegate&                delegate_;
     const MessageRxParams             params_;
+    ReassemblyMemory                  reassembly_memory_;
     UdpardRxSubscription              subscription_;
     cetl::optional<MessageRxTransfer> last_rx_transfer_;
     OnReceiveCallback::Function       on_receive_cb_fn_;
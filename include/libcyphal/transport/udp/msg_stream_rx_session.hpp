@@ -0,0 +1,387 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_MSG_STREAM_RX_SESSION_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_MSG_STREAM_RX_SESSION_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame_codec.hpp"
+#include "msg_stream_sessions.hpp"
+#include "session_tree.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <udpard.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// Internal implementation details of the UDP transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A class to represent a progressive (aka streaming) message subscriber RX session.
+///
+class MessageStreamRxSession final : private IMsgStreamRxSessionDelegate, public IMessageStreamRxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IMessageStreamRxSession, MessageStreamRxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IMessageStreamRxSession>, AnyFailure> make(
+        cetl::pmr::memory_resource& memory,
+        IExecutor&                  executor,
+        TransportDelegate&          delegate,
+        const MessageRxParams&      params,
+        RxSessionTreeNode::Message& rx_session_node)
+    {
+        if (params.subject_id > UDPARD_SUBJECT_ID_MAX)
+        {
+            return ArgumentError{};
+        }
+
+        auto session =
+            libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, executor, delegate, params, rx_session_node);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    MessageStreamRxSession(const Spec,
+                           IExecutor&                  executor,
+                           TransportDelegate&          delegate,
+                           const MessageRxParams&      params,
+                           RxSessionTreeNode::Message& rx_session_node)
+        : executor_{executor}
+        , delegate_{delegate}
+        , params_{params}
+        , transfer_id_timeout_{std::chrono::microseconds{UDPARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC}}
+    {
+        rx_session_node.streamDelegate() = this;
+    }
+
+    MessageStreamRxSession(const MessageStreamRxSession&)                = delete;
+    MessageStreamRxSession(MessageStreamRxSession&&) noexcept            = delete;
+    MessageStreamRxSession& operator=(const MessageStreamRxSession&)     = delete;
+    MessageStreamRxSession& operator=(MessageStreamRxSession&&) noexcept = delete;
+
+    ~MessageStreamRxSession()
+    {
+        delegate_.onSessionEvent(TransportDelegate::SessionEvent::MsgDestroyed{params_.subject_id});
+    }
+
+private:
+    using Status = OnChunkCallback::Status;
+
+    /// Holds state of the transfer which is currently in progress.
+    ///
+    struct Transfer
+    {
+        MessageRxMetadata metadata;
+        UdpardNodeID      source_node_id;
+        std::uint32_t     next_frame_index;
+        TimePoint         last_frame_timestamp;
+        std::size_t       offset;
+        std::uint32_t     crc;
+
+        /// The last bytes seen so far might be the transfer CRC (if it was the last frame),
+        /// so they are held back until the next frame proves otherwise.
+        std::array<cetl::byte, FrameCodec::TransferCrcSize> held_back;
+        std::size_t                                         held_back_size;
+    };
+
+    /// Identifies the last completed transfer - to drop its duplicates (f.e. from redundant media).
+    ///
+    struct CompletedTransfer
+    {
+        UdpardNodeID     source_node_id;
+        UdpardTransferID transfer_id;
+        TimePoint        timestamp;
+    };
+
+    // MARK: IMessageStreamRxSession
+
+    CETL_NODISCARD MessageRxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    void setOnChunkCallback(OnChunkCallback::Function&& function) override
+    {
+        on_chunk_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IRxSession
+
+    void setTransferIdTimeout(const Duration timeout) override
+    {
+        if (timeout > Duration::zero())
+        {
+            transfer_id_timeout_ = timeout;
+        }
+    }
+
+    // MARK: IMsgStreamRxSessionDelegate
+
+    CETL_NODISCARD PortId getSubjectId() const noexcept override
+    {
+        return params_.subject_id;
+    }
+
+    void acceptRxDatagram(const TimePoint timestamp, const cetl::span<const cetl::byte> datagram) override
+    {
+        const auto opt_header = FrameCodec::deserializeHeader(datagram);
+        if (!opt_header)
+        {
+            return;
+        }
+        const FrameCodec::Header& header = *opt_header;
+        if ((header.data_specifier != params_.subject_id) || (header.destination_node_id != UDPARD_NODE_ID_UNSET))
+        {
+            return;
+        }
+
+        if (transfer_ && ((timestamp - transfer_->last_frame_timestamp) > transfer_id_timeout_))
+        {
+            finishTransfer(Status::Aborted);
+        }
+
+        if (!isAcceptableFrame(header, timestamp))
+        {
+            return;
+        }
+        if (header.frame_index == 0)
+        {
+            startTransfer(header, timestamp);
+        }
+
+        transfer_->next_frame_index++;
+        transfer_->last_frame_timestamp = timestamp;
+        consumeFramePayload(datagram.subspan(FrameCodec::HeaderSize));
+
+        if (!header.end_of_transfer)
+        {
+            scheduleAbortOnTimeout();
+        }
+        else
+        {
+            const bool is_crc_valid = (transfer_->held_back_size == FrameCodec::TransferCrcSize) &&
+                                      ((transfer_->crc ^ FrameCodec::TransferCrcXor) == heldBackAsCrc());
+            if (is_crc_valid)
+            {
+                last_completed_transfer_ = CompletedTransfer{transfer_->source_node_id, header.transfer_id, timestamp};
+            }
+            finishTransfer(is_crc_valid ? Status::Completed : Status::Aborted);
+        }
+    }
+
+    // MARK: Privates:
+
+    /// Decides whether the frame continues (or starts) the transfer of this session.
+    ///
+    /// As a side effect, the current transfer might be aborted - f.e. b/c of a lost frame.
+    ///
+    CETL_NODISCARD bool isAcceptableFrame(const FrameCodec::Header& header, const TimePoint timestamp)
+    {
+        const bool is_same_transfer = transfer_ && (transfer_->source_node_id == header.source_node_id) &&
+                                      (transfer_->metadata.rx_meta.base.transfer_id == header.transfer_id);
+        if (header.frame_index == 0)
+        {
+            if (transfer_)
+            {
+                // A duplicate start frame (f.e. from a redundant media) is dropped, as well as a start frame
+                // from another publisher. But a new transfer from the same publisher means that the current one
+                // has lost its tail, so the current one is aborted in favor of the new one.
+                if (is_same_transfer || (transfer_->source_node_id != header.source_node_id))
+                {
+                    return false;
+                }
+                finishTransfer(Status::Aborted);
+            }
+            return !isDuplicateOfCompleted(header, timestamp);
+        }
+
+        if (!is_same_transfer || (header.frame_index < transfer_->next_frame_index))
+        {
+            // Either not our transfer, or a duplicate of an already consumed frame (f.e. from a redundant media).
+            return false;
+        }
+        if (header.frame_index > transfer_->next_frame_index)
+        {
+            // Some frame is lost (or reordered), and there is no buffering for out-of-order frames.
+            finishTransfer(Status::Aborted);
+            return false;
+        }
+        return true;
+    }
+
+    /// Schedules abortion of the current transfer in case its next frame won't arrive in time.
+    ///
+    /// Otherwise, the transfer would stay in progress until the next frame of the subject arrives
+    /// (which might never happen, f.e. if the publisher has gone). Each frame reschedules the abortion,
+    /// so the callback finds the transfer still in progress only if it has really timed out.
+    ///
+    void scheduleAbortOnTimeout()
+    {
+        if (!abort_callback_)
+        {
+            abort_callback_ = executor_.registerCallback([this](const auto&) {
+                //
+                if (transfer_)
+                {
+                    finishTransfer(Status::Aborted);
+                }
+            });
+        }
+
+        const bool result =
+            abort_callback_.schedule(IExecutor::Callback::Schedule::Once{executor_.now() + transfer_id_timeout_});
+        (void) result;
+        CETL_DEBUG_ASSERT(result, "Unexpected failure to schedule stream transfer abortion.");
+    }
+
+    CETL_NODISCARD bool isDuplicateOfCompleted(const FrameCodec::Header& header, const TimePoint timestamp) const
+    {
+        return last_completed_transfer_ && (last_completed_transfer_->source_node_id == header.source_node_id) &&
+               (last_completed_transfer_->transfer_id == header.transfer_id) &&
+               ((timestamp - last_completed_transfer_->timestamp) <= transfer_id_timeout_);
+    }
+
+    void startTransfer(const FrameCodec::Header& header, const TimePoint timestamp)
+    {
+        const cetl::optional<NodeId> publisher_node_id =
+            header.source_node_id > UDPARD_NODE_ID_MAX ? cetl::nullopt
+                                                       : cetl::make_optional<NodeId>(header.source_node_id);
+
+        const MessageRxMetadata meta{{{header.transfer_id, static_cast<Priority>(header.priority)}, timestamp},
+                                     publisher_node_id};
+        (void) transfer_.emplace(Transfer{meta,
+                                          header.source_node_id,
+                                          0,  // next frame index
+                                          timestamp,
+                                          0,  // offset
+                                          FrameCodec::TransferCrcInitial,
+                                          {},
+                                          0});
+    }
+
+    /// Delivers all but the last `TransferCrcSize` bytes (seen so far) of the transfer.
+    ///
+    void consumeFramePayload(const cetl::span<const cetl::byte> frame_payload)
+    {
+        Transfer& transfer = *transfer_;
+
+        const std::size_t total_size   = transfer.held_back_size + frame_payload.size();
+        const std::size_t deliver_size =
+            (total_size > FrameCodec::TransferCrcSize) ? (total_size - FrameCodec::TransferCrcSize) : 0U;
+
+        const std::size_t from_held_back = std::min(transfer.held_back_size, deliver_size);
+        const std::size_t from_frame     = deliver_size - from_held_back;
+        deliverChunk({transfer.held_back.data(), from_held_back});
+        deliverChunk(frame_payload.first(from_frame));
+
+        std::array<cetl::byte, FrameCodec::TransferCrcSize> new_held_back{};
+        auto new_end = std::copy(transfer.held_back.cbegin() + from_held_back,
+                                 transfer.held_back.cbegin() + transfer.held_back_size,
+                                 new_held_back.begin());
+        new_end      = std::copy(frame_payload.begin() + from_frame, frame_payload.end(), new_end);
+
+        transfer.held_back      = new_held_back;
+        transfer.held_back_size = static_cast<std::size_t>(new_end - new_held_back.begin());
+    }
+
+    void deliverChunk(const cetl::span<const cetl::byte> chunk)
+    {
+        if (chunk.empty())
+        {
+            return;
+        }
+
+        Transfer& transfer = *transfer_;
+        transfer.crc       = FrameCodec::addTransferCrc(transfer.crc, chunk.data(), chunk.size());
+
+        // Payload beyond the extent is not delivered (but still counted by CRC).
+        if ((transfer.offset < params_.extent_bytes) && on_chunk_cb_fn_)
+        {
+            const auto in_extent = chunk.first(std::min(chunk.size(), params_.extent_bytes - transfer.offset));
+            on_chunk_cb_fn_(OnChunkCallback::Arg{transfer.metadata, Status::InProgress, transfer.offset, in_extent});
+        }
+        transfer.offset += chunk.size();
+    }
+
+    CETL_NODISCARD std::uint32_t heldBackAsCrc() const
+    {
+        std::uint32_t crc = 0;
+        for (std::size_t i = 0; i < FrameCodec::TransferCrcSize; ++i)
+        {
+            // No lint b/c `i` is bound by the array size.
+            crc |= static_cast<std::uint32_t>(transfer_->held_back[i]) << (i * 8U);  // NOLINT
+        }
+        return crc;
+    }
+
+    void finishTransfer(const Status status)
+    {
+        CETL_DEBUG_ASSERT(transfer_, "");
+
+        const Transfer transfer = *transfer_;
+        transfer_.reset();
+
+        if (on_chunk_cb_fn_)
+        {
+            const std::size_t delivered_size = std::min(transfer.offset, params_.extent_bytes);
+            on_chunk_cb_fn_(OnChunkCallback::Arg{transfer.metadata, status, delivered_size, {}});
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                        executor_;
+    TransportDelegate&                delegate_;
+    const MessageRxParams             params_;
+    Duration                          transfer_id_timeout_;
+    cetl::optional<Transfer>          transfer_;
+    cetl::optional<CompletedTransfer> last_completed_transfer_;
+    OnChunkCallback::Function         on_chunk_cb_fn_;
+    IExecutor::Callback::Any          abort_callback_;
+
+};  // MessageStreamRxSession
+
+}  // namespace detail
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_MSG_STREAM_RX_SESSION_HPP_INCLUDED
@@ -0,0 +1,120 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_MSG_STREAM_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_MSG_STREAM_SESSIONS_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/session.hpp"
+#include "libcyphal/transport/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// @brief Defines an abstract interface of a UDP transport receive session for progressive message reception.
+///
+/// In contrast to `IMessageRxSession`, a transfer is not reassembled in memory. Instead, its payload is handed
+/// to the user in order, chunk by chunk, as soon as datagrams arrive - so that a consumer of very large transfers
+/// could start processing (f.e. decode incrementally or stream to a file) before the whole transfer has arrived.
+/// Only a few datagrams are held in memory at any moment, regardless of the transfer size.
+///
+/// The session handles one transfer at a time. Frames of other transfers (f.e. from other publishers)
+/// are dropped while a transfer is in progress, unless it's stale for longer than the transfer-ID timeout.
+/// Frames arriving out of order abort the transfer (see `OnChunkCallback::Status::Aborted`), as well as
+/// no next frame within the transfer-ID timeout (from the executor, even if no more frames of the subject arrive).
+///
+/// Use UDP transport's `makeMessageStreamRxSession` factory function to create an instance of this interface.
+///
+/// @see IRxSession, ISession
+///
+class IMessageStreamRxSession : public IRxSession
+{
+public:
+    IMessageStreamRxSession(const IMessageStreamRxSession&)                = delete;
+    IMessageStreamRxSession(IMessageStreamRxSession&&) noexcept            = delete;
+    IMessageStreamRxSession& operator=(const IMessageStreamRxSession&)     = delete;
+    IMessageStreamRxSession& operator=(IMessageStreamRxSession&&) noexcept = delete;
+
+    /// @brief Returns the parameters of the message reception session.
+    ///
+    /// Note that payload beyond `extent_bytes` is not delivered, but still taken into account for the transfer CRC.
+    ///
+    virtual MessageRxParams getParams() const noexcept = 0;
+
+    /// @brief Umbrella type for chunk reception callback entities.
+    ///
+    struct OnChunkCallback
+    {
+        /// @brief Defines status of a transfer, which is reported together with a chunk.
+        ///
+        enum class Status : std::uint8_t
+        {
+            /// The chunk is the next in-order piece of the transfer payload, and more chunks are expected.
+            InProgress,
+
+            /// The transfer is complete, and its CRC is valid. The `chunk` is empty.
+            Completed,
+
+            /// The transfer is aborted (f.e. b/c of a lost frame, transfer-ID timeout or invalid CRC).
+            /// All already delivered chunks of the transfer should be discarded. The `chunk` is empty.
+            Aborted,
+        };
+
+        /// @brief Defines standard arguments for chunk reception callback.
+        ///
+        struct Arg
+        {
+            /// Metadata of the transfer. It's the same for all chunks of the transfer.
+            const MessageRxMetadata& metadata;
+
+            /// Status of the transfer.
+            Status status;
+
+            /// Offset of the chunk within the transfer payload.
+            /// For the final (`Completed` or `Aborted`) call it's the total size of the delivered payload.
+            std::size_t offset;
+
+            /// The chunk of payload. It's valid only during the callback call.
+            cetl::span<const cetl::byte> chunk;
+        };
+
+        /// @brief Defines signature of the chunk reception callback function.
+        ///
+        static constexpr std::size_t FunctionMaxSize =
+            config::Transport::Udp::IMessageStreamRxSession_OnChunkCallback_FunctionMaxSize();
+        using Function = cetl::pmr::function<void(const Arg&), FunctionMaxSize>;
+
+    };  // OnChunkCallback
+
+    /// @brief Sets the chunk reception callback.
+    ///
+    /// @param function The callback function, which will be called on each chunk reception,
+    ///                 and once more at the end of each transfer (with the final status).
+    ///
+    virtual void setOnChunkCallback(OnChunkCallback::Function&& function) = 0;
+
+protected:
+    IMessageStreamRxSession()  = default;
+    ~IMessageStreamRxSession() = default;
+
+};  // IMessageStreamRxSession
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_MSG_STREAM_SESSIONS_HPP_INCLUDED
@@ -106,9 +106,9 @@ public:
     }
 
     template <typename Action>
-    CETL_NODISCARD cetl::optional<AnyFailure> forEachNode(Action&& action)
+    void forEachNode(const Action& action)
     {
-        return nodes_.traverse(std::forward<Action>(action));
+        nodes_.traverseInOrder(action);
     }
 
 private:
@@ -185,6 +185,13 @@ struct RxSessionTreeNode
             return delegate_;
         }
 
+        /// Delegate of a progressive (aka streaming) session. Only one of the delegates could be set at a time.
+        ///
+        CETL_NODISCARD IMsgStreamRxSessionDelegate*& streamDelegate() noexcept
+        {
+            return stream_delegate_;
+        }
+
         CETL_NODISCARD SocketState<IRxSocket>& socketState(const std::uint8_t media_index) noexcept
         {
             CETL_DEBUG_ASSERT(media_index < socket_states_.size(), "");
@@ -197,6 +204,7 @@ struct RxSessionTreeNode
         // MARK: Data members:
 
         IMsgRxSessionDelegate*                                                 delegate_{nullptr};
+        IMsgStreamRxSessionDelegate*                                           stream_delegate_{nullptr};
         std::array<SocketState<IRxSocket>, UDPARD_NETWORK_INTERFACE_COUNT_MAX> socket_states_;
 
     };  // Message
@@ -0,0 +1,65 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_TX_PAYLOAD_SOURCE_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_TX_PAYLOAD_SOURCE_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <cstddef>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// @brief Defines interface of a payload source, which is pulled lazily by the transport (aka streaming TX).
+///
+/// In contrast to the regular `send` of a TX session, the transport neither copies nor fragments
+/// the whole payload at once. Instead, it reads just enough of the payload to build the next datagram,
+/// and only when the media TX socket is ready to accept it. As a result, TX memory is bounded
+/// by a single datagram per transfer, regardless of the total payload size.
+///
+/// The source instance is owned by the transport until the transfer is either completely sent
+/// to all redundant media, or expired (by its deadline), or the transport itself is destroyed.
+///
+class ITxPayloadSource
+{
+public:
+    ITxPayloadSource(const ITxPayloadSource&)                = delete;
+    ITxPayloadSource(ITxPayloadSource&&) noexcept            = delete;
+    ITxPayloadSource& operator=(const ITxPayloadSource&)     = delete;
+    ITxPayloadSource& operator=(ITxPayloadSource&&) noexcept = delete;
+
+    /// Gets total size (in bytes) of the payload. Must not change during the transfer.
+    ///
+    virtual std::size_t size() const noexcept = 0;
+
+    /// Reads a chunk of the payload.
+    ///
+    /// For each media the payload is read sequentially, but in case of redundant media
+    /// the same chunk might be read multiple times (once per media, and maybe again after a "not ready" socket).
+    ///
+    /// @param offset Offset (in bytes) of the chunk from the beginning of the payload.
+    /// @param destination The buffer to read the chunk into. Never goes beyond the payload `size`.
+    /// @return Number of bytes actually read. Anything less than the `destination` size is considered
+    ///         as a failure, and the transfer will be dropped (for the media which has requested this chunk).
+    ///
+    virtual std::size_t read(const std::size_t offset, const cetl::span<cetl::byte> destination) = 0;
+
+protected:
+    ITxPayloadSource()  = default;
+    ~ITxPayloadSource() = default;
+
+};  // ITxPayloadSource
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_TX_PAYLOAD_SOURCE_HPP_INCLUDED
@@ -83,6 +83,11 @@ public:
         struct Success
         {
             bool is_accepted;
+
+            /// Time when the accepted datagram has actually left the interface (if the socket could tell).
+            /// Used by the transport to report TX timestamps of messages
+            /// (see `IMessageTxSession::setOnTxTimestampCallback`).
+            cetl::optional<TimePoint> tx_timestamp{};
         };
         using Failure = cetl::variant<PlatformError, ArgumentError>;
 
@@ -0,0 +1,362 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_TX_STREAM_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_TX_STREAM_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame_codec.hpp"
+#include "tx_payload_source.hpp"
+#include "tx_rx_sockets.hpp"
+
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <udpard.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// Internal implementation details of the UDP transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Represents a single message transfer, which is being streamed lazily to all redundant media.
+///
+/// Datagrams are built here (instead of the Udpard library) b/c Udpard fragments the whole payload at once.
+/// The layout of the datagrams is the same as the Udpard one (see Cyphal/UDP Specification).
+///
+class TxStream final
+{
+public:
+    TxStream(cetl::pmr::memory_resource&         memory,
+             UniquePtr<ITxPayloadSource>         source,
+             const AnyUdpardTxMetadata::Publish& tx_metadata,
+             const UdpardNodeID                  local_node_id,
+             const std::size_t                   media_count)
+        : memory_{memory}
+        , source_{std::move(source)}
+        , tx_metadata_{tx_metadata}
+        , local_node_id_{local_node_id}
+        , payload_size_{source_->size()}
+    {
+        CETL_DEBUG_ASSERT(media_count <= cursors_.size(), "");
+
+        for (std::size_t media_index = 0; media_index < cursors_.size(); ++media_index)
+        {
+            // No lint b/c `media_index` is bound by the array size.
+            cursors_[media_index].is_done = media_index >= media_count;  // NOLINT
+        }
+    }
+
+    TxStream(const TxStream&)                = delete;
+    TxStream(TxStream&&) noexcept            = delete;
+    TxStream& operator=(const TxStream&)     = delete;
+    TxStream& operator=(TxStream&&) noexcept = delete;
+
+    ~TxStream() = default;
+
+    CETL_NODISCARD UdpardPriority priority() const noexcept
+    {
+        return tx_metadata_.priority;
+    }
+
+    CETL_NODISCARD TimePoint deadline() const noexcept
+    {
+        return TimePoint{std::chrono::microseconds{tx_metadata_.deadline_us}};
+    }
+
+    CETL_NODISCARD PortId subjectId() const noexcept
+    {
+        return tx_metadata_.subject_id;
+    }
+
+    CETL_NODISCARD IpEndpoint endpoint() const noexcept
+    {
+        return FrameCodec::makeSubjectEndpoint(tx_metadata_.subject_id);
+    }
+
+    CETL_NODISCARD bool isDoneFor(const std::uint8_t media_index) const noexcept
+    {
+        return cursorOf(media_index).is_done;
+    }
+
+    CETL_NODISCARD bool isDone() const noexcept
+    {
+        return std::all_of(cursors_.cbegin(), cursors_.cend(), [](const Cursor& cursor) { return cursor.is_done; });
+    }
+
+    void finishFor(const std::uint8_t media_index) noexcept
+    {
+        cursorOf(media_index).is_done = true;
+    }
+
+    /// Builds the next datagram (header + chunk of the payload and/or transfer CRC) for the given media.
+    ///
+    /// The media cursor is not advanced until `commitFor` is called (f.e. when the datagram is accepted by socket).
+    ///
+    /// @return Span of the built datagram, or empty span in case of a failure (out of memory or payload read).
+    ///
+    CETL_NODISCARD cetl::span<const cetl::byte> buildNextDatagramFor(const std::uint8_t media_index,
+                                                                     const std::size_t  mtu)
+    {
+        Cursor& cursor = cursorOf(media_index);
+        CETL_DEBUG_ASSERT(!cursor.is_done, "");
+
+        const std::size_t total_size = payload_size_ + FrameCodec::TransferCrcSize;
+        const std::size_t chunk_size = std::min(total_size - cursor.offset, std::max<std::size_t>(mtu, 1U));
+        if (!ensureBufferOf(FrameCodec::HeaderSize + chunk_size))
+        {
+            return {};
+        }
+        cetl::byte* const datagram = buffer_.get();
+
+        // Payload part of the chunk (if any), followed by transfer CRC part (if any).
+        //
+        cursor.pending_offset = cursor.offset;
+        cursor.pending_crc    = cursor.crc;
+        cetl::byte* chunk_ptr = datagram + FrameCodec::HeaderSize;  // NOLINT(*-pointer-arithmetic)
+        if (cursor.pending_offset < payload_size_)
+        {
+            const std::size_t payload_part = std::min(chunk_size, payload_size_ - cursor.pending_offset);
+            if (source_->read(cursor.pending_offset, {chunk_ptr, payload_part}) != payload_part)
+            {
+                return {};
+            }
+            cursor.pending_crc = FrameCodec::addTransferCrc(cursor.pending_crc, chunk_ptr, payload_part);
+            cursor.pending_offset += payload_part;
+            chunk_ptr += payload_part;  // NOLINT(*-pointer-arithmetic)
+        }
+        while (chunk_ptr != (datagram + FrameCodec::HeaderSize + chunk_size))  // NOLINT(*-pointer-arithmetic)
+        {
+            const std::size_t   crc_byte_index = cursor.pending_offset - payload_size_;
+            const std::uint32_t transfer_crc   = cursor.pending_crc ^ FrameCodec::TransferCrcXor;
+            *chunk_ptr++ = static_cast<cetl::byte>((transfer_crc >> (crc_byte_index * 8U)) & 0xFFU);  // NOLINT
+            ++cursor.pending_offset;
+        }
+
+        const bool is_last = cursor.pending_offset == total_size;
+        serializeHeader(datagram, cursor.frame_index, is_last);
+
+        return {datagram, FrameCodec::HeaderSize + chunk_size};
+    }
+
+    /// Advances the media cursor past the datagram which was built by the last `buildNextDatagramFor` call.
+    ///
+    void commitFor(const std::uint8_t media_index) noexcept
+    {
+        Cursor& cursor = cursorOf(media_index);
+        cursor.offset  = cursor.pending_offset;
+        cursor.crc     = cursor.pending_crc;
+        cursor.frame_index++;
+        cursor.is_done = cursor.offset == (payload_size_ + FrameCodec::TransferCrcSize);
+    }
+
+    /// Intrusive links to the previous and next streams of the transport (which owns all its streams).
+    ///
+    CETL_NODISCARD TxStream*& prev() noexcept
+    {
+        return prev_;
+    }
+    CETL_NODISCARD TxStream*& next() noexcept
+    {
+        return next_;
+    }
+
+    /// Intrusive link to the next stream of the same priority in the given media band queue (see `TxStreamQueue`).
+    ///
+    CETL_NODISCARD TxStream*& nextInQueueFor(const std::uint8_t media_index) noexcept
+    {
+        return cursorOf(media_index).next_in_queue;
+    }
+
+private:
+    struct Cursor
+    {
+        std::size_t   offset{0};
+        std::uint32_t crc{FrameCodec::TransferCrcInitial};
+        std::uint32_t frame_index{0};
+        std::size_t   pending_offset{0};
+        std::uint32_t pending_crc{FrameCodec::TransferCrcInitial};
+        bool          is_done{true};
+        TxStream*     next_in_queue{nullptr};
+    };
+
+    CETL_NODISCARD Cursor& cursorOf(const std::uint8_t media_index) noexcept
+    {
+        CETL_DEBUG_ASSERT(media_index < cursors_.size(), "");
+
+        // No lint b/c at transport constructor we made sure that number of media interfaces is bound.
+        return cursors_[media_index];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    CETL_NODISCARD const Cursor& cursorOf(const std::uint8_t media_index) const noexcept
+    {
+        CETL_DEBUG_ASSERT(media_index < cursors_.size(), "");
+
+        // No lint b/c at transport constructor we made sure that number of media interfaces is bound.
+        return cursors_[media_index];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    CETL_NODISCARD bool ensureBufferOf(const std::size_t size)
+    {
+        if (buffer_ && (buffer_.get_deleter().size() >= size))
+        {
+            return true;
+        }
+
+        // No Sonar `cpp:S5356` and `cpp:S5357` b/c we do raw PMR allocation of bytes here.
+        buffer_.reset();
+        buffer_ = std::unique_ptr<cetl::byte, PmrRawBytesDeleter>{
+            static_cast<cetl::byte*>(memory_.allocate(size)),  // NOSONAR cpp:S5356 cpp:S5357
+            {size, &memory_}};
+        return buffer_ != nullptr;
+    }
+
+    void serializeHeader(cetl::byte* const datagram, const std::uint32_t frame_index, const bool is_last) const
+    {
+        const FrameCodec::Header header{tx_metadata_.priority,
+                                        local_node_id_,
+                                        UDPARD_NODE_ID_UNSET,  // Destination - messages are broadcast.
+                                        tx_metadata_.subject_id,
+                                        tx_metadata_.transfer_id,
+                                        frame_index,
+                                        is_last};
+        FrameCodec::serializeHeader(header, datagram);
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&                            memory_;
+    UniquePtr<ITxPayloadSource>                            source_;
+    const AnyUdpardTxMetadata::Publish                     tx_metadata_;
+    const UdpardNodeID                                     local_node_id_;
+    const std::size_t                                      payload_size_;
+    std::array<Cursor, UDPARD_NETWORK_INTERFACE_COUNT_MAX> cursors_;
+    std::unique_ptr<cetl::byte, PmrRawBytesDeleter>        buffer_;
+    TxStream*                                              prev_{nullptr};
+    TxStream*                                              next_{nullptr};
+
+};  // TxStream
+
+/// @brief Indexes TX streams of a media priority band by their priorities.
+///
+/// Each priority has its own FIFO queue (linked through the media cursors of the streams),
+/// so the highest priority (and the oldest among the same priority) stream is found w/o scanning all streams.
+/// The queue doesn't own its streams - the transport does.
+///
+class TxStreamQueue final
+{
+public:
+    /// Appends the stream to the tail of its priority queue.
+    ///
+    void push(TxStream& tx_stream, const std::uint8_t media_index) noexcept
+    {
+        Fifo& fifo                            = fifoOf(tx_stream.priority());
+        tx_stream.nextInQueueFor(media_index) = nullptr;
+        if (fifo.tail == nullptr)
+        {
+            fifo.head = &tx_stream;
+        }
+        else
+        {
+            fifo.tail->nextInQueueFor(media_index) = &tx_stream;
+        }
+        fifo.tail = &tx_stream;
+    }
+
+    /// Gets the highest priority (and the oldest among the same priority) stream, or `nullptr` if there is none.
+    ///
+    CETL_NODISCARD TxStream* peek() const noexcept
+    {
+        for (const Fifo& fifo : fifos_)
+        {
+            if (fifo.head != nullptr)
+            {
+                return fifo.head;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Removes the stream from its priority queue (if it's there).
+    ///
+    /// Normally the stream is the head of its queue (it was just sent, has failed or expired),
+    /// so the queue is walked only when a media is gone or the stream has failed to be handed over.
+    ///
+    void remove(TxStream& tx_stream, const std::uint8_t media_index) noexcept
+    {
+        Fifo&     fifo = fifoOf(tx_stream.priority());
+        TxStream* prev = nullptr;
+        TxStream* curr = fifo.head;
+        while ((curr != nullptr) && (curr != &tx_stream))
+        {
+            prev = curr;
+            curr = curr->nextInQueueFor(media_index);
+        }
+        if (curr == nullptr)
+        {
+            return;
+        }
+
+        TxStream* const next = tx_stream.nextInQueueFor(media_index);
+        if (prev == nullptr)
+        {
+            fifo.head = next;
+        }
+        else
+        {
+            prev->nextInQueueFor(media_index) = next;
+        }
+        if (fifo.tail == &tx_stream)
+        {
+            fifo.tail = prev;
+        }
+        tx_stream.nextInQueueFor(media_index) = nullptr;
+    }
+
+private:
+    struct Fifo
+    {
+        TxStream* head{nullptr};
+        TxStream* tail{nullptr};
+    };
+
+    CETL_NODISCARD Fifo& fifoOf(const UdpardPriority priority) noexcept
+    {
+        CETL_DEBUG_ASSERT(static_cast<std::size_t>(priority) < fifos_.size(), "");
+
+        // No lint b/c the transport accepts only valid priorities for streams.
+        return fifos_[static_cast<std::size_t>(priority)];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    // MARK: Data members:
+
+    std::array<Fifo, UDPARD_PRIORITY_MAX + 1U> fifos_{};
+
+};  // TxStreamQueue
+
+}  // namespace detail
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_TX_STREAM_HPP_INCLUDED
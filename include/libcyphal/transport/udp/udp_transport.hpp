@@ -7,16 +7,23 @@
 #define LIBCYPHAL_TRANSPORT_UDP_TRANSPORT_HPP_INCLUDED
 
 #include "media.hpp"
+#include "msg_stream_sessions.hpp"
+#include "tx_payload_source.hpp"
 #include "tx_rx_sockets.hpp"
 
 #include "libcyphal/config.hpp"
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
+#include "libcyphal/transport/rx_reassembly_budget.hpp"
 #include "libcyphal/transport/transport.hpp"
+#include "libcyphal/types.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pmr/function.hpp>
 #include <udpard.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace libcyphal
@@ -37,6 +44,7 @@ public:
     /// - Index of media interface related to this error.
     ///   This index is the same as the index of the (not `nullptr`!) media interface
     ///   pointer in the `media` span argument used at the `makeTransport()` factory method.
+    ///   A media added later (see `addMedia`) gets the lowest index which is not in use by other media.
     /// - A reference to the entity that has caused this error.
     ///
     struct TransientErrorReport
@@ -172,6 +180,103 @@ public:
     ///
     virtual void setTransientErrorHandler(TransientErrorHandler handler) = 0;
 
+    /// @brief Adds a new redundant media interface to the running transport.
+    ///
+    /// The transport brings up TX queues and RX sockets (for all existing RX sessions) of the new media,
+    /// so all existing sessions start using it as well - there is no need to remake the transport or its sessions.
+    /// TX sockets of the new media are made on demand (with the next transfer).
+    ///
+    /// @param media The media interface to add. Must outlive the transport (or be removed from it before).
+    /// @return `nullopt` on success. Otherwise:
+    ///         - `AlreadyExistsError` if the media has been already added;
+    ///         - `ArgumentError` if there is no room for the media (see `media` span at `makeTransport()`);
+    ///         - `MemoryError` if there is no memory for the media TX queues;
+    ///         - a media failure (if not handled by the transient error handler) of making a RX socket -
+    ///           in such case the media is not added.
+    ///
+    virtual cetl::optional<AnyFailure> addMedia(IMedia& media) = 0;
+
+    /// @brief Removes a redundant media interface from the running transport.
+    ///
+    /// Datagrams still queued for the media are dropped, and all its sockets are released, so the media
+    /// could be destroyed right after this call. Other media and all sessions continue to work as is.
+    /// Should not be called from within the transient error handler.
+    ///
+    /// @param media The media interface to remove.
+    /// @return `nullopt` on success. `ArgumentError` if the media is unknown, or if it's the last one
+    ///         (transport must have at least one media - the same as at `makeTransport()`).
+    ///
+    virtual cetl::optional<ArgumentError> removeMedia(IMedia& media) = 0;
+
+    /// @brief Umbrella type for RX reassembly memory budget entities.
+    ///
+    /// See `transport::RxReassemblyBudget` for details. For this transport, a frame is a whole datagram -
+    /// libudpard keeps received datagrams of multi-frame transfers until the transfer is reassembled.
+    ///
+    using RxReassemblyBudget = transport::RxReassemblyBudget;
+
+    /// Sets (or removes) the RX reassembly memory budget.
+    ///
+    /// See \ref RxReassemblyBudget for more details. Disabled by default.
+    ///
+    /// @param params Limits of the budget. `nullopt` disables the budget (statistics are kept).
+    ///
+    virtual void setRxReassemblyBudget(const cetl::optional<RxReassemblyBudget::Params>& params) = 0;
+
+    /// Gets cumulative statistics of the RX reassembly memory budget enforcement.
+    ///
+    virtual RxReassemblyBudget::Stats getRxReassemblyStats() const noexcept = 0;
+
+    /// Sends a message transfer, whose payload is pulled lazily from the given source (aka streaming TX).
+    ///
+    /// Intended for very large transfers (f.e. map tiles or file contents), so that neither the whole payload
+    /// nor all its datagrams have to be in memory at once. Datagrams are built one by one, and only when
+    /// the media TX socket is ready to accept them. Until then, the transfer competes (by priority) with other
+    /// transfers of the same media TX priority band - higher priority transfers are not blocked by the stream.
+    ///
+    /// The transfer ID is supplied by the caller, so to avoid collisions with regular publishing, a subject can be
+    /// used either by message TX sessions or by streams, but not both at the same time - a stream is rejected
+    /// while the subject has a TX session, and `makeMessageTxSession` is rejected while the subject has
+    /// a stream in flight (both with `AlreadyExistsError`).
+    ///
+    /// @param subject_id The subject ID of the message.
+    /// @param metadata The transfer metadata (priority, transfer ID and deadline).
+    /// @param source The payload source. It's owned by the transport until the transfer is sent to all media,
+    ///               or expired, or the transport is destroyed.
+    /// @return `nullopt` if the transfer has been accepted for streaming. `ArgumentError` if the subject ID
+    ///         is invalid or the local node is anonymous (anonymous nodes can't send multi-frame transfers).
+    ///         `AlreadyExistsError` if there is a message TX session for the subject.
+    ///
+    virtual cetl::optional<AnyFailure> sendMessageStream(const PortId                subject_id,
+                                                         const TransferTxMetadata&   metadata,
+                                                         UniquePtr<ITxPayloadSource> source) = 0;
+
+    /// Makes a new progressive (aka streaming) message RX session.
+    ///
+    /// Intended for very large transfers - payload is delivered in order, chunk by chunk, as datagrams arrive,
+    /// instead of being reassembled in memory first. See `IMessageStreamRxSession` for details.
+    /// A subject can have either a regular message RX session or a streaming one, but not both at the same time.
+    ///
+    /// @param params The message RX session parameters.
+    /// @return A new session if successful; otherwise a failure (f.e. `AlreadyExistsError` for the same subject).
+    ///
+    virtual Expected<UniquePtr<IMessageStreamRxSession>, AnyFailure> makeMessageStreamRxSession(
+        const MessageRxParams& params) = 0;
+
+    /// Makes a new frame monitor (aka promiscuous) RX session.
+    ///
+    /// Intended for network loggers and analyzers - all received frames of the monitored ports are delivered
+    /// to the session as is (without reassembly into transfers), see `IFrameMonitorRxSession` for details.
+    /// The session receives datagrams via dedicated frame monitor RX sockets of media
+    /// (see `IMedia::makeFrameMonitorRxSocket`), so it doesn't affect other RX sessions.
+    ///
+    /// @param params The frame monitor RX session parameters. Subject IDs should be in the [0, 8191] range.
+    /// @return A new session if successful; otherwise a failure (f.e. `AlreadyExistsError` if there is
+    ///         another frame monitor session already, or `ArgumentError` if media doesn't support monitoring).
+    ///
+    virtual Expected<UniquePtr<IFrameMonitorRxSession>, AnyFailure> makeFrameMonitorRxSession(
+        const FrameMonitorRxParams& params) = 0;
+
 protected:
     IUdpTransport()  = default;
     ~IUdpTransport() = default;
@@ -206,6 +311,29 @@ struct MemoryResourcesSpec
 
 };  // MemoryResourcesSpec
 
+/// @brief Specifies how the UDP transport splits TX path of each media into priority bands.
+///
+/// Each band has its own Udpard TX queue and its own TX socket (see `IMedia::makeBandTxSocket`). As a result,
+/// a datagram of a higher priority band never waits in the OS socket buffer (or in the NIC queue) behind
+/// already accepted datagrams of a lower priority band - f.e. behind a big low priority transfer.
+///
+/// Default (zero-initialized) specification results in a single band per media, which is served by a single socket.
+///
+struct TxPriorityBandsSpec
+{
+    /// Maps transfer priority (used as index) to its band index.
+    ///
+    /// The first element must be zero, and each next element must be either the same or one more than
+    /// the previous one. For example, `{0, 0, 1, 1, 1, 1, 2, 2}` defines three bands, where the `Exceptional`
+    /// and `Immediate` priorities are served by the band #0, and the `Slow` and `Optional` ones by the band #2.
+    std::array<std::uint8_t, UDPARD_PRIORITY_MAX + 1U> band_of_priority{};
+
+    /// Maximum number of datagrams which are allowed to be outstanding in the OS per band (using band index).
+    /// Zero means "no limit". See also `IMedia::TxBandParams::max_pending_datagrams`.
+    std::array<std::size_t, UDPARD_PRIORITY_MAX + 1U> max_pending_datagrams{};
+
+};  // TxPriorityBandsSpec
+
 }  // namespace udp
 }  // namespace transport
 }  // namespace libcyphal
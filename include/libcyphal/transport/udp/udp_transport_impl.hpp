@@ -7,20 +7,31 @@
 #define LIBCYPHAL_TRANSPORT_UDP_TRANSPORT_IMPL_HPP_INCLUDED
 
 #include "delegate.hpp"
+#include "frame_codec.hpp"
+#include "frame_monitor_rx_session.hpp"
 #include "media.hpp"
 #include "msg_rx_session.hpp"
+#include "msg_stream_rx_session.hpp"
+#include "msg_stream_sessions.hpp"
 #include "msg_tx_session.hpp"
 #include "session_tree.hpp"
 #include "svc_rx_sessions.hpp"
 #include "svc_tx_sessions.hpp"
+#include "tx_payload_source.hpp"
 #include "tx_rx_sockets.hpp"
+#include "tx_stream.hpp"
 #include "udp_transport.hpp"
 
+#include "libcyphal/common/cavl/cavl.hpp"
 #include "libcyphal/executor.hpp"
 #include "libcyphal/transport/contiguous_payload.hpp"
 #include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/frame_monitor_sessions.hpp"
 #include "libcyphal/transport/lizard_helpers.hpp"
+#include "libcyphal/transport/media_slots.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/msg_tx_capacity.hpp"
+#include "libcyphal/transport/msg_tx_timestamping.hpp"
 #include "libcyphal/transport/svc_sessions.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
@@ -65,26 +76,91 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
         explicit Spec() = default;
     };
 
-    /// @brief Defines private storage of a media index, its interface, TX queue and socket.
+    /// @brief Defines private storage of a media TX priority band - its parameters, TX queue, streams and socket.
     ///
-    struct Media final
+    struct TxBand final
     {
     public:
-        Media(const UdpardMemoryResource fragments_mr,
-              const std::size_t          index,
-              IMedia&                    interface,
-              const UdpardNodeID* const  local_node_id,
-              const std::size_t          tx_capacity)
-            : index_{static_cast<std::uint8_t>(index)}
-            , interface_{interface}
+        TxBand(const UdpardTxMemoryResources& tx_memory_resources,
+               const UdpardNodeID* const      local_node_id,
+               const std::size_t              tx_capacity,
+               const IMedia::TxBandParams&    params)
+            : params_{params}
             , udpard_tx_{}
         {
-            const UdpardTxMemoryResources tx_memory_resources = {fragments_mr, makeTxMemoryResource(interface)};
             const std::int8_t result = ::udpardTxInit(&udpard_tx_, local_node_id, tx_capacity, tx_memory_resources);
             CETL_DEBUG_ASSERT(result == 0, "There should be no path for an error here.");
             (void) result;
         }
 
+        const IMedia::TxBandParams& params() const
+        {
+            return params_;
+        }
+
+        UdpardTx& udpard_tx()
+        {
+            return udpard_tx_;
+        }
+
+        SocketState<ITxSocket>& socketState()
+        {
+            return socket_state_;
+        }
+
+        const SocketState<ITxSocket>& socketState() const
+        {
+            return socket_state_;
+        }
+
+        TxStreamQueue& txStreams()
+        {
+            return tx_streams_;
+        }
+
+    private:
+        const IMedia::TxBandParams params_;
+        UdpardTx                   udpard_tx_;
+        TxStreamQueue              tx_streams_;
+        SocketState<ITxSocket>     socket_state_;
+
+    };  // TxBand
+    using TxBandArray = libcyphal::detail::VarArray<TxBand>;
+
+    /// @brief Defines private storage of a media index, its interface, TX priority bands and shared RX sockets.
+    ///
+    struct Media final
+    {
+    public:
+        Media(cetl::pmr::memory_resource& general_mr,
+              const UdpardMemoryResource  fragments_mr,
+              const std::size_t           index,
+              IMedia&                     interface,
+              const UdpardNodeID* const   local_node_id,
+              const std::size_t           tx_capacity,
+              const TxPriorityBandsSpec&  tx_bands_spec)
+            : index_{static_cast<std::uint8_t>(index)}
+            , interface_{interface}
+            , tx_bands_{getTxBandsCount(tx_bands_spec), &general_mr}
+        {
+            const UdpardTxMemoryResources tx_memory_resources = {fragments_mr, makeTxMemoryResource(interface)};
+
+            // Reserve the space for the whole array of bands (to avoid reallocations).
+            // Capacity will be less than requested in case of out of memory.
+            const std::size_t bands_count = getTxBandsCount(tx_bands_spec);
+            tx_bands_.reserve(bands_count);
+            if (tx_bands_.capacity() >= bands_count)
+            {
+                for (std::size_t band_index = 0; band_index < bands_count; ++band_index)
+                {
+                    tx_bands_.emplace_back(tx_memory_resources,
+                                           local_node_id,
+                                           tx_capacity,
+                                           makeTxBandParams(tx_bands_spec, band_index));
+                }
+            }
+        }
+
         std::uint8_t index() const
         {
             return index_;
@@ -95,14 +171,15 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
             return interface_;
         }
 
-        UdpardTx& udpard_tx()
+        TxBandArray& txBands()
         {
-            return udpard_tx_;
+            return tx_bands_;
         }
 
-        SocketState<ITxSocket>& txSocketState()
+        TxBand& txBand(const std::uint8_t band_index)
         {
-            return tx_socket_state_;
+            CETL_DEBUG_ASSERT(band_index < tx_bands_.size(), "");
+            return tx_bands_[band_index];
         }
 
         SocketState<IRxSocket>& svcRxSocketState()
@@ -110,9 +187,29 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
             return svc_rx_socket_state_;
         }
 
+        SocketState<IRxSocket>& frameMonitorRxSocketState()
+        {
+            return frame_monitor_rx_socket_state_;
+        }
+
         std::size_t getTxSocketMtu() const noexcept
         {
-            return tx_socket_state_.interface ? tx_socket_state_.interface->getMtu() : ITxSocket::DefaultMtu;
+            // All bands share the same physical interface, but their sockets still might report different MTU.
+            //
+            std::size_t min_mtu = std::numeric_limits<std::size_t>::max();
+            for (const TxBand& tx_band : tx_bands_)
+            {
+                if (const auto& tx_socket = tx_band.socketState().interface)
+                {
+                    min_mtu = std::min(min_mtu, tx_socket->getMtu());
+                }
+            }
+            return (min_mtu != std::numeric_limits<std::size_t>::max()) ? min_mtu : ITxSocket::DefaultMtu;
+        }
+
+        CETL_NODISCARD static std::size_t getTxBandsCount(const TxPriorityBandsSpec& tx_bands_spec)
+        {
+            return static_cast<std::size_t>(tx_bands_spec.band_of_priority.back()) + 1U;
         }
 
     private:
@@ -128,24 +225,47 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
                 media_interface.getTxMemoryResource());
         }
 
+        CETL_NODISCARD static IMedia::TxBandParams makeTxBandParams(const TxPriorityBandsSpec& tx_bands_spec,
+                                                                    const std::size_t          band_index)
+        {
+            // Bands are contiguous (see `isValidTxBandsSpec`), so the first and the last priorities
+            // mapped to the band are the highest and the lowest priorities served by the band.
+            //
+            const auto& band_of_priority = tx_bands_spec.band_of_priority;
+            const auto  first = std::find(band_of_priority.cbegin(), band_of_priority.cend(), band_index);
+            const auto  last  = std::find(band_of_priority.crbegin(), band_of_priority.crend(), band_index);
+            CETL_DEBUG_ASSERT((first != band_of_priority.cend()) && (last != band_of_priority.crend()), "");
+
+            const auto highest = std::distance(band_of_priority.cbegin(), first);
+            const auto lowest  = std::distance(last, band_of_priority.crend()) - 1;
+
+            return IMedia::TxBandParams{static_cast<std::uint8_t>(band_index),
+                                        static_cast<std::uint8_t>(getTxBandsCount(tx_bands_spec)),
+                                        static_cast<Priority>(highest),
+                                        static_cast<Priority>(lowest),
+                                        tx_bands_spec.max_pending_datagrams[band_index]};
+        }
+
         const std::uint8_t     index_;
         IMedia&                interface_;
-        UdpardTx               udpard_tx_;
-        SocketState<ITxSocket> tx_socket_state_;
+        TxBandArray            tx_bands_;
         SocketState<IRxSocket> svc_rx_socket_state_;
+        SocketState<IRxSocket> frame_monitor_rx_socket_state_;
 
     };  // Media
-    using MediaArray = libcyphal::detail::VarArray<Media>;
+    using MediaArray = transport::detail::MediaSlots<Media>;
 
 public:
     CETL_NODISCARD static Expected<UniquePtr<IUdpTransport>, FactoryFailure> make(  //
         const MemoryResourcesSpec& mem_res_spec,
         IExecutor&                 executor,
         const cetl::span<IMedia*>  media,
-        const std::size_t          tx_capacity)
+        const std::size_t          tx_capacity,
+        const TxPriorityBandsSpec& tx_bands_spec)
     {
         // Verify input arguments:
         // - At least one media interface must be provided, but no more than the maximum allowed (3).
+        // - Priority bands must be contiguous, and start from the band #0.
         //
         const auto media_count = static_cast<std::size_t>(
             std::count_if(media.begin(), media.end(), [](const IMedia* const media_ptr) -> bool {
@@ -155,6 +275,10 @@ public:
         {
             return ArgumentError{};
         }
+        if (!isValidTxBandsSpec(tx_bands_spec))
+        {
+            return ArgumentError{};
+        }
 
         const MemoryResources memory_resources{mem_res_spec.general,
                                                makeUdpardMemoryResource(mem_res_spec.session, mem_res_spec.general),
@@ -163,19 +287,34 @@ public:
 
         const UdpardNodeID unset_node_id = UDPARD_NODE_ID_UNSET;
 
+        // Extra `nullptr` entries of the span reserve slots for media which might be added later (see `addMedia`).
+        const std::size_t media_capacity =
+            std::min(media.size(), static_cast<std::size_t>(UDPARD_NETWORK_INTERFACE_COUNT_MAX));
+
         // False positive of clang-tidy - we move `media_array` to the `transport` instance, so can't make it const.
         // NOLINTNEXTLINE(misc-const-correctness)
-        MediaArray media_array = makeMediaArray(memory_resources, media_count, media, &unset_node_id, tx_capacity);
+        MediaArray media_array =
+            makeMediaArray(memory_resources, media_capacity, media, &unset_node_id, tx_capacity, tx_bands_spec);
         if (media_array.size() != media_count)
         {
             return MemoryError{};
         }
+        const std::size_t bands_count = Media::getTxBandsCount(tx_bands_spec);
+        for (Media& some_media : media_array)
+        {
+            if (some_media.txBands().size() != bands_count)
+            {
+                return MemoryError{};
+            }
+        }
 
         auto transport = libcyphal::detail::makeUniquePtr<Spec>(memory_resources.general,
                                                                 Spec{},
                                                                 memory_resources,
                                                                 executor,
-                                                                std::move(media_array));
+                                                                std::move(media_array),
+                                                                tx_capacity,
+                                                                tx_bands_spec);
         if (transport == nullptr)
         {
             return MemoryError{};
@@ -184,17 +323,28 @@ public:
         return transport;
     }
 
-    TransportImpl(const Spec, const MemoryResources& memory_resources, IExecutor& executor, MediaArray&& media_array)
+    TransportImpl(const Spec,
+                  const MemoryResources&     memory_resources,
+                  IExecutor&                 executor,
+                  MediaArray&&               media_array,
+                  const std::size_t          tx_capacity,
+                  const TxPriorityBandsSpec& tx_bands_spec)
         : TransportDelegate{memory_resources}
         , executor_{executor}
         , media_array_{std::move(media_array)}
+        , tx_capacity_{tx_capacity}
+        , tx_bands_spec_{tx_bands_spec}
         , msg_rx_session_nodes_{memory_resources.general}
         , svc_request_rx_session_nodes_{memory_resources.general}
         , svc_response_rx_session_nodes_{memory_resources.general}
+        , tx_streams_allocator_{&memory_resources.general}
     {
         for (auto& media : media_array_)
         {
-            media.udpard_tx().local_node_id = &getNodeId();
+            for (TxBand& tx_band : media.txBands())
+            {
+                tx_band.udpard_tx().local_node_id = &getNodeId();
+            }
         }
     }
 
@@ -205,9 +355,17 @@ public:
 
     ~TransportImpl()
     {
+        while (tx_streams_head_ != nullptr)
+        {
+            releaseTxStream(*tx_streams_head_);
+        }
+
         for (Media& media : media_array_)
         {
-            flushUdpardTxQueue(media.udpard_tx());
+            for (TxBand& tx_band : media.txBands())
+            {
+                flushUdpardTxQueue(tx_band.udpard_tx());
+            }
         }
 
         CETL_DEBUG_ASSERT(msg_rx_session_nodes_.isEmpty(),  //
@@ -216,6 +374,8 @@ public:
                           "Service sessions must be destroyed before transport.");
         CETL_DEBUG_ASSERT(svc_response_rx_session_nodes_.isEmpty(),
                           "Service sessions must be destroyed before transport.");
+        CETL_DEBUG_ASSERT(frame_monitor_rx_session_ == nullptr,  //
+                          "Frame monitor session must be destroyed before transport.");
     }
 
 private:
@@ -226,6 +386,226 @@ private:
         transient_error_handler_ = std::move(handler);
     }
 
+    CETL_NODISCARD cetl::optional<AnyFailure> addMedia(IMedia& media_interface) override
+    {
+        if (nullptr != media_array_.findByInterface(media_interface))
+        {
+            return AlreadyExistsError{};
+        }
+        const auto free_index = media_array_.findFreeIndex();
+        if (!free_index.has_value())
+        {
+            return ArgumentError{};
+        }
+
+        const MemoryResources& memory = memoryResources();
+
+        Media& media = media_array_.emplaceAt(*free_index,
+                                              memory.general,
+                                              memory.fragment,
+                                              *free_index,
+                                              media_interface,
+                                              &getNodeId(),
+                                              tx_capacity_,
+                                              tx_bands_spec_);
+        if (media.txBands().size() != Media::getTxBandsCount(tx_bands_spec_))
+        {
+            media_array_.resetAt(*free_index);
+            return MemoryError{};
+        }
+
+        // The new media should receive the same datagrams as the others - so it needs RX sockets
+        // for all existing RX sessions. TX sockets are made on demand (with the next transfer).
+        //
+        cetl::optional<AnyFailure> failure = ensureMediaRxSocketsOf(media);
+        if (failure.has_value())
+        {
+            releaseMedia(media);
+            return failure;
+        }
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> removeMedia(IMedia& media_interface) override
+    {
+        Media* const media = media_array_.findByInterface(media_interface);
+        if ((nullptr == media) || (media_array_.size() <= 1))
+        {
+            return ArgumentError{};
+        }
+
+        releaseMedia(*media);
+
+        // Dropped frames might have been the ones which kept TX queues occupied.
+        updateTxCapacityOnDrain();
+
+        return cetl::nullopt;
+    }
+
+    void setRxReassemblyBudget(const cetl::optional<RxReassemblyBudget::Params>& params) override
+    {
+        rxReassemblyLedger().setParams(params);
+    }
+
+    RxReassemblyBudget::Stats getRxReassemblyStats() const noexcept override
+    {
+        return rxReassemblyLedger().getStats();
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> sendMessageStream(const PortId                subject_id,
+                                                                const TransferTxMetadata&   metadata,
+                                                                UniquePtr<ITxPayloadSource> source) override
+    {
+        if ((subject_id > UDPARD_SUBJECT_ID_MAX) || (getNodeId() > UDPARD_NODE_ID_MAX) || (source == nullptr) ||
+            (static_cast<std::size_t>(metadata.base.priority) > UDPARD_PRIORITY_MAX))
+        {
+            return ArgumentError{};
+        }
+
+        // Transfer ids of the stream are not coordinated with regular TX sessions of the same subject.
+        if (hasMsgTxSessionFor(subject_id))
+        {
+            return AlreadyExistsError{};
+        }
+
+        const auto deadline_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(metadata.deadline.time_since_epoch());
+        const AnyUdpardTxMetadata::Publish tx_metadata{static_cast<UdpardMicrosecond>(deadline_us.count()),
+                                                       static_cast<UdpardPriority>(metadata.base.priority),
+                                                       subject_id,
+                                                       metadata.base.transfer_id};
+
+        TxStream* const tx_stream = tx_streams_allocator_.allocate(1);
+        if (nullptr == tx_stream)
+        {
+            return MemoryError{};
+        }
+        tx_streams_allocator_.construct(tx_stream,
+                                        memoryResources().general,
+                                        std::move(source),
+                                        tx_metadata,
+                                        getNodeId(),
+                                        media_array_.capacity());
+        linkTxStream(*tx_stream);
+
+        // Free media slots (see `removeMedia`) won't ever consume the stream.
+        for (std::size_t index = 0; index < media_array_.capacity(); ++index)
+        {
+            if (nullptr == media_array_.find(index))
+            {
+                tx_stream->finishFor(static_cast<std::uint8_t>(index));
+            }
+        }
+
+        // Note that the stream might be already released (f.e. b/c of a socket failure at the last media),
+        // so it's not touched anymore after being handed over to the last media.
+        //
+        const std::uint8_t band_index = getTxBandIndexOf(tx_metadata.priority);
+        for (Media& some_media : media_array_)
+        {
+            some_media.txBand(band_index).txStreams().push(*tx_stream, some_media.index());
+
+            bool                       is_handed_over = false;
+            cetl::optional<AnyFailure> failure        = withEnsureMediaTxSocket(  //
+                some_media,
+                some_media.txBand(band_index),
+                [this, &is_handed_over](auto& media, auto& tx_band, auto& tx_socket) -> cetl::optional<AnyFailure> {
+                    //
+                    is_handed_over = true;
+
+                    // No need to try to send next frame when previous one hasn't finished yet.
+                    if (!tx_band.socketState().callback)
+                    {
+                        sendNextFrameToMediaTxSocket(media, tx_band, tx_socket);
+                    }
+                    return cetl::nullopt;
+                });
+            if (failure.has_value())
+            {
+                // The handler (if any) just said that it's NOT fine to continue with streaming to other media,
+                // and the error should not be ignored but propagated outside.
+                for (Media& rest_media : media_array_)
+                {
+                    if (rest_media.index() >= some_media.index())
+                    {
+                        dequeueTxStreamFor(rest_media, *tx_stream);
+                    }
+                }
+                if (tx_stream->isDone())
+                {
+                    releaseTxStream(*tx_stream);
+                }
+                return failure;
+            }
+            if (!is_handed_over)
+            {
+                // There is no TX socket for this media (and the handler has decided to ignore it).
+                finishTxStreamFor(some_media, *tx_stream);
+            }
+        }
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageStreamRxSession>, AnyFailure> makeMessageStreamRxSession(
+        const MessageRxParams& params) override
+    {
+        auto node_result = msg_rx_session_nodes_.ensureNewNodeFor(params.subject_id);
+        if (auto* const failure = cetl::get_if<AnyFailure>(&node_result))
+        {
+            return std::move(*failure);
+        }
+        auto& new_msg_node = cetl::get<RxSessionTreeNode::Message::ReferenceWrapper>(node_result).get();
+
+        auto session_result =
+            MessageStreamRxSession::make(memoryResources().general, executor_, asDelegate(), params, new_msg_node);
+        if (auto* const failure = cetl::get_if<AnyFailure>(&session_result))
+        {
+            msg_rx_session_nodes_.removeNodeFor(params.subject_id);
+            return std::move(*failure);
+        }
+
+        // Try to create all (per each media) RX sockets for the subject, and start receiving from them.
+        //
+        auto media_failure = withMediaMsgStreamRxSockets(new_msg_node, makeMsgStreamRxSocketAction());
+        if (media_failure.has_value())
+        {
+            return std::move(media_failure.value());
+        }
+
+        return session_result;
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IFrameMonitorRxSession>, AnyFailure> makeFrameMonitorRxSession(
+        const FrameMonitorRxParams& params) override
+    {
+        if (frame_monitor_rx_session_ != nullptr)
+        {
+            return AlreadyExistsError{};
+        }
+
+        auto session_result = FrameMonitorRxSession::make(memoryResources().general, asDelegate(), params);
+        if (auto* const failure = cetl::get_if<AnyFailure>(&session_result))
+        {
+            return std::move(*failure);
+        }
+
+        // Try to create all (per each media) frame monitor RX sockets, and start receiving from them.
+        // In case of a failure, the session (and so its already made sockets) is released on exit.
+        //
+        for (Media& media : media_array_)
+        {
+            cetl::optional<AnyFailure> media_failure = withEnsureMediaFrameMonitorRxSocket(media);
+            if (media_failure.has_value())
+            {
+                return std::move(media_failure.value());
+            }
+        }
+
+        return session_result;
+    }
+
     // MARK: ITransport
 
     CETL_NODISCARD cetl::optional<NodeId> getLocalNodeId() const noexcept override
@@ -281,6 +661,12 @@ private:
     CETL_NODISCARD Expected<UniquePtr<IMessageTxSession>, AnyFailure> makeMessageTxSession(
         const MessageTxParams& params) override
     {
+        // See `sendMessageStream` - transfer ids of a stream in flight are not coordinated with the new session.
+        if (hasTxStreamFor(params.subject_id))
+        {
+            return AlreadyExistsError{};
+        }
+
         auto failure = ensureMediaTxSockets();
         if (failure.has_value())
         {
@@ -351,37 +737,15 @@ private:
             return MemoryError{};
         }
 
-        for (Media& some_media : media_array_)
-        {
-            cetl::optional<AnyFailure> failure = withEnsureMediaTxSocket(  //
-                some_media,
-                [this, &tx_metadata_var, &payload](auto& media, auto& tx_socket) -> cetl::optional<AnyFailure> {
-                    //
-                    media.udpard_tx().mtu = tx_socket.getMtu();
-
-                    const TxTransferHandler transfer_handler{*this, media, payload};
-                    auto                    tx_failure = cetl::visit(transfer_handler, tx_metadata_var);
-                    if (tx_failure.has_value())
-                    {
-                        return tx_failure;
-                    }
-
-                    // No need to try to send next frame when previous one hasn't finished yet.
-                    if (!media.txSocketState().callback)
-                    {
-                        sendNextFrameToMediaTxSocket(media, tx_socket);
-                    }
-                    return cetl::nullopt;
-                });
-            if (failure.has_value())
-            {
-                // The handler (if any) just said that it's NOT fine to continue with transferring to
-                // other media TX queues, and the error should not be ignored but propagated outside.
-                return failure;
-            }
-        }
+        // Transfer goes to the TX queue (and socket) of its priority band only.
+        //
+        const UdpardPriority priority =
+            cetl::visit([](const auto& tx_metadata) { return tx_metadata.priority; }, tx_metadata_var);
+        const std::uint8_t band_index = getTxBandIndexOf(priority);
 
-        return cetl::nullopt;
+        auto failure = sendAnyTransferTo(band_index, tx_metadata_var, payload);
+        updateTxCapacityOnPush(failure);
+        return failure;
     }
 
     void onSessionEvent(const SessionEvent::Variant& event_var) override
@@ -400,6 +764,63 @@ private:
                             //
                             svc_response_rx_session_nodes_.removeNodeFor(res_session_destroyed.service_id);
                             cancelRxCallbacksIfNoSvcLeft();
+                        },
+                        [this](const SessionEvent::MsgTxTimestamping& timestamping) {
+                            //
+                            if (timestamping.is_added)
+                            {
+                                tx_timestamping_registry_.insertNode(timestamping.node);
+                            }
+                            else
+                            {
+                                tx_timestamping_registry_.removeNode(timestamping.node);
+                            }
+                        },
+                        [this](const SessionEvent::FrameMonitorRxLifetime& lifetime) {
+                            //
+                            if (lifetime.is_added)
+                            {
+                                CETL_DEBUG_ASSERT(frame_monitor_rx_session_ == nullptr,  //
+                                                  "Only one monitor is expected.");
+                                frame_monitor_rx_session_ = &lifetime.delegate;
+                            }
+                            else
+                            {
+                                CETL_DEBUG_ASSERT(frame_monitor_rx_session_ == &lifetime.delegate, "");
+                                frame_monitor_rx_session_ = nullptr;
+                                releaseFrameMonitorRxSockets();
+                            }
+                        },
+                        [this](const SessionEvent::MsgTxCapacity& capacity) {
+                            //
+                            if (capacity.is_added)
+                            {
+                                tx_capacity_registry_.insertNode(capacity.node);
+
+                                // The node might be added right after a failed send (when TX queues are full).
+                                updateTxCapacityOnPush(cetl::nullopt);
+                            }
+                            else
+                            {
+                                tx_capacity_registry_.removeNode(capacity.node);
+                            }
+                        },
+                        [this](const SessionEvent::MsgTxLifetime& lifetime) {
+                            //
+                            if (lifetime.is_added)
+                            {
+                                const auto node_existing = msg_tx_session_nodes_.search(  //
+                                    [&lifetime](const MsgTxSessionNode& other) {           // predicate
+                                        //
+                                        return other.compareWith(lifetime.node);
+                                    },
+                                    [&lifetime]() { return &lifetime.node; });  // "factory"
+                                (void) node_existing;
+                            }
+                            else
+                            {
+                                msg_tx_session_nodes_.remove(&lifetime.node);
+                            }
                         }),
                     event_var);
     }
@@ -412,16 +833,17 @@ private:
     struct TxTransferHandler
     {
         // No Sonar `cpp:S5356` b/c we integrate here with libudpard raw C buffers.
-        TxTransferHandler(const Self& self, Media& media, const ContiguousPayload& cont_payload)
+        TxTransferHandler(const Self& self, Media& media, UdpardTx& udpard_tx, const ContiguousPayload& cont_payload)
             : self_{self}
             , media_{media}
+            , udpard_tx_{udpard_tx}
             , payload_{cont_payload.size(), cont_payload.data()}  // NOSONAR cpp:S5356
         {
         }
 
         CETL_NODISCARD cetl::optional<AnyFailure> operator()(const AnyUdpardTxMetadata::Publish& tx_metadata) const
         {
-            const std::int32_t result = ::udpardTxPublish(&media_.udpard_tx(),
+            const std::int32_t result = ::udpardTxPublish(&udpard_tx_,
                                                           tx_metadata.deadline_us,
                                                           tx_metadata.priority,
                                                           tx_metadata.subject_id,
@@ -431,12 +853,12 @@ private:
 
             return self_.tryHandleTransientUdpardResult<TransientErrorReport::UdpardTxPublish>(media_,
                                                                                                result,
-                                                                                               media_.udpard_tx());
+                                                                                               udpard_tx_);
         }
 
         CETL_NODISCARD cetl::optional<AnyFailure> operator()(const AnyUdpardTxMetadata::Request& tx_metadata) const
         {
-            const std::int32_t result = ::udpardTxRequest(&media_.udpard_tx(),
+            const std::int32_t result = ::udpardTxRequest(&udpard_tx_,
                                                           tx_metadata.deadline_us,
                                                           tx_metadata.priority,
                                                           tx_metadata.service_id,
@@ -447,12 +869,12 @@ private:
 
             return self_.tryHandleTransientUdpardResult<TransientErrorReport::UdpardTxRequest>(media_,
                                                                                                result,
-                                                                                               media_.udpard_tx());
+                                                                                               udpard_tx_);
         }
 
         CETL_NODISCARD cetl::optional<AnyFailure> operator()(const AnyUdpardTxMetadata::Respond& tx_metadata) const
         {
-            const std::int32_t result = ::udpardTxRespond(&media_.udpard_tx(),
+            const std::int32_t result = ::udpardTxRespond(&udpard_tx_,
                                                           tx_metadata.deadline_us,
                                                           tx_metadata.priority,
                                                           tx_metadata.service_id,
@@ -463,12 +885,13 @@ private:
 
             return self_.tryHandleTransientUdpardResult<TransientErrorReport::UdpardTxRespond>(media_,
                                                                                                result,
-                                                                                               media_.udpard_tx());
+                                                                                               udpard_tx_);
         }
 
     private:
         const Self&                self_;
         Media&                     media_;
+        UdpardTx&                  udpard_tx_;
         const struct UdpardPayload payload_;
 
     };  // TxTransferHandler
@@ -494,21 +917,7 @@ private:
         // Try to create all (per each media) RX sockets for message subscription.
         // For now, we're just creating them, without any attempt to use them yet - hence the "do nothing" action.
         //
-        auto media_failure = withMediaMsgRxSockets(  //
-            new_msg_node,
-            [this](const auto& media, auto& socket_state, auto& subscription, auto& session_delegate)
-                -> cetl::optional<AnyFailure> {
-                //
-                if (!socket_state.callback)
-                {
-                    socket_state.callback = socket_state.interface->registerCallback(
-                        [this, &media, &socket_state, &subscription, &session_delegate](const auto&) {
-                            //
-                            receiveNextMessageFrame(media, socket_state, subscription, session_delegate);
-                        });
-                }
-                return cetl::nullopt;
-            });
+        auto media_failure = withMediaMsgRxSockets(new_msg_node, makeMsgRxSocketAction());
         if (media_failure.has_value())
         {
             return std::move(media_failure.value());
@@ -525,17 +934,7 @@ private:
         // Try to create all (per each media) shared RX sockets for services.
         // For now, we're just creating them, without any attempt to use them yet - hence the "do nothing" action.
         //
-        auto media_failure = withMediaSvcRxSockets([this](auto& media,
-                                                          auto& socket_state) -> cetl::optional<AnyFailure> {  //
-            if (!socket_state.callback)
-            {
-                socket_state.callback = socket_state.interface->registerCallback([this, &media, &socket_state](auto) {
-                    //
-                    receiveNextServiceFrame(media, socket_state);
-                });
-            }
-            return cetl::nullopt;
-        });
+        auto media_failure = withMediaSvcRxSockets(makeSvcRxSocketAction());
         if (media_failure.has_value())
         {
             return std::move(media_failure.value());
@@ -594,53 +993,84 @@ private:
     }
 
     CETL_NODISCARD static MediaArray makeMediaArray(const MemoryResources&    memory,
-                                                    const std::size_t         media_count,
+                                                    const std::size_t         media_capacity,
                                                     const cetl::span<IMedia*> media_interfaces,
                                                     const UdpardNodeID* const local_node_id_,
-                                                    const std::size_t         tx_capacity)
+                                                    const std::size_t         tx_capacity,
+                                                    const TxPriorityBandsSpec& tx_bands_spec)
     {
-        MediaArray media_array{media_count, &memory.general};
-
-        // Reserve the space for the whole array (to avoid reallocations).
-        // Capacity will be less than requested in case of out of memory.
-        media_array.reserve(media_count);
-        if (media_array.capacity() >= media_count)
+        // All media slots are allocated at once (to avoid reallocations).
+        // Capacity will be zero in case of out of memory.
+        MediaArray media_array{memory.general, media_capacity};
+        if (media_array.capacity() >= media_capacity)
         {
             std::size_t index = 0;
             for (IMedia* const media_interface : media_interfaces)
             {
-                if (media_interface != nullptr)
+                if ((media_interface != nullptr) && (index < media_capacity))
                 {
                     IMedia& media = *media_interface;
-                    media_array.emplace_back(memory.fragment, index, media, local_node_id_, tx_capacity);
+                    (void) media_array.emplaceAt(index,
+                                                 memory.general,
+                                                 memory.fragment,
+                                                 index,
+                                                 media,
+                                                 local_node_id_,
+                                                 tx_capacity,
+                                                 tx_bands_spec);
                     index++;
                 }
             }
-            CETL_DEBUG_ASSERT(index == media_count, "");
-            CETL_DEBUG_ASSERT(media_array.size() == media_count, "");
         }
 
         return media_array;
     }
 
-    /// @brief Tries to run an action with media and its TX socket (the latter one is made on demand if necessary).
+    /// @brief Checks that priority bands are contiguous, and start from the band #0.
     ///
-    template <typename Action>
-    CETL_NODISCARD cetl::optional<AnyFailure> withEnsureMediaTxSocket(Media& media, Action&& action)
+    CETL_NODISCARD static bool isValidTxBandsSpec(const TxPriorityBandsSpec& tx_bands_spec)
     {
-        if (!media.txSocketState().interface)
+        const auto& band_of_priority = tx_bands_spec.band_of_priority;
+        if (band_of_priority.front() != 0)
         {
-            using ErrorReport = TransientErrorReport::MediaMakeTxSocket;
+            return false;
+        }
+        return std::adjacent_find(band_of_priority.cbegin(),
+                                  band_of_priority.cend(),
+                                  [](const std::uint8_t prev_band, const std::uint8_t next_band) {
+                                      return (next_band != prev_band) && (next_band != prev_band + 1U);
+                                  }) == band_of_priority.cend();
+    }
 
-            auto tx_socket_result = media.interface().makeTxSocket();
-            if (auto* const failure = cetl::get_if<IMedia::MakeTxSocketResult::Failure>(&tx_socket_result))
-            {
-                return tryHandleTransientMediaError<ErrorReport>(media, std::move(*failure), media.interface());
+    CETL_NODISCARD std::uint8_t getTxBandIndexOf(const UdpardPriority priority) const
+    {
+        // Out of range priority is clamped to the lowest one - Udpard will reject such transfer anyway.
+        const auto& band_of_priority = tx_bands_spec_.band_of_priority;
+        const auto  priority_index   = std::min(static_cast<std::size_t>(priority), band_of_priority.size() - 1U);
+
+        // No lint b/c the index is clamped just above.
+        return band_of_priority[priority_index];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    /// @brief Tries to run an action with media, its TX band and the band socket
+    ///        (the latter one is made on demand if necessary).
+    ///
+    template <typename Action>
+    CETL_NODISCARD cetl::optional<AnyFailure> withEnsureMediaTxSocket(Media& media, TxBand& tx_band, Action&& action)
+    {
+        if (!tx_band.socketState().interface)
+        {
+            using ErrorReport = TransientErrorReport::MediaMakeTxSocket;
+
+            auto tx_socket_result = media.interface().makeBandTxSocket(tx_band.params());
+            if (auto* const failure = cetl::get_if<IMedia::MakeTxSocketResult::Failure>(&tx_socket_result))
+            {
+                return tryHandleTransientMediaError<ErrorReport>(media, std::move(*failure), media.interface());
             }
 
-            media.txSocketState().interface =
+            tx_band.socketState().interface =
                 cetl::get<IMedia::MakeTxSocketResult::Success>(std::move(tx_socket_result));
-            if (!media.txSocketState().interface)
+            if (!tx_band.socketState().interface)
             {
                 return tryHandleTransientMediaError<ErrorReport, cetl::variant<MemoryError>>(media,
                                                                                              MemoryError{},
@@ -648,18 +1078,23 @@ private:
             }
         }
 
-        return std::forward<Action>(action)(media, *(media.txSocketState().interface));
+        return std::forward<Action>(action)(media, tx_band, *(tx_band.socketState().interface));
     }
 
     CETL_NODISCARD cetl::optional<AnyFailure> ensureMediaTxSockets()
     {
         for (Media& media : media_array_)
         {
-            cetl::optional<AnyFailure> failure =
-                withEnsureMediaTxSocket(media, [](auto&, auto&) -> cetl::nullopt_t { return cetl::nullopt; });
-            if (failure.has_value())
+            for (TxBand& tx_band : media.txBands())
             {
-                return failure;
+                cetl::optional<AnyFailure> failure =
+                    withEnsureMediaTxSocket(media, tx_band, [](auto&, auto&, auto&) -> cetl::nullopt_t {
+                        return cetl::nullopt;
+                    });
+                if (failure.has_value())
+                {
+                    return failure;
+                }
             }
         }
 
@@ -675,68 +1110,352 @@ private:
         }
     }
 
-    /// @brief Tries to send next frame from media TX queue to socket.
+    /// @brief Pushes transfer to the given priority band TX queue of each media (and tries to send its first frame).
     ///
-    void sendNextFrameToMediaTxSocket(Media& media, ITxSocket& tx_socket)
+    CETL_NODISCARD cetl::optional<AnyFailure> sendAnyTransferTo(const std::uint8_t                  band_index,
+                                                                const AnyUdpardTxMetadata::Variant& tx_metadata_var,
+                                                                const ContiguousPayload&            payload)
     {
-        using PayloadFragment = cetl::span<const cetl::byte>;
+        for (Media& some_media : media_array_)
+        {
+            cetl::optional<AnyFailure> failure = withEnsureMediaTxSocket(  //
+                some_media,
+                some_media.txBand(band_index),
+                [this, &tx_metadata_var, &payload](auto& media,
+                                                   auto& tx_band,
+                                                   auto& tx_socket) -> cetl::optional<AnyFailure> {
+                    //
+                    tx_band.udpard_tx().mtu = tx_socket.getMtu();
 
-        TimePoint tx_deadline;
-        while (UdpardTxItem* const tx_item = peekFirstValidTxItem(media.udpard_tx(), tx_deadline))
-        {
-            // No Sonar `cpp:S5356` and `cpp:S5357` b/c we integrate here with C libudpard API.
-            const auto* const buffer =
-                static_cast<const cetl::byte*>(tx_item->datagram_payload.data);  // NOSONAR cpp:S5356 cpp:S5357
-            const std::array<PayloadFragment, 1> single_payload_fragment{
-                PayloadFragment{buffer, tx_item->datagram_payload.size}};
-
-            ITxSocket::SendResult::Type send_result =
-                tx_socket.send(tx_deadline,
-                               {tx_item->destination.ip_address, tx_item->destination.udp_port},
-                               tx_item->dscp,
-                               single_payload_fragment);
-
-            // In case of socket send error we are going to drop this problematic frame
-            // (b/c it looks like media TX socket can't handle this frame),
-            // but we will continue to try process other transfer frame.
-            // Note that socket not being ready/able to send a frame just yet (aka temporary)
-            // is not reported as an error (see `is_accepted` below).
-            //
-            auto* const send_failure = cetl::get_if<ITxSocket::SendResult::Failure>(&send_result);
-            if (nullptr == send_failure)
+                    const TxTransferHandler transfer_handler{*this, media, tx_band.udpard_tx(), payload};
+                    auto                    tx_failure = cetl::visit(transfer_handler, tx_metadata_var);
+                    if (tx_failure.has_value())
+                    {
+                        return tx_failure;
+                    }
+
+                    // No need to try to send next frame when previous one hasn't finished yet.
+                    if (!tx_band.socketState().callback)
+                    {
+                        sendNextFrameToMediaTxSocket(media, tx_band, tx_socket);
+                    }
+                    return cetl::nullopt;
+                });
+            if (failure.has_value())
             {
-                const auto sent = cetl::get<ITxSocket::SendResult::Success>(send_result);
-                if (sent.is_accepted)
-                {
-                    popAndFreeUdpardTxItem(&media.udpard_tx(), tx_item, false /* single frame */);
-                }
+                // The handler (if any) just said that it's NOT fine to continue with transferring to
+                // other media TX queues, and the error should not be ignored but propagated outside.
+                return failure;
+            }
+        }
+
+        return cetl::nullopt;
+    }
 
+    /// @brief Tries to send next frame from media band TX queue (or from a TX stream) to the band socket.
+    ///
+    void sendNextFrameToMediaTxSocket(Media& media, TxBand& tx_band, ITxSocket& tx_socket)
+    {
+        TimePoint     tx_deadline;
+        UdpardTxItem* tx_item   = peekFirstValidTxItem(tx_band.udpard_tx(), tx_deadline);
+        TxStream*     tx_stream = peekFirstValidTxStream(media, tx_band);
+        while ((tx_item != nullptr) || (tx_stream != nullptr))
+        {
+            // A stream goes first only if it has strictly higher priority - so that queued transfers
+            // of the same priority are not postponed by a (potentially very long) stream.
+            //
+            const bool is_stream_turn =
+                (tx_stream != nullptr) && ((tx_item == nullptr) || (tx_stream->priority() < tx_item->priority));
+
+            const bool is_sent = is_stream_turn
+                                     ? trySendTxStreamFrame(media, tx_band, tx_socket, *tx_stream)
+                                     : trySendTxItem(media, tx_band, tx_socket, *tx_item, tx_deadline);
+            if (is_sent)
+            {
                 // If needed schedule (recursively!) next frame for sending.
                 // Already existing callback will be called by executor when TX socket is ready to send more.
                 //
-                if (!media.txSocketState().callback)
+                if (!tx_band.socketState().callback)
                 {
-                    media.txSocketState().callback =
-                        tx_socket.registerCallback([this, &media, &tx_socket](const auto&) {
+                    tx_band.socketState().callback =
+                        tx_socket.registerCallback([this, &media, &tx_band, &tx_socket](const auto&) {
                             //
-                            sendNextFrameToMediaTxSocket(media, tx_socket);
+                            sendNextFrameToMediaTxSocket(media, tx_band, tx_socket);
                         });
                 }
+                updateTxCapacityOnDrain();
                 return;
             }
 
-            // Release whole problematic transfer from the TX queue,
-            // so that other transfers in TX queue have their chance.
-            // Otherwise, we would be stuck in an execution loop trying to send the same frame.
-            popAndFreeUdpardTxItem(&media.udpard_tx(), tx_item, true /* whole transfer */);
+            tx_item   = peekFirstValidTxItem(tx_band.udpard_tx(), tx_deadline);
+            tx_stream = peekFirstValidTxStream(media, tx_band);
 
-            using Report = TransientErrorReport::MediaTxSocketSend;
-            (void) tryHandleTransientMediaError<Report>(media, std::move(*send_failure), tx_socket);
-
-        }  // for a valid tx item
+        }  // for a valid tx item or stream
 
         // There is nothing to send anymore, so we are done with this media TX socket - no more callbacks for now.
-        media.txSocketState().callback.reset();
+        tx_band.socketState().callback.reset();
+        updateTxCapacityOnDrain();
+    }
+
+    /// @brief Gets occupancy of the fullest TX queue (across all media and their priority bands).
+    ///
+    CETL_NODISCARD transport::detail::MsgTxCapacityRegistry::Occupancy getTxOccupancy()
+    {
+        transport::detail::MsgTxCapacityRegistry::Occupancy occupancy{0, tx_capacity_};
+        for (Media& media : media_array_)
+        {
+            for (TxBand& tx_band : media.txBands())
+            {
+                occupancy.queued_frames = std::max(occupancy.queued_frames, tx_band.udpard_tx().queue_size);
+            }
+        }
+        return occupancy;
+    }
+
+    void updateTxCapacityOnPush(const cetl::optional<AnyFailure>& failure)
+    {
+        using Registry = transport::detail::MsgTxCapacityRegistry;
+
+        tx_capacity_registry_.onTxPush([this] { return getTxOccupancy(); }, Registry::isOutOfCapacity(failure));
+    }
+
+    /// Notifications are delivered from the executor (rather than right here) b/c TX queues are drained
+    /// from within `send` of any session as well - callbacks of other sessions must not run in the middle of it.
+    ///
+    void updateTxCapacityOnDrain()
+    {
+        if (tx_capacity_registry_.isEmpty())
+        {
+            return;
+        }
+
+        if (!tx_capacity_callback_)
+        {
+            tx_capacity_callback_ = executor_.registerCallback([this](const auto&) {
+                //
+                tx_capacity_registry_.onTxDrain([this] { return getTxOccupancy(); });
+            });
+        }
+
+        const bool result = tx_capacity_callback_.schedule(IExecutor::Callback::Schedule::Once{executor_.now()});
+        (void) result;
+        CETL_DEBUG_ASSERT(result, "Unexpected failure to schedule TX capacity notification.");
+    }
+
+    /// @brief Tries to send the given TX item to the socket.
+    ///
+    /// @return `true` if the socket has handled the frame (either accepted or not ready yet);
+    ///         `false` if the socket has failed, and so the whole transfer has been dropped.
+    ///
+    bool trySendTxItem(Media&          media,
+                       TxBand&         tx_band,
+                       ITxSocket&      tx_socket,
+                       UdpardTxItem&   tx_item,
+                       const TimePoint tx_deadline)
+    {
+        using PayloadFragment = cetl::span<const cetl::byte>;
+
+        // No Sonar `cpp:S5356` and `cpp:S5357` b/c we integrate here with C libudpard API.
+        const auto* const buffer =
+            static_cast<const cetl::byte*>(tx_item.datagram_payload.data);  // NOSONAR cpp:S5356 cpp:S5357
+        const std::array<PayloadFragment, 1> single_payload_fragment{
+            PayloadFragment{buffer, tx_item.datagram_payload.size}};
+
+        ITxSocket::SendResult::Type send_result =
+            tx_socket.send(tx_deadline,
+                           {tx_item.destination.ip_address, tx_item.destination.udp_port},
+                           tx_item.dscp,
+                           single_payload_fragment);
+
+        // In case of socket send error we are going to drop this problematic frame
+        // (b/c it looks like media TX socket can't handle this frame),
+        // but we will continue to try process other transfer frame.
+        // Note that socket not being ready/able to send a frame just yet (aka temporary)
+        // is not reported as an error (see `is_accepted` below).
+        //
+        auto* const send_failure = cetl::get_if<ITxSocket::SendResult::Failure>(&send_result);
+        if (nullptr == send_failure)
+        {
+            const auto sent = cetl::get<ITxSocket::SendResult::Success>(send_result);
+            if (sent.is_accepted)
+            {
+                if (sent.tx_timestamp)
+                {
+                    acceptTxTimestamp(single_payload_fragment.front(), *sent.tx_timestamp);
+                }
+                popAndFreeUdpardTxItem(&tx_band.udpard_tx(), &tx_item, false /* single frame */);
+            }
+            return true;
+        }
+
+        // Release whole problematic transfer from the TX queue,
+        // so that other transfers in TX queue have their chance.
+        // Otherwise, we would be stuck in an execution loop trying to send the same frame.
+        popAndFreeUdpardTxItem(&tx_band.udpard_tx(), &tx_item, true /* whole transfer */);
+
+        using Report = TransientErrorReport::MediaTxSocketSend;
+        (void) tryHandleTransientMediaError<Report>(media, std::move(*send_failure), tx_socket);
+        return false;
+    }
+
+    /// @brief Reports TX timestamp of a message transfer, which first datagram has been sent by a socket.
+    ///
+    void acceptTxTimestamp(const cetl::span<const cetl::byte> datagram, const TimePoint tx_timestamp)
+    {
+        if (tx_timestamping_registry_.isEmpty())
+        {
+            return;
+        }
+
+        const auto header = FrameCodec::deserializeHeader(datagram);
+        if ((!header) || (header->frame_index != 0) || header->isService())
+        {
+            return;
+        }
+
+        if (auto* const node = tx_timestamping_registry_.findNode(header->getPortId()))
+        {
+            node->acceptTxTimestamp(header->transfer_id, 0 /* no modulo */, tx_timestamp);
+        }
+    }
+
+    /// @brief Tries to build and send the next datagram of the given TX stream to the socket.
+    ///
+    /// @return `true` if the socket has handled the datagram (either accepted or not ready yet);
+    ///         `false` if the stream has failed (and so has been dropped) for this media.
+    ///
+    bool trySendTxStreamFrame(Media& media, TxBand& tx_band, ITxSocket& tx_socket, TxStream& tx_stream)
+    {
+        using PayloadFragment = cetl::span<const cetl::byte>;
+
+        const std::uint8_t media_index = media.index();
+
+        const PayloadFragment datagram = tx_stream.buildNextDatagramFor(media_index, tx_socket.getMtu());
+        if (datagram.empty())
+        {
+            // Either out of memory, or the payload source has failed to provide the next chunk.
+            finishTxStreamFor(media, tx_stream);
+            return false;
+        }
+        const std::array<PayloadFragment, 1> single_payload_fragment{datagram};
+
+        const auto priority_index = static_cast<std::size_t>(tx_stream.priority());
+        const auto dscp           = tx_band.udpard_tx().dscp_value_per_priority[priority_index];  // NOLINT
+
+        ITxSocket::SendResult::Type send_result =
+            tx_socket.send(tx_stream.deadline(), tx_stream.endpoint(), dscp, single_payload_fragment);
+
+        auto* const send_failure = cetl::get_if<ITxSocket::SendResult::Failure>(&send_result);
+        if (nullptr == send_failure)
+        {
+            const auto sent = cetl::get<ITxSocket::SendResult::Success>(send_result);
+            if (sent.is_accepted)
+            {
+                tx_stream.commitFor(media_index);
+                if (tx_stream.isDoneFor(media_index))
+                {
+                    finishTxStreamFor(media, tx_stream);
+                }
+            }
+            return true;
+        }
+
+        // Drop the whole problematic stream for this media (similar to a regular transfer).
+        finishTxStreamFor(media, tx_stream);
+
+        using Report = TransientErrorReport::MediaTxSocketSend;
+        (void) tryHandleTransientMediaError<Report>(media, std::move(*send_failure), tx_socket);
+        return false;
+    }
+
+    /// @brief Peeks the highest priority (and the oldest among the same priority) stream of the media band.
+    ///
+    /// While peeking, any of already expired streams are finished (and maybe released) for the media.
+    /// If there is no still valid stream for the media band, returns `nullptr`.
+    ///
+    CETL_NODISCARD TxStream* peekFirstValidTxStream(Media& media, TxBand& tx_band)
+    {
+        const TimePoint now = executor_.now();
+
+        while (TxStream* const tx_stream = tx_band.txStreams().peek())
+        {
+            // We use strictly `<` (instead of `<=`) to be consistent with TX queue items.
+            if (now < tx_stream->deadline())
+            {
+                return tx_stream;
+            }
+            finishTxStreamFor(media, *tx_stream);
+        }
+        return nullptr;
+    }
+
+    CETL_NODISCARD bool hasTxStreamFor(const PortId subject_id)
+    {
+        for (TxStream* tx_stream = tx_streams_head_; tx_stream != nullptr; tx_stream = tx_stream->next())
+        {
+            if (tx_stream->subjectId() == subject_id)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    CETL_NODISCARD bool hasMsgTxSessionFor(const PortId subject_id) const noexcept
+    {
+        return nullptr != msg_tx_session_nodes_.search([subject_id](const MsgTxSessionNode& node) {  //
+            return node.compareBySubjectId(subject_id);
+        });
+    }
+
+    void linkTxStream(TxStream& tx_stream)
+    {
+        tx_stream.next() = tx_streams_head_;
+        if (tx_streams_head_ != nullptr)
+        {
+            tx_streams_head_->prev() = &tx_stream;
+        }
+        tx_streams_head_ = &tx_stream;
+    }
+
+    /// @brief Finishes the stream for the media, and removes it from the media band queue.
+    ///
+    /// Unlike `finishTxStreamFor`, the stream is never released here (even if it's done for all media).
+    ///
+    void dequeueTxStreamFor(Media& media, TxStream& tx_stream)
+    {
+        media.txBand(getTxBandIndexOf(tx_stream.priority())).txStreams().remove(tx_stream, media.index());
+        tx_stream.finishFor(media.index());
+    }
+
+    void finishTxStreamFor(Media& media, TxStream& tx_stream)
+    {
+        dequeueTxStreamFor(media, tx_stream);
+        if (tx_stream.isDone())
+        {
+            releaseTxStream(tx_stream);
+        }
+    }
+
+    void releaseTxStream(TxStream& tx_stream)
+    {
+        if (tx_stream.prev() == nullptr)
+        {
+            CETL_DEBUG_ASSERT(tx_streams_head_ == &tx_stream, "Stream must be in the list.");
+            tx_streams_head_ = tx_stream.next();
+        }
+        else
+        {
+            tx_stream.prev()->next() = tx_stream.next();
+        }
+        if (tx_stream.next() != nullptr)
+        {
+            tx_stream.next()->prev() = tx_stream.prev();
+        }
+
+        // No Sonar cpp:M23_329 b/c we do our own low-level PMR management here.
+        tx_stream.~TxStream();  // NOSONAR cpp:M23_329
+        tx_streams_allocator_.deallocate(&tx_stream, 1);
     }
 
     /// @brief Tries to peek the first TX item from the media TX queue which is not expired.
@@ -788,55 +1507,159 @@ private:
                 return cetl::nullopt;
             }
 
-            using ErrorReport = TransientErrorReport::MediaMakeRxSocket;
-
-            auto rx_socket_result = media.interface().makeRxSocket(endpoint.value());
-            if (auto* const failure = cetl::get_if<IMedia::MakeRxSocketResult::Failure>(&rx_socket_result))
+            cetl::optional<AnyFailure> failure =
+                tryMakeMediaRxSocket(media, socket_state, [&endpoint](IMedia& media_interface) {
+                    //
+                    return media_interface.makeRxSocket(endpoint.value());
+                });
+            if (nullptr == socket_state.interface)
             {
-                return tryHandleTransientMediaError<ErrorReport>(media, std::move(*failure), media.interface());
+                return failure;
             }
+        }
+
+        return std::forward<Action>(action)(media, socket_state, std::forward<Args>(args)...);
+    }
+
+    /// @brief Tries to make a new media RX socket (using the given factory function of the media interface).
+    ///
+    /// On success the socket is stored in the socket state. Otherwise, the failure is passed to the transient
+    /// error handler, and the socket state is left without the socket.
+    ///
+    template <typename MakeSocket>
+    CETL_NODISCARD cetl::optional<AnyFailure> tryMakeMediaRxSocket(Media&                  media,
+                                                                   SocketState<IRxSocket>& socket_state,
+                                                                   MakeSocket&&            make_socket)
+    {
+        using ErrorReport = TransientErrorReport::MediaMakeRxSocket;
 
-            socket_state.interface = cetl::get<IMedia::MakeRxSocketResult::Success>(std::move(rx_socket_result));
+        auto rx_socket_result = std::forward<MakeSocket>(make_socket)(media.interface());
+        if (auto* const failure = cetl::get_if<IMedia::MakeRxSocketResult::Failure>(&rx_socket_result))
+        {
+            return tryHandleTransientMediaError<ErrorReport>(media, std::move(*failure), media.interface());
+        }
+
+        socket_state.interface = cetl::get<IMedia::MakeRxSocketResult::Success>(std::move(rx_socket_result));
+        if (nullptr == socket_state.interface)
+        {
+            return tryHandleTransientMediaError<ErrorReport, cetl::variant<MemoryError>>(media,
+                                                                                         MemoryError{},
+                                                                                         media.interface());
+        }
+        return cetl::nullopt;
+    }
+
+    /// @brief Makes the media frame monitor RX socket (if there is a frame monitor session, and the socket is missing),
+    ///        and starts receiving from it (if not yet).
+    ///
+    CETL_NODISCARD cetl::optional<AnyFailure> withEnsureMediaFrameMonitorRxSocket(Media& media)
+    {
+        if (nullptr == frame_monitor_rx_session_)
+        {
+            return cetl::nullopt;
+        }
+
+        SocketState<IRxSocket>& socket_state = media.frameMonitorRxSocketState();
+        if (nullptr == socket_state.interface)
+        {
+            const FrameMonitorRxParams params  = frame_monitor_rx_session_->getFrameMonitorParams();
+            cetl::optional<AnyFailure> failure =
+                tryMakeMediaRxSocket(media, socket_state, [&params](IMedia& media_interface) {
+                    //
+                    return media_interface.makeFrameMonitorRxSocket(params);
+                });
             if (nullptr == socket_state.interface)
             {
-                return tryHandleTransientMediaError<ErrorReport, cetl::variant<MemoryError>>(media,
-                                                                                             MemoryError{},
-                                                                                             media.interface());
+                return failure;
             }
         }
 
-        return std::forward<Action>(action)(media, socket_state, std::forward<Args>(args)...);
+        if (!socket_state.callback)
+        {
+            socket_state.callback =
+                socket_state.interface->registerCallback([this, &media, &socket_state](const auto&) {
+                    //
+                    receiveNextMonitorFrame(media, socket_state);
+                });
+        }
+        return cetl::nullopt;
     }
 
     template <typename Action>
     CETL_NODISCARD cetl::optional<AnyFailure> withMediaMsgRxSockets(RxSessionTreeNode::Message& msg_rx_node,
                                                                     const Action&               action)
+    {
+        for (Media& media : media_array_)
+        {
+            cetl::optional<AnyFailure> failure = withMediaMsgRxSocket(media, msg_rx_node, action);
+            if (failure.has_value())
+            {
+                return failure;
+            }
+        }
+
+        return cetl::nullopt;
+    }
+
+    template <typename Action>
+    CETL_NODISCARD cetl::optional<AnyFailure> withMediaMsgRxSocket(Media&                      media,
+                                                                   RxSessionTreeNode::Message& msg_rx_node,
+                                                                   const Action&               action)
     {
         IMsgRxSessionDelegate* const session_delegate = msg_rx_node.delegate();
-        if (nullptr != session_delegate)
+        if (nullptr == session_delegate)
         {
-            auto&      subscription = session_delegate->getSubscription();
-            const auto endpoint =
-                cetl::optional<IpEndpoint>{IpEndpoint::fromUdpardEndpoint(subscription.udp_ip_endpoint)};
+            return cetl::nullopt;
+        }
 
-            for (Media& media : media_array_)
+        auto&      subscription = session_delegate->getSubscription();
+        const auto endpoint = cetl::optional<IpEndpoint>{IpEndpoint::fromUdpardEndpoint(subscription.udp_ip_endpoint)};
+
+        return withEnsureMediaRxSocket(media,
+                                       endpoint,
+                                       msg_rx_node.socketState(media.index()),
+                                       action,
+                                       subscription,
+                                       *session_delegate);
+    }
+
+    template <typename Action>
+    CETL_NODISCARD cetl::optional<AnyFailure> withMediaMsgStreamRxSockets(RxSessionTreeNode::Message& msg_rx_node,
+                                                                          const Action&               action)
+    {
+        for (Media& media : media_array_)
+        {
+            cetl::optional<AnyFailure> failure = withMediaMsgStreamRxSocket(media, msg_rx_node, action);
+            if (failure.has_value())
             {
-                cetl::optional<AnyFailure> failure = withEnsureMediaRxSocket(media,
-                                                                             endpoint,
-                                                                             msg_rx_node.socketState(media.index()),
-                                                                             action,
-                                                                             subscription,
-                                                                             *session_delegate);
-                if (failure.has_value())
-                {
-                    return failure;
-                }
+                return failure;
             }
         }
 
         return cetl::nullopt;
     }
 
+    template <typename Action>
+    CETL_NODISCARD cetl::optional<AnyFailure> withMediaMsgStreamRxSocket(Media&                      media,
+                                                                         RxSessionTreeNode::Message& msg_rx_node,
+                                                                         const Action&               action)
+    {
+        IMsgStreamRxSessionDelegate* const session_delegate = msg_rx_node.streamDelegate();
+        if (nullptr == session_delegate)
+        {
+            return cetl::nullopt;
+        }
+
+        const auto endpoint =
+            cetl::optional<IpEndpoint>{FrameCodec::makeSubjectEndpoint(session_delegate->getSubjectId())};
+
+        return withEnsureMediaRxSocket(media,
+                                       endpoint,
+                                       msg_rx_node.socketState(media.index()),
+                                       action,
+                                       *session_delegate);
+    }
+
     template <typename Action>
     CETL_NODISCARD cetl::optional<AnyFailure> withMediaSvcRxSockets(const Action& action)
     {
@@ -853,6 +1676,60 @@ private:
         return cetl::nullopt;
     }
 
+    /// @brief Makes an action which starts receiving messages from a media RX socket (if not yet).
+    ///
+    auto makeMsgRxSocketAction()
+    {
+        return [this](const auto& media, auto& socket_state, auto& subscription, auto& session_delegate)
+                   -> cetl::optional<AnyFailure> {
+            //
+            if (!socket_state.callback)
+            {
+                socket_state.callback = socket_state.interface->registerCallback(
+                    [this, &media, &socket_state, &subscription, &session_delegate](const auto&) {
+                        //
+                        receiveNextMessageFrame(media, socket_state, subscription, session_delegate);
+                    });
+            }
+            return cetl::nullopt;
+        };
+    }
+
+    /// @brief Makes an action which starts receiving message stream datagrams from a media RX socket (if not yet).
+    ///
+    auto makeMsgStreamRxSocketAction()
+    {
+        return [this](const auto& media, auto& socket_state, auto& session_delegate) -> cetl::optional<AnyFailure> {
+            //
+            if (!socket_state.callback)
+            {
+                socket_state.callback = socket_state.interface->registerCallback(
+                    [this, &media, &socket_state, &session_delegate](const auto&) {
+                        //
+                        receiveNextMessageStreamFrame(media, socket_state, session_delegate);
+                    });
+            }
+            return cetl::nullopt;
+        };
+    }
+
+    /// @brief Makes an action which starts receiving service frames from a media shared RX socket (if not yet).
+    ///
+    auto makeSvcRxSocketAction()
+    {
+        return [this](auto& media, auto& socket_state) -> cetl::optional<AnyFailure> {
+            //
+            if (!socket_state.callback)
+            {
+                socket_state.callback = socket_state.interface->registerCallback([this, &media, &socket_state](auto) {
+                    //
+                    receiveNextServiceFrame(media, socket_state);
+                });
+            }
+            return cetl::nullopt;
+        };
+    }
+
     CETL_NODISCARD IRxSocket::ReceiveResult::Success tryReceiveFromRxSocket(const Media&            media,
                                                                             SocketState<IRxSocket>& socket_state)
     {
@@ -930,7 +1807,7 @@ private:
     void receiveNextMessageFrame(const Media&            media,
                                  SocketState<IRxSocket>& socket_state,
                                  UdpardRxSubscription&   subscription,
-                                 IRxSessionDelegate&     session_delegate)
+                                 IMsgRxSessionDelegate&  session_delegate)
     {
         // 1. Try to receive a frame from the media RX socket.
         //
@@ -955,6 +1832,19 @@ private:
         CETL_DEBUG_ASSERT(payload_deleter.resource() == memoryResources().payload.user_reference,
                           "PMR of deleter is expected to be the same as the payload memory resource.");
 
+        const auto frame_priority =
+            static_cast<Priority>(FrameCodec::peekPriority({rx_meta.payload_ptr.get(), payload_deleter.size()}));
+        auto& ledger  = rxReassemblyLedger();
+        auto& account = session_delegate.getRxReassemblyAccount();
+        if (!ledger.admit(account, payload_deleter.size(), frame_priority, rx_meta.timestamp))
+        {
+            // The frame is dropped (and its buffer is freed by the deleter) without passing it to libudpard.
+            return;
+        }
+
+        // Libudpard takes the frame buffer, and gives it back either on discard or as part of a complete transfer.
+        ledger.adopt(account, payload_deleter.size(), frame_priority, rx_meta.timestamp);
+
         UdpardRxTransfer out_transfer{};
 
         const std::int8_t result =
@@ -977,6 +1867,175 @@ private:
         }
     }
 
+    void receiveNextMessageStreamFrame(const Media&                 media,
+                                       SocketState<IRxSocket>&      socket_state,
+                                       IMsgStreamRxSessionDelegate& session_delegate)
+    {
+        auto opt_rx_meta = tryReceiveFromRxSocket(media, socket_state);
+        if (!opt_rx_meta)
+        {
+            return;
+        }
+        const auto& rx_meta = *opt_rx_meta;
+
+        // In contrast to `receiveNextMessageFrame`, the datagram is not passed to libudpard (which would keep it
+        // until the whole transfer is reassembled), but to the session directly. The datagram buffer is released
+        // right after the session has consumed it (on exit from this method).
+        //
+        const auto payload_size = rx_meta.payload_ptr.get_deleter().size();
+        session_delegate.acceptRxDatagram(rx_meta.timestamp, {rx_meta.payload_ptr.get(), payload_size});
+    }
+
+    void receiveNextMonitorFrame(const Media& media, SocketState<IRxSocket>& socket_state)
+    {
+        auto opt_rx_meta = tryReceiveFromRxSocket(media, socket_state);
+        if ((!opt_rx_meta) || (nullptr == frame_monitor_rx_session_))
+        {
+            return;
+        }
+        const auto& rx_meta = *opt_rx_meta;
+
+        // Similar to `receiveNextMessageStreamFrame`, the datagram is parsed and passed to the session directly,
+        // and its buffer is released right after the session has consumed it (on exit from this method).
+        //
+        const auto payload_size = rx_meta.payload_ptr.get_deleter().size();
+        acceptFrameMonitorRxDatagram(media, rx_meta.timestamp, {rx_meta.payload_ptr.get(), payload_size});
+    }
+
+    /// @brief Parses a received datagram (according to the Cyphal/UDP Specification), and passes it to the monitor.
+    ///
+    /// Datagrams which are not valid Cyphal/UDP frames (f.e. with wrong header CRC) are not passed.
+    ///
+    void acceptFrameMonitorRxDatagram(const Media&                       media,
+                                      const TimePoint                    timestamp,
+                                      const cetl::span<const cetl::byte> datagram)
+    {
+        using Kind = FrameMonitorRxMetadata::Kind;
+
+        const auto opt_header = FrameCodec::deserializeHeader(datagram);
+        if (!opt_header)
+        {
+            return;
+        }
+        const auto& header = *opt_header;
+
+        // Own datagrams (f.e. looped back by the multicast) are not delivered.
+        if ((getNodeId() <= UDPARD_NODE_ID_MAX) && (header.source_node_id == getNodeId()))
+        {
+            return;
+        }
+
+        FrameMonitorRxMetadata metadata{};
+        metadata.rx_meta.base.transfer_id = header.transfer_id;
+        metadata.rx_meta.base.priority    = static_cast<Priority>(header.priority);
+        metadata.rx_meta.timestamp        = timestamp;
+        metadata.media_index              = media.index();
+        metadata.port_id                  = header.getPortId();
+        metadata.is_start_of_transfer     = header.frame_index == 0;
+        metadata.is_end_of_transfer       = header.end_of_transfer;
+        if (header.source_node_id <= UDPARD_NODE_ID_MAX)
+        {
+            metadata.source_node_id = header.source_node_id;
+        }
+
+        if (!header.isService())
+        {
+            metadata.kind = Kind::Message;
+        }
+        else
+        {
+            metadata.kind                = header.isRequest() ? Kind::Request : Kind::Response;
+            metadata.destination_node_id = header.destination_node_id;
+        }
+
+        frame_monitor_rx_session_->acceptRxFrame(metadata, datagram.subspan(FrameCodec::HeaderSize));
+    }
+
+    /// @brief Makes RX sockets of the (just added) media for all existing RX sessions, and starts receiving.
+    ///
+    CETL_NODISCARD cetl::optional<AnyFailure> ensureMediaRxSocketsOf(Media& media)
+    {
+        cetl::optional<AnyFailure> failure;
+        msg_rx_session_nodes_.forEachNode([this, &media, &failure](auto& msg_rx_node) {
+            //
+            if (!failure.has_value())
+            {
+                failure = withMediaMsgRxSocket(media, msg_rx_node, makeMsgRxSocketAction());
+            }
+            if (!failure.has_value())
+            {
+                failure = withMediaMsgStreamRxSocket(media, msg_rx_node, makeMsgStreamRxSocketAction());
+            }
+        });
+        if (failure.has_value())
+        {
+            return failure;
+        }
+
+        failure = withEnsureMediaFrameMonitorRxSocket(media);
+        if (failure.has_value())
+        {
+            return failure;
+        }
+
+        if (svc_request_rx_session_nodes_.isEmpty() && svc_response_rx_session_nodes_.isEmpty())
+        {
+            return cetl::nullopt;
+        }
+        return withEnsureMediaRxSocket(media,
+                                       svc_rx_sockets_endpoint_,
+                                       media.svcRxSocketState(),
+                                       makeSvcRxSocketAction());
+    }
+
+    /// @brief Releases all resources of the media (including its slot).
+    ///
+    /// Streams which are still in progress for the media are finished for it (and so maybe released),
+    /// and datagrams still queued for the media are dropped. All media sockets are released as well.
+    ///
+    void releaseMedia(Media& media)
+    {
+        const std::uint8_t media_index = media.index();
+
+        TxStream* tx_stream = tx_streams_head_;
+        while (tx_stream != nullptr)
+        {
+            TxStream* const next_stream = tx_stream->next();
+            if (!tx_stream->isDoneFor(media_index))
+            {
+                finishTxStreamFor(media, *tx_stream);
+            }
+            tx_stream = next_stream;
+        }
+
+        for (TxBand& tx_band : media.txBands())
+        {
+            flushUdpardTxQueue(tx_band.udpard_tx());
+        }
+
+        // Callbacks are reset before their sockets (the same order as at the socket state destruction).
+        msg_rx_session_nodes_.forEachNode([media_index](auto& msg_rx_node) {
+            //
+            SocketState<IRxSocket>& socket_state = msg_rx_node.socketState(media_index);
+            socket_state.callback.reset();
+            socket_state.interface.reset();
+        });
+
+        // The rest of the media sockets (TX bands and shared service RX ones) are released together with the media.
+        media_array_.resetAt(media_index);
+    }
+
+    void releaseFrameMonitorRxSockets()
+    {
+        // Callbacks are reset before their sockets (the same order as at the socket state destruction).
+        for (Media& media : media_array_)
+        {
+            SocketState<IRxSocket>& socket_state = media.frameMonitorRxSocketState();
+            socket_state.callback.reset();
+            socket_state.interface.reset();
+        }
+    }
+
     void cancelRxCallbacksIfNoSvcLeft()
     {
         if (svc_request_rx_session_nodes_.isEmpty() && svc_response_rx_session_nodes_.isEmpty())
@@ -990,13 +2049,22 @@ private:
 
     // MARK: Data members:
 
-    IExecutor&                               executor_;
-    MediaArray                               media_array_;
-    TransientErrorHandler                    transient_error_handler_;
-    SessionTree<RxSessionTreeNode::Message>  msg_rx_session_nodes_;
-    SessionTree<RxSessionTreeNode::Request>  svc_request_rx_session_nodes_;
-    SessionTree<RxSessionTreeNode::Response> svc_response_rx_session_nodes_;
-    cetl::optional<IpEndpoint>               svc_rx_sockets_endpoint_;
+    IExecutor&                                   executor_;
+    MediaArray                                   media_array_;
+    const std::size_t                            tx_capacity_;
+    const TxPriorityBandsSpec                    tx_bands_spec_;
+    TransientErrorHandler                        transient_error_handler_;
+    SessionTree<RxSessionTreeNode::Message>      msg_rx_session_nodes_;
+    SessionTree<RxSessionTreeNode::Request>      svc_request_rx_session_nodes_;
+    SessionTree<RxSessionTreeNode::Response>     svc_response_rx_session_nodes_;
+    common::cavl::Tree<MsgTxSessionNode>         msg_tx_session_nodes_;
+    cetl::optional<IpEndpoint>                   svc_rx_sockets_endpoint_;
+    libcyphal::detail::PmrAllocator<TxStream>    tx_streams_allocator_;
+    TxStream*                                    tx_streams_head_{nullptr};
+    transport::detail::MsgTxTimestampingRegistry tx_timestamping_registry_;
+    transport::detail::MsgTxCapacityRegistry     tx_capacity_registry_;
+    IExecutor::Callback::Any                     tx_capacity_callback_;
+    IFrameMonitorRxSessionDelegate*              frame_monitor_rx_session_{nullptr};
 
 };  // TransportImpl
 
@@ -1008,16 +2076,22 @@ private:
 ///
 /// @param mem_res_spec Specification of polymorphic memory resources to use for all allocations.
 /// @param executor Interface of the executor to use.
-/// @param media Collection of redundant media interfaces to use.
-/// @param tx_capacity Total number of frames that can be queued for transmission per `IMedia` instance.
+/// @param media Collection of redundant media interfaces to use. Size of the span (but not more than 3) also defines
+///              max number of media which the transport could have at once - extra `nullptr` entries reserve room
+///              for media which might be added later (see `IUdpTransport::addMedia`).
+/// @param tx_capacity Total number of frames that can be queued for transmission per `IMedia` instance
+///                    (per each of its priority bands).
+/// @param tx_bands_spec Specifies how TX path of each media is split into priority bands.
+///                      By default, there is a single band (and so a single TX socket) per media.
 /// @return Unique pointer to the new UDP transport instance or a failure.
 ///
 inline Expected<UniquePtr<IUdpTransport>, FactoryFailure> makeTransport(const MemoryResourcesSpec& mem_res_spec,
                                                                         IExecutor&                 executor,
                                                                         const cetl::span<IMedia*>  media,
-                                                                        const std::size_t          tx_capacity)
+                                                                        const std::size_t          tx_capacity,
+                                                                        const TxPriorityBandsSpec& tx_bands_spec = {})
 {
-    return detail::TransportImpl::make(mem_res_spec, executor, media, tx_capacity);
+    return detail::TransportImpl::make(mem_res_spec, executor, media, tx_capacity, tx_bands_spec);
 }
 
 }  // namespace udp
@@ -0,0 +1,233 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/port_list_producer.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/node/port/List_0_1.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPortListProducer : public testing::Test
+{
+protected:
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectMessageTxSession(StrictMock<MessageTxSessionMock>& msg_tx_session_mock, const PortId subject_id)
+    {
+        const MessageTxParams tx_params{subject_id};
+        EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([this, &msg_tx_session_mock](const auto&) {                  //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+            }));
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<TransportMock>       transport_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestPortListProducer, make)
+{
+    using Message = node::PortListProducer::Message;
+
+    StrictMock<MessageTxSessionMock> list_tx_session_mock;
+    expectMessageTxSession(list_tx_session_mock, Message::_traits_::FixedPortId);
+
+    StrictMock<MessageTxSessionMock> other_tx_session_mock;
+    expectMessageTxSession(other_tx_session_mock, 147);
+
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::nullopt));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<node::PortListProducer> port_list_producer;
+    cetl::optional<Publisher<void>>        other_publisher;
+    std::vector<TimePoint>                 sends;
+
+    EXPECT_CALL(list_tx_session_mock, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto& metadata, const auto&) {
+            //
+            EXPECT_THAT(metadata.base.priority, Priority::Optional);
+            EXPECT_THAT(metadata.deadline, now() + 1s);
+            sends.push_back(now());
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_port_list_producer = node::PortListProducer::make(presentation);
+        ASSERT_THAT(maybe_port_list_producer, VariantWith<node::PortListProducer>(_));
+        port_list_producer.emplace(cetl::get<node::PortListProducer>(std::move(maybe_port_list_producer)));
+    });
+    scheduler_.scheduleAt(2s + 500ms, [&](const auto&) {
+        //
+        // Anonymous node doesn't publish anything, but as soon as it has node ID, the list is published.
+        EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+            .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+    });
+    scheduler_.scheduleAt(5s + 500ms, [&](const auto&) {
+        //
+        auto maybe_pub = presentation.makePublisher<void>(147);
+        ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+        other_publisher.emplace(cetl::get<Publisher<void>>(std::move(maybe_pub)));
+    });
+    scheduler_.scheduleAt(6s + 500ms, [&](const auto&) {
+        //
+        // Changes faster than the check period are accumulated.
+        other_publisher.reset();
+        auto maybe_pub = presentation.makePublisher<void>(147);
+        ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+        other_publisher.emplace(cetl::get<Publisher<void>>(std::move(maybe_pub)));
+    });
+    scheduler_.scheduleAt(6s + 600ms, [&](const auto&) {
+        //
+        other_publisher.reset();
+    });
+    scheduler_.scheduleAt(19s + 500ms, [&](const auto&) {
+        //
+        port_list_producer.reset();
+    });
+    scheduler_.spinFor(30s);
+
+    EXPECT_THAT(sends, ElementsAre(TimePoint{3s}, TimePoint{6s}, TimePoint{7s}, TimePoint{17s}));
+}
+
+TEST_F(TestPortListProducer, make_failure)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(_))  //
+        .WillOnce(Return(libcyphal::ArgumentError{}));
+
+    EXPECT_THAT(node::PortListProducer::make(presentation),
+                VariantWith<Presentation::MakeFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+}
+
+TEST_F(TestPortListProducer, move)
+{
+    static_assert(std::is_move_constructible<node::PortListProducer>::value, "Should be move constructible.");
+    static_assert(!std::is_copy_assignable<node::PortListProducer>::value, "Should not be copy assignable.");
+    static_assert(!std::is_move_assignable<node::PortListProducer>::value, "Should not be move assignable.");
+    static_assert(!std::is_copy_constructible<node::PortListProducer>::value, "Should not be copy constructible.");
+    static_assert(!std::is_default_constructible<node::PortListProducer>::value,
+                  "Should not be default constructible.");
+
+    StrictMock<MessageTxSessionMock> list_tx_session_mock;
+    expectMessageTxSession(list_tx_session_mock, node::PortListProducer::Message::_traits_::FixedPortId);
+
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    std::vector<TimePoint>                 sends;
+    cetl::optional<node::PortListProducer> port_list_producer1;
+    cetl::optional<node::PortListProducer> port_list_producer2;
+
+    EXPECT_CALL(list_tx_session_mock, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto&, const auto&) {
+            //
+            sends.push_back(now());
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_port_list_producer = node::PortListProducer::make(presentation);
+        ASSERT_THAT(maybe_port_list_producer, VariantWith<node::PortListProducer>(_));
+        port_list_producer1.emplace(cetl::get<node::PortListProducer>(std::move(maybe_port_list_producer)));
+    });
+    scheduler_.scheduleAt(2s + 500ms, [&](const auto&) {
+        //
+        // The moved producer keeps track of what has been published already.
+        port_list_producer2.emplace(std::move(*port_list_producer1));
+    });
+    scheduler_.scheduleAt(11s + 500ms, [&](const auto&) {
+        //
+        port_list_producer1.reset();
+        port_list_producer2.reset();
+    });
+    scheduler_.spinFor(15s);
+
+    EXPECT_THAT(sends, ElementsAre(TimePoint{1s}, TimePoint{11s}));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,212 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/time/time_sync_master.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/time/Synchronization_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTimeSyncMaster : public testing::Test
+{
+protected:
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using Message            = uavcan::time::Synchronization_1_0;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    /// Decodes `previous_transmission_timestamp_microsecond` (little-endian `uint56`) of a sent message.
+    static std::uint64_t decodePreviousTxTimestamp(const PayloadFragments payload_fragments)
+    {
+        std::uint64_t result = 0;
+        const auto&   bytes  = payload_fragments[0];
+        for (std::size_t i = bytes.size(); i > 0; --i)
+        {
+            result = (result << 8U) | static_cast<std::uint8_t>(bytes[i - 1]);
+        }
+        return result;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<TransportMock>       transport_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestTimeSyncMaster, make)
+{
+    IMessageTxSession::OnTxTimestampCallback::Function tx_ts_cb_fn;
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    constexpr MessageTxParams        tx_params{Message::_traits_::FixedPortId};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+    EXPECT_CALL(msg_tx_session_mock, setOnTxTimestampCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {                 //
+            tx_ts_cb_fn = std::forward<IMessageTxSession::OnTxTimestampCallback::Function>(cb_fn);
+        }));
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    std::vector<std::tuple<TimePoint, TransferId, std::uint64_t>> messages;
+    EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto& metadata, const auto payload_fragments) {
+            //
+            EXPECT_THAT(metadata.deadline, now() + 1s);
+            messages.emplace_back(now(), metadata.base.transfer_id, decodePreviousTxTimestamp(payload_fragments));
+            return cetl::nullopt;
+        }));
+
+    cetl::optional<time::TimeSyncMaster> time_sync_master;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_master = time::TimeSyncMaster::make(presentation);
+        ASSERT_THAT(maybe_master, VariantWith<time::TimeSyncMaster>(_));
+        time_sync_master.emplace(cetl::get<time::TimeSyncMaster>(std::move(maybe_master)));
+        EXPECT_TRUE(tx_ts_cb_fn);
+    });
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        tx_ts_cb_fn({1, TimePoint{1s + 7us}});
+    });
+    scheduler_.scheduleAt(3s + 100ms, [&](const auto&) {
+        //
+        // Late report of a much older message - should not be used.
+        tx_ts_cb_fn({2, TimePoint{2s - 600ms}});
+    });
+    scheduler_.scheduleAt(4s + 100ms, [&](const auto&) {
+        //
+        tx_ts_cb_fn({4, TimePoint{4s + 3us}});
+    });
+    scheduler_.scheduleAt(4s + 500ms, [&](const auto&) {
+        //
+        time_sync_master.emplace(std::move(*time_sync_master));
+        EXPECT_TRUE(tx_ts_cb_fn);
+    });
+    scheduler_.scheduleAt(5s + 500ms, [&](const auto&) {
+        //
+        time_sync_master.reset();
+        EXPECT_FALSE(tx_ts_cb_fn);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(messages,
+                ElementsAre(std::make_tuple(TimePoint{1s}, 1, 0),
+                            std::make_tuple(TimePoint{2s}, 2, 1000007),
+                            std::make_tuple(TimePoint{3s}, 3, 0),
+                            std::make_tuple(TimePoint{4s}, 4, 0),
+                            std::make_tuple(TimePoint{5s}, 5, 4000003)));
+}
+
+TEST_F(TestTimeSyncMaster, make_anonymous)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    constexpr MessageTxParams        tx_params{Message::_traits_::FixedPortId};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+    EXPECT_CALL(msg_tx_session_mock, setOnTxTimestampCallback(_)).WillRepeatedly(Return());
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::nullopt));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<time::TimeSyncMaster> time_sync_master;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_master = time::TimeSyncMaster::make(presentation);
+        ASSERT_THAT(maybe_master, VariantWith<time::TimeSyncMaster>(_));
+        time_sync_master.emplace(cetl::get<time::TimeSyncMaster>(std::move(maybe_master)));
+    });
+    scheduler_.scheduleAt(3s + 500ms, [&](const auto&) {
+        //
+        time_sync_master.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
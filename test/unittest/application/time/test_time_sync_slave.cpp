@@ -0,0 +1,231 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/time/time_sync_slave.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/time/Synchronization_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTimeSyncSlave : public testing::Test
+{
+protected:
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using Message            = uavcan::time::Synchronization_1_0;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    StrictMock<TransportMock>              transport_mock_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestTimeSyncSlave, make)
+{
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn;
+
+    StrictMock<MessageRxSessionMock> msg_rx_session_mock;
+    constexpr MessageRxParams        rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            msg_rx_cb_fn = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    Message test_message{mr_alloc_};
+
+    NiceMock<ScatteredBufferStorageMock> storage_mock;
+    ScatteredBufferStorageMock::Wrapper  storage{&storage_mock};
+    EXPECT_CALL(storage_mock, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+    EXPECT_CALL(storage_mock, copy(0, _, _))                           //
+        .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+            //
+            std::array<std::uint8_t, Message::_traits_::SerializationBufferSizeBytes> buffer{};
+            const auto result = serialize(test_message, buffer);
+            const auto size   = std::min(result.value(), len);
+            (void) std::memmove(dst, buffer.data(), size);
+            return size;
+        }));
+
+    MessageRxTransfer transfer{{{{0, Priority::Nominal}, {}}, cetl::nullopt}, ScatteredBuffer{std::move(storage)}};
+
+    const auto deliver = [&](const cetl::optional<NodeId> master, const TransferId tid, const std::uint64_t prev_tx) {
+        //
+        test_message.previous_transmission_timestamp_microsecond = prev_tx;
+        transfer.metadata.rx_meta.base.transfer_id               = tid;
+        transfer.metadata.rx_meta.timestamp                      = now();
+        transfer.metadata.publisher_node_id                      = master;
+        msg_rx_cb_fn({transfer});
+    };
+
+    cetl::optional<time::TimeSyncSlave> time_sync_slave;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_slave = time::TimeSyncSlave::make(presentation);
+        ASSERT_THAT(maybe_slave, VariantWith<time::TimeSyncSlave>(_));
+        time_sync_slave.emplace(cetl::get<time::TimeSyncSlave>(std::move(maybe_slave)));
+        ASSERT_TRUE(msg_rx_cb_fn);
+
+        EXPECT_THAT(time_sync_slave->now(), Eq(cetl::nullopt));
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Eq(cetl::nullopt));
+
+        // The very first message - there is nothing to compare its timestamp with.
+        deliver(NodeId{10}, 5, 0);
+        EXPECT_THAT(time_sync_slave->getOffset(), Eq(cetl::nullopt));
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Optional(NodeId{10}));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Master clock is 100s ahead of ours (the previous message was sent at 1s of our clock).
+        deliver(NodeId{10}, 6, 101000000);
+        EXPECT_THAT(time_sync_slave->getOffset(), Optional(libcyphal::Duration{100s}));
+        EXPECT_THAT(time_sync_slave->now(), Optional(TimePoint{102s}));
+    });
+    scheduler_.scheduleAt(2s + 500ms, [&](const auto&) {
+        //
+        // Master with higher node ID is ignored while the current one is alive.
+        deliver(NodeId{20}, 0, 123);
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Optional(NodeId{10}));
+        EXPECT_THAT(time_sync_slave->getOffset(), Optional(libcyphal::Duration{100s}));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Lost message #7 - the timestamp belongs to an unknown message, so the offset is kept as is.
+        deliver(NodeId{10}, 8, 999);
+        EXPECT_THAT(time_sync_slave->getOffset(), Optional(libcyphal::Duration{100s}));
+    });
+    scheduler_.scheduleAt(3s + 500ms, [&](const auto&) {
+        //
+        // Master with lower node ID takes over, and synchronization starts over.
+        deliver(NodeId{5}, 1, 555);
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Optional(NodeId{5}));
+        EXPECT_THAT(time_sync_slave->getOffset(), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(4s + 500ms, [&](const auto&) {
+        //
+        deliver(NodeId{5}, 2, 53500000);
+        EXPECT_THAT(time_sync_slave->getOffset(), Optional(libcyphal::Duration{50s}));
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        time_sync_slave.emplace(std::move(*time_sync_slave));
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Optional(NodeId{5}));
+        EXPECT_THAT(time_sync_slave->getOffset(), Optional(libcyphal::Duration{50s}));
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        deliver(NodeId{5}, 3, 54500000);
+        EXPECT_THAT(time_sync_slave->now(), Optional(TimePoint{56s}));
+    });
+    scheduler_.scheduleAt(9s + 100ms, [&](const auto&) {
+        //
+        // The master is lost.
+        EXPECT_THAT(time_sync_slave->now(), Eq(cetl::nullopt));
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Eq(cetl::nullopt));
+
+        // Anonymous masters are ignored.
+        deliver(cetl::nullopt, 4, 55500000);
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(10s, [&](const auto&) {
+        //
+        deliver(NodeId{7}, 31, 0);
+        EXPECT_THAT(time_sync_slave->getMasterNodeId(), Optional(NodeId{7}));
+        EXPECT_THAT(time_sync_slave->getOffset(), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(11s, [&](const auto&) {
+        //
+        // Wrapped around (5-bit) CAN transfer ID is still consecutive.
+        deliver(NodeId{7}, 0, 11000000);
+        EXPECT_THAT(time_sync_slave->getOffset(), Optional(libcyphal::Duration{1s}));
+    });
+    scheduler_.scheduleAt(12s, [&](const auto&) {
+        //
+        time_sync_slave.reset();
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(20s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -35,11 +35,13 @@ using namespace libcyphal::platform;  // NOLINT This our main concern here in th
 
 using testing::Eq;
 using testing::Ge;
+using testing::Field;
 using testing::Le;
 using testing::AllOf;
 using testing::IsNull;
 using testing::Return;
 using testing::NotNull;
+using testing::Optional;
 using testing::InSequence;
 using testing::StrictMock;
 using testing::ElementsAre;
@@ -452,6 +454,63 @@ TEST_F(TestSingleThreadedExecutor, spinOnce_worsth_lateness)
                             std::make_tuple(1, start_time + 7ms, start_time + 15ms)));
 }
 
+TEST_F(TestSingleThreadedExecutor, repeat_overrun_policies)
+{
+    using Overrun = Schedule::Repeat::Overrun;
+
+    const auto test_policy = [](const Overrun overrun) {
+        //
+        MySingleThreadedExecutor executor;
+
+        std::vector<TimePoint> exec_times;
+
+        auto cb = executor.registerCallback([&](const auto& arg) {
+            //
+            exec_times.push_back(arg.exec_time);
+        });
+        EXPECT_THAT(cb.getOverrunStats(), Optional(Field(&Callback::OverrunStats::overruns, 0)));
+        EXPECT_TRUE(cb.schedule(Schedule::Repeat{TimePoint{10ms}, 5ms, overrun, 2 /* max_burst */}));
+
+        // On time execution, and then a stall till +33ms (periods @ 15, 20, 25 & 30ms are late).
+        for (const auto virtual_now : {TimePoint{10ms}, TimePoint{33ms}, TimePoint{35ms}})
+        {
+            EXPECT_CALL(executor.now_mock_, now()).WillRepeatedly(Return(virtual_now));
+            (void) executor.spinOnce();
+        }
+
+        const auto stats = cb.getOverrunStats();
+        EXPECT_THAT(stats, Optional(Field(&Callback::OverrunStats::max_lateness, Duration{18ms})));
+        return std::make_tuple(exec_times,
+                               stats.value_or(Callback::OverrunStats{}).overruns,
+                               stats.value_or(Callback::OverrunStats{}).missed_periods);
+    };
+
+    // All missed periods are executed back-to-back.
+    EXPECT_THAT(test_policy(Overrun::CatchUp),
+                std::make_tuple(std::vector<TimePoint>{TimePoint{10ms},
+                                                       TimePoint{15ms},
+                                                       TimePoint{20ms},
+                                                       TimePoint{25ms},
+                                                       TimePoint{30ms},
+                                                       TimePoint{35ms}},
+                                3U,
+                                0U));
+
+    // Missed periods are skipped, but the phase is kept.
+    EXPECT_THAT(test_policy(Overrun::Skip),
+                std::make_tuple(std::vector<TimePoint>{TimePoint{10ms}, TimePoint{15ms}, TimePoint{35ms}}, 1U, 3U));
+
+    // Only two missed periods are executed back-to-back.
+    EXPECT_THAT(test_policy(Overrun::LimitBurst),
+                std::make_tuple(std::vector<TimePoint>{TimePoint{10ms},
+                                                       TimePoint{15ms},
+                                                       TimePoint{20ms},
+                                                       TimePoint{25ms},
+                                                       TimePoint{35ms}},
+                                3U,
+                                1U));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
@@ -32,6 +32,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <string>
@@ -685,6 +686,82 @@ TEST_F(TestClient, multiple_requests_responses_expired)
                             FieldsAre("1", TimePoint{5000ms}, TimePoint{5000ms})));
 }
 
+TEST_F(TestClient, multiple_clients_responses_expired)
+{
+    using Service       = uavcan::node::GetInfo_1_0;
+    using SvcResPromise = ResponsePromise<Service::Response>;
+
+    constexpr ResponseRxParams rx_params_a{Service::Response::_traits_::ExtentBytes,
+                                           Service::Request::_traits_::FixedPortId,
+                                           0x31};
+    constexpr ResponseRxParams rx_params_b{Service::Response::_traits_::ExtentBytes,
+                                           Service::Request::_traits_::FixedPortId,
+                                           0x32};
+
+    State state_a{mr_, transport_mock_, rx_params_a};
+    State state_b{mr_, transport_mock_, rx_params_b};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client_a = presentation.makeClient<Service>(rx_params_a.server_node_id);
+    ASSERT_THAT(maybe_client_a, VariantWith<ServiceClient<Service>>(_));
+    cetl::optional<ServiceClient<Service>> client_a = cetl::get<ServiceClient<Service>>(std::move(maybe_client_a));
+
+    auto maybe_client_b = presentation.makeClient<Service>(rx_params_b.server_node_id);
+    ASSERT_THAT(maybe_client_b, VariantWith<ServiceClient<Service>>(_));
+    cetl::optional<ServiceClient<Service>> client_b = cetl::get<ServiceClient<Service>>(std::move(maybe_client_b));
+
+    std::vector<std::tuple<std::string, TimePoint, TimePoint>> responses;
+    std::vector<SvcResPromise>                                 promises;
+    promises.reserve(4);
+
+    const auto request = [&](ServiceClient<Service>& client,
+                             State&                  state,
+                             const char* const       name,
+                             const TimePoint         response_deadline) {
+        EXPECT_CALL(state.req_tx_session_mock_, send(_, _)).WillOnce(Return(cetl::nullopt));
+
+        auto maybe_promise = client.request(now() + 100ms, Service::Request{mr_alloc_}, response_deadline);
+        ASSERT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+        promises.emplace_back(cetl::get<SvcResPromise>(std::move(maybe_promise)));
+        promises.back().setCallback([&responses, name](const auto& arg) {
+            //
+            ASSERT_THAT(arg.result, VariantWith<ResponsePromiseFailure>(VariantWith<ResponsePromiseExpired>(_)));
+            auto failure = cetl::get<ResponsePromiseFailure>(std::move(arg.result));
+            auto expired = cetl::get<ResponsePromiseExpired>(std::move(failure));
+            responses.emplace_back(name, expired.deadline, arg.approx_now);
+        });
+    };
+
+    // Deadlines of the both clients are interleaved, and so should be their expirations.
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        request(*client_a, state_a, "A1", now() + 4s);
+        request(*client_b, state_b, "B1", now() + 2s);
+        request(*client_a, state_a, "A2", now() + 1500ms);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        request(*client_b, state_b, "B2", now() + 2s);
+
+        // Extend deadline of the currently nearest one (A2) - B1 should become the nearest.
+        promises[2].setDeadline(now() + 3s + 500ms);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        promises.clear();
+        client_a.reset();
+        client_b.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(responses,
+                ElementsAre(FieldsAre("B1", TimePoint{3s}, TimePoint{3s}),
+                            FieldsAre("B2", TimePoint{4s}, TimePoint{4s}),
+                            FieldsAre("A1", TimePoint{5s}, TimePoint{5s}),
+                            FieldsAre("A2", TimePoint{5s + 500ms}, TimePoint{5s + 500ms})));
+}
+
 TEST_F(TestClient, raw_request_response_via_callabck)
 {
     using SvcResPromise = ResponsePromise<void>;
@@ -829,6 +906,92 @@ TEST_F(TestClient, raw_request_response_failures)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestClient, raw_request_retransmissions)
+{
+    using SvcResPromise = ResponsePromise<void>;
+
+    constexpr ResponseRxParams rx_params{4, 147, 0x31};
+
+    State state{mr_, transport_mock_, rx_params};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client = presentation.makeClient(rx_params.server_node_id, rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_client, VariantWith<RawServiceClient>(_));
+    cetl::optional<RawServiceClient> client = cetl::get<RawServiceClient>(std::move(maybe_client));
+    EXPECT_THAT(client->getRequestPolicy().retransmissions, 0);
+    client->setRequestPolicy({2});
+
+    std::vector<std::tuple<TransferId, TimePoint, TimePoint, std::size_t>> sends;
+    EXPECT_CALL(state.req_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto& metadata, const auto fragments) {
+            //
+            std::size_t payload_size = 0;
+            for (const auto& fragment : fragments)
+            {
+                payload_size += fragment.size();
+            }
+            sends.emplace_back(metadata.base.transfer_id, now(), metadata.deadline, payload_size);
+            return cetl::nullopt;
+        }));
+
+    const std::array<cetl::byte, 3>                         payload{};
+    const std::array<const cetl::span<const cetl::byte>, 1> fragments{payload};
+
+    cetl::optional<SvcResPromise>                        response_promise1;
+    cetl::optional<SvcResPromise>                        response_promise2;
+    std::vector<std::tuple<TransferId, bool, TimePoint>> results;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // The 1st request is going to be responded, the 2nd - expired.
+        auto maybe_promise = client->request(now() + 50ms, fragments, now() + 300ms);
+        ASSERT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+        response_promise1.emplace(cetl::get<SvcResPromise>(std::move(maybe_promise)));
+
+        maybe_promise = client->request(now() + 50ms, fragments, now() + 300ms);
+        ASSERT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+        response_promise2.emplace(cetl::get<SvcResPromise>(std::move(maybe_promise)));
+
+        for (auto* const promise : {&response_promise1, &response_promise2})
+        {
+            (*promise)->setCallback([&results](const auto& arg) {
+                //
+                if (const auto* const success = cetl::get_if<SvcResPromise::Success>(&arg.result))
+                {
+                    results.emplace_back(success->metadata.rx_meta.base.transfer_id, true, arg.approx_now);
+                    return;
+                }
+                results.emplace_back(0, false, arg.approx_now);
+            });
+        }
+    });
+    scheduler_.scheduleAt(1s + 150ms, [&](const auto&) {
+        //
+        ServiceRxTransfer transfer{{{{0, Priority::Nominal}, now()}, 0x31}, {}};
+        state.res_rx_cb_fn_({transfer});
+
+        // Late duplicate response is dropped.
+        state.res_rx_cb_fn_({transfer});
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        client.reset();
+        response_promise1.reset();
+        response_promise2.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(sends,
+                ElementsAre(FieldsAre(0, TimePoint{1s}, TimePoint{1s + 50ms}, 3),
+                            FieldsAre(1, TimePoint{1s}, TimePoint{1s + 50ms}, 3),
+                            FieldsAre(0, TimePoint{1s + 100ms}, TimePoint{1s + 150ms}, 3),
+                            FieldsAre(1, TimePoint{1s + 100ms}, TimePoint{1s + 150ms}, 3),
+                            FieldsAre(1, TimePoint{1s + 200ms}, TimePoint{1s + 250ms}, 3)));
+    EXPECT_THAT(results,
+                ElementsAre(FieldsAre(0, true, TimePoint{1s + 150ms}), FieldsAre(0, false, TimePoint{1s + 300ms})));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, *-function-cognitive-complexity)
 
 }  // namespace
@@ -37,9 +37,11 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <vector>
 
 namespace
 {
@@ -52,10 +54,12 @@ using namespace libcyphal::transport;     // NOLINT This our main concern here i
 
 using testing::_;
 using testing::Eq;
+using testing::Ne;
 using testing::Invoke;
 using testing::Return;
 using testing::IsEmpty;
 using testing::StrictMock;
+using testing::ElementsAre;
 using testing::VariantWith;
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
@@ -798,6 +802,88 @@ TEST_F(TestPresentation, makeClient_with_failure)
     }
 }
 
+TEST_F(TestPresentation, forEachPortId)
+{
+    using Service = uavcan::node::GetInfo_1_0;
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    constexpr MessageTxParams        tx_params{147};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+
+    StrictMock<MessageRxSessionMock> msg_rx_session_mock;
+    constexpr MessageRxParams        rx_params{0, 42};
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_)).WillRepeatedly(Return());
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+    StrictMock<RequestRxSessionMock>  req_rx_session_mock;
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_)).WillRepeatedly(Return());
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                 //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    const auto collect = [&presentation](const Presentation::PortKind kind) {
+        //
+        std::vector<PortId> port_ids;
+        presentation.forEachPortId(kind, [&port_ids](const PortId port_id) { port_ids.push_back(port_id); });
+        return port_ids;
+    };
+
+    const auto revision0 = presentation.getPortsRevision();
+    EXPECT_THAT(collect(Presentation::PortKind::Publisher), IsEmpty());
+    EXPECT_THAT(collect(Presentation::PortKind::Subscriber), IsEmpty());
+    EXPECT_THAT(collect(Presentation::PortKind::Client), IsEmpty());
+    EXPECT_THAT(collect(Presentation::PortKind::Server), IsEmpty());
+    {
+        auto maybe_pub = presentation.makePublisher<void>(tx_params.subject_id);
+        ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+        const auto revision1 = presentation.getPortsRevision();
+        EXPECT_THAT(revision1, Ne(revision0));
+
+        auto maybe_sub = presentation.makeSubscriber(rx_params.subject_id, rx_params.extent_bytes);
+        ASSERT_THAT(maybe_sub, VariantWith<Subscriber<void>>(_));
+        const auto revision2 = presentation.getPortsRevision();
+        EXPECT_THAT(revision2, Ne(revision1));
+
+        auto maybe_server = presentation.makeServer<Service>();
+        ASSERT_THAT(maybe_server, VariantWith<ServiceServer<Service>>(_));
+        EXPECT_THAT(presentation.getPortsRevision(), Ne(revision2));
+
+        EXPECT_THAT(collect(Presentation::PortKind::Publisher), ElementsAre(tx_params.subject_id));
+        EXPECT_THAT(collect(Presentation::PortKind::Subscriber), ElementsAre(rx_params.subject_id));
+        EXPECT_THAT(collect(Presentation::PortKind::Client), IsEmpty());
+        EXPECT_THAT(collect(Presentation::PortKind::Server), ElementsAre(Service::Request::_traits_::FixedPortId));
+
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+    }
+    // Destroyed ports are not visited anymore (even if their shared objects are still to be released).
+    const auto revision3 = presentation.getPortsRevision();
+    EXPECT_THAT(collect(Presentation::PortKind::Publisher), IsEmpty());
+    EXPECT_THAT(collect(Presentation::PortKind::Subscriber), IsEmpty());
+    EXPECT_THAT(collect(Presentation::PortKind::Server), IsEmpty());
+
+    scheduler_.spinFor(std::chrono::seconds{10});
+    EXPECT_THAT(presentation.getPortsRevision(), revision3);
+}
+
 TEST_F(TestPresentation, tryDeserialize_coverage)
 {
     using namespace libcyphal::presentation::detail;  // NOLINT
@@ -13,6 +13,7 @@
 #include "virtual_time_scheduler.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/config.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/presentation/publisher.hpp>
 #include <libcyphal/transport/errors.hpp>
@@ -26,8 +27,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -43,6 +47,7 @@ using libcyphal::verification_utilities::makeSpansFrom;
 
 using testing::_;
 using testing::Eq;
+using testing::Lt;
 using testing::Invoke;
 using testing::Return;
 using testing::IsEmpty;
@@ -303,6 +308,68 @@ TEST_F(TestPublisher, publishRawData)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestPublisher, publishRawData_compression_max_payload_size)
+{
+    constexpr std::size_t MaxPayloadSize = libcyphal::config::Presentation::RawCompression_MaxPayloadSize();
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    constexpr MessageTxParams        tx_params{123};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_pub = presentation.makePublisher<void>(tx_params.subject_id);
+    ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+    cetl::optional<Publisher<void>> publisher{cetl::get<Publisher<void>>(std::move(maybe_pub))};
+    publisher->setCompression(true);
+
+    // Zeros are perfectly compressible, so only the size decides whether the payload is framed.
+    const std::vector<cetl::byte> payload(MaxPayloadSize + 1, b(0));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // The biggest payload which subscribers could restore is compressed.
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([](const auto&, const auto frags) {
+                //
+                EXPECT_THAT(frags.size(), 1);
+                EXPECT_THAT(frags[0].size(), Lt(MaxPayloadSize));
+                EXPECT_THAT(frags[0][0], b(0xCF));
+                return cetl::nullopt;
+            }));
+
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), MaxPayloadSize}}};
+        EXPECT_THAT(publisher->publish(now() + 200ms, fragments), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // One byte more - and it's sent as is (otherwise subscribers would get the frame instead of the payload).
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&payload](const auto&, const auto frags) {
+                //
+                EXPECT_THAT(frags.size(), 1);
+                EXPECT_THAT(frags[0].data(), payload.data());
+                EXPECT_THAT(frags[0].size(), MaxPayloadSize + 1);
+                return cetl::nullopt;
+            }));
+
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+        EXPECT_THAT(publisher->publish(now() + 200ms, fragments), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        publisher.reset();
+        testing::Mock::VerifyAndClearExpectations(&msg_tx_session_mock);
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
@@ -0,0 +1,196 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "memory_resource_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/raw_compression.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::MemoryError;
+using libcyphal::ArgumentError;
+using libcyphal::presentation::detail::RawCompression;
+using libcyphal::presentation::detail::RawPayloadBuffer;
+using libcyphal::transport::ScatteredBuffer;
+using libcyphal::verification_utilities::b;
+
+using cetl::byte;
+
+using testing::_;
+using testing::Return;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::ElementsAreArray;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+
+class TestRawCompression : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    ScatteredBuffer compress(const cetl::span<const byte> payload)
+    {
+        const std::array<const cetl::span<const byte>, 1> fragments{payload};
+
+        auto frame = RawCompression::compress(mr_, fragments);
+        EXPECT_THAT(frame, VariantWith<RawPayloadBuffer>(_));
+        return ScatteredBuffer{std::move(cetl::get<RawPayloadBuffer>(frame))};
+    }
+
+    std::vector<byte> decompress(const ScatteredBuffer& frame)
+    {
+        auto payload = RawCompression::decompress(mr_, frame);
+        EXPECT_THAT(payload, VariantWith<RawPayloadBuffer>(_));
+        const auto span = cetl::get<RawPayloadBuffer>(payload).getSpan();
+        return {span.begin(), span.end()};
+    }
+
+    static std::vector<byte> makeText(const std::size_t size)
+    {
+        static const char* const Text = "The quick brown fox jumps over the lazy dog. ";
+
+        std::vector<byte> text;
+        for (std::size_t i = 0; text.size() < size; ++i)
+        {
+            text.push_back(b(static_cast<std::uint8_t>(Text[i % 45])));  // NOLINT
+        }
+        return text;
+    }
+
+    static std::vector<byte> makeNoise(const std::size_t size)
+    {
+        std::vector<byte> noise;
+        std::uint32_t     state = 1;
+        while (noise.size() < size)
+        {
+            state = (state * 1103515245U) + 12345U;  // NOLINT
+            noise.push_back(b(static_cast<std::uint8_t>(state >> 24U)));
+        }
+        return noise;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestRawCompression, compressible_round_trip)
+{
+    const auto text = makeText(1000);
+
+    // Fragmented payload is gathered before compression.
+    {
+        const std::array<const cetl::span<const byte>, 2> fragments{cetl::span<const byte>{text.data(), 300},
+                                                                    cetl::span<const byte>{text.data() + 300, 700}};
+
+        auto frame = RawCompression::compress(mr_, fragments);
+        ASSERT_THAT(frame, VariantWith<RawPayloadBuffer>(_));
+        const ScatteredBuffer frame_buffer{std::move(cetl::get<RawPayloadBuffer>(frame))};
+
+        EXPECT_TRUE(RawCompression::hasFrameMarker(frame_buffer));
+        EXPECT_THAT(frame_buffer.size(), testing::Lt(text.size() / 4));
+        EXPECT_THAT(decompress(frame_buffer), ElementsAreArray(text));
+    }
+
+    // Long runs of the same byte (overlapping matches with long length extensions).
+    {
+        const std::vector<byte> zeros(5000, b(0));
+        const auto              frame = compress(zeros);
+        EXPECT_THAT(frame.size(), testing::Lt(64));
+        EXPECT_THAT(decompress(frame), ElementsAreArray(zeros));
+    }
+}
+
+TEST_F(TestRawCompression, incompressible_round_trip)
+{
+    const auto noise = makeNoise(1000);
+    const auto frame = compress(noise);
+    EXPECT_TRUE(RawCompression::hasFrameMarker(frame));
+    EXPECT_THAT(frame.size(), noise.size() + RawCompression::HeaderSize);
+    EXPECT_THAT(decompress(frame), ElementsAreArray(noise));
+
+    const std::vector<byte> tiny{b(1), b(2)};
+    EXPECT_THAT(decompress(compress(tiny)), ElementsAreArray(tiny));
+
+    const std::vector<byte> empty;
+    const auto              empty_frame = compress(empty);
+    EXPECT_THAT(empty_frame.size(), RawCompression::HeaderSize);
+    EXPECT_THAT(decompress(empty_frame), IsEmpty());
+}
+
+TEST_F(TestRawCompression, legacy_and_malformed_payloads)
+{
+    // Uncompressed (legacy) payload has no marker.
+    {
+        const auto            text = makeText(100);
+        RawPayloadBuffer      legacy{RawPayloadBuffer::make(mr_, text.size()).value()};
+        std::copy(text.begin(), text.end(), legacy.data());
+        legacy.resize(text.size());
+        const ScatteredBuffer legacy_buffer{std::move(legacy)};
+
+        EXPECT_FALSE(RawCompression::hasFrameMarker(legacy_buffer));
+        EXPECT_THAT(RawCompression::decompress(mr_, legacy_buffer),
+                    VariantWith<RawCompression::DecompressFailure>(VariantWith<ArgumentError>(_)));
+    }
+
+    // Truncated compressed frame.
+    {
+        const auto text  = makeText(1000);
+        const auto frame = compress(text);
+
+        RawPayloadBuffer truncated{RawPayloadBuffer::make(mr_, frame.size() - 3).value()};
+        truncated.resize(frame.copy(0, truncated.data(), frame.size() - 3));
+        const ScatteredBuffer truncated_buffer{std::move(truncated)};
+
+        EXPECT_TRUE(RawCompression::hasFrameMarker(truncated_buffer));
+        EXPECT_THAT(RawCompression::decompress(mr_, truncated_buffer),
+                    VariantWith<RawCompression::DecompressFailure>(VariantWith<ArgumentError>(_)));
+    }
+}
+
+TEST_F(TestRawCompression, out_of_memory)
+{
+    StrictMock<MemoryResourceMock> mr_mock;
+    EXPECT_CALL(mr_mock, do_allocate(_, _)).WillRepeatedly(Return(nullptr));
+
+    const auto                                        text = makeText(100);
+    const std::array<const cetl::span<const byte>, 1> fragments{text};
+    EXPECT_THAT(RawCompression::compress(mr_mock, fragments), VariantWith<MemoryError>(_));
+
+    const auto frame = compress(text);
+    EXPECT_THAT(RawCompression::decompress(mr_mock, frame),
+                VariantWith<RawCompression::DecompressFailure>(VariantWith<MemoryError>(_)));
+}
+
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+}  // namespace
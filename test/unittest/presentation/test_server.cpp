@@ -32,6 +32,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -42,6 +43,7 @@ using namespace libcyphal::presentation;  // NOLINT This our main concern here i
 using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
 
 using testing::_;
+using testing::Eq;
 using testing::Invoke;
 using testing::Return;
 using testing::IsEmpty;
@@ -50,6 +52,7 @@ using testing::NiceMock;
 using testing::Optional;
 using testing::StrictMock;
 using testing::VariantWith;
+using testing::ElementsAre;
 
 // https://github.com/llvm/llvm-project/issues/53444
 // NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
@@ -389,6 +392,265 @@ TEST_F(TestServer, raw_request_response)
     EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
 }
 
+TEST_F(TestServer, raw_request_admission_control)
+{
+    using Continuation = RawServiceServer::OnRequestCallback::Continuation;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn;
+    StrictMock<RequestRxSessionMock>               req_rx_session_mock;
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            req_rx_cb_fn = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr RequestRxParams rx_params{0x456, 0x123};
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    constexpr ResponseTxParams tx_params{rx_params.service_id};
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    auto maybe_server = presentation.makeServer(rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_server, VariantWith<RawServiceServer>(_));
+    auto raw_server = cetl::get<RawServiceServer>(std::move(maybe_server));
+
+    ServerAdmission::Params params{};
+    params.max_outstanding_requests = 2;
+    params.client_burst             = 2;
+    params.client_interval          = 100ms;
+    params.shedding_priority        = Priority::Nominal;
+    params.congestion_hold          = 500ms;
+    raw_server.setAdmissionControl(params);
+
+    std::vector<TransferId>   admitted;
+    std::vector<Continuation> continuations;
+    raw_server.setOnRequestCallback([&](const auto& arg, auto cont) {
+        //
+        admitted.push_back(arg.metadata.rx_meta.base.transfer_id);
+        continuations.push_back(std::move(cont));
+    });
+
+    const auto receive = [&](const TransferId transfer_id, const Priority priority, const NodeId client_node_id) {
+        //
+        ServiceRxTransfer request{{{{transfer_id, priority}, now()}, client_node_id}, {}};
+        req_rx_cb_fn({request});
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // The 3rd request exceeds the limit of outstanding requests.
+        receive(1, Priority::Nominal, 0x31);
+        receive(2, Priority::Nominal, 0x31);
+        receive(3, Priority::Nominal, 0x31);
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        EXPECT_CALL(res_tx_session_mock, send(_, _)).WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(continuations.at(0)(now() + 200ms, {}), Eq(cetl::nullopt));
+
+        // The 0x31 client has exhausted its burst, but the 0x32 has not.
+        receive(4, Priority::Nominal, 0x31);
+        receive(5, Priority::Nominal, 0x32);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(res_tx_session_mock, send(_, _)).WillOnce(Return(CapacityError{}));
+        EXPECT_THAT(continuations.at(1)(now() + 200ms, {}), Optional(VariantWith<CapacityError>(_)));
+        continuations.clear();
+
+        // Response TX queue is congested now, so only important enough requests are admitted.
+        receive(6, Priority::Low, 0x31);
+        receive(7, Priority::Fast, 0x31);
+    });
+    scheduler_.scheduleAt(2s + 500ms, [&](const auto&) {
+        //
+        // Congestion is over.
+        receive(8, Priority::Low, 0x33);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        const auto stats = raw_server.getAdmissionStats();
+        EXPECT_THAT(stats.admitted, 5);
+        EXPECT_THAT(stats.rejected_outstanding, 1);
+        EXPECT_THAT(stats.rejected_rate_limited, 1);
+        EXPECT_THAT(stats.rejected_shed, 1);
+
+        // No limits at all when the admission control is disabled.
+        raw_server.setAdmissionControl(cetl::nullopt);
+        receive(9, Priority::Optional, 0x31);
+        receive(10, Priority::Optional, 0x31);
+        receive(11, Priority::Optional, 0x31);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        continuations.clear();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(admitted, ElementsAre(1, 2, 5, 7, 8, 9, 10, 11));
+    EXPECT_THAT(raw_server.getAdmissionStats().admitted, 5);
+
+    EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+}
+
+TEST_F(TestServer, raw_request_admission_rate_limit_after_idle)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn;
+    StrictMock<RequestRxSessionMock>               req_rx_session_mock;
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            req_rx_cb_fn = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr RequestRxParams rx_params{0x456, 0x123};
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    constexpr ResponseTxParams tx_params{rx_params.service_id};
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    auto maybe_server = presentation.makeServer(rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_server, VariantWith<RawServiceServer>(_));
+    auto raw_server = cetl::get<RawServiceServer>(std::move(maybe_server));
+
+    ServerAdmission::Params params{};
+    params.client_burst    = 2;
+    params.client_interval = 100ms;
+    raw_server.setAdmissionControl(params);
+
+    std::vector<TransferId> admitted;
+    raw_server.setOnRequestCallback([&](const auto& arg, auto) {
+        //
+        admitted.push_back(arg.metadata.rx_meta.base.transfer_id);
+    });
+
+    const auto receive = [&](const TransferId transfer_id) {
+        //
+        ServiceRxTransfer request{{{{transfer_id, Priority::Nominal}, now()}, 0x31}, {}};
+        req_rx_cb_fn({request});
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receive(1);
+    });
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        // One token has been earned since then, so the bucket is full again.
+        receive(2);
+        receive(3);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        // Long idle time doesn't accumulate more than the burst.
+        receive(4);
+        receive(5);
+        receive(6);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(admitted, ElementsAre(1, 2, 3, 4, 5));
+    EXPECT_THAT(raw_server.getAdmissionStats().rejected_rate_limited, 1);
+
+    EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+}
+
+TEST_F(TestServer, raw_request_admission_continuation_outlives_server)
+{
+    using Continuation = RawServiceServer::OnRequestCallback::Continuation;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn;
+    StrictMock<RequestRxSessionMock>               req_rx_session_mock;
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            req_rx_cb_fn = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr RequestRxParams rx_params{0x456, 0x123};
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    constexpr ResponseTxParams tx_params{rx_params.service_id};
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    auto maybe_server = presentation.makeServer(rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_server, VariantWith<RawServiceServer>(_));
+    cetl::optional<RawServiceServer> raw_server;
+    raw_server.emplace(cetl::get<RawServiceServer>(std::move(maybe_server)));
+
+    ServerAdmission::Params params{};
+    params.max_outstanding_requests = 2;
+    raw_server->setAdmissionControl(params);
+
+    std::vector<TransferId>   admitted;
+    std::vector<Continuation> continuations;
+    raw_server->setOnRequestCallback([&](const auto& arg, auto cont) {
+        //
+        admitted.push_back(arg.metadata.rx_meta.base.transfer_id);
+        continuations.push_back(std::move(cont));
+    });
+
+    const auto receive = [&](const TransferId transfer_id) {
+        //
+        ServiceRxTransfer request{{{{transfer_id, Priority::Nominal}, now()}, 0x31}, {}};
+        req_rx_cb_fn({request});
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receive(1);
+        receive(2);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Moved server still counts outstanding requests of its continuations.
+        auto moved_server = std::move(*raw_server);
+        raw_server.reset();
+        raw_server.emplace(std::move(moved_server));
+        receive(3);
+
+        continuations.at(0) = Continuation{};
+        receive(4);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Continuations may outlive their server.
+        EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+        raw_server.reset();
+        continuations.clear();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(admitted, ElementsAre(1, 2, 4));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
@@ -12,11 +12,13 @@
 #include "transport/scattered_buffer_storage_mock.hpp"
 #include "transport/transport_gtest_helpers.hpp"
 #include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
 #include "virtual_time_scheduler.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/config.hpp>
 #include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/raw_compression.hpp>
 #include <libcyphal/presentation/subscriber.hpp>
 #include <libcyphal/transport/msg_sessions.hpp>
 #include <libcyphal/transport/types.hpp>
@@ -29,7 +31,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -44,6 +48,7 @@ namespace
 
 using libcyphal::TimePoint;
 using libcyphal::UniquePtr;
+using libcyphal::verification_utilities::b;
 using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
 using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
 
@@ -62,6 +67,7 @@ using testing::UnorderedElementsAre;
 // NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
 using std::literals::chrono_literals::operator""s;
 using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
 // NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
@@ -87,6 +93,38 @@ protected:
         return scheduler_.now();
     }
 
+    std::vector<cetl::byte> compress(const std::vector<cetl::byte>& payload)
+    {
+        using libcyphal::presentation::detail::RawCompression;
+        using libcyphal::presentation::detail::RawPayloadBuffer;
+
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{payload};
+
+        auto frame = RawCompression::compress(mr_, fragments);
+        EXPECT_THAT(frame, VariantWith<RawPayloadBuffer>(_));
+        const auto span = cetl::get<RawPayloadBuffer>(frame).getSpan();
+        return {span.begin(), span.end()};
+    }
+
+    static std::vector<cetl::byte> makeText(const std::size_t size)
+    {
+        static const char* const Text = "The quick brown fox jumps over the lazy dog. ";
+
+        std::vector<cetl::byte> text;
+        for (std::size_t i = 0; text.size() < size; ++i)
+        {
+            text.push_back(b(static_cast<std::uint8_t>(Text[i % 45])));  // NOLINT
+        }
+        return text;
+    }
+
+    static std::vector<cetl::byte> toBytes(const ScatteredBuffer& buffer)
+    {
+        std::vector<cetl::byte> bytes(buffer.size());
+        bytes.resize(buffer.copy(0, bytes.data(), bytes.size()));
+        return bytes;
+    }
+
     // MARK: Data members:
 
     // NOLINTBEGIN
@@ -791,6 +829,234 @@ TEST_F(TestSubscriber, onReceive_different_type_deserializers_on_same_subject)
     EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
 }
 
+TEST_F(TestSubscriber, onReceive_raw_message_decompression)
+{
+    StrictMock<MemoryResourceMock> mr_mock;
+    mr_mock.redirectExpectedCallsTo(mr_);
+
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn;
+
+    StrictMock<MessageRxSessionMock> msg_rx_session_mock;
+    constexpr MessageRxParams        rx_params{4096, 0x123};
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillOnce(Invoke([&](auto&& cb_fn) {                   //
+            msg_rx_cb_fn = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+
+    Presentation presentation{mr_mock, scheduler_, transport_mock_};
+
+    auto maybe_raw_sub = presentation.makeSubscriber(rx_params.subject_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_raw_sub, VariantWith<Subscriber<void>>(_));
+    cetl::optional<Subscriber<void>> raw_subscriber = cetl::get<Subscriber<void>>(std::move(maybe_raw_sub));
+
+    // Decompression is disabled by default.
+    EXPECT_FALSE(raw_subscriber->isDecompressionEnabled());
+    raw_subscriber->setDecompression(true);
+    EXPECT_TRUE(raw_subscriber->isDecompressionEnabled());
+
+    // Payload on the wire is the one which is currently in `wire`.
+    std::vector<cetl::byte>              wire;
+    NiceMock<ScatteredBufferStorageMock> storage_mock;
+    ScatteredBufferStorageMock::Wrapper  storage{&storage_mock};
+    EXPECT_CALL(storage_mock, size()).WillRepeatedly(Invoke([&] { return wire.size(); }));
+    EXPECT_CALL(storage_mock, copy(_, _, _))                                 //
+        .WillRepeatedly(Invoke([&](auto offset, auto* const dst, auto len) {  //
+            const auto from = std::min(offset, wire.size());
+            const auto size = std::min(wire.size() - from, len);
+            (void) std::copy_n(wire.begin() + static_cast<std::ptrdiff_t>(from), size, dst);
+            return size;
+        }));
+
+    std::vector<std::tuple<TransferId, std::vector<cetl::byte>>> messages;
+    raw_subscriber->setOnReceiveCallback([&](const auto& arg) {
+        //
+        messages.emplace_back(arg.metadata.rx_meta.base.transfer_id, toBytes(arg.raw_message));
+    });
+
+    MessageRxTransfer transfer{{{{0, Priority::Fast}, {}}, NodeId{0x31}}, ScatteredBuffer{std::move(storage)}};
+    const auto        receive = [&](const TransferId transfer_id, std::vector<cetl::byte> payload) {
+        wire                                       = std::move(payload);
+        transfer.metadata.rx_meta.base.transfer_id = transfer_id;
+        transfer.metadata.rx_meta.timestamp        = now();
+        msg_rx_cb_fn({transfer});
+    };
+
+    const auto text       = makeText(1000);
+    const auto compressed = compress(text);
+    ASSERT_THAT(compressed.size(), testing::Lt(text.size()));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Compressed payload is delivered decompressed.
+        receive(1, compressed);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Legacy (uncompressed and not framed) payload is passed through.
+        receive(2, text);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Truncated and malformed frames (with the marker) are dropped.
+        receive(3, {compressed.begin(), compressed.end() - 3});
+        receive(4, {compressed.begin(), compressed.begin() + 5});
+        auto unknown_method = compressed;
+        unknown_method[3]   = b(0x7F);
+        receive(5, std::move(unknown_method));
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Allocation failure of the restored payload drops the transfer.
+        EXPECT_CALL(mr_mock, do_allocate(text.size(), _)).WillOnce(Return(nullptr));
+        receive(6, compressed);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        // Memory is back.
+        mr_mock.redirectExpectedCallsTo(mr_);
+        receive(7, compressed);
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        // Disabled decompression delivers the payload unchanged - even the compressed one.
+        raw_subscriber->setDecompression(false);
+        receive(8, compressed);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        raw_subscriber.reset();
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(messages,
+                ElementsAre(std::make_tuple(1, text),
+                            std::make_tuple(2, text),
+                            std::make_tuple(7, text),
+                            std::make_tuple(8, compressed)));
+}
+
+TEST_F(TestSubscriber, rx_metrics)
+{
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn;
+
+    StrictMock<MessageRxSessionMock> msg_rx_session_mock;
+    constexpr MessageRxParams        rx_params{0, 0x123};
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillOnce(Invoke([&](auto&& cb_fn) {                   //
+            msg_rx_cb_fn = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_raw_sub = presentation.makeSubscriber(rx_params.subject_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_raw_sub, VariantWith<Subscriber<void>>(_));
+    cetl::optional<Subscriber<void>> raw_subscriber = cetl::get<Subscriber<void>>(std::move(maybe_raw_sub));
+
+    // Metrics are disabled by default.
+    EXPECT_THAT(raw_subscriber->getRxMetrics(), cetl::nullopt);
+    EXPECT_THAT(raw_subscriber->getRxMetrics(NodeId{0x31}), cetl::nullopt);
+
+    // Transfer ID modulo is queried only once - on the first enabling. CAN-like modulo is used.
+    EXPECT_CALL(transport_mock_, getProtocolParams()).WillOnce(Return(ProtocolParams{32, 0, 0}));
+    EXPECT_THAT(raw_subscriber->enableRxMetrics(), cetl::nullopt);
+    EXPECT_THAT(raw_subscriber->enableRxMetrics(), cetl::nullopt);
+    EXPECT_THAT(raw_subscriber->getRxMetrics(NodeId{0x31}), cetl::nullopt);
+
+    NiceMock<ScatteredBufferStorageMock> storage_mock;
+    ScatteredBufferStorageMock::Wrapper  storage{&storage_mock};
+
+    MessageRxTransfer transfer{{{{30, Priority::Fast}, {}}, NodeId{0x31}}, ScatteredBuffer{std::move(storage)}};
+    const auto        receive = [&](const TransferId transfer_id, const cetl::optional<NodeId> node_id) {
+        transfer.metadata.rx_meta.base.transfer_id = transfer_id;
+        transfer.metadata.rx_meta.timestamp        = now();
+        transfer.metadata.publisher_node_id        = node_id;
+        msg_rx_cb_fn({transfer});
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receive(30, NodeId{0x31});
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        receive(31, NodeId{0x31});
+
+        const auto metrics = raw_subscriber->getRxMetrics(NodeId{0x31});
+        ASSERT_THAT(metrics, Optional(_));
+        EXPECT_THAT(metrics->messages, 2);
+        EXPECT_THAT(metrics->mean_interval, 1s);
+        EXPECT_THAT(metrics->jitter, 0s);
+        EXPECT_THAT(metrics->getRateHz(), 1.0F);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Transfer ID wraps around, and two transfers (#0 and #1) are lost.
+        receive(2, NodeId{0x31});
+    });
+    scheduler_.scheduleAt(3s + 500ms, [&](const auto&) {
+        //
+        receive(2, NodeId{0x31});  // duplicate
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        receive(13, cetl::nullopt);  // anonymous
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        receive(7, NodeId{0x32});
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        receive(5, NodeId{0x32});  // backward jump - not a loss
+    });
+    scheduler_.scheduleAt(7s, [&](const auto&) {
+        //
+        const auto src_31 = raw_subscriber->getRxMetrics(NodeId{0x31});
+        ASSERT_THAT(src_31, Optional(_));
+        EXPECT_THAT(src_31->messages, 4);
+        EXPECT_THAT(src_31->lost, 2);
+        EXPECT_THAT(src_31->duplicates, 1);
+        EXPECT_THAT(src_31->last_timestamp, Optional(TimePoint{3s + 500ms}));
+        EXPECT_THAT(src_31->mean_interval, 1s - 62500us);  // 1s + (500ms - 1s) / 8
+        EXPECT_THAT(src_31->jitter, 31250us);  // 0 + (500ms - 0) / 16
+        EXPECT_THAT(src_31->getAge(now()), Optional(3s + 500ms));
+
+        const auto src_32 = raw_subscriber->getRxMetrics(NodeId{0x32});
+        ASSERT_THAT(src_32, Optional(_));
+        EXPECT_THAT(src_32->messages, 2);
+        EXPECT_THAT(src_32->lost, 0);
+        EXPECT_THAT(src_32->duplicates, 0);
+
+        EXPECT_THAT(raw_subscriber->getRxMetrics(NodeId{0x33}), cetl::nullopt);
+
+        const auto aggregate = raw_subscriber->getRxMetrics();
+        ASSERT_THAT(aggregate, Optional(_));
+        EXPECT_THAT(aggregate->messages, 7);
+        EXPECT_THAT(aggregate->lost, 2);
+        EXPECT_THAT(aggregate->duplicates, 1);
+        EXPECT_THAT(aggregate->getAge(now()), Optional(1s));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        raw_subscriber.reset();
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
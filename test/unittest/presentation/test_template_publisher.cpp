@@ -0,0 +1,200 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/presentation/template_publisher.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/node/Heartbeat_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTemplatePublisher : public testing::Test
+{
+protected:
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    StrictMock<TransportMock>              transport_mock_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestTemplatePublisher, make_patch_publish)
+{
+    using Message = uavcan::node::Heartbeat_1_0;
+
+    static_assert(std::is_copy_constructible<TemplatePublisher<Message>>::value, "Should be copy constructible.");
+    static_assert(std::is_move_constructible<TemplatePublisher<Message>>::value, "Should be move constructible.");
+    static_assert(!std::is_default_constructible<TemplatePublisher<Message>>::value,
+                  "Should not be default constructible.");
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    constexpr MessageTxParams        tx_params{Message::_traits_::FixedPortId};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+
+    auto maybe_pub = presentation.makePublisher<Message>(tx_params.subject_id);
+    ASSERT_THAT(maybe_pub, VariantWith<Publisher<Message>>(_));
+    auto publisher = cetl::get<Publisher<Message>>(std::move(maybe_pub));
+    publisher.setPriority(Priority::Fast);
+
+    Message message{&mr_};
+    message.uptime                      = 0x12345678;
+    message.health.value                = uavcan::node::Health_1_0::ADVISORY;
+    message.vendor_specific_status_code = 0x42;
+
+    auto maybe_template_pub = TemplatePublisher<Message>::make(std::move(publisher), message);
+    ASSERT_THAT(maybe_template_pub, VariantWith<TemplatePublisher<Message>>(_));
+    cetl::optional<TemplatePublisher<Message>> template_pub{
+        cetl::get<TemplatePublisher<Message>>(std::move(maybe_template_pub))};
+    EXPECT_THAT(template_pub->getPriority(), Priority::Fast);
+    EXPECT_THAT(template_pub->getPayload(),
+                ElementsAre(b(0x78), b(0x56), b(0x34), b(0x12), b(1), b(0), b(0x42)));
+
+    // Out of the payload patches are rejected.
+    EXPECT_FALSE(template_pub->patch(4, std::uint32_t{0}));
+    EXPECT_FALSE(template_pub->patch(7, std::uint8_t{0}));
+    EXPECT_FALSE(template_pub->patch(100, std::uint8_t{0}));
+    EXPECT_THAT(template_pub->getPayload().size(), 7);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([now = now()](const auto& metadata, const auto frags) {
+                //
+                EXPECT_THAT(metadata.base.transfer_id, 1);
+                EXPECT_THAT(metadata.base.priority, Priority::Fast);
+                EXPECT_THAT(metadata.deadline, now + 200ms);
+                EXPECT_THAT(frags.size(), 1);
+                EXPECT_THAT(frags[0], ElementsAre(b(0x78), b(0x56), b(0x34), b(0x12), b(1), b(0), b(0x42)));
+                return cetl::nullopt;
+            }));
+
+        EXPECT_THAT(template_pub->publish(now() + 200ms), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([](const auto& metadata, const auto frags) {
+                //
+                EXPECT_THAT(metadata.base.transfer_id, 2);
+                EXPECT_THAT(frags.size(), 1);
+                EXPECT_THAT(frags[0], ElementsAre(b(0x02), b(0x01), b(0), b(0), b(3), b(2), b(0x42)));
+                return cetl::nullopt;
+            }));
+
+        EXPECT_TRUE(template_pub->patch(0, std::uint32_t{0x0102}));
+        EXPECT_TRUE(template_pub->patch(4, std::uint8_t{uavcan::node::Health_1_0::WARNING}));
+        EXPECT_TRUE(template_pub->patch(5, std::uint8_t{uavcan::node::Mode_1_0::MAINTENANCE}));
+        EXPECT_THAT(template_pub->publish(now() + 200ms), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([](const auto&, const auto frags) {
+                //
+                EXPECT_THAT(frags[0], ElementsAre(b(0), b(0), b(0), b(0), b(0), b(0), b(0)));
+                return cetl::nullopt;
+            }));
+
+        // Re-serialization of the whole template.
+        EXPECT_THAT(template_pub->setMessage(Message{&mr_}), Eq(cetl::nullopt));
+        EXPECT_THAT(template_pub->publish(now() + 200ms), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Return(CapacityError{}));
+
+        EXPECT_THAT(template_pub->publish(now() + 200ms), Optional(VariantWith<CapacityError>(_)));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        template_pub.reset();
+        testing::Mock::VerifyAndClearExpectations(&msg_tx_session_mock);
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
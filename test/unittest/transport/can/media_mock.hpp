@@ -45,6 +45,9 @@ public:
                 (const TimePoint deadline, const CanId can_id, MediaPayload& payload),
                 (noexcept, override));
 
+    // NOLINTNEXTLINE(bugprone-exception-escape)
+    MOCK_METHOD(cetl::optional<std::size_t>, getTxInFlightCount, (), (const, noexcept, override));
+
     MOCK_METHOD(PopResult::Type, pop, (const cetl::span<cetl::byte> payload_buffer), (noexcept, override));
 
     MOCK_METHOD(IExecutor::Callback::Any,
@@ -0,0 +1,372 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <canard.h>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/can/fault_injection_media.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/fault_injection.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::IExecutor;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::Optional;
+using testing::ReturnRef;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+auto IsAccepted(const bool is_accepted)
+{
+    return testing::Field(&IMedia::PushResult::Success::is_accepted, is_accepted);
+}
+
+class TestCanFaultInjectionMedia : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        EXPECT_CALL(media_mock_, getTxMemoryResource()).WillRepeatedly(ReturnRef(tx_mr_));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+        EXPECT_THAT(tx_mr_.total_allocated_bytes, tx_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    static CanId makeMessageCanId(const Priority priority, const PortId subject_id)
+    {
+        const auto priority_bits = static_cast<CanId>(priority) << 26U;
+        return priority_bits | (0b11UL << 21U) | (static_cast<CanId>(subject_id) << 8U) | 0x13U;
+    }
+
+    MediaPayload makePayload(const std::size_t size)
+    {
+        auto* const data = static_cast<cetl::byte*>(tx_mr_.allocate(size));
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            data[i] = b(static_cast<std::uint8_t>('0' + i));
+        }
+        return {size, data, size, &tx_mr_};
+    }
+
+    void expectPop(const CanId can_id, const std::uint8_t first_byte)
+    {
+        EXPECT_CALL(media_mock_, pop(_)).WillOnce([this, can_id, first_byte](auto p) {
+            p[0] = b(first_byte);
+            p[1] = b(0xE0);
+            return IMedia::PopResult::Metadata{now(), can_id, 2};
+        });
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    TrackingMemoryResource          tx_mr_;
+    StrictMock<MediaMock>           media_mock_{};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestCanFaultInjectionMedia, no_faults_by_default)
+{
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, {}};
+
+    EXPECT_CALL(media_mock_, getMtu()).WillOnce(Return(CANARD_MTU_CAN_FD));
+    EXPECT_THAT(media.getMtu(), CANARD_MTU_CAN_FD);
+
+    const auto can_id = makeMessageCanId(Priority::Nominal, 7);
+    EXPECT_CALL(media_mock_, push(_, can_id, _)).WillOnce([](auto, auto, auto& payload) {
+        EXPECT_THAT(payload.getSpan(), ElementsAre(b('0'), b('1'), b('2')));
+        return IMedia::PushResult::Success{true /* is_accepted */};
+    });
+    auto payload = makePayload(3);
+    EXPECT_THAT(media.push(now() + 1s, can_id, payload), VariantWith<IMedia::PushResult::Success>(IsAccepted(true)));
+
+    std::array<cetl::byte, CANARD_MTU_MAX> buffer{};
+    expectPop(can_id, 0x42);
+    const auto result = media.pop(buffer);
+    ASSERT_THAT(result, VariantWith<IMedia::PopResult::Success>(Optional(testing::_)));
+    EXPECT_THAT(buffer[0], b(0x42));
+
+    const auto& stats = media.getStats();
+    EXPECT_THAT(stats.dropped + stats.duplicated + stats.corrupted, 0);
+    EXPECT_THAT(stats.delayed + stats.reordered + stats.tx_busy, 0);
+}
+
+TEST_F(TestCanFaultInjectionMedia, rx_drop_per_priority)
+{
+    FaultInjectionParams params{};
+    params.priority_rates[static_cast<std::size_t>(Priority::Low)] = FaultRates{1.0F /* drop */};
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    std::array<cetl::byte, CANARD_MTU_MAX> buffer{};
+
+    expectPop(makeMessageCanId(Priority::Low, 7), 0x42);
+    EXPECT_THAT(media.pop(buffer), VariantWith<IMedia::PopResult::Success>(Eq(cetl::nullopt)));
+
+    expectPop(makeMessageCanId(Priority::High, 7), 0x43);
+    EXPECT_THAT(media.pop(buffer), VariantWith<IMedia::PopResult::Success>(Optional(testing::_)));
+
+    EXPECT_THAT(media.getStats().dropped, 1);
+}
+
+TEST_F(TestCanFaultInjectionMedia, rx_corruption_flips_single_bit)
+{
+    FaultInjectionParams params{};
+    params.rates.corrupt = 1.0F;
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    std::array<cetl::byte, CANARD_MTU_MAX> buffer{};
+    expectPop(makeMessageCanId(Priority::Nominal, 7), 0x00);
+    EXPECT_THAT(media.pop(buffer), VariantWith<IMedia::PopResult::Success>(Optional(testing::_)));
+
+    const auto byte0 = static_cast<std::uint32_t>(buffer[0]);
+    const auto byte1 = static_cast<std::uint32_t>(buffer[1]);
+    EXPECT_THAT(std::bitset<16>{(byte0 << 8U) | (byte1 ^ 0xE0U)}.count(), 1);
+    EXPECT_THAT(media.getStats().corrupted, 1);
+}
+
+TEST_F(TestCanFaultInjectionMedia, rx_delay_and_reorder)
+{
+    FaultInjectionParams params{};
+    params.max_delay  = 50ms;
+    params.port_rates = [](const FaultFrameInfo& info) -> cetl::optional<FaultRates> {
+        //
+        if (info.port_id == 7)
+        {
+            FaultRates rates{};
+            rates.delay = 1.0F;
+            return rates;
+        }
+        if (info.port_id == 8)
+        {
+            FaultRates rates{};
+            rates.reorder = 1.0F;
+            return rates;
+        }
+        return cetl::nullopt;
+    };
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    std::array<cetl::byte, CANARD_MTU_MAX> buffer{};
+    std::vector<std::uint8_t>              delivered;
+
+    IExecutor::Callback::Any pop_callback;
+    EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {         //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        pop_callback = media.registerPopCallback([&](const auto&) {
+            //
+            const auto result = media.pop(buffer);
+            if (const auto* const success = cetl::get_if<IMedia::PopResult::Success>(&result))
+            {
+                if (success->has_value())
+                {
+                    EXPECT_THAT((*success)->timestamp, now());
+                    delivered.push_back(static_cast<std::uint8_t>(buffer[0]));
+                }
+            }
+        });
+
+        // Port 8 frame is held until the next frame (port 9), which has no faults.
+        expectPop(makeMessageCanId(Priority::Nominal, 8), 8);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(delivered, IsEmpty());
+
+        expectPop(makeMessageCanId(Priority::Nominal, 9), 9);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        EXPECT_THAT(delivered, ElementsAre(9, 8));
+
+        // Port 7 frame is delayed (up to the max delay).
+        expectPop(makeMessageCanId(Priority::Nominal, 7), 7);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 60ms, [&](const auto&) {
+        //
+        EXPECT_THAT(delivered, ElementsAre(9, 8, 7));
+        EXPECT_THAT(media.getStats().delayed, 1);
+        EXPECT_THAT(media.getStats().reordered, 1);
+
+        pop_callback.reset();
+        EXPECT_THAT(scheduler_.hasNamedCallback("rx"), false);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestCanFaultInjectionMedia, tx_busy_then_ready)
+{
+    FaultInjectionParams params{};
+    params.tx_busy_duration = 5ms;
+    params.rates.tx_busy    = 1.0F;
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    std::vector<TimePoint> notified;
+
+    IExecutor::Callback::Any push_callback;
+    EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {          //
+            return scheduler_.registerNamedCallback("tx", std::move(function));
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        push_callback = media.registerPushCallback([&](const auto& arg) { notified.push_back(arg.exec_time); });
+
+        auto payload = makePayload(3);
+        EXPECT_THAT(media.push(now() + 1s, makeMessageCanId(Priority::Nominal, 7), payload),
+                    VariantWith<IMedia::PushResult::Success>(IsAccepted(false)));
+        EXPECT_THAT(payload.getSpan().size(), 3);
+        EXPECT_THAT(media.getStats().tx_busy, 1);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(notified, ElementsAre(TimePoint{1s + 5ms}));
+
+        // Media's own notifications are relayed as well.
+        scheduler_.scheduleNamedCallback("tx");
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(notified, ElementsAre(TimePoint{1s + 5ms}, TimePoint{2s}));
+        push_callback.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestCanFaultInjectionMedia, tx_drop_and_duplicate)
+{
+    FaultInjectionParams params{};
+    params.port_rates = [](const FaultFrameInfo& info) -> cetl::optional<FaultRates> {
+        //
+        FaultRates rates{};
+        if (info.port_id == 7)
+        {
+            rates.drop = 1.0F;
+        }
+        else
+        {
+            rates.duplicate = 1.0F;
+        }
+        return rates;
+    };
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    auto dropped = makePayload(3);
+    EXPECT_THAT(media.push(now() + 1s, makeMessageCanId(Priority::Nominal, 7), dropped),
+                VariantWith<IMedia::PushResult::Success>(IsAccepted(true)));
+    EXPECT_THAT(dropped.getSpan().size(), 0);
+
+    const auto can_id = makeMessageCanId(Priority::Nominal, 8);
+    EXPECT_CALL(media_mock_, push(_, can_id, _)).Times(2).WillRepeatedly([](auto, auto, auto& payload) {
+        EXPECT_THAT(payload.getSpan(), ElementsAre(b('0'), b('1')));
+        return IMedia::PushResult::Success{true /* is_accepted */};
+    });
+    auto duplicated = makePayload(2);
+    EXPECT_THAT(media.push(now() + 1s, can_id, duplicated), VariantWith<IMedia::PushResult::Success>(IsAccepted(true)));
+
+    EXPECT_THAT(media.getStats().dropped, 1);
+    EXPECT_THAT(media.getStats().duplicated, 1);
+}
+
+TEST_F(TestCanFaultInjectionMedia, deterministic_by_seed)
+{
+    const auto run = [this](const std::uint64_t seed) {
+        //
+        FaultInjectionParams params{};
+        params.seed       = seed;
+        params.rates.drop = 0.5F;
+
+        FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+        std::vector<bool>                      pattern;
+        std::array<cetl::byte, CANARD_MTU_MAX> buffer{};
+        for (std::uint8_t i = 0; i < 64; ++i)
+        {
+            expectPop(makeMessageCanId(Priority::Nominal, 7), i);
+            const auto result = media.pop(buffer);
+            pattern.push_back(cetl::get<IMedia::PopResult::Success>(result).has_value());
+        }
+        return pattern;
+    };
+
+    const auto pattern_a = run(42);
+    EXPECT_THAT(run(42), Eq(pattern_a));
+    EXPECT_THAT(run(43), testing::Ne(pattern_a));
+    const auto dropped = std::count(pattern_a.begin(), pattern_a.end(), false);
+    EXPECT_THAT(dropped, testing::AllOf(testing::Gt(16), testing::Lt(48)));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,106 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "verification_utilities.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/can/frame_codec.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace
+{
+
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in the unit tests.
+
+using cetl::byte;
+using libcyphal::verification_utilities::b;
+
+using testing::Optional;
+using testing::FieldsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+using FrameCodec = detail::FrameCodec;
+
+// MARK: - Tests:
+
+TEST(TestCanFrameCodec, parseCanId_message)
+{
+    // Heartbeat of node 42 at the nominal priority (see Cyphal/CAN Specification examples).
+    const auto heartbeat = FrameCodec::parseCanId(0x107D552AUL);
+    EXPECT_THAT(heartbeat.priority, Priority::Nominal);
+    EXPECT_FALSE(heartbeat.is_service);
+    EXPECT_FALSE(heartbeat.is_anonymous);
+    EXPECT_THAT(heartbeat.port_id, 7509);
+    EXPECT_THAT(heartbeat.source_node_id, 42);
+
+    // Anonymous message of the max subject ID at the exceptional priority.
+    const auto anonymous = FrameCodec::parseCanId((1UL << 24U) | (0x1FFFUL << 8U) | 0x55U);
+    EXPECT_THAT(anonymous.priority, Priority::Exceptional);
+    EXPECT_FALSE(anonymous.is_service);
+    EXPECT_TRUE(anonymous.is_anonymous);
+    EXPECT_THAT(anonymous.port_id, 0x1FFF);
+}
+
+TEST(TestCanFrameCodec, parseCanId_service)
+{
+    // `uavcan.node.GetInfo` request from node 123 to node 42 at the slow priority.
+    const auto request = FrameCodec::parseCanId((6UL << 26U) | (3UL << 24U) | (430UL << 14U) | (42UL << 7U) | 123U);
+    EXPECT_THAT(request.priority, Priority::Slow);
+    EXPECT_TRUE(request.is_service);
+    EXPECT_TRUE(request.is_request);
+    EXPECT_THAT(request.port_id, 430);
+    EXPECT_THAT(request.source_node_id, 123);
+    EXPECT_THAT(request.destination_node_id, 42);
+
+    // ... and its response.
+    const auto response = FrameCodec::parseCanId((6UL << 26U) | (1UL << 25U) | (430UL << 14U) | (123UL << 7U) | 42U);
+    EXPECT_TRUE(response.is_service);
+    EXPECT_FALSE(response.is_request);
+    EXPECT_THAT(response.port_id, 430);
+    EXPECT_THAT(response.source_node_id, 42);
+    EXPECT_THAT(response.destination_node_id, 123);
+}
+
+TEST(TestCanFrameCodec, parseTailByte)
+{
+    EXPECT_THAT(FrameCodec::parseTailByte({}), cetl::nullopt);
+
+    // Single frame transfer.
+    const std::array<byte, 3> single{b(0x11), b(0x22), b(0xE0 | 0x1F)};
+    EXPECT_THAT(FrameCodec::parseTailByte(single), Optional(FieldsAre(0x1F, true, true)));
+
+    // Middle frame of a multi-frame transfer.
+    const std::array<byte, 2> middle{b(0x11), b(0x05)};
+    EXPECT_THAT(FrameCodec::parseTailByte(middle), Optional(FieldsAre(5, false, false)));
+
+    // Last frame of a multi-frame transfer.
+    const std::array<byte, 1> last{b(0x40 | 0x07)};
+    EXPECT_THAT(FrameCodec::parseTailByte(last), Optional(FieldsAre(7, false, true)));
+}
+
+TEST(TestCanFrameCodec, addTransferCrc)
+{
+    // See Cyphal/CAN Specification - the CRC-16/CCITT-FALSE check value.
+    const std::array<byte, 9> data{b('1'), b('2'), b('3'), b('4'), b('5'), b('6'), b('7'), b('8'), b('9')};
+    const auto crc = FrameCodec::addTransferCrc(FrameCodec::TransferCrcInitial, data.data(), data.size());
+    EXPECT_THAT(crc, 0x29B1);
+    EXPECT_FALSE(FrameCodec::isTransferCrcResidue(crc));
+
+    // The CRC is appended in the big-endian byte order, so the whole transfer yields zero residue.
+    const std::array<byte, 2> crc_bytes{b(0x29), b(0xB1)};
+    EXPECT_TRUE(FrameCodec::isTransferCrcResidue(FrameCodec::addTransferCrc(crc, crc_bytes.data(), crc_bytes.size())));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
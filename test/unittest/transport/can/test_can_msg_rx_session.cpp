@@ -27,7 +27,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <utility>
 
@@ -374,6 +377,116 @@ TEST_F(TestCanMsgRxSession, receive_via_callback)
     scheduler_.spinFor(10s);
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestCanMsgRxSession, rx_reassembly_budget)
+{
+    using Budget = ICanTransport::RxReassemblyBudget;
+
+    auto transport = makeTransport(mr_);
+
+    EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {         //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+    EXPECT_CALL(media_mock_, setFilters(_)).WillRepeatedly(Return(cetl::nullopt));
+
+    // Canard allocates a payload buffer of the extent size per each transfer being reassembled,
+    // so the total budget is enough only for a single multi-frame transfer.
+    constexpr std::size_t Extent = 64;
+
+    auto maybe_session_a = transport->makeMessageRxSession({Extent, 0x23});
+    ASSERT_THAT(maybe_session_a, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session_a = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session_a));
+
+    auto maybe_session_b = transport->makeMessageRxSession({Extent, 0x24});
+    ASSERT_THAT(maybe_session_b, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session_b = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session_b));
+
+    // Either the first frame of a multi-frame transfer, or a single-frame transfer.
+    const auto receive_frame_at = [&](const TimePoint  rx_timestamp,
+                                      const Priority   priority,
+                                      const PortId     subject_id,
+                                      const NodeId     src_node_id,
+                                      const TransferId transfer_id,
+                                      const bool       is_single) {
+        //
+        const auto can_id = (static_cast<std::uint32_t>(priority) << 26U) | 0x60'00'00UL |
+                            (static_cast<std::uint32_t>(subject_id) << 8U) | src_node_id;
+        const auto tail   = static_cast<std::uint8_t>((is_single ? 0b111'00000 : 0b101'00000) | transfer_id);
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([rx_timestamp, can_id, tail](auto p) {
+                std::fill_n(p.begin(), 7, b('x'));
+                p[7] = b(tail);
+                return IMedia::PopResult::Metadata{rx_timestamp, can_id, 8};
+            });
+        scheduler_.scheduleNamedCallback("rx", rx_timestamp);
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        transport->setRxReassemblyBudget(Budget::Params{Extent, 0});
+        receive_frame_at(now() + 10ms, Priority::Low, 0x23, 0x10, 1, false);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        // More important transfer evicts the less important one.
+        receive_frame_at(now() + 10ms, Priority::High, 0x24, 0x11, 1, false);
+    });
+    scheduler_.scheduleAt(1s + 40ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 1);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 0);
+
+        // Less important transfer can't evict the more important one - so it's dropped.
+        receive_frame_at(now() + 10ms, Priority::Low, 0x23, 0x12, 1, false);
+    });
+    scheduler_.scheduleAt(1s + 60ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 1);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 1);
+
+        // Single-frame transfers are not subject to the budget.
+        receive_frame_at(now() + 10ms, Priority::Low, 0x23, 0x31, 5, true);
+    });
+    scheduler_.scheduleAt(1s + 80ms, [&](const auto&) {
+        //
+        EXPECT_THAT(session_a->receive(), Optional(_));
+
+        // Exceptional transfer evicts the high priority one.
+        receive_frame_at(now() + 10ms, Priority::Exceptional, 0x23, 0x32, 1, false);
+    });
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 2);
+
+        // The same priority - the oldest reassembly is evicted (together with canard transfer-ID state of 0x31).
+        receive_frame_at(now() + 10ms, Priority::Exceptional, 0x24, 0x33, 1, false);
+    });
+    scheduler_.scheduleAt(1s + 120ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 3);
+
+        // A redundant copy of the already delivered transfer - it still has to be rejected.
+        receive_frame_at(now() + 10ms, Priority::Low, 0x23, 0x31, 5, true);
+    });
+    scheduler_.scheduleAt(1s + 140ms, [&](const auto&) {
+        //
+        EXPECT_THAT(session_a->receive(), Eq(cetl::nullopt));
+
+        receive_frame_at(now() + 10ms, Priority::Low, 0x23, 0x31, 6, true);
+    });
+    scheduler_.scheduleAt(1s + 160ms, [&](const auto&) {
+        //
+        EXPECT_THAT(session_a->receive(), Optional(_));
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 3);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 1);
+
+        session_a.reset();
+        session_b.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
 TEST_F(TestCanMsgRxSession, unsubscribe)
 {
     auto transport = makeTransport(mr_);
@@ -27,8 +27,12 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -304,6 +308,195 @@ TEST_F(TestCanMsgTxSession, send_when_no_memory_for_contiguous_payload)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestCanMsgTxSession, send_with_tx_timestamps)
+{
+    auto transport = makeTransport(mr_);
+
+    auto maybe_session = transport->makeMessageTxSession({17});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    const auto         payload = makeIotaArray<3>(b('1'));
+    TransferTxMetadata metadata{{0x23, Priority::High}, {}};
+
+    CanId                   sent_can_id{};
+    std::vector<cetl::byte> sent_frame;
+
+    std::vector<std::tuple<TransferId, TimePoint>> timestamps;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, setFilters(_)).WillRepeatedly(Return(cetl::nullopt));
+        EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {         //
+                return scheduler_.registerNamedCallback("rx", std::move(function));
+            }));
+
+        session->setOnTxTimestampCallback([&](const auto& arg) {
+            //
+            timestamps.emplace_back(arg.transfer_id, arg.timestamp);
+        });
+
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .WillOnce([&](auto, auto can_id, auto& pld) {
+                sent_can_id = can_id;
+                sent_frame.assign(pld.getSpan().begin(), pld.getSpan().end());
+                return IMedia::PushResult::Success{true /* is_accepted */};
+            });
+
+        metadata.deadline = now() + 1s;
+        EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // Emulate that the same frame is reported twice (f.e. by redundant media) - only the first report is delivered.
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .Times(2)
+            .WillRepeatedly([&](auto p) {
+                std::copy(sent_frame.begin(), sent_frame.end(), p.begin());
+                return IMedia::PopResult::Metadata{now(), sent_can_id, sent_frame.size(), true /* is_tx_loopback */};
+            });
+        scheduler_.scheduleNamedCallback("rx", now());
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        scheduler_.scheduleNamedCallback("rx", now());
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        session.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(timestamps, ElementsAre(std::make_tuple(0x23, TimePoint{1s + 10ms})));
+}
+
+TEST_F(TestCanMsgTxSession, send_with_tx_capacity_callback)
+{
+    auto transport = makeTransport(mr_);
+
+    auto maybe_session = transport->makeMessageTxSession({17});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    const auto         payload = makeIotaArray<3>(b('1'));
+    TransferTxMetadata metadata{{0x23, Priority::High}, {}};
+
+    std::vector<std::tuple<TimePoint, std::size_t>> notifications;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        session->setOnTxCapacityCallback(
+            [&](const auto& arg) {
+                //
+                notifications.emplace_back(now(), arg.free_frames);
+            },
+            12);
+
+        // Emulate that media is busy, so that all 16 frames stay in the TX queue.
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .WillOnce(Return(IMedia::PushResult::Success{false /* is_accepted */}));
+        EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("tx", std::move(function));
+            }));
+
+        metadata.deadline = now() + 1s;
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+            ++metadata.base.transfer_id;
+        }
+        EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Optional(VariantWith<MemoryError>(_)));
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        // Media is ready now - each "tx" callback drains one frame (16 -> 15 -> ... -> 11).
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .Times(5)
+            .WillRepeatedly(Return(IMedia::PushResult::Success{true /* is_accepted */}));
+    });
+    for (int i = 1; i <= 5; ++i)
+    {
+        scheduler_.scheduleAt(1s + i * 10ms, [&](const auto&) {
+            //
+            scheduler_.scheduleNamedCallback("tx");
+        });
+    }
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        session.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(notifications, ElementsAre(std::make_tuple(TimePoint{1s + 50ms}, 5)));
+}
+
+TEST_F(TestCanMsgTxSession, send_with_tx_capacity_callback_on_empty_queue)
+{
+    auto transport = makeTransport(mr_);
+
+    auto maybe_session = transport->makeMessageTxSession({17});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    const auto         payload = makeIotaArray<3>(b('1'));
+    TransferTxMetadata metadata{{0x23, Priority::High}, {}};
+
+    bool                                            is_sending = false;
+    std::vector<std::tuple<TimePoint, std::size_t>> notifications;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Zero watermark - notify once TX queues become empty.
+        session->setOnTxCapacityCallback(
+            [&](const auto& arg) {
+                //
+                EXPECT_FALSE(is_sending);
+                notifications.emplace_back(now(), arg.free_frames);
+            },
+            0);
+
+        // Emulate that media is busy, so that both frames stay in the TX queue.
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .WillOnce(Return(IMedia::PushResult::Success{false /* is_accepted */}));
+        EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("tx", std::move(function));
+            }));
+
+        is_sending        = true;
+        metadata.deadline = now() + 1s;
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+            ++metadata.base.transfer_id;
+        }
+        is_sending = false;
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        // Media is ready now - each "tx" callback drains one frame (2 -> 1 -> 0).
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .Times(2)
+            .WillRepeatedly(Return(IMedia::PushResult::Success{true /* is_accepted */}));
+    });
+    for (int i = 1; i <= 2; ++i)
+    {
+        scheduler_.scheduleAt(1s + i * 10ms, [&](const auto&) {
+            //
+            scheduler_.scheduleNamedCallback("tx");
+        });
+    }
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        session.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(notifications, ElementsAre(std::make_tuple(TimePoint{1s + 20ms}, 16)));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
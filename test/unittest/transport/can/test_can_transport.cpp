@@ -20,6 +20,7 @@
 #include <libcyphal/transport/can/can_transport_impl.hpp>
 #include <libcyphal/transport/can/media.hpp>
 #include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/frame_monitor_sessions.hpp>
 #include <libcyphal/transport/msg_sessions.hpp>
 #include <libcyphal/transport/svc_sessions.hpp>
 #include <libcyphal/transport/types.hpp>
@@ -36,6 +37,7 @@
 #include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -568,6 +570,87 @@ TEST_F(TestCanTransport, sending_multiframe_payload_for_non_anonymous)
     scheduler_.spinFor(10s);
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestCanTransport, send_payload_with_tx_in_flight_limit)
+{
+    std::array<IMedia*, 1> media_array{&media_mock_};
+    auto maybe_transport = can::makeTransport(mr_, scheduler_, media_array, 16, 1 /*tx_in_flight_limit*/);
+    ASSERT_THAT(maybe_transport, VariantWith<UniquePtr<ICanTransport>>(NotNull()));
+    auto transport = cetl::get<UniquePtr<ICanTransport>>(std::move(maybe_transport));
+    EXPECT_THAT(transport->setLocalNodeId(0x45), Eq(cetl::nullopt));
+
+    auto maybe_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    constexpr auto timeout = 1s;
+
+    const auto         payload = makeIotaArray<3>(b('0'));
+    TransferTxMetadata nominal_metadata{{0x13, Priority::Nominal}, {}};
+    TransferTxMetadata slow_metadata{{0x14, Priority::Slow}, {}};
+    TransferTxMetadata high_metadata{{0x15, Priority::High}, {}};
+
+    EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+        .WillOnce([&](Filters) { return cetl::nullopt; });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, getTxInFlightCount()).WillOnce(Return(0));
+        EXPECT_CALL(media_mock_, push(_, _, _)).WillOnce([&](auto, auto can_id, auto&) {
+            EXPECT_THAT(can_id, PriorityOfCanIdEq(nominal_metadata.base.priority));
+            return IMedia::PushResult::Success{true /* is_accepted */};
+        });
+        EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerAndScheduleNamedCallback("push", now() + 10us, std::move(function));
+            }));
+
+        nominal_metadata.deadline = now() + timeout;
+        EXPECT_THAT(session->send(nominal_metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 1us, [&](const auto&) {
+        //
+        // Previous frame hasn't left the media yet, so these transfers are held in the TX queue.
+        //
+        slow_metadata.deadline = now() + timeout;
+        EXPECT_THAT(session->send(slow_metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+
+        high_metadata.deadline = now() + timeout;
+        EXPECT_THAT(session->send(high_metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 10us, [&](const auto&) {
+        //
+        // Media is ready to accept more, but the only frame in flight is still there - limit reached.
+        //
+        EXPECT_CALL(media_mock_, getTxInFlightCount()).WillOnce(Return(1));
+    });
+    scheduler_.scheduleAt(1s + 10us + 100us, [&](const auto&) {
+        //
+        // Re-check - the higher priority transfer goes first despite it was sent later.
+        //
+        EXPECT_CALL(media_mock_, getTxInFlightCount()).WillOnce(Return(0));
+        EXPECT_CALL(media_mock_, push(_, _, _)).WillOnce([&](auto, auto can_id, auto&) {
+            EXPECT_THAT(can_id, PriorityOfCanIdEq(high_metadata.base.priority));
+            scheduler_.scheduleNamedCallback("push", now() + 10us);
+            return IMedia::PushResult::Success{true /* is_accepted */};
+        });
+    });
+    scheduler_.scheduleAt(1s + 10us + 100us + 10us, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, getTxInFlightCount()).WillOnce(Return(0));
+        EXPECT_CALL(media_mock_, push(_, _, _)).WillOnce([&](auto, auto can_id, auto&) {
+            EXPECT_THAT(can_id, PriorityOfCanIdEq(slow_metadata.base.priority));
+            return IMedia::PushResult::Success{true /* is_accepted */};
+        });
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        session.reset();
+        transport.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 TEST_F(TestCanTransport, send_multiframe_payload_to_redundant_not_ready_media)
 {
@@ -1231,6 +1314,576 @@ TEST_F(TestCanTransport, setFilters_with_transient_handler)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestCanTransport, addMedia_removeMedia)
+{
+    StrictMock<MediaMock> media_mock2{};
+    EXPECT_CALL(media_mock2, getMtu()).WillRepeatedly(Return(CANARD_MTU_CAN_CLASSIC));
+    EXPECT_CALL(media_mock2, getTxMemoryResource()).WillRepeatedly(ReturnRef(tx_mr_));
+    StrictMock<MediaMock> media_mock3{};
+    EXPECT_CALL(media_mock3, getMtu()).WillRepeatedly(Return(CANARD_MTU_CAN_CLASSIC));
+    EXPECT_CALL(media_mock3, getTxMemoryResource()).WillRepeatedly(ReturnRef(tx_mr_));
+
+    // Transport has room for 2 media, but only the first one is in use.
+    auto transport = makeTransport(mr_);
+    EXPECT_THAT(transport->setLocalNodeId(0x45), Eq(cetl::nullopt));
+
+    EXPECT_THAT(transport->removeMedia(media_mock2), Optional(testing::A<libcyphal::ArgumentError>()));
+    EXPECT_THAT(transport->removeMedia(media_mock_), Optional(testing::A<libcyphal::ArgumentError>()));  // the last one
+    EXPECT_THAT(transport->addMedia(media_mock_), Optional(VariantWith<AlreadyExistsError>(_)));
+    EXPECT_THAT(transport->addMedia(media_mock2), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->addMedia(media_mock2), Optional(VariantWith<AlreadyExistsError>(_)));
+    EXPECT_THAT(transport->addMedia(media_mock3), Optional(VariantWith<libcyphal::ArgumentError>(_)));
+
+    auto maybe_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    const auto         payload = makeIotaArray<6>(b('0'));
+    TransferTxMetadata metadata{{0x13, Priority::Nominal}, {}};
+
+    EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+        .WillOnce([&](Filters) { return cetl::nullopt; });
+    EXPECT_CALL(media_mock2, setFilters(IsEmpty()))  //
+        .WillOnce([&](Filters) { return cetl::nullopt; });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Emulate that both media are not ready to accept the frame - so it stays in their TX queues.
+        //
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .WillOnce(Return(IMedia::PushResult::Success{false /* is_accepted */}));
+        EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("tx1", std::move(function));
+            }));
+        EXPECT_CALL(media_mock2, push(_, _, _))  //
+            .WillOnce([&](auto, auto can_id, auto&) {
+                EXPECT_THAT(can_id, AllOf(SubjectOfCanIdEq(7), SourceNodeOfCanIdEq(0x45)));
+                return IMedia::PushResult::Success{false /* is_accepted */};
+            });
+        EXPECT_CALL(media_mock2, registerPushCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("tx2", std::move(function));
+            }));
+
+        metadata.deadline = now() + 1s;
+        auto failure      = session->send(metadata, makeSpansFrom(payload));
+        EXPECT_THAT(failure, Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Removal drops the frame queued for the second media, and frees its slot (index #1) for the third one.
+        //
+        EXPECT_THAT(transport->removeMedia(media_mock2), Eq(cetl::nullopt));
+        EXPECT_THAT(transport->removeMedia(media_mock2), Optional(testing::A<libcyphal::ArgumentError>()));
+        EXPECT_THAT(transport->addMedia(media_mock3), Eq(cetl::nullopt));
+
+        EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+            .WillOnce([&](Filters) { return cetl::nullopt; });
+        EXPECT_CALL(media_mock3, setFilters(IsEmpty()))  //
+            .WillOnce([&](Filters) { return cetl::nullopt; });
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestCanTransport, makeFrameMonitorRxSession)
+{
+    using Kind = FrameMonitorRxMetadata::Kind;
+
+    struct Frame
+    {
+        FrameMonitorRxMetadata  metadata;
+        std::vector<cetl::byte> payload;
+    };
+    std::vector<Frame> frames;
+
+    auto transport = makeTransport(mr_);
+    EXPECT_THAT(transport->setLocalNodeId(0x13), Eq(cetl::nullopt));
+
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({10, 5, false}),
+                VariantWith<AnyFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({0, CANARD_SUBJECT_ID_MAX + 1, false}),
+                VariantWith<AnyFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+
+    EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {         //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+
+    auto maybe_session = transport->makeFrameMonitorRxSession({7, 100, true});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IFrameMonitorRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IFrameMonitorRxSession>>(std::move(maybe_session));
+    EXPECT_THAT(session->getParams().subject_id_first, 7);
+    EXPECT_THAT(session->getParams().subject_id_last, 100);
+
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({0, 10, false}),
+                VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+
+    session->setOnFrameCallback([&frames](const auto& arg) {
+        //
+        frames.push_back({arg.metadata, {arg.payload.begin(), arg.payload.end()}});
+    });
+
+    // Monitor needs all frames - so there is the single accept-all filter.
+    EXPECT_CALL(media_mock_, setFilters(SizeIs(1))).WillOnce([&](Filters filters) {
+        EXPECT_THAT(filters, Contains(FilterEq({0, 0})));
+        return cetl::nullopt;
+    });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('0');
+                p[1] = b('1');
+                p[2] = b(0b111'11101);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 3};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Subject #200 is out of the monitored range.
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b(0b111'00000);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000011001000'0'0110001, 1};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Service request to another node (#0x27) is monitored as well.
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('2');
+                p[1] = b(0b100'00011);
+                return IMedia::PopResult::Metadata{now(), 0b111'1'1'0'101111011'0100111'0110001, 2};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        ASSERT_THAT(frames, SizeIs(2));
+
+        const auto& msg = frames[0];
+        EXPECT_THAT(msg.metadata.kind, Kind::Message);
+        EXPECT_THAT(msg.metadata.port_id, 7);
+        EXPECT_THAT(msg.metadata.source_node_id, Optional(0x31));
+        EXPECT_THAT(msg.metadata.destination_node_id, Eq(cetl::nullopt));
+        EXPECT_THAT(msg.metadata.rx_meta.base.transfer_id, 0x1D);
+        EXPECT_THAT(msg.metadata.rx_meta.base.priority, Priority::Nominal);
+        EXPECT_THAT(msg.metadata.rx_meta.timestamp, TimePoint{1s});
+        EXPECT_THAT(msg.metadata.media_index, 0);
+        EXPECT_TRUE(msg.metadata.is_start_of_transfer);
+        EXPECT_TRUE(msg.metadata.is_end_of_transfer);
+        EXPECT_THAT(msg.payload, ElementsAre(b('0'), b('1')));
+
+        const auto& req = frames[1];
+        EXPECT_THAT(req.metadata.kind, Kind::Request);
+        EXPECT_THAT(req.metadata.port_id, 0x17B);
+        EXPECT_THAT(req.metadata.source_node_id, Optional(0x31));
+        EXPECT_THAT(req.metadata.destination_node_id, Optional(0x27));
+        EXPECT_THAT(req.metadata.rx_meta.base.transfer_id, 0x03);
+        EXPECT_THAT(req.metadata.rx_meta.base.priority, Priority::Optional);
+        EXPECT_TRUE(req.metadata.is_start_of_transfer);
+        EXPECT_FALSE(req.metadata.is_end_of_transfer);
+        EXPECT_THAT(req.payload, ElementsAre(b('2')));
+
+        EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+            .WillOnce([&](Filters) { return cetl::nullopt; });
+        session.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestCanTransport, makeFrameMonitorRxSession_reassembling)
+{
+    struct Transfer
+    {
+        FrameMonitorRxMetadata  metadata;
+        std::vector<cetl::byte> payload;
+    };
+    std::vector<Transfer> transfers;
+
+    auto transport = makeTransport(mr_);
+
+    EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {         //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+    EXPECT_CALL(media_mock_, setFilters(SizeIs(1)))  //
+        .WillOnce([&](Filters) { return cetl::nullopt; });
+
+    // Transfers are truncated to 8 bytes.
+    auto maybe_session = transport->makeFrameMonitorRxSession({7, 7, false, 8});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IFrameMonitorRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IFrameMonitorRxSession>>(std::move(maybe_session));
+    EXPECT_THAT(session->getParams().reassembly_extent_bytes, 8);
+
+    session->setOnFrameCallback([&transfers](const auto& arg) {
+        //
+        transfers.push_back({arg.metadata, {arg.payload.begin(), arg.payload.end()}});
+    });
+
+    // Multi-frame transfer of "0123456789" (followed by its CRC-16/CCITT-FALSE), and then its corrupted copy.
+    //
+    const auto pop_start = [&](auto p) {
+        for (std::size_t i = 0; i < 7; ++i)
+        {
+            p[i] = b(static_cast<std::uint8_t>('0' + i));
+        }
+        p[7] = b(0b101'00101);
+        return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 8};
+    };
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_)).WillOnce(pop_start);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('7');
+                p[1] = b('8');
+                p[2] = b('9');
+                p[3] = b(0x7D);
+                p[4] = b(0x61);
+                p[5] = b(0b010'00101);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 6};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_)).WillOnce(pop_start);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('7');
+                p[1] = b('8');
+                p[2] = b('9');
+                p[3] = b(0x7D);
+                p[4] = b(0x62);
+                p[5] = b(0b010'00101);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 6};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        // Single-frame transfer has no CRC.
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('A');
+                p[1] = b(0b111'00110);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 2};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        ASSERT_THAT(transfers, SizeIs(2));
+
+        const auto& multi = transfers[0];
+        EXPECT_THAT(multi.metadata.port_id, 7);
+        EXPECT_THAT(multi.metadata.source_node_id, Optional(0x31));
+        EXPECT_THAT(multi.metadata.rx_meta.base.transfer_id, 5);
+        EXPECT_THAT(multi.metadata.rx_meta.base.priority, Priority::Nominal);
+        EXPECT_THAT(multi.metadata.rx_meta.timestamp, TimePoint{1s});
+        EXPECT_TRUE(multi.metadata.is_start_of_transfer);
+        EXPECT_TRUE(multi.metadata.is_end_of_transfer);
+        EXPECT_THAT(multi.payload, ElementsAre(b('0'), b('1'), b('2'), b('3'), b('4'), b('5'), b('6'), b('7')));
+
+        const auto& single = transfers[1];
+        EXPECT_THAT(single.metadata.rx_meta.base.transfer_id, 6);
+        EXPECT_THAT(single.metadata.rx_meta.timestamp, TimePoint{5s});
+        EXPECT_THAT(single.payload, ElementsAre(b('A')));
+
+        EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+            .WillOnce([&](Filters) { return cetl::nullopt; });
+        session.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestCanTransport, makeLogicalNode)
+{
+    auto transport = makeTransport(mr_);
+
+    EXPECT_THAT(transport->makeLogicalNode(CANARD_NODE_ID_MAX + 1),
+                VariantWith<AnyFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+
+    auto maybe_node1 = transport->makeLogicalNode(0x13);
+    ASSERT_THAT(maybe_node1, VariantWith<UniquePtr<ITransport>>(NotNull()));
+    auto node1 = cetl::get<UniquePtr<ITransport>>(std::move(maybe_node1));
+
+    auto maybe_node2 = transport->makeLogicalNode(0x14);
+    ASSERT_THAT(maybe_node2, VariantWith<UniquePtr<ITransport>>(NotNull()));
+    auto node2 = cetl::get<UniquePtr<ITransport>>(std::move(maybe_node2));
+
+    // Node IDs are unique among the transport and all its logical nodes.
+    EXPECT_THAT(transport->makeLogicalNode(0x13), VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+    EXPECT_THAT(transport->setLocalNodeId(0x14), Optional(_));
+    EXPECT_THAT(transport->setLocalNodeId(0x15), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->makeLogicalNode(0x15), VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+
+    EXPECT_THAT(node1->getLocalNodeId(), Optional(0x13));
+    EXPECT_THAT(node1->setLocalNodeId(0x13), Eq(cetl::nullopt));
+    EXPECT_THAT(node1->setLocalNodeId(0x16), Optional(_));
+    EXPECT_THAT(node1->getProtocolParams().mtu_bytes, CANARD_MTU_CAN_CLASSIC);
+
+    EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {         //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+
+    auto maybe_msg_rx1 = node1->makeMessageRxSession({8, 7});
+    ASSERT_THAT(maybe_msg_rx1, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto msg_rx1 = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_msg_rx1));
+
+    auto maybe_msg_rx2 = node2->makeMessageRxSession({8, 7});
+    ASSERT_THAT(maybe_msg_rx2, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto msg_rx2 = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_msg_rx2));
+
+    EXPECT_THAT(node1->makeMessageRxSession({8, 7}), VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+
+    auto maybe_req_rx1 = node1->makeRequestRxSession({8, 0x17B});
+    ASSERT_THAT(maybe_req_rx1, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto req_rx1 = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_req_rx1));
+
+    auto maybe_req_rx2 = node2->makeRequestRxSession({8, 0x17B});
+    ASSERT_THAT(maybe_req_rx2, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto req_rx2 = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_req_rx2));
+
+    // Subject filter is shared by both nodes, whereas service filters are per node ID.
+    const auto msg_flt  = ::canardMakeFilterForSubject(7);
+    const auto svc_flt1 = ::canardMakeFilterForService(0x17B, 0x13);
+    const auto svc_flt2 = ::canardMakeFilterForService(0x17B, 0x14);
+    EXPECT_CALL(media_mock_, setFilters(SizeIs(3))).WillOnce([&](Filters filters) {
+        EXPECT_THAT(filters, Contains(FilterEq({msg_flt.extended_can_id, msg_flt.extended_mask})));
+        EXPECT_THAT(filters, Contains(FilterEq({svc_flt1.extended_can_id, svc_flt1.extended_mask})));
+        EXPECT_THAT(filters, Contains(FilterEq({svc_flt2.extended_can_id, svc_flt2.extended_mask})));
+        return cetl::nullopt;
+    });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Request from node #0x31 to the 2nd logical node (#0x14).
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('r');
+                p[1] = b(0b111'00011);
+                return IMedia::PopResult::Metadata{now(), 0b100'1'1'0'101111011'0010100'0110001, 2};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(req_rx1->receive(), Eq(cetl::nullopt));
+
+        const auto maybe_rx_transfer = req_rx2->receive();
+        ASSERT_THAT(maybe_rx_transfer, Optional(_));
+        // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+        const auto& rx_transfer = maybe_rx_transfer.value();
+        EXPECT_THAT(rx_transfer.metadata.remote_node_id, 0x31);
+        EXPECT_THAT(rx_transfer.metadata.rx_meta.base.transfer_id, 0x03);
+        EXPECT_THAT(rx_transfer.payload.size(), 1);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Message from node #0x31 is delivered to both logical nodes.
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('m');
+                p[1] = b(0b111'00100);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 2};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        for (auto* const msg_rx : {msg_rx1.get(), msg_rx2.get()})
+        {
+            const auto maybe_rx_transfer = msg_rx->receive();
+            ASSERT_THAT(maybe_rx_transfer, Optional(_));
+            // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+            const auto& rx_transfer = maybe_rx_transfer.value();
+            EXPECT_THAT(rx_transfer.metadata.publisher_node_id, Optional(0x31));
+            EXPECT_THAT(rx_transfer.metadata.rx_meta.base.transfer_id, 0x04);
+        }
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Transfers of a logical node are sent with its node ID as the source one.
+        auto maybe_msg_tx = node1->makeMessageTxSession({7});
+        ASSERT_THAT(maybe_msg_tx, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+        auto msg_tx = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_msg_tx));
+
+        EXPECT_CALL(media_mock_, push(_, _, _)).WillOnce([&](auto, auto can_id, auto&) {
+            EXPECT_THAT(can_id, AllOf(SubjectOfCanIdEq(7), SourceNodeOfCanIdEq(0x13), IsMessageCanId()));
+            return IMedia::PushResult::Success{true /* is_accepted */};
+        });
+        EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("tx", std::move(function));
+            }));
+
+        const auto               payload = makeIotaArray<3>(b('0'));
+        const TransferTxMetadata metadata{{0x0A, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(msg_tx->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        auto maybe_res_tx = node2->makeResponseTxSession({0x17B});
+        ASSERT_THAT(maybe_res_tx, VariantWith<UniquePtr<IResponseTxSession>>(NotNull()));
+        auto res_tx = cetl::get<UniquePtr<IResponseTxSession>>(std::move(maybe_res_tx));
+
+        EXPECT_CALL(media_mock_, push(_, _, _)).WillOnce([&](auto, auto can_id, auto&) {
+            EXPECT_THAT(can_id, AllOf(ServiceOfCanIdEq(0x17B), IsServiceCanId()));
+            EXPECT_THAT(can_id, AllOf(SourceNodeOfCanIdEq(0x14), DestinationNodeOfCanIdEq(0x31)));
+            return IMedia::PushResult::Success{true /* is_accepted */};
+        });
+
+        const auto              payload = makeIotaArray<3>(b('0'));
+        const ServiceTxMetadata metadata{{{0x03, Priority::Nominal}, now() + 1s}, 0x31};
+        EXPECT_THAT(res_tx->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+        scheduler_.scheduleNamedCallback("tx");
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+            .WillOnce([&](Filters) { return cetl::nullopt; });
+
+        msg_rx1.reset();
+        msg_rx2.reset();
+        req_rx1.reset();
+        req_rx2.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    node1.reset();
+    node2.reset();
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestCanTransport, makeLogicalNode_shared_subject_reassembly)
+{
+    auto transport = makeTransport(mr_);
+
+    auto maybe_node1 = transport->makeLogicalNode(0x13);
+    ASSERT_THAT(maybe_node1, VariantWith<UniquePtr<ITransport>>(NotNull()));
+    auto node1 = cetl::get<UniquePtr<ITransport>>(std::move(maybe_node1));
+
+    auto maybe_node2 = transport->makeLogicalNode(0x14);
+    ASSERT_THAT(maybe_node2, VariantWith<UniquePtr<ITransport>>(NotNull()));
+    auto node2 = cetl::get<UniquePtr<ITransport>>(std::move(maybe_node2));
+
+    EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {         //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+    EXPECT_CALL(media_mock_, setFilters(SizeIs(1)))  //
+        .WillOnce([&](Filters) { return cetl::nullopt; });
+
+    // Each node has its own extent of the same subject.
+    auto maybe_msg_rx1 = node1->makeMessageRxSession({8, 7});
+    ASSERT_THAT(maybe_msg_rx1, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto msg_rx1 = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_msg_rx1));
+
+    auto maybe_msg_rx2 = node2->makeMessageRxSession({4, 7});
+    ASSERT_THAT(maybe_msg_rx2, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto msg_rx2 = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_msg_rx2));
+
+    // Multi-frame transfer of "0123456789" (followed by its CRC-16/CCITT-FALSE) is reassembled just once,
+    // and then delivered to both nodes (each one truncated to its own extent).
+    //
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                for (std::size_t i = 0; i < 7; ++i)
+                {
+                    p[i] = b(static_cast<std::uint8_t>('0' + i));
+                }
+                p[7] = b(0b101'00101);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 8};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('7');
+                p[1] = b('8');
+                p[2] = b('9');
+                p[3] = b(0x7D);
+                p[4] = b(0x61);
+                p[5] = b(0b010'00101);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 6};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        const auto maybe_rx_transfer1 = msg_rx1->receive();
+        ASSERT_THAT(maybe_rx_transfer1, Optional(_));
+        // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+        const auto& rx_transfer1 = maybe_rx_transfer1.value();
+        EXPECT_THAT(rx_transfer1.metadata.publisher_node_id, Optional(0x31));
+        EXPECT_THAT(rx_transfer1.metadata.rx_meta.base.transfer_id, 0x05);
+        EXPECT_THAT(rx_transfer1.metadata.rx_meta.timestamp, TimePoint{1s});
+        ASSERT_THAT(rx_transfer1.payload.size(), 8);
+
+        const auto maybe_rx_transfer2 = msg_rx2->receive();
+        ASSERT_THAT(maybe_rx_transfer2, Optional(_));
+        // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+        const auto& rx_transfer2 = maybe_rx_transfer2.value();
+        EXPECT_THAT(rx_transfer2.metadata.rx_meta.base.transfer_id, 0x05);
+        ASSERT_THAT(rx_transfer2.payload.size(), 4);
+
+        std::array<cetl::byte, 8> buffer{};
+        EXPECT_THAT(rx_transfer1.payload.copy(0, buffer.data(), buffer.size()), 8);
+        EXPECT_THAT(buffer, ElementsAre(b('0'), b('1'), b('2'), b('3'), b('4'), b('5'), b('6'), b('7')));
+        EXPECT_THAT(rx_transfer2.payload.copy(0, buffer.data(), buffer.size()), 4);
+        EXPECT_THAT(buffer, ElementsAre(b('0'), b('1'), b('2'), b('3'), b('4'), b('5'), b('6'), b('7')));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // The shared subscription stays while any node is still subscribed.
+        msg_rx1.reset();
+
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillOnce([&](auto p) {
+                p[0] = b('m');
+                p[1] = b(0b111'00110);
+                return IMedia::PopResult::Metadata{now(), 0b100'0'0'0'11'0000000000111'0'0110001, 2};
+            });
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(3s + 1ms, [&](const auto&) {
+        //
+        const auto maybe_rx_transfer = msg_rx2->receive();
+        ASSERT_THAT(maybe_rx_transfer, Optional(_));
+        // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+        EXPECT_THAT(maybe_rx_transfer.value().payload.size(), 1);
+
+        EXPECT_CALL(media_mock_, setFilters(IsEmpty()))  //
+            .WillOnce([&](Filters) { return cetl::nullopt; });
+        msg_rx2.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    node1.reset();
+    node2.reset();
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
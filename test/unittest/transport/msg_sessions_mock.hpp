@@ -16,6 +16,7 @@
 
 #include <gmock/gmock.h>
 
+#include <cstddef>
 #include <utility>
 
 namespace libcyphal
@@ -103,6 +104,8 @@ public:
                 send,
                 (const TransferTxMetadata& metadata, const PayloadFragments payload_fragments),
                 (override));
+    MOCK_METHOD(void, setOnTxTimestampCallback, (OnTxTimestampCallback::Function&&), (override));
+    MOCK_METHOD(void, setOnTxCapacityCallback, (OnTxCapacityCallback::Function&&, const std::size_t), (override));
     MOCK_METHOD(void, deinit, (), ());
 
 };  // MessageTxSessionMock
@@ -0,0 +1,264 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/config.hpp>
+#include <libcyphal/transport/rx_reassembly_budget.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::TimePoint;
+using namespace libcyphal::transport;  // NOLINT This our main concern here in the unit tests.
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestRxReassemblyBudget : public testing::Test
+{
+protected:
+    using Ledger = detail::RxReassemblyLedger;
+    using Params = RxReassemblyBudget::Params;
+
+    /// Emulates a message RX session, which releases all its bytes on abort (as real sessions do via the lizard).
+    ///
+    class MyAccount final : public detail::RxReassemblyAccount
+    {
+    public:
+        explicit MyAccount(Ledger& ledger)
+            : ledger_{ledger}
+        {
+        }
+
+        std::size_t aborts() const noexcept
+        {
+            return aborts_;
+        }
+
+        // MARK: RxReassemblyAccount
+
+        void abortReassemblies() override
+        {
+            ++aborts_;
+            ledger_.releaseAll(*this);
+        }
+
+    private:
+        Ledger&     ledger_;
+        std::size_t aborts_{0};
+
+    };  // MyAccount
+
+    static TimePoint at(const Duration duration)
+    {
+        return TimePoint{duration};
+    }
+
+    static void receive(Ledger& ledger, MyAccount& account, const Priority priority, const TimePoint timestamp)
+    {
+        ASSERT_TRUE(ledger.admit(account, 100, priority, timestamp));
+        ledger.adopt(account, 100, priority, timestamp);
+    }
+};
+
+// MARK: - Tests:
+
+TEST_F(TestRxReassemblyBudget, disabled_by_default)
+{
+    Ledger    ledger;
+    MyAccount account{ledger};
+
+    EXPECT_FALSE(ledger.isEnabled());
+    EXPECT_TRUE(ledger.admit(account, 1000000, Priority::Optional, at(1s)));
+
+    // Bytes are tracked regardless of the budget.
+    ledger.adopt(account, 1000, Priority::Optional, at(1s));
+    EXPECT_THAT(ledger.getTotalBytes(), 1000);
+    EXPECT_THAT(account.getBytes(), 1000);
+
+    // Zero limits disable the budget as well.
+    ledger.setParams(Params{0, 0});
+    EXPECT_FALSE(ledger.isEnabled());
+
+    ledger.releaseAll(account);
+    EXPECT_THAT(ledger.getTotalBytes(), 0);
+    EXPECT_THAT(account.getBytes(), 0);
+}
+
+TEST_F(TestRxReassemblyBudget, evicts_least_important_then_oldest)
+{
+    Ledger ledger;
+    ledger.setParams(Params{300, 0});
+
+    MyAccount low1{ledger};
+    MyAccount slow{ledger};
+    MyAccount low2{ledger};
+    MyAccount nominal{ledger};
+
+    receive(ledger, low1, Priority::Low, at(1ms));
+    receive(ledger, slow, Priority::Slow, at(2ms));
+    receive(ledger, low2, Priority::Low, at(3ms));
+    EXPECT_THAT(ledger.getTotalBytes(), 300);
+
+    // The least important reassembly is evicted first.
+    receive(ledger, nominal, Priority::Nominal, at(4ms));
+    EXPECT_THAT(slow.aborts(), 1);
+    EXPECT_THAT(low1.aborts(), 0);
+    EXPECT_THAT(low2.aborts(), 0);
+
+    // ... and then the oldest one among the same priority.
+    receive(ledger, slow, Priority::Nominal, at(5ms));
+    EXPECT_THAT(low1.aborts(), 1);
+    EXPECT_THAT(low2.aborts(), 0);
+    EXPECT_THAT(ledger.getTotalBytes(), 300);
+    EXPECT_THAT(ledger.getStats().evictions, 2);
+
+    // More important reassemblies are never evicted - the frame is dropped instead.
+    EXPECT_FALSE(ledger.admit(low1, 100, Priority::Slow, at(6ms)));
+    EXPECT_THAT(ledger.getStats().dropped_frames, 1);
+    EXPECT_THAT(ledger.getTotalBytes(), 300);
+
+    // The same priority is not more important, so the oldest one is evicted.
+    receive(ledger, low1, Priority::Low, at(7ms));
+    EXPECT_THAT(low2.aborts(), 1);
+    EXPECT_THAT(nominal.aborts(), 0);
+    EXPECT_THAT(ledger.getStats().evictions, 3);
+
+    // A frame which doesn't fit even into an empty budget is dropped w/o any eviction.
+    EXPECT_FALSE(ledger.admit(low2, 301, Priority::Exceptional, at(8ms)));
+    EXPECT_THAT(ledger.getStats().dropped_frames, 2);
+    EXPECT_THAT(ledger.getStats().evictions, 3);
+
+    ledger.releaseAll(low1);
+    ledger.releaseAll(slow);
+    ledger.releaseAll(nominal);
+    EXPECT_THAT(ledger.getTotalBytes(), 0);
+}
+
+TEST_F(TestRxReassemblyBudget, raised_priority_protects_reassembly)
+{
+    Ledger ledger;
+    ledger.setParams(Params{200, 0});
+
+    MyAccount first{ledger};
+    MyAccount second{ledger};
+    MyAccount third{ledger};
+
+    receive(ledger, first, Priority::Nominal, at(1ms));
+    receive(ledger, second, Priority::Nominal, at(2ms));
+
+    // Priority is not affected by an empty frame.
+    ledger.adopt(first, 0, Priority::High, at(3ms));
+    EXPECT_THAT(first.getPriority(), Priority::Nominal);
+
+    // The first reassembly got a more important frame (f.e. of another transfer).
+    ledger.release(first, 50);
+    ledger.adopt(first, 50, Priority::High, at(3ms));
+    EXPECT_THAT(first.getPriority(), Priority::High);
+    EXPECT_THAT(first.getSince(), at(1ms));
+    EXPECT_THAT(ledger.getTotalBytes(), 200);
+
+    // So the second one is the oldest nominal victim now.
+    receive(ledger, third, Priority::Nominal, at(4ms));
+    EXPECT_THAT(second.aborts(), 1);
+    EXPECT_THAT(first.aborts(), 0);
+
+    receive(ledger, second, Priority::High, at(5ms));
+    EXPECT_THAT(third.aborts(), 1);
+    EXPECT_THAT(first.aborts(), 0);
+
+    // Among high priority reassemblies the first one is still the oldest.
+    receive(ledger, third, Priority::High, at(6ms));
+    EXPECT_THAT(first.aborts(), 1);
+    EXPECT_THAT(second.aborts(), 1);
+    EXPECT_THAT(first.getBytes(), 0);
+
+    ledger.releaseAll(second);
+    ledger.releaseAll(third);
+    EXPECT_THAT(ledger.getTotalBytes(), 0);
+}
+
+TEST_F(TestRxReassemblyBudget, per_port_budget)
+{
+    Ledger ledger;
+    ledger.setParams(Params{0, 200});
+
+    MyAccount account{ledger};
+    receive(ledger, account, Priority::Nominal, at(1ms));
+    receive(ledger, account, Priority::Nominal, at(2ms));
+
+    // Less important frame can't evict the port reassembly.
+    EXPECT_FALSE(ledger.admit(account, 100, Priority::Low, at(3ms)));
+    EXPECT_THAT(account.aborts(), 0);
+
+    // Too big frame is dropped.
+    EXPECT_FALSE(ledger.admit(account, 201, Priority::Exceptional, at(3ms)));
+    EXPECT_THAT(ledger.getStats().dropped_frames, 2);
+
+    // The same (or more important) priority evicts the port reassembly.
+    receive(ledger, account, Priority::Nominal, at(4ms));
+    EXPECT_THAT(account.aborts(), 1);
+    EXPECT_THAT(account.getBytes(), 100);
+    EXPECT_THAT(account.getSince(), at(4ms));
+
+    ledger.releaseAll(account);
+}
+
+TEST_F(TestRxReassemblyBudget, keeps_transfer_id_dedup_after_eviction)
+{
+    Ledger ledger;
+    ledger.setParams(Params{0, 100});
+
+    constexpr auto tid_timeout = 2s;
+
+    MyAccount account{ledger};
+    account.onTransferDelivered(NodeId{5}, 7, at(100ms));
+    account.onTransferDelivered(cetl::nullopt, 7, at(100ms));
+
+    // W/o eviction, deduplication is up to the lizard.
+    EXPECT_FALSE(account.isDuplicateAfterEviction(NodeId{5}, 7, at(101ms), tid_timeout));
+
+    receive(ledger, account, Priority::Low, at(101ms));
+    receive(ledger, account, Priority::Exceptional, at(102ms));
+    EXPECT_THAT(account.aborts(), 1);
+
+    EXPECT_TRUE(account.isDuplicateAfterEviction(NodeId{5}, 7, at(103ms), tid_timeout));
+    EXPECT_FALSE(account.isDuplicateAfterEviction(NodeId{5}, 8, at(103ms), tid_timeout));
+    EXPECT_FALSE(account.isDuplicateAfterEviction(NodeId{6}, 7, at(103ms), tid_timeout));
+    EXPECT_FALSE(account.isDuplicateAfterEviction(cetl::nullopt, 7, at(103ms), tid_timeout));
+
+    // The lizard has its own transfer-ID state again after the timeout since the eviction.
+    EXPECT_FALSE(account.isDuplicateAfterEviction(NodeId{5}, 7, at(102ms) + tid_timeout, tid_timeout));
+
+    // The least recently heard source is forgotten.
+    constexpr auto capacity = libcyphal::config::Transport::RxReassemblyBudget_DeliveredSourcesCapacity();
+    for (NodeId node_id = 10; node_id < (10 + capacity); ++node_id)
+    {
+        account.onTransferDelivered(node_id, 1, at(200ms + std::chrono::milliseconds{node_id}));
+    }
+    EXPECT_FALSE(account.isDuplicateAfterEviction(NodeId{5}, 7, at(300ms), tid_timeout));
+    EXPECT_TRUE(account.isDuplicateAfterEviction(NodeId{10}, 1, at(300ms), tid_timeout));
+    EXPECT_TRUE(account.isDuplicateAfterEviction(NodeId{10 + capacity - 1}, 1, at(300ms), tid_timeout));
+
+    ledger.releaseAll(account);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -8,6 +8,7 @@
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/frame_monitor_sessions.hpp>
 #include <libcyphal/transport/udp/media.hpp>
 #include <libcyphal/transport/udp/tx_rx_sockets.hpp>
 
@@ -35,6 +36,7 @@ public:
 
     MOCK_METHOD(MakeTxSocketResult::Type, makeTxSocket, (), (override));
     MOCK_METHOD(MakeRxSocketResult::Type, makeRxSocket, (const IpEndpoint& multicast_endpoint), (override));
+    MOCK_METHOD(MakeRxSocketResult::Type, makeFrameMonitorRxSocket, (const FrameMonitorRxParams& params), (override));
     MOCK_METHOD(cetl::pmr::memory_resource&, getTxMemoryResource, (), (override));
 
 };  // MediaMock
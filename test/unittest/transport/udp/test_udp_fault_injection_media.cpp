@@ -0,0 +1,354 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "tx_rx_sockets_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/fault_injection.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/fault_injection_media.hpp>
+#include <libcyphal/transport/udp/frame_codec.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+#include <udpard.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::ArgumentError;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::udp;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpFaultInjectionMedia : public testing::Test
+{
+protected:
+    using FrameCodec = libcyphal::transport::udp::detail::FrameCodec;
+    using Datagram   = IRxSocket::ReceiveResult::Metadata;
+
+    static constexpr std::size_t DatagramSize = FrameCodec::HeaderSize + 4U;
+
+    void SetUp() override
+    {
+        EXPECT_CALL(media_mock_, makeTxSocket())  //
+            .WillRepeatedly(Invoke([this] {
+                return libcyphal::detail::makeUniquePtr<TxSocketMock::RefWrapper::Spec>(mr_, tx_socket_mock_);
+            }));
+        EXPECT_CALL(media_mock_, makeRxSocket(_))  //
+            .WillRepeatedly(Invoke([this](auto&) {
+                return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, rx_socket_mock_);
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    static std::array<cetl::byte, DatagramSize> makeFrame(const PortId subject_id, const std::uint8_t payload_byte)
+    {
+        std::array<cetl::byte, DatagramSize> frame{};
+        FrameCodec::serializeHeader({UdpardPriorityNominal, 0x13, UDPARD_NODE_ID_UNSET, subject_id, 0, 0, true},
+                                    frame.data());
+        std::fill(frame.begin() + FrameCodec::HeaderSize, frame.end(), b(payload_byte));
+        return frame;
+    }
+
+    Datagram makeDatagram(const PortId subject_id, const std::uint8_t payload_byte)
+    {
+        const auto frame = makeFrame(subject_id, payload_byte);
+
+        auto* const buffer = static_cast<cetl::byte*>(mr_.allocate(frame.size()));
+        std::copy(frame.begin(), frame.end(), buffer);
+        return {now(), {buffer, libcyphal::PmrRawBytesDeleter{frame.size(), &mr_}}};
+    }
+
+    void expectReceive(const PortId subject_id, const std::uint8_t payload_byte)
+    {
+        EXPECT_CALL(rx_socket_mock_, receive()).WillOnce([this, subject_id, payload_byte] {
+            return IRxSocket::ReceiveResult::Success{makeDatagram(subject_id, payload_byte)};
+        });
+    }
+
+    UniquePtr<IRxSocket> makeRxSocket(IMedia& media)
+    {
+        auto maybe_rx_socket = media.makeRxSocket(IpEndpoint{0xEF000007, 9382});
+        EXPECT_THAT(maybe_rx_socket, VariantWith<UniquePtr<IRxSocket>>(NotNull()));
+        return cetl::get<UniquePtr<IRxSocket>>(std::move(maybe_rx_socket));
+    }
+
+    static cetl::optional<std::uint8_t> payloadByteOf(const IRxSocket::ReceiveResult::Type& result)
+    {
+        const auto* const success = cetl::get_if<IRxSocket::ReceiveResult::Success>(&result);
+        if ((success == nullptr) || !success->has_value())
+        {
+            return cetl::nullopt;
+        }
+        return static_cast<std::uint8_t>((*success)->payload_ptr.get()[FrameCodec::HeaderSize]);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<MediaMock>           media_mock_{};
+    StrictMock<TxSocketMock>        tx_socket_mock_{"TxS1"};
+    StrictMock<RxSocketMock>        rx_socket_mock_{"RxS1"};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestUdpFaultInjectionMedia, sockets_are_decorated)
+{
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, {}};
+
+    {
+        auto maybe_tx_socket = media.makeTxSocket();
+        ASSERT_THAT(maybe_tx_socket, VariantWith<UniquePtr<ITxSocket>>(NotNull()));
+        auto tx_socket = cetl::get<UniquePtr<ITxSocket>>(std::move(maybe_tx_socket));
+
+        EXPECT_CALL(tx_socket_mock_, getMtu()).WillOnce(Return(1234));
+        EXPECT_THAT(tx_socket->getMtu(), 1234);
+
+        EXPECT_CALL(tx_socket_mock_, deinit());
+    }
+    {
+        auto rx_socket = makeRxSocket(media);
+
+        expectReceive(7, 0x42);
+        EXPECT_THAT(payloadByteOf(rx_socket->receive()), Optional(0x42));
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+    }
+
+    // Failures of the decorated media are passed as is.
+    EXPECT_CALL(media_mock_, makeRxSocket(_)).WillOnce(Return(ArgumentError{}));
+    EXPECT_THAT(media.makeRxSocket(IpEndpoint{0xEF000007, 9382}),
+                VariantWith<IMedia::MakeRxSocketResult::Failure>(VariantWith<ArgumentError>(_)));
+}
+
+TEST_F(TestUdpFaultInjectionMedia, rx_drop_duplicate_and_corrupt)
+{
+    FaultInjectionParams params{};
+    params.port_rates = [](const FaultFrameInfo& info) -> cetl::optional<FaultRates> {
+        //
+        FaultRates rates{};
+        if (info.port_id == 7)
+        {
+            rates.drop = 1.0F;
+        }
+        else
+        {
+            rates.duplicate = 1.0F;
+            rates.corrupt   = 1.0F;
+        }
+        return rates;
+    };
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+    {
+        auto rx_socket = makeRxSocket(media);
+
+        expectReceive(7, 0x42);
+        EXPECT_THAT(payloadByteOf(rx_socket->receive()), Eq(cetl::nullopt));
+
+        // The header is intact, but a single bit of the payload is flipped (in both copies).
+        const auto expected_frame = makeFrame(8, 0x00);
+        expectReceive(8, 0x00);
+        for (int i = 0; i < 2; ++i)
+        {
+            const auto  result   = rx_socket->receive();
+            const auto& datagram = cetl::get<IRxSocket::ReceiveResult::Success>(result);
+            ASSERT_TRUE(datagram.has_value());
+
+            const cetl::span<const cetl::byte> bytes{datagram->payload_ptr.get(), DatagramSize};
+            const auto                         header_end = expected_frame.begin() + FrameCodec::HeaderSize;
+            EXPECT_TRUE(std::equal(expected_frame.begin(), header_end, bytes.begin()));
+
+            std::size_t flipped_bits = 0;
+            for (std::size_t j = FrameCodec::HeaderSize; j < DatagramSize; ++j)
+            {
+                flipped_bits += std::bitset<8>{static_cast<std::uint8_t>(bytes[j])}.count();
+            }
+            EXPECT_THAT(flipped_bits, 1);
+        }
+
+        EXPECT_THAT(media.getStats().dropped, 1);
+        EXPECT_THAT(media.getStats().duplicated, 1);
+        EXPECT_THAT(media.getStats().corrupted, 1);
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+    }
+}
+
+TEST_F(TestUdpFaultInjectionMedia, rx_reorder)
+{
+    FaultInjectionParams params{};
+    params.port_rates = [](const FaultFrameInfo& info) -> cetl::optional<FaultRates> {
+        //
+        if (info.port_id != 8)
+        {
+            return cetl::nullopt;
+        }
+        FaultRates rates{};
+        rates.reorder = 1.0F;
+        return rates;
+    };
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    auto                      rx_socket = makeRxSocket(media);
+    std::vector<std::uint8_t> delivered;
+
+    EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {          //
+            return scheduler_.registerNamedCallback("rx", std::move(function));
+        }));
+    auto rx_callback = rx_socket->registerCallback([&](const auto&) {
+        //
+        if (const auto payload_byte = payloadByteOf(rx_socket->receive()))
+        {
+            delivered.push_back(*payload_byte);
+        }
+    });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        expectReceive(8, 8);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(delivered, IsEmpty());
+
+        expectReceive(9, 9);
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        EXPECT_THAT(delivered, ElementsAre(9, 8));
+        EXPECT_THAT(media.getStats().reordered, 1);
+
+        rx_callback.reset();
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        rx_socket.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestUdpFaultInjectionMedia, tx_faults)
+{
+    FaultInjectionParams params{};
+    params.tx_busy_duration = 3ms;
+    params.port_rates       = [](const FaultFrameInfo& info) -> cetl::optional<FaultRates> {
+        //
+        FaultRates rates{};
+        rates.drop      = (info.port_id == 7) ? 1.0F : 0.0F;
+        rates.duplicate = (info.port_id == 8) ? 1.0F : 0.0F;
+        rates.tx_busy   = (info.port_id == 9) ? 1.0F : 0.0F;
+        return rates;
+    };
+
+    FaultInjectionMedia media{media_mock_, scheduler_, mr_, std::move(params)};
+
+    auto maybe_tx_socket = media.makeTxSocket();
+    ASSERT_THAT(maybe_tx_socket, VariantWith<UniquePtr<ITxSocket>>(NotNull()));
+    auto tx_socket = cetl::get<UniquePtr<ITxSocket>>(std::move(maybe_tx_socket));
+
+    std::vector<TimePoint> notified;
+    EXPECT_CALL(tx_socket_mock_, registerCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {          //
+            return scheduler_.registerNamedCallback("tx", std::move(function));
+        }));
+    auto tx_callback = tx_socket->registerCallback([&](const auto& arg) { notified.push_back(arg.exec_time); });
+
+    const auto send = [&](const PortId subject_id) {
+        //
+        // The header is split between fragments on purpose.
+        const auto                                        frame = makeFrame(subject_id, 0x00);
+        const std::array<cetl::span<const cetl::byte>, 2> fragments{cetl::span<const cetl::byte>{frame.data(), 10},
+                                                                     cetl::span<const cetl::byte>{frame}.subspan(10)};
+        const auto result = tx_socket->send(now() + 1s, IpEndpoint{0xEF000007, 9382}, 0, fragments);
+        return cetl::get<ITxSocket::SendResult::Success>(result).is_accepted;
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(send(7));
+
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .Times(2)
+            .WillRepeatedly(Return(ITxSocket::SendResult::Success{true /* is_accepted */}));
+        EXPECT_TRUE(send(8));
+
+        EXPECT_FALSE(send(9));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(notified, ElementsAre(TimePoint{1s + 3ms}));
+
+        EXPECT_THAT(media.getStats().dropped, 1);
+        EXPECT_THAT(media.getStats().duplicated, 1);
+        EXPECT_THAT(media.getStats().tx_busy, 1);
+
+        tx_callback.reset();
+        EXPECT_CALL(tx_socket_mock_, deinit());
+        tx_socket.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
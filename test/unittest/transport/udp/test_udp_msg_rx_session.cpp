@@ -548,6 +548,203 @@ TEST_F(TestUdpMsgRxSession, receive_via_callback)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestUdpMsgRxSession, rx_reassembly_budget)
+{
+    using Budget = IUdpTransport::RxReassemblyBudget;
+
+    auto transport = makeTransport({mr_, nullptr, nullptr, &payload_mr_});
+
+    EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {          //
+            return scheduler_.registerNamedCallback("rx_socket", std::move(function));
+        }));
+
+    auto maybe_session = transport->makeMessageRxSession({1000, 0x23});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    // Each frame is the first (but not the last) one of a new multi-frame transfer from a different node,
+    // so its buffer is held by the subscription until the transfer is complete (or aborted).
+    constexpr std::size_t PayloadSize = 100;
+    constexpr std::size_t FrameSize   = UdpardFrame::SizeOfHeader + PayloadSize;
+
+    const auto receive_frame_at = [&](const TimePoint rx_timestamp,
+                                      const NodeId    src_node_id,
+                                      const Priority  priority,
+                                      const bool      is_last) {
+        //
+        EXPECT_CALL(rx_socket_mock_, receive())  //
+            .WillOnce([this, rx_timestamp, src_node_id, priority, is_last]() -> IRxSocket::ReceiveResult::Metadata {
+                auto frame =
+                    UdpardFrame(src_node_id, UDPARD_NODE_ID_UNSET, 0x0D, PayloadSize, &payload_mr_, priority, is_last);
+                frame.setPortId(0x23, false /*is_service*/);
+                std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+                return {rx_timestamp, std::move(frame).release(tx_crc)};
+            });
+        scheduler_.scheduleNamedCallback("rx_socket", rx_timestamp);
+    };
+    const auto held_bytes = [this] { return payload_mr_.total_allocated_bytes - payload_mr_.total_deallocated_bytes; };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        transport->setRxReassemblyBudget(Budget::Params{0, 2 * FrameSize});
+        receive_frame_at(now() + 10ms, 0x10, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        receive_frame_at(now() + 10ms, 0x11, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 40ms, [&](const auto&) {
+        //
+        EXPECT_THAT(held_bytes(), 2 * FrameSize);
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 0);
+
+        // More important frame doesn't fit into the port budget - the low priority reassemblies are aborted.
+        receive_frame_at(now() + 10ms, 0x12, Priority::High, false);
+    });
+    scheduler_.scheduleAt(1s + 60ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 1);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 0);
+        EXPECT_THAT(held_bytes(), FrameSize);
+
+        receive_frame_at(now() + 10ms, 0x13, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 80ms, [&](const auto&) {
+        //
+        // Less important frame doesn't fit, and can't evict the high priority reassembly - so it's dropped.
+        receive_frame_at(now() + 10ms, 0x14, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 1);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 1);
+
+        // Single-frame exceptional transfer evicts everything, and it's delivered.
+        receive_frame_at(now() + 10ms, 0x15, Priority::Exceptional, true);
+    });
+    scheduler_.scheduleAt(1s + 120ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 2);
+        EXPECT_THAT(session->receive(), Optional(_));
+        EXPECT_THAT(held_bytes(), 0);
+
+        // Switch to the global budget.
+        transport->setRxReassemblyBudget(Budget::Params{2 * FrameSize, 0});
+        receive_frame_at(now() + 10ms, 0x16, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 140ms, [&](const auto&) {
+        //
+        receive_frame_at(now() + 10ms, 0x17, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 160ms, [&](const auto&) {
+        //
+        receive_frame_at(now() + 10ms, 0x18, Priority::Optional, false);
+    });
+    scheduler_.scheduleAt(1s + 180ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 2);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 2);
+
+        receive_frame_at(now() + 10ms, 0x19, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 200ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 3);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 2);
+        EXPECT_THAT(held_bytes(), FrameSize);
+
+        // Without budget, nothing is evicted or dropped anymore.
+        transport->setRxReassemblyBudget(cetl::nullopt);
+        receive_frame_at(now() + 10ms, 0x1A, Priority::Optional, false);
+    });
+    scheduler_.scheduleAt(1s + 220ms, [&](const auto&) {
+        //
+        receive_frame_at(now() + 10ms, 0x1B, Priority::Optional, false);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 3);
+        EXPECT_THAT(transport->getRxReassemblyStats().dropped_frames, 2);
+        EXPECT_THAT(held_bytes(), 3 * FrameSize);
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestUdpMsgRxSession, rx_reassembly_budget_keeps_tid_dedup)
+{
+    using Budget = IUdpTransport::RxReassemblyBudget;
+
+    auto transport = makeTransport({mr_, nullptr, nullptr, &payload_mr_});
+
+    EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {          //
+            return scheduler_.registerNamedCallback("rx_socket", std::move(function));
+        }));
+
+    auto maybe_session = transport->makeMessageRxSession({1000, 0x23});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    constexpr std::size_t PayloadSize = 100;
+    constexpr std::size_t FrameSize   = UdpardFrame::SizeOfHeader + PayloadSize;
+
+    // All frames have the same transfer ID.
+    const auto receive_frame_at = [&](const TimePoint rx_timestamp,
+                                      const NodeId    src_node_id,
+                                      const Priority  priority,
+                                      const bool      is_last) {
+        //
+        EXPECT_CALL(rx_socket_mock_, receive())  //
+            .WillOnce([this, rx_timestamp, src_node_id, priority, is_last]() -> IRxSocket::ReceiveResult::Metadata {
+                auto frame =
+                    UdpardFrame(src_node_id, UDPARD_NODE_ID_UNSET, 0x0D, PayloadSize, &payload_mr_, priority, is_last);
+                frame.setPortId(0x23, false /*is_service*/);
+                std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+                return {rx_timestamp, std::move(frame).release(tx_crc)};
+            });
+        scheduler_.scheduleNamedCallback("rx_socket", rx_timestamp);
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        transport->setRxReassemblyBudget(Budget::Params{0, FrameSize});
+        receive_frame_at(now() + 10ms, 0x31, Priority::Exceptional, true);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        EXPECT_THAT(session->receive(), Optional(_));
+
+        receive_frame_at(now() + 10ms, 0x32, Priority::Low, false);
+    });
+    scheduler_.scheduleAt(1s + 40ms, [&](const auto&) {
+        //
+        // Evicts the whole session - libudpard forgets transfer ID of 0x31 as well.
+        receive_frame_at(now() + 10ms, 0x33, Priority::High, false);
+    });
+    scheduler_.scheduleAt(1s + 60ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 1);
+
+        // A redundant copy of the already delivered transfer - it still has to be rejected.
+        receive_frame_at(now() + 10ms, 0x31, Priority::Exceptional, true);
+    });
+    scheduler_.scheduleAt(1s + 80ms, [&](const auto&) {
+        //
+        EXPECT_THAT(transport->getRxReassemblyStats().evictions, 2);
+        EXPECT_THAT(session->receive(), Eq(cetl::nullopt));
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+}
+
 TEST_F(TestUdpMsgRxSession, unsubscribe)
 {
     auto transport = makeTransport({mr_});
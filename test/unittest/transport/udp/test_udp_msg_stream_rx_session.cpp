@@ -0,0 +1,361 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "tx_rx_sockets_mock.hpp"
+#include "udp_gtest_helpers.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/msg_stream_rx_session.hpp>
+#include <libcyphal/transport/udp/msg_stream_sessions.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/transport/udp/udp_transport.hpp>
+#include <libcyphal/transport/udp/udp_transport_impl.hpp>
+#include <libcyphal/types.hpp>
+#include <udpard.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::udp;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::Invoke;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::ReturnRef;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpMsgStreamRxSession : public testing::Test
+{
+protected:
+    using Status = IMessageStreamRxSession::OnChunkCallback::Status;
+
+    struct Chunk
+    {
+        Status            status;
+        TransferId        transfer_id;
+        std::size_t       offset;
+        std::vector<char> data;
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(media_mock_, makeRxSocket(_))  //
+            .WillRepeatedly(Invoke([this](auto& endpoint) {
+                rx_socket_mock_.setEndpoint(endpoint);
+                return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, rx_socket_mock_);
+            }));
+        EXPECT_CALL(media_mock_, getTxMemoryResource()).WillRepeatedly(ReturnRef(mr_));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(payload_mr_.allocations, IsEmpty());
+        EXPECT_THAT(payload_mr_.total_allocated_bytes, payload_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    UniquePtr<IUdpTransport> makeTransport(const MemoryResourcesSpec& mem_res_spec)
+    {
+        std::array<IMedia*, 1> media_array{&media_mock_};
+
+        auto maybe_transport = udp::makeTransport(mem_res_spec, scheduler_, media_array, 0);
+        EXPECT_THAT(maybe_transport, VariantWith<UniquePtr<IUdpTransport>>(NotNull()));
+        return cetl::get<UniquePtr<IUdpTransport>>(std::move(maybe_transport));
+    }
+
+    UniquePtr<IMessageStreamRxSession> makeSession(IUdpTransport& transport, const MessageRxParams& params)
+    {
+        EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("rx_socket", std::move(function));
+            }));
+
+        auto maybe_session = transport.makeMessageStreamRxSession(params);
+        EXPECT_THAT(maybe_session, VariantWith<UniquePtr<IMessageStreamRxSession>>(NotNull()));
+        auto session = cetl::get<UniquePtr<IMessageStreamRxSession>>(std::move(maybe_session));
+
+        session->setOnChunkCallback([this](const auto& arg) {
+            //
+            Chunk chunk{arg.status, arg.metadata.rx_meta.base.transfer_id, arg.offset, {}};
+            for (const auto byte : arg.chunk)
+            {
+                chunk.data.push_back(static_cast<char>(byte));
+            }
+            chunks_.push_back(std::move(chunk));
+        });
+        return session;
+    }
+
+    /// Emulates reception of a frame (with "a", "b", "c"... payload) by the media RX socket.
+    ///
+    void receiveFrame(const TransferId    transfer_id,
+                      const std::uint32_t frame_index,
+                      const bool          is_last,
+                      const std::size_t   payload_size,
+                      std::uint32_t&      inout_tx_crc)
+    {
+        EXPECT_CALL(rx_socket_mock_, receive())  //
+            .WillOnce([&, transfer_id, frame_index, is_last, payload_size]() -> IRxSocket::ReceiveResult::Metadata {
+                auto frame = UdpardFrame(0x13,
+                                         UDPARD_NODE_ID_UNSET,
+                                         transfer_id,
+                                         payload_size,
+                                         &payload_mr_,
+                                         Priority::Slow,
+                                         is_last,
+                                         frame_index);
+                for (std::size_t i = 0; i < payload_size; ++i)
+                {
+                    frame.payload()[i] = b(static_cast<std::uint8_t>('a' + ((frame_index * payload_size + i) % 26)));
+                }
+                frame.setPortId(0x23);
+                return {now(), std::move(frame).release(inout_tx_crc)};
+            });
+        scheduler_.scheduleNamedCallback("rx_socket", now());
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    TrackingMemoryResource          payload_mr_;
+    StrictMock<MediaMock>           media_mock_{};
+    StrictMock<RxSocketMock>        rx_socket_mock_{"RxS1"};
+    std::vector<Chunk>              chunks_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestUdpMsgStreamRxSession, make)
+{
+    auto transport = makeTransport({mr_, nullptr, nullptr, &payload_mr_});
+
+    auto session = makeSession(*transport, {64, 0x23});
+    EXPECT_THAT(session->getParams().extent_bytes, 64);
+    EXPECT_THAT(session->getParams().subject_id, 0x23);
+    EXPECT_THAT(rx_socket_mock_.getEndpoint().ip_address, 0xEF000023);
+    EXPECT_THAT(rx_socket_mock_.getEndpoint().udp_port, 9382);
+
+    // The same subject can't have another (regular or streaming) session.
+    EXPECT_THAT(transport->makeMessageRxSession({64, 0x23}),
+                VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+    EXPECT_THAT(transport->makeMessageStreamRxSession({64, 0x23}),
+                VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+
+    // Invalid subject id.
+    EXPECT_THAT(transport->makeMessageStreamRxSession({64, UDPARD_SUBJECT_ID_MAX + 1}),
+                VariantWith<AnyFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+
+    EXPECT_CALL(rx_socket_mock_, deinit());
+    session.reset();
+    testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    EXPECT_THAT(scheduler_.hasNamedCallback("rx_socket"), false);
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestUdpMsgStreamRxSession, receive_progressively)
+{
+    auto transport = makeTransport({mr_, nullptr, nullptr, &payload_mr_});
+    auto session   = makeSession(*transport, {64, 0x23});
+
+    std::uint32_t tx_crc     = UdpardFrame::InitialTxCrc;
+    std::uint32_t dup_tx_crc = UdpardFrame::InitialTxCrc;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receiveFrame(0x0D, 0, false, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        // The last 4 bytes are held back (b/c they might be the transfer CRC).
+        ASSERT_THAT(chunks_, SizeIs(1));
+        EXPECT_THAT(chunks_[0].status, Status::InProgress);
+        EXPECT_THAT(chunks_[0].transfer_id, 0x0D);
+        EXPECT_THAT(chunks_[0].offset, 0);
+        EXPECT_THAT(chunks_[0].data, ElementsAre('a', 'b', 'c', 'd'));
+        EXPECT_THAT(payload_mr_.allocations, IsEmpty());
+        chunks_.clear();
+
+        receiveFrame(0x0D, 1, false, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        ASSERT_THAT(chunks_, SizeIs(2));
+        EXPECT_THAT(chunks_[0].offset, 4);
+        EXPECT_THAT(chunks_[0].data, ElementsAre('e', 'f', 'g', 'h'));
+        EXPECT_THAT(chunks_[1].offset, 8);
+        EXPECT_THAT(chunks_[1].data, ElementsAre('i', 'j', 'k', 'l'));
+        chunks_.clear();
+
+        // Duplicate (f.e. from a redundant media) is dropped.
+        receiveFrame(0x0D, 1, false, 8, dup_tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 3ms, [&](const auto&) {
+        //
+        EXPECT_THAT(chunks_, IsEmpty());
+
+        receiveFrame(0x0D, 2, true, 2, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 4ms, [&](const auto&) {
+        //
+        ASSERT_THAT(chunks_, SizeIs(3));
+        EXPECT_THAT(chunks_[0].offset, 12);
+        EXPECT_THAT(chunks_[0].data, ElementsAre('m', 'n', 'o', 'p'));
+        EXPECT_THAT(chunks_[1].offset, 16);
+        EXPECT_THAT(chunks_[1].data, ElementsAre('e', 'f'));  // 2-nd frame of 2 bytes starts from 'a' + 2 * 2
+        EXPECT_THAT(chunks_[2].status, Status::Completed);
+        EXPECT_THAT(chunks_[2].offset, 18);
+        EXPECT_THAT(chunks_[2].data, IsEmpty());
+        chunks_.clear();
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestUdpMsgStreamRxSession, receive_with_lost_frame_and_extent)
+{
+    auto transport = makeTransport({mr_, nullptr, nullptr, &payload_mr_});
+    auto session   = makeSession(*transport, {6, 0x23});
+
+    std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receiveFrame(0x0D, 0, false, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        // Frame #1 is lost.
+        receiveFrame(0x0D, 2, true, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        ASSERT_THAT(chunks_, SizeIs(2));
+        EXPECT_THAT(chunks_[0].status, Status::InProgress);
+        EXPECT_THAT(chunks_[0].data, ElementsAre('a', 'b', 'c', 'd'));
+        EXPECT_THAT(chunks_[1].status, Status::Aborted);
+        EXPECT_THAT(chunks_[1].offset, 4);
+        chunks_.clear();
+
+        // The next transfer is received as a single frame, but only up to the extent.
+        tx_crc = UdpardFrame::InitialTxCrc;
+        receiveFrame(0x0E, 0, true, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 3ms, [&](const auto&) {
+        //
+        ASSERT_THAT(chunks_, SizeIs(2));
+        EXPECT_THAT(chunks_[0].transfer_id, 0x0E);
+        EXPECT_THAT(chunks_[0].data, ElementsAre('a', 'b', 'c', 'd', 'e', 'f'));
+        EXPECT_THAT(chunks_[1].status, Status::Completed);
+        EXPECT_THAT(chunks_[1].offset, 6);
+        chunks_.clear();
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestUdpMsgStreamRxSession, receive_aborted_by_timeout)
+{
+    auto transport = makeTransport({mr_, nullptr, nullptr, &payload_mr_});
+    auto session   = makeSession(*transport, {64, 0x23});
+    session->setTransferIdTimeout(100ms);
+
+    std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receiveFrame(0x0D, 0, false, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 60ms, [&](const auto&) {
+        //
+        receiveFrame(0x0D, 1, false, 8, tx_crc);
+    });
+    scheduler_.scheduleAt(1s + 150ms, [&](const auto&) {
+        //
+        // Each frame restarts the timeout, so the transfer is still in progress.
+        ASSERT_THAT(chunks_, SizeIs(3));
+        EXPECT_THAT(chunks_[2].status, Status::InProgress);
+        chunks_.clear();
+    });
+    scheduler_.scheduleAt(1s + 160ms + 1us, [&](const auto&) {
+        //
+        // No more frames of the subject, but the transfer is aborted anyway (by the executor).
+        ASSERT_THAT(chunks_, SizeIs(1));
+        EXPECT_THAT(chunks_[0].status, Status::Aborted);
+        EXPECT_THAT(chunks_[0].transfer_id, 0x0D);
+        EXPECT_THAT(chunks_[0].offset, 12);
+        chunks_.clear();
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(chunks_, IsEmpty());
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
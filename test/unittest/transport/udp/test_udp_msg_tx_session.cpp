@@ -33,7 +33,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -59,6 +61,7 @@ using testing::IsEmpty;
 using testing::NotNull;
 using testing::ReturnRef;
 using testing::StrictMock;
+using testing::ElementsAre;
 using testing::VariantWith;
 
 // https://github.com/llvm/llvm-project/issues/53444
@@ -413,6 +416,135 @@ TEST_F(TestUdpMsgTxSession, send_when_no_memory_for_contiguous_payload)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestUdpMsgTxSession, send_with_tx_timestamps)
+{
+    auto transport = makeTransport({mr_});
+
+    auto maybe_session = transport->makeMessageTxSession({0x17});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    const auto         payload = makeIotaArray<3>(b('1'));
+    TransferTxMetadata metadata{{0x03, Priority::High}, {}};
+
+    std::vector<std::tuple<TransferId, TimePoint>> timestamps;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        session->setOnTxTimestampCallback([&](const auto& arg) {
+            //
+            timestamps.emplace_back(arg.transfer_id, arg.timestamp);
+        });
+
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .WillOnce(Return(ITxSocket::SendResult::Success{true /* is_accepted */, TimePoint{1s + 5us}}));
+
+        metadata.deadline = now() + 1s;
+        EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Socket which can't timestamp the datagram - nothing to report.
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .WillOnce(Return(ITxSocket::SendResult::Success{true /* is_accepted */}));
+
+        metadata.base.transfer_id++;
+        metadata.deadline = now() + 1s;
+        EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Cancel the callback, so there should be no more reports.
+        session->setOnTxTimestampCallback({});
+
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .WillOnce(Return(ITxSocket::SendResult::Success{true /* is_accepted */, TimePoint{3s + 5us}}));
+
+        metadata.base.transfer_id++;
+        metadata.deadline = now() + 1s;
+        EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        session.reset();
+        EXPECT_CALL(tx_socket_mock_, deinit());
+        transport.reset();
+        testing::Mock::VerifyAndClearExpectations(&tx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(timestamps, ElementsAre(std::make_tuple(0x03, TimePoint{1s + 5us})));
+}
+
+TEST_F(TestUdpMsgTxSession, send_with_tx_capacity_callback)
+{
+    auto transport = makeTransport({mr_});
+
+    auto maybe_session = transport->makeMessageTxSession({0x17});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    const auto         payload = makeIotaArray<3>(b('1'));
+    TransferTxMetadata metadata{{0x03, Priority::High}, {}};
+
+    std::vector<std::tuple<TimePoint, std::size_t>> notifications;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        session->setOnTxCapacityCallback(
+            [&](const auto& arg) {
+                //
+                notifications.emplace_back(now(), arg.free_frames);
+
+                // Retry from within the callback - it brings occupancy back to the watermark (and so re-arms).
+                metadata.base.transfer_id++;
+                EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+            },
+            12);
+
+        // Emulate that socket is busy, so that all 16 datagrams stay in the TX queue.
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))
+            .WillOnce(Return(ITxSocket::SendResult::Success{false /* is_accepted */}));
+        EXPECT_CALL(tx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("tx", std::move(function));
+            }));
+
+        metadata.deadline = now() + 1s;
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+            metadata.base.transfer_id++;
+        }
+        EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Optional(VariantWith<CapacityError>(_)));
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        // Socket is ready now - each "tx" callback sends one datagram (16 -> 15 -> ... -> 11).
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .Times(6)
+            .WillRepeatedly(Return(ITxSocket::SendResult::Success{true /* is_accepted */}));
+    });
+    for (int i = 1; i <= 6; ++i)
+    {
+        scheduler_.scheduleAt(1s + i * 10ms, [&](const auto&) {
+            //
+            scheduler_.scheduleNamedCallback("tx");
+        });
+    }
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        session.reset();
+        EXPECT_CALL(tx_socket_mock_, deinit());
+        transport.reset();
+        testing::Mock::VerifyAndClearExpectations(&tx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(notifications,
+                ElementsAre(std::make_tuple(TimePoint{1s + 50ms}, 5), std::make_tuple(TimePoint{1s + 60ms}, 5)));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
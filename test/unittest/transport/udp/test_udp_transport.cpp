@@ -9,12 +9,14 @@
 #include "tracking_memory_resource.hpp"
 #include "transient_error_handler_mock.hpp"
 #include "tx_rx_sockets_mock.hpp"
+#include "udp_gtest_helpers.hpp"
 #include "verification_utilities.hpp"
 #include "virtual_time_scheduler.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/errors.hpp>
 #include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/frame_monitor_sessions.hpp>
 #include <libcyphal/transport/msg_sessions.hpp>
 #include <libcyphal/transport/svc_sessions.hpp>
 #include <libcyphal/transport/types.hpp>
@@ -35,6 +37,7 @@
 #include <functional>
 #include <limits>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -61,6 +64,7 @@ using testing::NotNull;
 using testing::Optional;
 using testing::ReturnRef;
 using testing::StrictMock;
+using testing::ElementsAre;
 using testing::VariantWith;
 
 // https://github.com/llvm/llvm-project/issues/53444
@@ -97,6 +101,41 @@ private:
 
 };  // MyPlatformError
 
+class MyTxPayloadSource final : public ITxPayloadSource
+{
+public:
+    MyTxPayloadSource(const cetl::span<const cetl::byte> payload, std::size_t& reads_count)
+        : payload_{payload}
+        , reads_count_{reads_count}
+    {
+    }
+    ~MyTxPayloadSource()                                       = default;
+    MyTxPayloadSource(const MyTxPayloadSource&)                = delete;
+    MyTxPayloadSource(MyTxPayloadSource&&) noexcept            = delete;
+    MyTxPayloadSource& operator=(const MyTxPayloadSource&)     = delete;
+    MyTxPayloadSource& operator=(MyTxPayloadSource&&) noexcept = delete;
+
+    // MARK: ITxPayloadSource
+
+    std::size_t size() const noexcept override
+    {
+        return payload_.size();
+    }
+
+    std::size_t read(const std::size_t offset, const cetl::span<cetl::byte> destination) override
+    {
+        ++reads_count_;
+        const auto chunk = payload_.subspan(offset, std::min(destination.size(), payload_.size() - offset));
+        std::copy(chunk.begin(), chunk.end(), destination.begin());
+        return chunk.size();
+    }
+
+private:
+    const cetl::span<const cetl::byte> payload_;
+    std::size_t&                       reads_count_;
+
+};  // MyTxPayloadSource
+
 class TestUpdTransport : public testing::Test
 {
 protected:
@@ -281,6 +320,30 @@ TEST_F(TestUpdTransport, makeTransport_with_invalid_arguments)
     EXPECT_THAT(maybe_transport, VariantWith<FactoryFailure>(VariantWith<libcyphal::ArgumentError>(_)));
 }
 
+TEST_F(TestUpdTransport, makeTransport_with_invalid_tx_bands)
+{
+    std::array<IMedia*, 1> media_array{&media_mock_};
+
+    // The first band is not #0.
+    {
+        const TxPriorityBandsSpec tx_bands_spec{{1, 1, 1, 1, 1, 1, 1, 1}, {}};
+        const auto maybe_transport = udp::makeTransport({mr_}, scheduler_, media_array, 0, tx_bands_spec);
+        EXPECT_THAT(maybe_transport, VariantWith<FactoryFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+    }
+    // There is a gap between bands.
+    {
+        const TxPriorityBandsSpec tx_bands_spec{{0, 0, 0, 0, 2, 2, 2, 2}, {}};
+        const auto maybe_transport = udp::makeTransport({mr_}, scheduler_, media_array, 0, tx_bands_spec);
+        EXPECT_THAT(maybe_transport, VariantWith<FactoryFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+    }
+    // Bands are not in the priority order.
+    {
+        const TxPriorityBandsSpec tx_bands_spec{{0, 0, 1, 1, 0, 0, 0, 0}, {}};
+        const auto maybe_transport = udp::makeTransport({mr_}, scheduler_, media_array, 0, tx_bands_spec);
+        EXPECT_THAT(maybe_transport, VariantWith<FactoryFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+    }
+}
+
 TEST_F(TestUpdTransport, getProtocolParams)
 {
     StrictMock<MediaMock>    media_mock2{};
@@ -605,6 +668,161 @@ TEST_F(TestUpdTransport, sending_multiframe_payload_for_non_anonymous)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestUpdTransport, sendMessageStream_invalid_arguments)
+{
+    auto transport = makeTransport({mr_});
+
+    std::size_t        reads_count = 0;
+    const auto         payload     = makeIotaArray<8>(b('0'));
+    TransferTxMetadata metadata{{0x13, Priority::Nominal}, now() + 1s};
+
+    // Anonymous node can't stream.
+    {
+        auto source = libcyphal::makeUniquePtr<ITxPayloadSource, MyTxPayloadSource>(mr_, payload, reads_count);
+        EXPECT_THAT(transport->sendMessageStream(7, metadata, std::move(source)),
+                    Optional(VariantWith<ArgumentError>(_)));
+    }
+
+    EXPECT_THAT(transport->setLocalNodeId(0x45), Eq(cetl::nullopt));
+
+    // Invalid subject id.
+    {
+        auto source = libcyphal::makeUniquePtr<ITxPayloadSource, MyTxPayloadSource>(mr_, payload, reads_count);
+        EXPECT_THAT(transport->sendMessageStream(UDPARD_SUBJECT_ID_MAX + 1, metadata, std::move(source)),
+                    Optional(VariantWith<ArgumentError>(_)));
+    }
+
+    // No source.
+    EXPECT_THAT(transport->sendMessageStream(7, metadata, nullptr), Optional(VariantWith<ArgumentError>(_)));
+
+    EXPECT_THAT(reads_count, 0);
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestUpdTransport, sendMessageStream_subject_in_use)
+{
+    auto transport = makeTransport({mr_});
+    EXPECT_THAT(transport->setLocalNodeId(0x45), Eq(cetl::nullopt));
+
+    std::size_t        reads_count = 0;
+    const auto         payload     = makeIotaArray<UDPARD_MTU_DEFAULT * 2>(b('0'));
+    TransferTxMetadata metadata{{0x13, Priority::Nominal}, now() + 1s};
+
+    // A subject with a regular TX session can't be streamed (b/c of possible transfer id collisions).
+    {
+        auto maybe_session = transport->makeMessageTxSession({7});
+        ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+        auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+        auto source = libcyphal::makeUniquePtr<ITxPayloadSource, MyTxPayloadSource>(mr_, payload, reads_count);
+        EXPECT_THAT(transport->sendMessageStream(7, metadata, std::move(source)),
+                    Optional(VariantWith<AlreadyExistsError>(_)));
+        EXPECT_THAT(reads_count, 0);
+    }
+
+    // And vice versa - no new TX session for a subject while its stream is in flight.
+    {
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .WillOnce(Return(ITxSocket::SendResult::Success{false /* is_accepted */}));
+        EXPECT_CALL(tx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerAndScheduleNamedCallback("tx", now() + 10us, std::move(function));
+            }));
+
+        auto source = libcyphal::makeUniquePtr<ITxPayloadSource, MyTxPayloadSource>(mr_, payload, reads_count);
+        EXPECT_THAT(transport->sendMessageStream(7, metadata, std::move(source)), Eq(cetl::nullopt));
+
+        EXPECT_THAT(transport->makeMessageTxSession({7}), VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+        EXPECT_THAT(transport->makeMessageTxSession({8}), VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    }
+
+    EXPECT_CALL(tx_socket_mock_, deinit());
+    transport.reset();
+    testing::Mock::VerifyAndClearExpectations(&tx_socket_mock_);
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestUpdTransport, sendMessageStream_lazily)
+{
+    auto transport = makeTransport({mr_});
+    EXPECT_THAT(transport->setLocalNodeId(0x45), Eq(cetl::nullopt));
+
+    constexpr auto timeout = 1s;
+
+    std::size_t        reads_count = 0;
+    const auto         payload     = makeIotaArray<UDPARD_MTU_DEFAULT * 2 + 1>(b('0'));
+    TransferTxMetadata metadata{{0x13, Priority::Nominal}, {}};
+
+    auto source = libcyphal::makeUniquePtr<ITxPayloadSource, MyTxPayloadSource>(mr_, payload, reads_count);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))
+            .WillOnce([&](auto deadline, auto endpoint, auto, auto fragments) {
+                EXPECT_THAT(deadline, metadata.deadline);
+                EXPECT_THAT(endpoint.ip_address, 0xEF000007);
+                EXPECT_THAT(endpoint.udp_port, 9382);
+                EXPECT_THAT(fragments, SizeIs(1));
+                EXPECT_THAT(fragments[0], SizeIs(24 + UDPARD_MTU_DEFAULT));
+                EXPECT_THAT(fragments[0][24], b('0'));
+                return ITxSocket::SendResult::Success{false /* is_accepted */};
+            });
+        EXPECT_CALL(tx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerAndScheduleNamedCallback("tx", now() + 10us, std::move(function));
+            }));
+
+        metadata.deadline = now() + timeout;
+        auto failure      = transport->sendMessageStream(7, metadata, std::move(source));
+        EXPECT_THAT(failure, Eq(cetl::nullopt));
+        EXPECT_THAT(reads_count, 1);
+    });
+    scheduler_.scheduleAt(1s + 10us, [&](const auto&) {
+        //
+        // Not accepted datagram should be rebuilt (from the same payload offset) and re-sent.
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))
+            .WillOnce([&](auto, auto, auto, auto fragments) {
+                EXPECT_THAT(fragments[0], SizeIs(24 + UDPARD_MTU_DEFAULT));
+                EXPECT_THAT(fragments[0][24], b('0'));
+                return ITxSocket::SendResult::Success{true /* is_accepted */};
+            });
+        scheduler_.scheduleNamedCallback("tx", now() + 10us);
+    });
+    scheduler_.scheduleAt(1s + 10us + 1us, [&](const auto&) {
+        //
+        EXPECT_THAT(reads_count, 2);
+    });
+    scheduler_.scheduleAt(1s + 20us, [&](const auto&) {
+        //
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))
+            .WillOnce([&](auto, auto, auto, auto fragments) {
+                EXPECT_THAT(fragments[0], SizeIs(24 + UDPARD_MTU_DEFAULT));
+                return ITxSocket::SendResult::Success{true /* is_accepted */};
+            });
+        scheduler_.scheduleNamedCallback("tx", now() + 10us);
+    });
+    scheduler_.scheduleAt(1s + 30us, [&](const auto&) {
+        //
+        // The last datagram contains the rest of the payload and the transfer CRC.
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))
+            .WillOnce([&](auto, auto, auto, auto fragments) {
+                EXPECT_THAT(fragments[0], SizeIs(24 + payload.size() + 4 - UDPARD_MTU_DEFAULT * 2));
+                return ITxSocket::SendResult::Success{true /* is_accepted */};
+            });
+    });
+    scheduler_.scheduleAt(1s + 30us + 1us, [&](const auto&) {
+        //
+        EXPECT_THAT(reads_count, 4);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_CALL(tx_socket_mock_, deinit());
+        transport.reset();
+        testing::Mock::VerifyAndClearExpectations(&tx_socket_mock_);
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 TEST_F(TestUpdTransport, send_multiframe_payload_to_redundant_not_ready_media)
 {
@@ -717,6 +935,94 @@ TEST_F(TestUpdTransport, send_multiframe_payload_to_redundant_not_ready_media)
     scheduler_.spinFor(10s);
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestUpdTransport, send_payload_by_priority_bands)
+{
+    // The band #0 is for `Exceptional`...`Nominal` priorities, and the band #1 - for `Low`...`Optional`.
+    //
+    const TxPriorityBandsSpec tx_bands_spec{{0, 0, 0, 0, 0, 1, 1, 1}, {0, 4}};
+
+    StrictMock<TxSocketMock> tx_socket_mock0{"TxS0"};
+    EXPECT_CALL(tx_socket_mock0, getMtu()).WillRepeatedly(Return(UDPARD_MTU_DEFAULT));
+    EXPECT_CALL(media_mock_, makeTxSocket())
+        .WillOnce(Invoke([this, &tx_socket_mock0] {
+            return libcyphal::detail::makeUniquePtr<TxSocketMock::RefWrapper::Spec>(mr_, tx_socket_mock0);
+        }))
+        .WillOnce(Invoke([this] {
+            return libcyphal::detail::makeUniquePtr<TxSocketMock::RefWrapper::Spec>(mr_, tx_socket_mock_);
+        }));
+
+    std::array<IMedia*, 1> media_array{&media_mock_};
+    auto maybe_transport = udp::makeTransport({mr_}, scheduler_, media_array, 16, tx_bands_spec);
+    ASSERT_THAT(maybe_transport, VariantWith<UniquePtr<IUdpTransport>>(NotNull()));
+    auto transport = cetl::get<UniquePtr<IUdpTransport>>(std::move(maybe_transport));
+    EXPECT_THAT(transport->setLocalNodeId(0x45), Eq(cetl::nullopt));
+
+    auto maybe_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    constexpr auto timeout = 1s;
+
+    const auto         payload = makeIotaArray<6>(b('0'));
+    TransferTxMetadata low_metadata{{0x13, Priority::Optional}, {}};
+    TransferTxMetadata high_metadata{{0x14, Priority::Exceptional}, {}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Emulate that the low priority band socket is busy (f.e. its OS buffer is full of big transfer datagrams).
+        // The high priority transfer should not wait for it, but go immediately through its own band socket.
+        //
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .WillOnce(Return(ITxSocket::SendResult::Success{false /* is_accepted */}));
+        EXPECT_CALL(tx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerAndScheduleNamedCallback("tx1", now() + 100us, std::move(function));
+            }));
+
+        low_metadata.deadline = now() + timeout;
+        EXPECT_THAT(session->send(low_metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 10us, [&](const auto&) {
+        //
+        EXPECT_CALL(tx_socket_mock0, send(_, _, _, _))
+            .WillOnce([&](auto deadline, auto endpoint, auto, auto fragments) {
+                EXPECT_THAT(deadline, high_metadata.deadline);
+                EXPECT_THAT(endpoint.ip_address, 0xEF000007);
+                EXPECT_THAT(fragments, SizeIs(1));
+                EXPECT_THAT(fragments[0], SizeIs(24 + 6 + 4));
+                return ITxSocket::SendResult::Success{true /* is_accepted */};
+            });
+        EXPECT_CALL(tx_socket_mock0, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerAndScheduleNamedCallback("tx0", now() + 5us, std::move(function));
+            }));
+
+        high_metadata.deadline = now() + timeout;
+        EXPECT_THAT(session->send(high_metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 100us, [&](const auto&) {
+        //
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))
+            .WillOnce([&](auto deadline, auto, auto, auto fragments) {
+                EXPECT_THAT(deadline, low_metadata.deadline);
+                EXPECT_THAT(fragments, SizeIs(1));
+                EXPECT_THAT(fragments[0], SizeIs(24 + 6 + 4));
+                return ITxSocket::SendResult::Success{true /* is_accepted */};
+            });
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        session.reset();
+        EXPECT_CALL(tx_socket_mock_, deinit());
+        EXPECT_CALL(tx_socket_mock0, deinit());
+        transport.reset();
+        testing::Mock::VerifyAndClearExpectations(&tx_socket_mock_);
+        testing::Mock::VerifyAndClearExpectations(&tx_socket_mock0);
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 TEST_F(TestUpdTransport, send_payload_to_redundant_fallible_media)
 {
@@ -855,6 +1161,270 @@ TEST_F(TestUpdTransport, no_adhoc_tx_sockets_creation_when_there_is_nothing_to_s
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestUpdTransport, addMedia_removeMedia)
+{
+    StrictMock<MediaMock>    media_mock2{};
+    StrictMock<RxSocketMock> rx_socket_mock2{"RxS2"};
+    EXPECT_CALL(media_mock2, getTxMemoryResource()).WillRepeatedly(ReturnRef(mr_));
+    StrictMock<MediaMock> media_mock3{};
+
+    // Transport has room for 2 media, but only the first one is in use.
+    auto transport = makeTransport({mr_});
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerCallback(std::move(function));
+            }));
+
+        auto maybe_rx_session = transport->makeMessageRxSession({42, 123});
+        ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+        auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+        // The added media should get RX socket for the already existing session.
+        //
+        EXPECT_CALL(media_mock2, makeRxSocket(_))  //
+            .WillOnce(Invoke([&](auto& endpoint) {
+                rx_socket_mock2.setEndpoint(endpoint);
+                return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, rx_socket_mock2);
+            }));
+        EXPECT_CALL(rx_socket_mock2, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerCallback(std::move(function));
+            }));
+        EXPECT_THAT(transport->addMedia(media_mock2), Eq(cetl::nullopt));
+        EXPECT_THAT(rx_socket_mock2.getEndpoint().ip_address, 0xEF00007B);
+
+        EXPECT_THAT(transport->addMedia(media_mock_), Optional(VariantWith<AlreadyExistsError>(_)));
+        EXPECT_THAT(transport->addMedia(media_mock2), Optional(VariantWith<AlreadyExistsError>(_)));
+        EXPECT_THAT(transport->addMedia(media_mock3), Optional(VariantWith<ArgumentError>(_)));
+
+        // Removal releases RX socket of the media, but not of the others.
+        //
+        EXPECT_CALL(rx_socket_mock2, deinit());
+        EXPECT_THAT(transport->removeMedia(media_mock2), Eq(cetl::nullopt));
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock2);
+
+        EXPECT_THAT(transport->removeMedia(media_mock2), Optional(testing::A<libcyphal::ArgumentError>()));
+        EXPECT_THAT(transport->removeMedia(media_mock_), Optional(testing::A<libcyphal::ArgumentError>()));
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        transport.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestUpdTransport, makeFrameMonitorRxSession)
+{
+    using Kind = FrameMonitorRxMetadata::Kind;
+
+    struct Frame
+    {
+        FrameMonitorRxMetadata  metadata;
+        std::vector<cetl::byte> payload;
+    };
+    std::vector<Frame> frames;
+
+    StrictMock<RxSocketMock> monitor_socket_mock{"MonRxS1"};
+
+    auto transport = makeTransport({mr_});
+    EXPECT_THAT(transport->setLocalNodeId(0x13), Eq(cetl::nullopt));
+
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({10, 5, false}),
+                VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({0, UDPARD_SUBJECT_ID_MAX + 1, false}),
+                VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+
+    // Media which doesn't support monitoring.
+    EXPECT_CALL(media_mock_, makeFrameMonitorRxSocket(_)).WillOnce(Return(ArgumentError{}));
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({0, 10, false}),
+                VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+
+    EXPECT_CALL(media_mock_, makeFrameMonitorRxSocket(_))  //
+        .WillOnce(Invoke([&](const FrameMonitorRxParams& params) {
+            EXPECT_THAT(params.subject_id_first, 0x20);
+            EXPECT_THAT(params.subject_id_last, 0x30);
+            EXPECT_TRUE(params.with_services);
+            return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, monitor_socket_mock);
+        }));
+    EXPECT_CALL(monitor_socket_mock, registerCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {              //
+            return scheduler_.registerNamedCallback("rx_monitor", std::move(function));
+        }));
+
+    auto maybe_session = transport->makeFrameMonitorRxSession({0x20, 0x30, true});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IFrameMonitorRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IFrameMonitorRxSession>>(std::move(maybe_session));
+
+    EXPECT_THAT(transport->makeFrameMonitorRxSession({0, 10, false}),
+                VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+
+    session->setOnFrameCallback([&frames](const auto& arg) {
+        //
+        frames.push_back({arg.metadata, {arg.payload.begin(), arg.payload.end()}});
+    });
+
+    const auto receiveFrame = [&](const NodeId src_node_id, const NodeId dst_node_id, const PortId port_id) {
+        EXPECT_CALL(monitor_socket_mock, receive())  //
+            .WillOnce([&, src_node_id, dst_node_id, port_id]() -> IRxSocket::ReceiveResult::Metadata {
+                const bool is_service = dst_node_id != UDPARD_NODE_ID_UNSET;
+
+                // Service frame is the first (but not the last) one of its transfer.
+                auto frame = UdpardFrame(src_node_id, dst_node_id, 0x1D, 2, &mr_, Priority::Slow, !is_service, 0);
+
+                frame.payload()[0] = b('x');
+                frame.payload()[1] = b('y');
+                frame.setPortId(port_id, is_service, true /* is_request */);
+
+                std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+                return {now(), std::move(frame).release(tx_crc)};
+            });
+        scheduler_.scheduleNamedCallback("rx_monitor");
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receiveFrame(0x31, UDPARD_NODE_ID_UNSET, 0x23);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Own frame is not delivered.
+        receiveFrame(0x13, UDPARD_NODE_ID_UNSET, 0x23);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Subject #0x40 is out of the monitored range.
+        receiveFrame(0x31, UDPARD_NODE_ID_UNSET, 0x40);
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Service request to another node (#0x27) is monitored as well.
+        receiveFrame(0x31, 0x27, 0x17B);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        ASSERT_THAT(frames, SizeIs(2));
+
+        const auto& msg = frames[0];
+        EXPECT_THAT(msg.metadata.kind, Kind::Message);
+        EXPECT_THAT(msg.metadata.port_id, 0x23);
+        EXPECT_THAT(msg.metadata.source_node_id, Optional(0x31));
+        EXPECT_THAT(msg.metadata.destination_node_id, Eq(cetl::nullopt));
+        EXPECT_THAT(msg.metadata.rx_meta.base.transfer_id, 0x1D);
+        EXPECT_THAT(msg.metadata.rx_meta.base.priority, Priority::Slow);
+        EXPECT_THAT(msg.metadata.rx_meta.timestamp, TimePoint{1s});
+        EXPECT_THAT(msg.metadata.media_index, 0);
+        EXPECT_TRUE(msg.metadata.is_start_of_transfer);
+        EXPECT_TRUE(msg.metadata.is_end_of_transfer);
+        ASSERT_THAT(msg.payload, SizeIs(2 + 4));  // + transfer CRC
+        EXPECT_THAT(msg.payload[0], b('x'));
+        EXPECT_THAT(msg.payload[1], b('y'));
+
+        const auto& req = frames[1];
+        EXPECT_THAT(req.metadata.kind, Kind::Request);
+        EXPECT_THAT(req.metadata.port_id, 0x17B);
+        EXPECT_THAT(req.metadata.source_node_id, Optional(0x31));
+        EXPECT_THAT(req.metadata.destination_node_id, Optional(0x27));
+        EXPECT_TRUE(req.metadata.is_start_of_transfer);
+        EXPECT_FALSE(req.metadata.is_end_of_transfer);
+        EXPECT_THAT(req.payload, ElementsAre(b('x'), b('y')));
+
+        EXPECT_CALL(monitor_socket_mock, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&monitor_socket_mock);
+        EXPECT_THAT(scheduler_.hasNamedCallback("rx_monitor"), false);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestUpdTransport, makeFrameMonitorRxSession_reassembling)
+{
+    struct Transfer
+    {
+        FrameMonitorRxMetadata  metadata;
+        std::vector<cetl::byte> payload;
+    };
+    std::vector<Transfer> transfers;
+
+    StrictMock<RxSocketMock> monitor_socket_mock{"MonRxS1"};
+
+    auto transport = makeTransport({mr_});
+
+    EXPECT_CALL(media_mock_, makeFrameMonitorRxSocket(_))  //
+        .WillOnce(Invoke([&](const FrameMonitorRxParams&) {
+            return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, monitor_socket_mock);
+        }));
+    EXPECT_CALL(monitor_socket_mock, registerCallback(_))  //
+        .WillOnce(Invoke([&](auto function) {              //
+            return scheduler_.registerNamedCallback("rx_monitor", std::move(function));
+        }));
+
+    auto maybe_session = transport->makeFrameMonitorRxSession({0x20, 0x30, false, 64});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IFrameMonitorRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IFrameMonitorRxSession>>(std::move(maybe_session));
+
+    session->setOnFrameCallback([&transfers](const auto& arg) {
+        //
+        transfers.push_back({arg.metadata, {arg.payload.begin(), arg.payload.end()}});
+    });
+
+    // Two-frame transfer of "abcd" (followed by its CRC-32C in the last frame).
+    //
+    std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+    const auto receiveFrame = [&](const std::uint32_t index, const bool is_last, const char first, const char second) {
+        EXPECT_CALL(monitor_socket_mock, receive())  //
+            .WillOnce([&, index, is_last, first, second]() -> IRxSocket::ReceiveResult::Metadata {
+                auto frame = UdpardFrame(0x31, UDPARD_NODE_ID_UNSET, 0x1D, 2, &mr_, Priority::High, is_last, index);
+
+                frame.payload()[0] = b(static_cast<std::uint8_t>(first));
+                frame.payload()[1] = b(static_cast<std::uint8_t>(second));
+                frame.setPortId(0x23);
+
+                return {now(), std::move(frame).release(tx_crc)};
+            });
+        scheduler_.scheduleNamedCallback("rx_monitor");
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receiveFrame(0, false, 'a', 'b');
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        receiveFrame(1, true, 'c', 'd');
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // The last frame alone (f.e. b/c the first one was lost) is not a valid transfer.
+        receiveFrame(1, true, 'c', 'd');
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        ASSERT_THAT(transfers, SizeIs(1));
+
+        const auto& transfer = transfers[0];
+        EXPECT_THAT(transfer.metadata.port_id, 0x23);
+        EXPECT_THAT(transfer.metadata.source_node_id, Optional(0x31));
+        EXPECT_THAT(transfer.metadata.rx_meta.base.transfer_id, 0x1D);
+        EXPECT_THAT(transfer.metadata.rx_meta.base.priority, Priority::High);
+        EXPECT_THAT(transfer.metadata.rx_meta.timestamp, TimePoint{1s});
+        EXPECT_TRUE(transfer.metadata.is_start_of_transfer);
+        EXPECT_TRUE(transfer.metadata.is_end_of_transfer);
+        EXPECT_THAT(transfer.payload, ElementsAre(b('a'), b('b'), b('c'), b('d')));
+
+        EXPECT_CALL(monitor_socket_mock, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&monitor_socket_mock);
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
@@ -0,0 +1,211 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/transport/udp/delegate.hpp>
+#include <libcyphal/transport/udp/tx_payload_source.hpp>
+#include <libcyphal/transport/udp/tx_stream.hpp>
+#include <libcyphal/types.hpp>
+#include <udpard.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::UniquePtr;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::udp;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+using libcyphal::verification_utilities::makeIotaArray;
+
+using testing::Eq;
+using testing::IsEmpty;
+using testing::IsNull;
+using testing::ElementsAreArray;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class MyTxPayloadSource final : public ITxPayloadSource
+{
+public:
+    explicit MyTxPayloadSource(const cetl::span<const cetl::byte> payload)
+        : payload_{payload}
+    {
+    }
+    ~MyTxPayloadSource()                                       = default;
+    MyTxPayloadSource(const MyTxPayloadSource&)                = delete;
+    MyTxPayloadSource(MyTxPayloadSource&&) noexcept            = delete;
+    MyTxPayloadSource& operator=(const MyTxPayloadSource&)     = delete;
+    MyTxPayloadSource& operator=(MyTxPayloadSource&&) noexcept = delete;
+
+    // MARK: ITxPayloadSource
+
+    std::size_t size() const noexcept override
+    {
+        return payload_.size();
+    }
+
+    std::size_t read(const std::size_t offset, const cetl::span<cetl::byte> destination) override
+    {
+        const auto chunk = payload_.subspan(offset, std::min(destination.size(), payload_.size() - offset));
+        std::copy(chunk.begin(), chunk.end(), destination.begin());
+        return chunk.size();
+    }
+
+private:
+    const cetl::span<const cetl::byte> payload_;
+
+};  // MyTxPayloadSource
+
+class TestUdpTxStream : public testing::Test
+{
+protected:
+    using TxStream      = detail::TxStream;
+    using TxStreamQueue = detail::TxStreamQueue;
+    using Publish       = detail::AnyUdpardTxMetadata::Publish;
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    UniquePtr<TxStream> makeStream(const cetl::span<const cetl::byte> payload,
+                                   const Publish&                     tx_metadata,
+                                   const std::size_t                  media_count = 1)
+    {
+        auto source = libcyphal::makeUniquePtr<ITxPayloadSource, MyTxPayloadSource>(mr_, payload);
+        return libcyphal::makeUniquePtr<TxStream, TxStream>(mr_,  //
+                                                            mr_,
+                                                            std::move(source),
+                                                            tx_metadata,
+                                                            0x45,
+                                                            media_count);
+    }
+
+    UdpardMemoryResource makeUdpardMemoryResource()
+    {
+        return {&mr_,
+                [](void* const user_reference, const std::size_t size, void* const pointer) {
+                    static_cast<TrackingMemoryResource*>(user_reference)->deallocate(pointer, size);
+                },
+                [](void* const user_reference, const std::size_t size) {
+                    return static_cast<TrackingMemoryResource*>(user_reference)->allocate(size);
+                }};
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestUdpTxStream, datagrams_are_the_same_as_udpard_ones)
+{
+    const auto    payload = makeIotaArray<UDPARD_MTU_DEFAULT * 2 + 3>(b('0'));
+    const Publish tx_metadata{1000000, UdpardPriorityFast, 7, 0x13};
+
+    // Reference datagrams - built by the Udpard library itself.
+    //
+    const UdpardNodeID            local_node_id = 0x45;
+    const UdpardTxMemoryResources tx_memory{makeUdpardMemoryResource(), makeUdpardMemoryResource()};
+    UdpardTx                      udpard_tx{};
+    ASSERT_THAT(::udpardTxInit(&udpard_tx, &local_node_id, 16, tx_memory), Eq(0));
+    ASSERT_THAT(::udpardTxPublish(&udpard_tx,
+                                  tx_metadata.deadline_us,
+                                  tx_metadata.priority,
+                                  tx_metadata.subject_id,
+                                  tx_metadata.transfer_id,
+                                  {payload.size(), payload.data()},
+                                  nullptr),
+                Eq(3));
+
+    // The stream should build exactly the same datagrams (header, payload and transfer CRC) one by one.
+    //
+    auto tx_stream = makeStream(payload, tx_metadata);
+    while (UdpardTxItem* const maybe_item = ::udpardTxPeek(&udpard_tx))
+    {
+        UdpardTxItem* const tx_item = ::udpardTxPop(&udpard_tx, maybe_item);
+        EXPECT_THAT(tx_item->destination.ip_address, tx_stream->endpoint().ip_address);
+        EXPECT_THAT(tx_item->destination.udp_port, tx_stream->endpoint().udp_port);
+
+        const cetl::span<const cetl::byte> expected{static_cast<const cetl::byte*>(tx_item->datagram_payload.data),
+                                                    tx_item->datagram_payload.size};
+        EXPECT_THAT(tx_stream->buildNextDatagramFor(0, UDPARD_MTU_DEFAULT), ElementsAreArray(expected));
+        tx_stream->commitFor(0);
+
+        ::udpardTxFree(tx_memory, tx_item);
+    }
+    EXPECT_TRUE(tx_stream->isDone());
+}
+
+TEST_F(TestUdpTxStream, queue_by_priority_then_fifo)
+{
+    const auto payload = makeIotaArray<3>(b('0'));
+
+    auto slow    = makeStream(payload, {1000000, UdpardPrioritySlow, 1, 0}, 2);
+    auto fast1   = makeStream(payload, {1000000, UdpardPriorityFast, 2, 0}, 2);
+    auto nominal = makeStream(payload, {1000000, UdpardPriorityNominal, 3, 0}, 2);
+    auto fast2   = makeStream(payload, {1000000, UdpardPriorityFast, 4, 0}, 2);
+
+    // Each media has its own queue (linked through its own cursor), so streams are queued independently.
+    TxStreamQueue queue0;
+    TxStreamQueue queue1;
+    EXPECT_THAT(queue0.peek(), IsNull());
+    for (TxStream* const tx_stream : {slow.get(), fast1.get(), nominal.get(), fast2.get()})
+    {
+        queue0.push(*tx_stream, 0);
+    }
+    queue1.push(*slow, 1);
+    queue1.push(*fast2, 1);
+
+    // The highest priority goes first, and the oldest one among the same priority.
+    EXPECT_THAT(queue0.peek(), fast1.get());
+    queue0.remove(*fast1, 0);
+    EXPECT_THAT(queue0.peek(), fast2.get());
+
+    // Removal from the middle (or of a missing stream) keeps the rest in order.
+    queue0.remove(*nominal, 0);
+    queue0.remove(*nominal, 0);
+    EXPECT_THAT(queue0.peek(), fast2.get());
+    queue0.remove(*fast2, 0);
+    EXPECT_THAT(queue0.peek(), slow.get());
+
+    // The tail is maintained after removals, so new streams are still appended in order.
+    queue0.push(*nominal, 0);
+    queue0.push(*fast1, 0);
+    EXPECT_THAT(queue0.peek(), fast1.get());
+    queue0.remove(*fast1, 0);
+    EXPECT_THAT(queue0.peek(), nominal.get());
+    queue0.remove(*nominal, 0);
+    queue0.remove(*slow, 0);
+    EXPECT_THAT(queue0.peek(), IsNull());
+
+    // The other media queue is not affected.
+    EXPECT_THAT(queue1.peek(), fast2.get());
+    queue1.remove(*fast2, 1);
+    EXPECT_THAT(queue1.peek(), slow.get());
+    queue1.remove(*slow, 1);
+    EXPECT_THAT(queue1.peek(), IsNull());
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -124,16 +124,18 @@ struct UdpardFrame final
             {
                 inout_tx_crc = transferCrcAddByte(inout_tx_crc, byte);
             }
-            inout_tx_crc ^= InitialTxCrc;
 
+            // Running CRC is kept as is (for the next frames of the same transfer), and only the last frame
+            // gets the final (xor-ed) value of the transfer CRC.
             if (is_last_)
             {
                 const auto tx_crc_span = buffer_span().last<SizeOfTransferCrc>();
+                const auto tx_crc      = inout_tx_crc ^ InitialTxCrc;
 
-                tx_crc_span[0] = static_cast<cetl::byte>(inout_tx_crc);
-                tx_crc_span[1] = static_cast<cetl::byte>(inout_tx_crc >> 8UL);
-                tx_crc_span[2] = static_cast<cetl::byte>(inout_tx_crc >> 16UL);
-                tx_crc_span[3] = static_cast<cetl::byte>(inout_tx_crc >> 24UL);
+                tx_crc_span[0] = static_cast<cetl::byte>(tx_crc);
+                tx_crc_span[1] = static_cast<cetl::byte>(tx_crc >> 8UL);
+                tx_crc_span[2] = static_cast<cetl::byte>(tx_crc >> 16UL);
+                tx_crc_span[3] = static_cast<cetl::byte>(tx_crc >> 24UL);
             }
         }
 